@@ -34,6 +34,8 @@
 #include "StGermain/StGermain.h"
 #include "StGermain/FD/FD.h"
 #include "Snac/Snac.h"
+#include <stddef.h>
+#include <string.h>
 
 #include "bindings.h"
 #include "misc.h"
@@ -42,6 +44,12 @@
 struct PyMethodDef Snac_Context_Python_Methods[] = {
 	{ Snac_Context_Python_copyright__name__,	Snac_Context_Python_copyright,	METH_VARARGS, Snac_Context_Python_copyright__doc__	},
 	{ Snac_Context_Python_New__name__,		Snac_Context_Python_New,	METH_VARARGS, Snac_Context_Python_New__doc__		},
+	{ Snac_Context_Python_NodeCoord__name__,	Snac_Context_Python_NodeCoord,	METH_VARARGS, Snac_Context_Python_NodeCoord__doc__	},
+	{ Snac_Context_Python_Nodes__name__,		Snac_Context_Python_Nodes,	METH_VARARGS, Snac_Context_Python_Nodes__doc__		},
+	{ Snac_Context_Python_Elements__name__,		Snac_Context_Python_Elements,	METH_VARARGS, Snac_Context_Python_Elements__doc__	},
+	{ Snac_Context_Python_NodeFields__name__,	Snac_Context_Python_NodeFields,	METH_VARARGS, Snac_Context_Python_NodeFields__doc__	},
+	{ Snac_Context_Python_ElementFields__name__,	Snac_Context_Python_ElementFields, METH_VARARGS, Snac_Context_Python_ElementFields__doc__ },
+	{ Snac_Context_Python_ExtensionOffset__name__,	Snac_Context_Python_ExtensionOffset, METH_VARARGS, Snac_Context_Python_ExtensionOffset__doc__ },
 	{ 0, 0, 0, 0 }
 };
 
@@ -85,3 +93,204 @@ PyObject* Snac_Context_Python_New( PyObject* self, PyObject* args ) {
 	return PyCObject_FromVoidPtr( Snac_Context_New( 0.0f, 0.0f, sizeof(Snac_Node), sizeof(Snac_Element), communicator, 
 		dictionary ), 0 );
 }
+
+
+/* The buffers below alias the mesh's own arrays: nothing is copied, and they are only valid from Build until the mesh
+   is destroyed or re-allocated. Local items come first, followed by the shadow ones. */
+static PyObject* _Snac_Context_Python_Buffer( void* ptr, SizeT size ) {
+	if( !ptr || !size ) {
+		Py_INCREF( Py_None );
+		return Py_None;
+	}
+	return PyBuffer_FromReadWriteMemory( ptr, (Py_ssize_t)size );
+}
+
+
+/* A field of an item: (byte offset in the item, numpy type character, shape of one item's field, byte strides of that
+   shape). The stride between items is that of the item array. */
+static PyObject* _Snac_Context_Python_Field( SizeT offset, char* type, int count, int* shape, int* strides ) {
+	PyObject*	pyShape = PyTuple_New( count );
+	PyObject*	pyStrides = PyTuple_New( count );
+	int		dim_I;
+	
+	for( dim_I = 0; dim_I < count; dim_I++ ) {
+		PyTuple_SetItem( pyShape, dim_I, PyInt_FromLong( shape[dim_I] ) );
+		PyTuple_SetItem( pyStrides, dim_I, PyInt_FromLong( strides[dim_I] ) );
+	}
+	return Py_BuildValue( "(lsNN)", (long)offset, type, pyShape, pyStrides );
+}
+
+
+/* PyDict_SetItemString takes its own reference to the value, so drop the one handed over by the field. */
+static void _Snac_Context_Python_SetField( PyObject* fields, char* name, PyObject* field ) {
+	PyDict_SetItemString( fields, name, field );
+	Py_DECREF( field );
+}
+
+
+/* "NodeCoord" member */
+char Snac_Context_Python_NodeCoord__doc__[] = "Get (buffer, local count, domain count) of the mesh's node coordinates";
+char Snac_Context_Python_NodeCoord__name__[] = "NodeCoord";
+PyObject* Snac_Context_Python_NodeCoord( PyObject* self, PyObject* args ) {
+	PyObject*	pyContext;
+	Snac_Context*	context;
+	
+	/* Obtain arguements */
+	if( !PyArg_ParseTuple( args, "O:", &pyContext ) ) {
+		return NULL;
+	}
+	context = (Snac_Context*)( PyCObject_AsVoidPtr( pyContext ) );
+	
+	return Py_BuildValue( "(Nii)", 
+		_Snac_Context_Python_Buffer( context->mesh->nodeCoord, context->mesh->nodeDomainCount * sizeof(Coord) ),
+		context->mesh->nodeLocalCount, 
+		context->mesh->nodeDomainCount );
+}
+
+
+/* "Nodes" member */
+char Snac_Context_Python_Nodes__doc__[] = "Get (buffer, local count, domain count, stride) of the mesh's extended nodes";
+char Snac_Context_Python_Nodes__name__[] = "Nodes";
+PyObject* Snac_Context_Python_Nodes( PyObject* self, PyObject* args ) {
+	PyObject*	pyContext;
+	Snac_Context*	context;
+	SizeT		stride;
+	
+	/* Obtain arguements */
+	if( !PyArg_ParseTuple( args, "O:", &pyContext ) ) {
+		return NULL;
+	}
+	context = (Snac_Context*)( PyCObject_AsVoidPtr( pyContext ) );
+	stride = ExtensionManager_GetFinalSize( context->mesh->nodeExtensionMgr );
+	
+	return Py_BuildValue( "(Niil)", 
+		_Snac_Context_Python_Buffer( context->mesh->node, context->mesh->nodeDomainCount * stride ),
+		context->mesh->nodeLocalCount, 
+		context->mesh->nodeDomainCount,
+		(long)stride );
+}
+
+
+/* "Elements" member */
+char Snac_Context_Python_Elements__doc__[] = "Get (buffer, local count, domain count, stride) of the mesh's extended elements";
+char Snac_Context_Python_Elements__name__[] = "Elements";
+PyObject* Snac_Context_Python_Elements( PyObject* self, PyObject* args ) {
+	PyObject*	pyContext;
+	Snac_Context*	context;
+	SizeT		stride;
+	
+	/* Obtain arguements */
+	if( !PyArg_ParseTuple( args, "O:", &pyContext ) ) {
+		return NULL;
+	}
+	context = (Snac_Context*)( PyCObject_AsVoidPtr( pyContext ) );
+	stride = ExtensionManager_GetFinalSize( context->mesh->elementExtensionMgr );
+	
+	return Py_BuildValue( "(Niil)", 
+		_Snac_Context_Python_Buffer( context->mesh->element, context->mesh->elementDomainCount * stride ),
+		context->mesh->elementLocalCount, 
+		context->mesh->elementDomainCount,
+		(long)stride );
+}
+
+
+/* "NodeFields" member */
+char Snac_Context_Python_NodeFields__doc__[] = "Get the layout of the Snac_Node fields, as name: (offset, type, shape, strides)";
+char Snac_Context_Python_NodeFields__name__[] = "NodeFields";
+PyObject* Snac_Context_Python_NodeFields( PyObject* self, PyObject* args ) {
+	PyObject*	fields = PyDict_New();
+	int		vector[1] = { 3 };
+	int		vectorStrides[1] = { sizeof(double) };
+	int		six[1] = { 6 };
+	
+	#define _Snac_Context_Python_NodeField( name, count, shape, strides ) \
+		_Snac_Context_Python_SetField( fields, #name, _Snac_Context_Python_Field( offsetof( Snac_Node, name ), "d", count, shape, strides ) )
+	_Snac_Context_Python_NodeField( velocity, 1, vector, vectorStrides );
+	_Snac_Context_Python_NodeField( force, 1, vector, vectorStrides );
+	_Snac_Context_Python_NodeField( dh, 0, NULL, NULL );
+	_Snac_Context_Python_NodeField( residualFr, 0, NULL, NULL );
+	_Snac_Context_Python_NodeField( residualFt, 0, NULL, NULL );
+	_Snac_Context_Python_NodeField( inertialMass, 0, NULL, NULL );
+	_Snac_Context_Python_NodeField( stressSPR, 1, six, vectorStrides );
+	_Snac_Context_Python_NodeField( strainSPR, 1, six, vectorStrides );
+	_Snac_Context_Python_NodeField( material_ISPR, 0, NULL, NULL );
+	_Snac_Context_Python_NodeField( densitySPR, 0, NULL, NULL );
+	#undef _Snac_Context_Python_NodeField
+	
+	return fields;
+}
+
+
+/* "ElementFields" member */
+char Snac_Context_Python_ElementFields__doc__[] = "Get the layout of the Snac_Element fields, as name: (offset, type, shape, strides)";
+char Snac_Context_Python_ElementFields__name__[] = "ElementFields";
+PyObject* Snac_Context_Python_ElementFields( PyObject* self, PyObject* args ) {
+	PyObject*	fields = PyDict_New();
+	int		tetra[1] = { Tetrahedra_Count };
+	int		tetraStrides[1] = { sizeof(Snac_Element_Tetrahedra) };
+	int		tensor[3] = { Tetrahedra_Count, 3, 3 };
+	int		tensorStrides[3] = { sizeof(Snac_Element_Tetrahedra), 3 * sizeof(double), sizeof(double) };
+	
+	#define _Snac_Context_Python_ElementField( name, type ) \
+		_Snac_Context_Python_SetField( fields, #name, _Snac_Context_Python_Field( offsetof( Snac_Element, name ), type, 0, NULL, NULL ) )
+	#define _Snac_Context_Python_TetraField( name, type, count, shape, strides ) \
+		_Snac_Context_Python_SetField( fields, "tetra_" #name, _Snac_Context_Python_Field( \
+			offsetof( Snac_Element, tetra ) + offsetof( Snac_Element_Tetrahedra, name ), type, count, shape, strides ) )
+	_Snac_Context_Python_ElementField( material_I, "I" );
+	_Snac_Context_Python_ElementField( volume, "d" );
+	_Snac_Context_Python_ElementField( strainRate, "d" );
+	_Snac_Context_Python_ElementField( stress, "d" );
+	_Snac_Context_Python_ElementField( hydroPressure, "d" );
+	_Snac_Context_Python_ElementField( rzbo, "d" );
+	_Snac_Context_Python_ElementField( bottomPressure, "d" );
+	_Snac_Context_Python_ElementField( irheology, "i" );
+	_Snac_Context_Python_TetraField( volume, "d", 1, tetra, tetraStrides );
+	_Snac_Context_Python_TetraField( strainRate, "d", 3, tensor, tensorStrides );
+	_Snac_Context_Python_TetraField( strain, "d", 3, tensor, tensorStrides );
+	_Snac_Context_Python_TetraField( stress, "d", 3, tensor, tensorStrides );
+	_Snac_Context_Python_TetraField( density, "d", 1, tetra, tetraStrides );
+	_Snac_Context_Python_TetraField( avgTemp, "d", 1, tetra, tetraStrides );
+	_Snac_Context_Python_TetraField( material_I, "I", 1, tetra, tetraStrides );
+	#undef _Snac_Context_Python_ElementField
+	#undef _Snac_Context_Python_TetraField
+	
+	return fields;
+}
+
+
+/* "ExtensionOffset" member */
+char Snac_Context_Python_ExtensionOffset__doc__[] = "Get the byte offset of a plugin's \"node\" or \"element\" extension, or -1";
+char Snac_Context_Python_ExtensionOffset__name__[] = "ExtensionOffset";
+PyObject* Snac_Context_Python_ExtensionOffset( PyObject* self, PyObject* args ) {
+	PyObject*		pyContext;
+	Snac_Context*		context;
+	char*			itemType;
+	char*			extensionName;
+	ExtensionManager*	extensionMgr;
+	void*			item;
+	ExtensionInfo_Index	handle;
+	
+	/* Obtain arguements */
+	if( !PyArg_ParseTuple( args, "Oss:", &pyContext, &itemType, &extensionName ) ) {
+		return NULL;
+	}
+	context = (Snac_Context*)( PyCObject_AsVoidPtr( pyContext ) );
+	
+	if( !strcmp( itemType, "node" ) ) {
+		extensionMgr = context->mesh->nodeExtensionMgr;
+		item = context->mesh->node;
+	}
+	else if( !strcmp( itemType, "element" ) ) {
+		extensionMgr = context->mesh->elementExtensionMgr;
+		item = context->mesh->element;
+	}
+	else {
+		return PyInt_FromLong( -1 );
+	}
+	
+	handle = ExtensionManager_GetHandle( extensionMgr, extensionName );
+	if( handle == (unsigned)-1 || !item ) {
+		return PyInt_FromLong( -1 );
+	}
+	return PyInt_FromLong( (long)( (ArithPointer)ExtensionManager_Get( extensionMgr, item, handle ) - (ArithPointer)item ) );
+}
@@ -45,4 +45,28 @@
 	extern char Snac_Context_Python_New__doc__[];
 	PyObject* Snac_Context_Python_New( PyObject* self, PyObject* args );
 
+	extern char Snac_Context_Python_NodeCoord__name__[];
+	extern char Snac_Context_Python_NodeCoord__doc__[];
+	PyObject* Snac_Context_Python_NodeCoord( PyObject* self, PyObject* args );
+
+	extern char Snac_Context_Python_Nodes__name__[];
+	extern char Snac_Context_Python_Nodes__doc__[];
+	PyObject* Snac_Context_Python_Nodes( PyObject* self, PyObject* args );
+
+	extern char Snac_Context_Python_Elements__name__[];
+	extern char Snac_Context_Python_Elements__doc__[];
+	PyObject* Snac_Context_Python_Elements( PyObject* self, PyObject* args );
+
+	extern char Snac_Context_Python_NodeFields__name__[];
+	extern char Snac_Context_Python_NodeFields__doc__[];
+	PyObject* Snac_Context_Python_NodeFields( PyObject* self, PyObject* args );
+
+	extern char Snac_Context_Python_ElementFields__name__[];
+	extern char Snac_Context_Python_ElementFields__doc__[];
+	PyObject* Snac_Context_Python_ElementFields( PyObject* self, PyObject* args );
+
+	extern char Snac_Context_Python_ExtensionOffset__name__[];
+	extern char Snac_Context_Python_ExtensionOffset__doc__[];
+	PyObject* Snac_Context_Python_ExtensionOffset( PyObject* self, PyObject* args );
+
 #endif /* __Snac_Context_Python_bindings_h__ */
@@ -41,6 +41,53 @@ class Context( MeshContext.MeshContext ):
 		MeshContext.MeshContext.__init__( self, bindings.New( dictionary._handle, communicator ) )
 		return
 
+	# Zero-copy numpy views of the mesh. They alias the C arrays, so are valid from Build until the context is
+	# destroyed (or a remesh re-allocates the mesh); get them afresh after each Step rather than holding on to them.
+	# Only the local items are viewed unless shadow=True.
+
+	def nodeCoord( self, shadow=False ):
+		buffer, localCount, domainCount = bindings.NodeCoord( self._handle )
+		return _view( buffer, ( shadow and domainCount or localCount, 3 ), "d", ( 24, 8 ) )
+
+	def nodeField( self, name, shadow=False ):
+		offset, type, shape, strides = bindings.NodeFields()[name]
+		return self._itemView( bindings.Nodes( self._handle ), shadow, offset, type, shape, strides )
+
+	def elementField( self, name, shadow=False ):
+		offset, type, shape, strides = bindings.ElementFields()[name]
+		return self._itemView( bindings.Elements( self._handle ), shadow, offset, type, shape, strides )
+
+	def nodeVelocity( self, shadow=False ):
+		return self.nodeField( "velocity", shadow )
+
+	def nodeForce( self, shadow=False ):
+		return self.nodeField( "force", shadow )
+
+	# A field of a plugin's extension, e.g. nodeExtensionField( "SnacTemperature", 0, "d" ) for the temperature.
+	# "offset" is the field's byte offset within the extension struct; shape and strides are those of one item's field.
+	def nodeExtensionField( self, extension, offset, type, shape=(), strides=(), shadow=False ):
+		base = bindings.ExtensionOffset( self._handle, "node", extension )
+		if base < 0:
+			return None
+		return self._itemView( bindings.Nodes( self._handle ), shadow, base + offset, type, shape, strides )
+
+	def elementExtensionField( self, extension, offset, type, shape=(), strides=(), shadow=False ):
+		base = bindings.ExtensionOffset( self._handle, "element", extension )
+		if base < 0:
+			return None
+		return self._itemView( bindings.Elements( self._handle ), shadow, base + offset, type, shape, strides )
+
+	def _itemView( self, items, shadow, offset, type, shape, strides ):
+		buffer, localCount, domainCount, stride = items
+		return _view( buffer, ( shadow and domainCount or localCount, ) + tuple( shape ), type, 
+			( stride, ) + tuple( strides ), offset )
+
+def _view( buffer, shape, type, strides, offset=0 ):
+	import numpy
+	if buffer is None:
+		return numpy.zeros( ( 0, ) + shape[1:], type )
+	return numpy.ndarray( shape, type, buffer, offset, strides )
+
 # version
 __id__ = "$Id: Context.py 2265 2004-10-28 08:46:52Z SteveQuenette $"
 
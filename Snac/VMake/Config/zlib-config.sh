@@ -0,0 +1,32 @@
+#!/bin/sh
+
+##  Copyright (C) 2005 Victorian Partnership for Advanced Computing (VPAC) Ltd
+##  110 Victoria Street, Melbourne, 3053, Australia.
+##
+##  This library is free software; you can redistribute it and/or
+##  modify it under the terms of the GNU Lesser General Public
+##  License as published by the Free Software Foundation; either
+##  version 2.1 of the License, or (at your option) any later version.
+##
+##  This library is distributed in the hope that it will be useful,
+##  but WITHOUT ANY WARRANTY; without even the implied warranty of
+##  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+##  Lesser General Public License for more details.
+##
+##  You should have received a copy of the GNU Lesser General Public
+##  License along with this library; if not, write to the Free Software
+##  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+parsePackageConfigOptions $@
+
+# Obtain zlib information. zlib is optional; HAVE_ZLIB is only defined when the header is found.
+setValueWithDefault ZLIB_DIR '/usr'
+setValueWithDefault ZLIB_INCDIR '${ZLIB_DIR}/include'
+
+if test -r "${ZLIB_INCDIR}/zlib.h" -a "${NOZLIB}" != "1" ; then
+	setValueWithDefault ZLIB_INCLUDES '-I${ZLIB_INCDIR} -DHAVE_ZLIB'
+	setValueWithDefault ZLIB_LIBDIR '${ZLIB_DIR}/lib'
+	setValueWithDefault ZLIB_LIBS '-L${ZLIB_LIBDIR} -lz'
+
+	setValueWithDefault HAVE_ZLIB '1'
+fi
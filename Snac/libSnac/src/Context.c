@@ -45,11 +45,14 @@
 #include "UpdateElement.h"
 #include "StrainRate.h"
 #include "Stress.h"
+#include "Yield.h"
+#include "Rheology.h"
 #include "Force.h"
 #include "UpdateNode.h"
 #include "Parallel.h"
 #include "Restart.h"
 #include "Context.h"
+#include "Topography.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -426,6 +429,9 @@ void _Snac_Context_Init( Snac_Context* self ) {
 	/* Parallelisation information */
 	self->parallel = Snac_Parallel_New( self->communicator, self->mesh );
 
+	/* Surface processes */
+	self->topography = Snac_Topography_New( self );
+
 	/* Outputs that can be written only for one processor (rank==0). */
 	if( self->rank==0 ) {
 		sprintf( tmpBuf, "%s/sim.%u", self->outputPath, self->rank );
@@ -550,10 +556,10 @@ void _Snac_Context_Init( Snac_Context* self ) {
 		"default",
 		Snac_StrainRate,
 		Snac_Context_Type );
-	EntryPoint_Append(
+	Snac_EntryPoint_AppendRangeHook(
 		Context_GetEntryPoint( self, Snac_EP_Stress ),
 		"default",
-		Snac_Stress,
+		Snac_Stress_Range,
 		Snac_Context_Type );
 	EntryPoint_Append(
 		Context_GetEntryPoint( self, Snac_EP_LoopNodesMomentum ),
@@ -568,28 +574,18 @@ void _Snac_Context_Init( Snac_Context* self ) {
 	EntryPoint_Append(
 		Context_GetEntryPoint( self, Snac_EP_UpdateNodeMomentum ),
 		"default",
-		Snac_UpdateNodeMomentum ,
+		Snac_UpdateNodeMomentum,
 		Snac_Context_Type );
 	EntryPoint_Prepend(
 		Context_GetEntryPoint( self, Snac_EP_UpdateNodeMomentum ),
 		"default",
 		Snac_UpdateNodeMomentum_PreProcess,
 		Snac_Context_Type );
-	/* Keep the order of appeding the following three functions. */
-	EntryPoint_Append(
-		Context_GetEntryPoint( self, Snac_EP_UpdateNodeMomentum ),
-		"Snac_DiffTopo",
-		Snac_UpdateNodeMomentum_DiffTopo,
-		Snac_Context_Type );
+	/* The surface is diffused once all the nodes have moved */
 	EntryPoint_Append(
-		Context_GetEntryPoint( self, Snac_EP_UpdateNodeMomentum ),
-		"Snac_DiffTopo",
-		Snac_UpdateNodeMomentum_UpdateInteriorTopo,
-		Snac_Context_Type );
-	EntryPoint_Append(
-		Context_GetEntryPoint( self, Snac_EP_UpdateNodeMomentum ),
+		Context_GetEntryPoint( self, Snac_EP_LoopNodesMomentum ),
 		"Snac_DiffTopo",
-		Snac_UpdateNodeMomentum_AdjustEdgeTopo,
+		Snac_Topography_Diffuse,
 		Snac_Context_Type );
 	/*CCCCC*/
 	EntryPoint_Append(
@@ -665,6 +661,9 @@ void _Snac_Context_Delete( void* context ) {
 	if( self->parallel ) {
 		Stg_Class_Delete( self->parallel );
 	}
+	if( self->topography ) {
+		Stg_Class_Delete( self->topography );
+	}
 
 	/* Intitial and Boundary condition managers */
 	if( self->velocityBCs ) {
@@ -883,6 +882,7 @@ void getMaterial_Dictionary_Entry_Values( void* _context, Dictionary* materialDi
 		Dictionary_GetDefault( materialDict, "ten_off",Dictionary_Entry_Value_FromDouble( 0.0 ) ) );
 	self->materialProperty[phaseI].putSeeds = Dictionary_Entry_Value_AsBool(
 		Dictionary_GetDefault( materialDict, "putSeeds",Dictionary_Entry_Value_FromBool( False ) ) );
+	Snac_Yield_BuildSoftening( &self->materialProperty[phaseI] );
 
 	/* Viscosity: in reality, materialProperty group should be different !!*/
 	self->materialProperty[phaseI].vis_min = Dictionary_Entry_Value_AsDouble(
@@ -905,6 +905,7 @@ void getMaterial_Dictionary_Entry_Values( void* _context, Dictionary* materialDi
 		Dictionary_GetDefault( materialDict, "srexponent1", Dictionary_Entry_Value_FromDouble( 1.0 ) ) );
 	self->materialProperty[phaseI].srexponent2 = Dictionary_Entry_Value_AsDouble(
 		Dictionary_GetDefault( materialDict, "srexponent2", Dictionary_Entry_Value_FromDouble( 1.0 ) ) );
+	Snac_Rheology_BuildViscosity( &self->materialProperty[phaseI] );
 	/* Thermal properties. */
 	self->materialProperty[phaseI].thermal_conduct = Dictionary_Entry_Value_AsDouble(
 		Dictionary_GetDefault( materialDict, "thermal_conduct", Dictionary_Entry_Value_FromDouble( 2.0 ) ) );
@@ -1101,56 +1102,56 @@ void _Snac_Context_Solve( void* context ) {
 
 void _Snac_Context_CalcStresses( void* context ) {
 	Snac_Context* 		self = (Snac_Context*)context;
-	Element_LocalIndex	element_dI;
 
 	if( self->rank == 0 ) Journal_DPrintf( self->debug, "In: %s\n", __func__ );
 	if( self->rank == 0 ) Journal_Printf( self->verbose, "For each element, calculating strain-rate and then stress\n" );
 
-	/* For each element, calculate strain-rate and then stress */
-	for( element_dI = 0; element_dI < self->mesh->elementLocalCount; element_dI++ ) {
-		KeyCall( self, self->strainRateK, Snac_StrainRate_CallCast* )(
-			KeyHandle( self, self->strainRateK ),
-			self,
-			element_dI );
-		KeyCall( self, self->stressK, Snac_Stress_CallCast* )( KeyHandle( self, self->stressK ), self, element_dI );
-	}
+	/* Strain-rate and stress are element-local, so each is run over all the local elements in one call */
+	Snac_KeyRangeCall( self, self->strainRateK, Snac_StrainRate_RangeCallCast* )(
+		KeyHandle( self, self->strainRateK ),
+		self,
+		0,
+		self->mesh->elementLocalCount );
+	Snac_KeyRangeCall( self, self->stressK, Snac_Stress_RangeCallCast* )(
+		KeyHandle( self, self->stressK ),
+		self,
+		0,
+		self->mesh->elementLocalCount );
 }
 
 
 void _Snac_Context_LoopNodes( void* context ) {
 	Snac_Context* 		self = (Snac_Context*)context;
 	Node_LocalIndex		node_lI;
+	Mass			mass[Snac_Context_NodeBatchSize];
+	Force			balance[Snac_Context_NodeBatchSize];
 
 	if( self->rank == 0 ) Journal_DPrintf( self->debug, "In: %s\n", __func__ );
 	if( self->rank == 0 ) Journal_Printf(
 		self->verbose,
 		"For each node, calculate mass, force, velocity and then coordinates\n" );
 
-	for( node_lI = 0; node_lI < self->mesh->nodeLocalCount; node_lI++ ) {
-		Snac_Node*		node = Snac_Node_At( self, node_lI );
-		Mass			mass;
-		Force			balance;
-		
-		KeyCall( self, self->forceK, Snac_Force_CallCast* )(
+	/* Force hooks get scratch mass and balance per node, hence batches of a fixed size */
+	for( node_lI = 0; node_lI < self->mesh->nodeLocalCount; node_lI += Snac_Context_NodeBatchSize ) {
+		Node_LocalIndex		batchEnd = node_lI + Snac_Context_NodeBatchSize;
+
+		if( batchEnd > self->mesh->nodeLocalCount )
+			batchEnd = self->mesh->nodeLocalCount;
+		Snac_KeyRangeCall( self, self->forceK, Snac_Force_RangeCallCast* )(
 				KeyHandle(self,self->forceK),
 				self,
 				node_lI,
+				batchEnd,
 				self->speedOfSound,
-				&mass,
-				&(node->inertialMass),
-				&(node->force),
-				&balance );
+				mass,
+				balance );
 	}
-	for( node_lI = 0; node_lI < self->mesh->nodeLocalCount; node_lI++ ) {
-		Snac_Node*		node = Snac_Node_At( self, node_lI );
 
-		KeyCall( self, self->updateNodeK, Snac_UpdateNodeMomentum_CallCast* )(
-				KeyHandle(self,self->updateNodeK),
-				self,
-				node_lI,
-				node->inertialMass,
-				node->force );
-	}
+	Snac_KeyRangeCall( self, self->updateNodeK, Snac_UpdateNodeMomentum_RangeCallCast* )(
+			KeyHandle(self,self->updateNodeK),
+			self,
+			0,
+			self->mesh->nodeLocalCount );
 }
 
 void _Snac_Context_LoopElements( void* context ) {
@@ -59,6 +59,9 @@
 	extern const Name Snac_EP_UpdateElementMomentum;
 	extern const Name Snac_EP_RheologyUpdate;
 
+	/* Number of nodes per call of the force entry point's range hooks */
+	#define Snac_Context_NodeBatchSize	256
+
 	/* Snac_Context dt type names */
 	extern const Name Snac_DtType_Constant;
 	extern const Name Snac_DtType_Dynamic;
@@ -126,6 +129,9 @@
 		/* Parallisation information */ \
 		Snac_Parallel*			parallel; \
 		\
+		/* Surface processes */ \
+		Snac_Topography*		topography; \
+		\
 		/* Snac_Context specific entry point keys */ \
 		EntryPoint_Index		calcStressesK; \
 		EntryPoint_Index		strainRateK; \
@@ -43,6 +43,7 @@
 #include "Tetrahedra.h"
 #include "TetrahedraTables.h"
 #include "Material.h"
+#include "Node.h"
 #include "Element.h"
 #include "EntryPoint.h"
 #include "UpdateElement.h"
@@ -54,6 +55,9 @@
 
 /* Textual name of this class */
 const Type Snac_EntryPoint_Type = "Snac_EntryPoint";
+const Type Snac_RangeHook_Type = "Snac_RangeHook";
+
+#define Snac_Hook_IsRange( hook )	( ((Hook*)(hook))->type == Snac_RangeHook_Type )
 
 
 Snac_EntryPoint* Snac_EntryPoint_New( const Name name, unsigned int castType) {
@@ -119,6 +123,7 @@ void _Snac_EntryPoint_Init( Snac_EntryPoint* self ) {
 	/* Snac_EntryPoint info */
 	self->constitutiveRun = _Snac_EntryPoint_Run_Constitutive;
 	self->run = EntryPoint_GetRun( self ); /* run is set before this func is called... hence may have invalid value; set */
+	self->rangeRun = _Snac_EntryPoint_GetRangeRun( self );
 }
 
 
@@ -150,6 +155,53 @@ Func_Ptr _Snac_EntryPoint_GetRun( void* snac_EntryPoint ) {
 }
 
 
+Func_Ptr _Snac_EntryPoint_GetRangeRun( void* snac_EntryPoint ) {
+	Snac_EntryPoint* self = (Snac_EntryPoint*)snac_EntryPoint;
+	
+	switch( self->castType ) {
+		case Snac_StrainRate_CastType:
+		case Snac_Stress_CastType:
+		case Snac_Constitutive_CastType:
+			return _Snac_EntryPoint_RangeRun_Element;
+		
+		case Snac_Force_CastType:
+			return _Snac_EntryPoint_RangeRun_Force;
+		
+		case Snac_UpdateNodeMomentum_CastType:
+			return _Snac_EntryPoint_RangeRun_UpdateNodeMomentum;
+		
+		default:
+			return NULL;
+	}
+}
+
+
+Hook* Snac_RangeHook_New( Name name, Func_Ptr funcPtr, char* addedBy ) {
+	/* A range hook carries nothing more than a Hook; only its type tells the run functions how to call it */
+	return _Hook_New( sizeof(Hook), Snac_RangeHook_Type, _Hook_Delete, _Hook_Print, _Hook_Copy, name, funcPtr, addedBy );
+}
+
+void Snac_EntryPoint_PrependRangeHook( void* entryPoint, Name name, Func_Ptr funcPtr, char* addedBy ) {
+	_EntryPoint_PrependHook( entryPoint, Snac_RangeHook_New( name, funcPtr, addedBy ) );
+}
+
+void Snac_EntryPoint_AppendRangeHook( void* entryPoint, Name name, Func_Ptr funcPtr, char* addedBy ) {
+	_EntryPoint_AppendHook( entryPoint, Snac_RangeHook_New( name, funcPtr, addedBy ) );
+}
+
+void Snac_EntryPoint_InsertRangeHookBefore( void* entryPoint, Name hookToInsertBefore, Name name, Func_Ptr funcPtr, char* addedBy ) {
+	_EntryPoint_InsertHookBefore( entryPoint, hookToInsertBefore, Snac_RangeHook_New( name, funcPtr, addedBy ) );
+}
+
+void Snac_EntryPoint_InsertRangeHookAfter( void* entryPoint, Name hookToInsertAfter, Name name, Func_Ptr funcPtr, char* addedBy ) {
+	_EntryPoint_InsertHookAfter( entryPoint, hookToInsertAfter, Snac_RangeHook_New( name, funcPtr, addedBy ) );
+}
+
+void Snac_EntryPoint_ReplaceRangeHook( void* entryPoint, Name hookToReplace, Name name, Func_Ptr funcPtr, char* addedBy ) {
+	_EntryPoint_ReplaceHook( entryPoint, hookToReplace, Snac_RangeHook_New( name, funcPtr, addedBy ) );
+}
+
+
 void _Snac_EntryPoint_Run_UpdateElementMomentum( 
 		void*					entryPoint, 
 		void*					context, 
@@ -186,8 +238,12 @@ void _Snac_EntryPoint_Run_StrainRate(
 	#endif
 
 	for( hookIndex = 0; hookIndex < self->hooks->count; hookIndex++ ) {
-		(*(Snac_StrainRate_Cast*)((Hook*)self->hooks->data[hookIndex])->funcPtr)
-			( context, element_lI );
+		Hook*		hook = (Hook*)self->hooks->data[hookIndex];
+
+		if( Snac_Hook_IsRange( hook ) )
+			(*(Snac_StrainRate_RangeCast*)hook->funcPtr)( context, element_lI, element_lI + 1 );
+		else
+			(*(Snac_StrainRate_Cast*)hook->funcPtr)( context, element_lI );
 	}
 
 	#ifdef USE_PROFILE
@@ -208,8 +264,12 @@ void _Snac_EntryPoint_Run_Stress(
 	#endif
 
 	for( hookIndex = 0; hookIndex < self->hooks->count; hookIndex++ ) {
-		(*(Snac_Stress_Cast*)((Hook*)self->hooks->data[hookIndex])->funcPtr)
-			( context, element_lI );
+		Hook*		hook = (Hook*)self->hooks->data[hookIndex];
+
+		if( Snac_Hook_IsRange( hook ) )
+			(*(Snac_Stress_RangeCast*)hook->funcPtr)( context, element_lI, element_lI + 1 );
+		else
+			(*(Snac_Stress_Cast*)hook->funcPtr)( context, element_lI );
 	}
 
 	#ifdef USE_PROFILE
@@ -235,8 +295,12 @@ void _Snac_EntryPoint_Run_Force(
 	#endif
 
 	for( hookIndex = 0; hookIndex < self->hooks->count; hookIndex++ ) {
-		(*(Snac_Force_Cast*)((Hook*)self->hooks->data[hookIndex])->funcPtr)
-			( context, node_lI, speedOfSnd, mass, inertialMass, force, balance );
+		Hook*		hook = (Hook*)self->hooks->data[hookIndex];
+
+		if( Snac_Hook_IsRange( hook ) )
+			(*(Snac_Force_RangeCast*)hook->funcPtr)( context, node_lI, node_lI + 1, speedOfSnd, mass, balance );
+		else
+			(*(Snac_Force_Cast*)hook->funcPtr)( context, node_lI, speedOfSnd, mass, inertialMass, force, balance );
 	}
 
 	#ifdef USE_PROFILE
@@ -259,8 +323,12 @@ void _Snac_EntryPoint_Run_UpdateNodeMomentum(
 	#endif
 
 	for( hookIndex = 0; hookIndex < self->hooks->count; hookIndex++ ) {
-		(*(Snac_UpdateNodeMomentum_Cast*)((Hook*)self->hooks->data[hookIndex])->funcPtr)
-			( context, node_lI, inertialMass, force );
+		Hook*		hook = (Hook*)self->hooks->data[hookIndex];
+
+		if( Snac_Hook_IsRange( hook ) )
+			(*(Snac_UpdateNodeMomentum_RangeCast*)hook->funcPtr)( context, node_lI, node_lI + 1 );
+		else
+			(*(Snac_UpdateNodeMomentum_Cast*)hook->funcPtr)( context, node_lI, inertialMass, force );
 	}
 
 	#ifdef USE_PROFILE
@@ -281,8 +349,12 @@ void _Snac_EntryPoint_Run_Constitutive(
 	#endif
 
 	for( hookIndex = 0; hookIndex < self->hooks->count; hookIndex++ ) {
-		(*(Snac_Constitutive_Cast*)((Hook*)self->hooks->data[hookIndex])->funcPtr)
-			( context, element_lI );
+		Hook*		hook = (Hook*)self->hooks->data[hookIndex];
+
+		if( Snac_Hook_IsRange( hook ) )
+			(*(Snac_Constitutive_RangeCast*)hook->funcPtr)( context, element_lI, element_lI + 1 );
+		else
+			(*(Snac_Constitutive_Cast*)hook->funcPtr)( context, element_lI );
 	}
 	
 	#ifdef USE_PROFILE
@@ -295,4 +367,148 @@ void Snac_EntryPoint_ChangeRunConstitutive( void* entryPoint, Snac_Constitutive_
 	
 	self->constitutiveRun = constitutiveRun;
 	self->run = self->constitutiveRun;
+	/* The range hooks are the default run's business; a replaced run is called element by element instead */
+	self->rangeRun = (Func_Ptr)_Snac_EntryPoint_RangeRun_ChangedConstitutive;
+}
+
+
+void _Snac_EntryPoint_RangeRun_Element(
+		void*					entryPoint, 
+		void*					context, 
+		Element_LocalIndex			begin, 
+		Element_LocalIndex			end )
+{
+	Snac_EntryPoint*			self = (Snac_EntryPoint*)entryPoint;
+	Hook_Index				hookIndex;
+	Hook_Index				segmentEnd;
+	Hook_Index				segment_I;
+	Element_LocalIndex			element_lI;
+	
+	#ifdef USE_PROFILE
+		Stg_CallGraph_Push( stgCallGraph, _Snac_EntryPoint_RangeRun_Element, self->name );
+	#endif
+
+	for( hookIndex = 0; hookIndex < self->hooks->count; hookIndex = segmentEnd ) {
+		if( Snac_Hook_IsRange( self->hooks->data[hookIndex] ) ) {
+			(*(Snac_StrainRate_RangeCast*)((Hook*)self->hooks->data[hookIndex])->funcPtr)( context, begin, end );
+			segmentEnd = hookIndex + 1;
+			continue;
+		}
+
+		/* Adapter for per-index hooks */
+		for( segmentEnd = hookIndex + 1; 
+		     segmentEnd < self->hooks->count && !Snac_Hook_IsRange( self->hooks->data[segmentEnd] ); 
+		     segmentEnd++ );
+		for( element_lI = begin; element_lI < end; element_lI++ ) {
+			for( segment_I = hookIndex; segment_I < segmentEnd; segment_I++ ) {
+				(*(Snac_StrainRate_Cast*)((Hook*)self->hooks->data[segment_I])->funcPtr)( context, element_lI );
+			}
+		}
+	}
+
+	#ifdef USE_PROFILE
+		Stg_CallGraph_Pop( stgCallGraph );
+	#endif
+}
+
+void _Snac_EntryPoint_RangeRun_Force(
+		void*					entryPoint, 
+		void*					context, 
+		Node_LocalIndex				begin, 
+		Node_LocalIndex				end, 
+		double					speedOfSnd, 
+		Mass*					mass, 
+		Force*					balance )
+{
+	Snac_EntryPoint*			self = (Snac_EntryPoint*)entryPoint;
+	Hook_Index				hookIndex;
+	Hook_Index				segmentEnd;
+	Hook_Index				segment_I;
+	Node_LocalIndex				node_lI;
+	
+	#ifdef USE_PROFILE
+		Stg_CallGraph_Push( stgCallGraph, _Snac_EntryPoint_RangeRun_Force, self->name );
+	#endif
+
+	for( hookIndex = 0; hookIndex < self->hooks->count; hookIndex = segmentEnd ) {
+		if( Snac_Hook_IsRange( self->hooks->data[hookIndex] ) ) {
+			(*(Snac_Force_RangeCast*)((Hook*)self->hooks->data[hookIndex])->funcPtr)
+				( context, begin, end, speedOfSnd, mass, balance );
+			segmentEnd = hookIndex + 1;
+			continue;
+		}
+
+		/* Adapter for per-index hooks */
+		for( segmentEnd = hookIndex + 1; 
+		     segmentEnd < self->hooks->count && !Snac_Hook_IsRange( self->hooks->data[segmentEnd] ); 
+		     segmentEnd++ );
+		for( node_lI = begin; node_lI < end; node_lI++ ) {
+			Snac_Node*		node = Snac_Node_At( (Snac_Context*)context, node_lI );
+
+			for( segment_I = hookIndex; segment_I < segmentEnd; segment_I++ ) {
+				(*(Snac_Force_Cast*)((Hook*)self->hooks->data[segment_I])->funcPtr)
+					( context, node_lI, speedOfSnd, &mass[node_lI - begin], &node->inertialMass, &node->force, 
+					  &balance[node_lI - begin] );
+			}
+		}
+	}
+
+	#ifdef USE_PROFILE
+		Stg_CallGraph_Pop( stgCallGraph );
+	#endif
+}
+
+void _Snac_EntryPoint_RangeRun_UpdateNodeMomentum(
+		void*					entryPoint, 
+		void*					context, 
+		Node_LocalIndex				begin, 
+		Node_LocalIndex				end )
+{
+	Snac_EntryPoint*			self = (Snac_EntryPoint*)entryPoint;
+	Hook_Index				hookIndex;
+	Hook_Index				segmentEnd;
+	Hook_Index				segment_I;
+	Node_LocalIndex				node_lI;
+	
+	#ifdef USE_PROFILE
+		Stg_CallGraph_Push( stgCallGraph, _Snac_EntryPoint_RangeRun_UpdateNodeMomentum, self->name );
+	#endif
+
+	for( hookIndex = 0; hookIndex < self->hooks->count; hookIndex = segmentEnd ) {
+		if( Snac_Hook_IsRange( self->hooks->data[hookIndex] ) ) {
+			(*(Snac_UpdateNodeMomentum_RangeCast*)((Hook*)self->hooks->data[hookIndex])->funcPtr)( context, begin, end );
+			segmentEnd = hookIndex + 1;
+			continue;
+		}
+
+		/* Adapter for per-index hooks */
+		for( segmentEnd = hookIndex + 1; 
+		     segmentEnd < self->hooks->count && !Snac_Hook_IsRange( self->hooks->data[segmentEnd] ); 
+		     segmentEnd++ );
+		for( node_lI = begin; node_lI < end; node_lI++ ) {
+			Snac_Node*		node = Snac_Node_At( (Snac_Context*)context, node_lI );
+
+			for( segment_I = hookIndex; segment_I < segmentEnd; segment_I++ ) {
+				(*(Snac_UpdateNodeMomentum_Cast*)((Hook*)self->hooks->data[segment_I])->funcPtr)
+					( context, node_lI, node->inertialMass, node->force );
+			}
+		}
+	}
+
+	#ifdef USE_PROFILE
+		Stg_CallGraph_Pop( stgCallGraph );
+	#endif
+}
+
+void _Snac_EntryPoint_RangeRun_ChangedConstitutive(
+		void*					entryPoint, 
+		void*					context, 
+		Element_LocalIndex			begin, 
+		Element_LocalIndex			end )
+{
+	Snac_EntryPoint*			self = (Snac_EntryPoint*)entryPoint;
+	Element_LocalIndex			element_lI;
+
+	for( element_lI = begin; element_lI < end; element_lI++ )
+		self->constitutiveRun( self, context, element_lI );
 }
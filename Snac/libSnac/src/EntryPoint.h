@@ -45,6 +45,20 @@
 	typedef void			(Snac_UpdateNodeMomentum_CallCast)	( void* entryPoint, void* context, Node_LocalIndex node_lI, Mass inertialMass, Force force );
 	typedef void			(Snac_Constitutive_Cast)		( void* context, Element_LocalIndex element_lI );
 	typedef void			(Snac_Constitutive_CallCast)		( void* entryPoint, void* context, Element_LocalIndex element_lI );
+	/* Range (batch) forms of the per-element and per-node casts. A range hook is called once for the indices [begin,end),
+	 * and must give the same result as calling it index by index (i.e. each index only reads and writes its own element or
+	 * node). The force outputs of a Snac_Force range hook are the nodes' own inertialMass and force; mass and balance are
+	 * caller supplied scratch arrays of (end - begin) entries. */
+	typedef void			(Snac_StrainRate_RangeCast)		( void* context, Element_LocalIndex begin, Element_LocalIndex end );
+	typedef void			(Snac_StrainRate_RangeCallCast)		( void* entryPoint, void* context, Element_LocalIndex begin, Element_LocalIndex end );
+	typedef void			(Snac_Stress_RangeCast)			( void* context, Element_LocalIndex begin, Element_LocalIndex end );
+	typedef void			(Snac_Stress_RangeCallCast)		( void* entryPoint, void* context, Element_LocalIndex begin, Element_LocalIndex end );
+	typedef void			(Snac_Constitutive_RangeCast)		( void* context, Element_LocalIndex begin, Element_LocalIndex end );
+	typedef void			(Snac_Constitutive_RangeCallCast)	( void* entryPoint, void* context, Element_LocalIndex begin, Element_LocalIndex end );
+	typedef void			(Snac_Force_RangeCast)			( void* context, Node_LocalIndex begin, Node_LocalIndex end, double speedOfSnd, Mass* mass, Force* balance );
+	typedef void			(Snac_Force_RangeCallCast)		( void* entryPoint, void* context, Node_LocalIndex begin, Node_LocalIndex end, double speedOfSnd, Mass* mass, Force* balance );
+	typedef void			(Snac_UpdateNodeMomentum_RangeCast)	( void* context, Node_LocalIndex begin, Node_LocalIndex end );
+	typedef void			(Snac_UpdateNodeMomentum_RangeCallCast)	( void* entryPoint, void* context, Node_LocalIndex begin, Node_LocalIndex end );
 	#define 			Snac_UpdateElementMomentum_CastType	(ContextEntryPoint_CastType_MAX+1)
 	#define 			Snac_StrainRate_CastType		(Snac_UpdateElementMomentum_CastType+1)
 	#define 			Snac_Stress_CastType			(Snac_StrainRate_CastType+1)
@@ -57,6 +71,13 @@
 	/** Textual name of this class */
 	extern const Type Snac_EntryPoint_Type;
 
+	/** Textual name of the hooks that take an index range (they are otherwise plain Hooks) */
+	extern const Type Snac_RangeHook_Type;
+
+	/** Call the range form of a Snac entry point, as KeyCall does for the per-index form */
+	#define Snac_KeyRangeCall( self, key, cast ) \
+		((cast)(((Snac_EntryPoint*)EntryPoint_Register_At( (self)->entryPoint_Register, key ))->rangeRun))
+
 	/** Snac_EntryPoint info */
 	#define __Snac_EntryPoint \
 		/* General info */ \
@@ -65,7 +86,8 @@
 		/* Virtual info */ \
 		\
 		/* Snac_EntryPoint info */ \
-		Snac_Constitutive_CallCast*		constitutiveRun;
+		Snac_Constitutive_CallCast*		constitutiveRun; \
+		Func_Ptr				rangeRun;
 	struct _Snac_EntryPoint { __Snac_EntryPoint };
 
 	/* Create a new Snac_EntryPoint */
@@ -92,6 +114,19 @@
 	/* Default GetRun implementation */
 	Func_Ptr _Snac_EntryPoint_GetRun( void* snac_EntryPoint );
 
+	/* The range run function for this entry point's cast type (NULL if it has no range form) */
+	Func_Ptr _Snac_EntryPoint_GetRangeRun( void* snac_EntryPoint );
+
+	/* Create a hook that takes an index range instead of a single index */
+	Hook* Snac_RangeHook_New( Name name, Func_Ptr funcPtr, char* addedBy );
+
+	/* Add range hooks to an entry point, as the EntryPoint_* functions do for per-index hooks */
+	void Snac_EntryPoint_PrependRangeHook( void* entryPoint, Name name, Func_Ptr funcPtr, char* addedBy );
+	void Snac_EntryPoint_AppendRangeHook( void* entryPoint, Name name, Func_Ptr funcPtr, char* addedBy );
+	void Snac_EntryPoint_InsertRangeHookBefore( void* entryPoint, Name hookToInsertBefore, Name name, Func_Ptr funcPtr, char* addedBy );
+	void Snac_EntryPoint_InsertRangeHookAfter( void* entryPoint, Name hookToInsertAfter, Name name, Func_Ptr funcPtr, char* addedBy );
+	void Snac_EntryPoint_ReplaceRangeHook( void* entryPoint, Name hookToReplace, Name name, Func_Ptr funcPtr, char* addedBy );
+
 	/* Snac entry point run... for update element */
 	void _Snac_EntryPoint_Run_UpdateElementMomentum( 
 		void*					entryPoint, 
@@ -136,6 +171,36 @@
 		void*					context, 
 		Element_LocalIndex			element_lI );
 
+	/* Snac entry point range runs... range hooks are called once, and each run of consecutive per-index hooks is called index
+	 * by index (so per-index hooks still see each other's results for the same index in the order they were added) */
+	void _Snac_EntryPoint_RangeRun_Element( 
+		void*					entryPoint, 
+		void*					context, 
+		Element_LocalIndex			begin, 
+		Element_LocalIndex			end );
+
+	void _Snac_EntryPoint_RangeRun_Force( 
+		void*					entryPoint, 
+		void*					context, 
+		Node_LocalIndex				begin, 
+		Node_LocalIndex				end, 
+		double					speedOfSnd, 
+		Mass*					mass, 
+		Force*					balance );
+
+	void _Snac_EntryPoint_RangeRun_UpdateNodeMomentum( 
+		void*					entryPoint, 
+		void*					context, 
+		Node_LocalIndex				begin, 
+		Node_LocalIndex				end );
+
+	/* Range run of a constitutive entry point whose run was changed: that run, element by element */
+	void _Snac_EntryPoint_RangeRun_ChangedConstitutive( 
+		void*					entryPoint, 
+		void*					context, 
+		Element_LocalIndex			begin, 
+		Element_LocalIndex			end );
+
 	/* Snac entry point run... for rheology */
 	void Snac_EntryPoint_ChangeRunConststutive( void* entryPoint, Snac_Constitutive_CallCast* constitutiveRun );
 
@@ -76,6 +76,15 @@
 		double*			cohesion;
 		double			ten_off;
 		Bool			putSeeds;
+		/* Softening table built from the segments above by Snac_Yield_BuildSoftening(): slopes per segment,
+		   and the Mohr-Coulomb factors at each segment end, used wherever the angles do not change. */
+		double*			frictionSlope;
+		double*			dilationSlope;
+		double*			cohesionSlope;
+		double*			anphi;
+		double*			sqrtAnphi;
+		double*			anpsi;
+		double*			tanFriction;
 
 		/* Viscous */
 		double          vis_min;
@@ -89,6 +98,13 @@
 		double          srexponent1;
 		double          srexponent2;
 
+		/* The power-law/Arrhenius constants folded once per material: the strain-rate exponent (1/n-1), 1/refsrate, 
+		   H/R and 1/(reftemp+273.15). */
+		double			viscousExponent;
+		double			invRefSrate;
+		double			activationOverR;
+		double			invRefTemp;
+
 /*		double			densityT0K;
 		double			cohesion;
 		double			dissipation;
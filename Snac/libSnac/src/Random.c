@@ -0,0 +1,77 @@
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+**
+** Copyright (C), 2003,
+**	Steve Quenette, 110 Victoria Street, Melbourne, Victoria, 3053, Australia.
+**	Californian Institute of Technology, 1200 East California Boulevard, Pasadena, California, 91125, USA.
+**	University of Texas, 1 University Station, Austin, Texas, 78712, USA.
+**
+** Authors:
+**	Stevan M. Quenette, Senior Software Engineer, VPAC. (steve@vpac.org)
+**	Stevan M. Quenette, Visitor in Geophysics, Caltech.
+**	Luc Lavier, Research Scientist, The University of Texas. (luc@utig.ug.utexas.edu)
+**	Luc Lavier, Research Scientist, Caltech.
+**
+** This program is free software; you can redistribute it and/or modify it
+** under the terms of the GNU General Public License as published by the
+** Free Software Foundation; either version 2, or (at your option) any
+** later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program; if not, write to the Free Software
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+**
+** $Id$
+**
+**~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#include <mpi.h>
+#include <StGermain/StGermain.h>
+#include <StGermain/FD/FD.h>
+
+#include "units.h"
+#include "types.h"
+#include "shortcuts.h"
+#include "Material.h"
+#include "Node.h"
+#include "Mesh.h"
+#include "Tetrahedra.h"
+#include "TetrahedraTables.h"
+#include "Element.h"
+#include "EntryPoint.h"
+#include "Context.h"
+#include "Random.h"
+
+/* The 32 bit finaliser of MurmurHash3: every input bit affects every output bit. */
+#define Snac_Random_Mix( x ) \
+	( (x) ^= (x) >> 16, (x) *= 0x85ebca6bU, (x) &= 0xffffffffU, (x) ^= (x) >> 13, \
+	  (x) *= 0xc2b2ae35U, (x) &= 0xffffffffU, (x) ^= (x) >> 16 )
+
+
+double Snac_Random_Uniform( unsigned int seed, unsigned int stream, Index key ) {
+	unsigned int		x = key;
+	
+	/* Mix the key, then fold in the stream and the seed with another round each. */
+	x ^= seed * 0x9e3779b9U;
+	Snac_Random_Mix( x );
+	x ^= stream * 0x632be5abU + 0x7f4a7c15U;
+	Snac_Random_Mix( x );
+	x ^= seed;
+	Snac_Random_Mix( x );
+	
+	return ( x & 0xffffffffU ) / 4294967296.0;
+}
+
+
+void Snac_Random_ElementUniforms( void* _context, unsigned int seed, unsigned int stream, double* uniforms ) {
+	Snac_Context*		context = (Snac_Context*)_context;
+	Mesh*			mesh = context->mesh;
+	Element_LocalIndex	element_lI;
+	
+	for( element_lI = 0; element_lI < mesh->elementLocalCount; element_lI++ )
+		uniforms[element_lI] = Snac_Random_Uniform( seed, stream, Mesh_ElementMapLocalToGlobal( mesh, element_lI ) );
+}
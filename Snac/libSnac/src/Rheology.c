@@ -0,0 +1,82 @@
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+**
+** Copyright (C), 2003,
+**	Steve Quenette, 110 Victoria Street, Melbourne, Victoria, 3053, Australia.
+**	Californian Institute of Technology, 1200 East California Boulevard, Pasadena, California, 91125, USA.
+**	University of Texas, 1 University Station, Austin, Texas, 78712, USA.
+**
+** Authors:
+**	Stevan M. Quenette, Senior Software Engineer, VPAC. (steve@vpac.org)
+**	Stevan M. Quenette, Visitor in Geophysics, Caltech.
+**	Luc Lavier, Research Scientist, The University of Texas. (luc@utig.ug.utexas.edu)
+**	Luc Lavier, Research Scientist, Caltech.
+**
+** This program is free software; you can redistribute it and/or modify it
+** under the terms of the GNU General Public License as published by the
+** Free Software Foundation; either version 2, or (at your option) any
+** later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program; if not, write to the Free Software
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+**
+** $Id$
+**
+**~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#include <mpi.h>
+#include <StGermain/StGermain.h>
+#include <StGermain/FD/FD.h>
+
+#include "units.h"
+#include "types.h"
+#include "shortcuts.h"
+#include "Material.h"
+#include "Rheology.h"
+#include <math.h>
+
+/* Gas constant, J/mol/K */
+static const double Snac_Rheology_R = 8.31448;
+
+
+void Snac_Rheology_BuildViscosity( Snac_Material* material ) {
+	material->viscousExponent = 1.0 / material->srexponent - 1.0;
+	material->invRefSrate = 1.0 / material->refsrate;
+	material->activationOverR = material->activationE / Snac_Rheology_R;
+	material->invRefTemp = 1.0 / ( material->reftemp + 273.15 );
+}
+
+
+void Snac_Rheology_Viscosity(
+		const Snac_Material*		material,
+		Index				count,
+		const double*			srJ2,
+		const double*			temperature,
+		double*				viscosity )
+{
+	const double		exponent = material->viscousExponent;
+	const double		invRefSrate = material->invRefSrate;
+	const double		activationOverR = material->activationOverR;
+	const double		invRefTemp = material->invRefTemp;
+	const double		refvisc = material->refvisc;
+	Index			lane_I;
+	
+	/* Exponent of the Arrhenius term first, then the power law folded into it; each pass is free of branches so the 
+	   compiler can vectorise it. A Newtonian material (n = 1) needs no log at all. */
+	for( lane_I = 0; lane_I < count; lane_I++ )
+		viscosity[lane_I] = activationOverR * ( 1.0 / ( temperature[lane_I] + 273.15 ) - invRefTemp );
+	if( exponent != 0.0 ) {
+		for( lane_I = 0; lane_I < count; lane_I++ )
+			viscosity[lane_I] += exponent * log( srJ2[lane_I] * invRefSrate );
+	}
+	for( lane_I = 0; lane_I < count; lane_I++ ) {
+		const double	v = refvisc * exp( viscosity[lane_I] );
+		
+		viscosity[lane_I] = v < material->vis_min ? material->vis_min : v > material->vis_max ? material->vis_max : v;
+	}
+}
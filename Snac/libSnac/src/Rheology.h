@@ -0,0 +1,60 @@
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+**
+** Copyright (C), 2003, 
+**	Steve Quenette, 110 Victoria Street, Melbourne, Victoria, 3053, Australia.
+**	Californian Institute of Technology, 1200 East California Boulevard, Pasadena, California, 91125, USA.
+**	University of Texas, 1 University Station, Austin, Texas, 78712, USA.
+**
+** Authors:
+**	Stevan M. Quenette, Senior Software Engineer, VPAC. (steve@vpac.org)
+**	Stevan M. Quenette, Visitor in Geophysics, Caltech.
+**	Luc Lavier, Research Scientist, The University of Texas. (luc@utig.ug.utexas.edu)
+**	Luc Lavier, Research Scientist, Caltech.
+**
+** This program is free software; you can redistribute it and/or modify it
+** under the terms of the GNU General Public License as published by the
+** Free Software Foundation; either version 2, or (at your option) any
+** later version.
+** 
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+** 
+** You should have received a copy of the GNU General Public License
+** along with this program; if not, write to the Free Software
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+**
+*/
+/** \file
+** Role:
+**	Temperature and strain-rate dependent viscosity shared by the viscous rheologies. The material's constants are
+**	folded once when it is read in, and the power law and the Arrhenius term are evaluated together as a single
+**	exp of a log over a batch of tetrahedra, so a batch costs one log and one exp per lane.
+**
+** Assumptions:
+**	Temperatures are in Celsius and the strain rates are the second invariants of the deviatoric strain rate.
+**
+** Comments:
+**	None as yet.
+**
+** $Id$
+**
+**~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#ifndef __Snac_Rheology_h__
+#define __Snac_Rheology_h__
+	
+	/* Fill in the material's folded viscous constants from refvisc, refsrate, reftemp, activationE and srexponent */
+	void Snac_Rheology_BuildViscosity( Snac_Material* material );
+	
+	/* Hall et al. (2004) viscosity of "count" lanes, 
+	   refvisc * (srJ2/refsrate)^(1/n-1) * exp(H/R * (1/(T+273.15) - 1/(reftemp+273.15))), clamped to [vis_min, vis_max] */
+	void Snac_Rheology_Viscosity(
+		const Snac_Material*		material,
+		Index				count,
+		const double*			srJ2,
+		const double*			temperature,
+		double*				viscosity );
+	
+#endif /* __Snac_Rheology_h__ */
@@ -57,9 +57,13 @@
 	#include "Restart.h"
 	#include "StrainRate.h"
 	#include "Stress.h"
+	#include "Yield.h"
+	#include "Rheology.h"
 	#include "Force.h"
 	#include "UpdateNode.h"
+	#include "Topography.h"
 	#include "Context.h"
+	#include "Random.h"
 	#include "SnacSync.h"
 	#include "Init.h"
 	#include "Finalise.h"
@@ -50,24 +50,14 @@
 #define Snac_Constitutive_CallEP( self, element_lI ) \
 	(KeyCall( self, self->constitutiveK, Snac_Constitutive_CallCast* )( KeyHandle( self, self->constitutiveK ), self, element_lI ))
 
-void Snac_Stress( void* context, Element_LocalIndex element_lI ) {
-	Snac_Context*			self = (Snac_Context*)context;
+#define Snac_Constitutive_RangeCallEP( self, begin, end ) \
+	(Snac_KeyRangeCall( self, self->constitutiveK, Snac_Constitutive_RangeCallCast* )( KeyHandle( self, self->constitutiveK ), self, begin, end ))
+
+/* Calculate the strain for each tetrahedra from its strain rate. */
+static void _Snac_Stress_Strain( Snac_Context* self, Element_LocalIndex element_lI ) {
 	Tetrahedra_Index		tetra_I;
 	Snac_Element*			element = Snac_Element_At( self, element_lI );
-	Stress				traceStress[Tetrahedra_Count];
-	Stress				partialStress;
-	Stress				sVolAvg;
-	Stress				sOtherAvg;
-	/* for adjusting density to changed pressure */
-	Material_Index                  material_I = element->material_I;
-	Snac_Material*          material = &self->materialProperty[material_I];
-	Density                 phsDensity = material->phsDensity; // node->density
-	double          alpha = material->alpha;
-	double          beta = material->beta;
-	Stress          pressure = 0.0f;
-	double			elemVolume = ( Tetrahedra_Count > 5 )?(2.0*element->volume):element->volume;
 
-	/* Calculate the strain for each tetrahedra. */
 	for( tetra_I = 0; tetra_I < Tetrahedra_Count; tetra_I++ ) {
 		/* Initialise the strain tensor for this tetrahedra to 0 */
 		memset( element->tetra[tetra_I].strain, 0, sizeof(element->tetra[tetra_I].strain) );
@@ -80,9 +70,24 @@ void Snac_Stress( void* context, Element_LocalIndex element_lI ) {
 		element->tetra[tetra_I].strain[0][2] = element->tetra[tetra_I].strainRate[0][2] * self->dt;
 		element->tetra[tetra_I].strain[1][2] = element->tetra[tetra_I].strainRate[1][2] * self->dt;
 	}
+}
 
-	/* Calculate the stresses for each tetrahedra. */
-	Snac_Constitutive_CallEP( self, element_lI );
+/* Remove the tetrahedra pressure variation and set the element's scalar stress, pressure and the tetrahedra densities. */
+static void _Snac_Stress_Average( Snac_Context* self, Element_LocalIndex element_lI ) {
+	Tetrahedra_Index		tetra_I;
+	Snac_Element*			element = Snac_Element_At( self, element_lI );
+	Stress				traceStress[Tetrahedra_Count];
+	Stress				partialStress;
+	Stress				sVolAvg;
+	Stress				sOtherAvg;
+	/* for adjusting density to changed pressure */
+	Material_Index                  material_I = element->material_I;
+	Snac_Material*          material = &self->materialProperty[material_I];
+	Density                 phsDensity = material->phsDensity; // node->density
+	double          alpha = material->alpha;
+	double          beta = material->beta;
+	Stress          pressure = 0.0f;
+	double			elemVolume = ( Tetrahedra_Count > 5 )?(2.0*element->volume):element->volume;
 
 	partialStress = 0.0f;
 	for( tetra_I = 0; tetra_I < Tetrahedra_Count; tetra_I++ ) {
@@ -170,3 +175,30 @@ void Snac_Stress( void* context, Element_LocalIndex element_lI ) {
 		element->tetra[tetra_I].density = phsDensity * (1.0 - alpha * (element->tetra[tetra_I].avgTemp-material->reftemp) + beta * pressure);
 
 }
+
+
+void Snac_Stress( void* context, Element_LocalIndex element_lI ) {
+	Snac_Context*			self = (Snac_Context*)context;
+
+	_Snac_Stress_Strain( self, element_lI );
+
+	/* Calculate the stresses for each tetrahedra. */
+	Snac_Constitutive_CallEP( self, element_lI );
+
+	_Snac_Stress_Average( self, element_lI );
+}
+
+
+void Snac_Stress_Range( void* context, Element_LocalIndex begin, Element_LocalIndex end ) {
+	Snac_Context*			self = (Snac_Context*)context;
+	Element_LocalIndex		element_lI;
+
+	for( element_lI = begin; element_lI < end; element_lI++ )
+		_Snac_Stress_Strain( self, element_lI );
+
+	/* Calculate the stresses for each tetrahedra of the whole range. */
+	Snac_Constitutive_RangeCallEP( self, begin, end );
+
+	for( element_lI = begin; element_lI < end; element_lI++ )
+		_Snac_Stress_Average( self, element_lI );
+}
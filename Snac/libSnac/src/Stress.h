@@ -44,5 +44,6 @@
 #define __Snac_Stress_h__
 	
 	void Snac_Stress( void* context, Element_LocalIndex element_lI );
+	void Snac_Stress_Range( void* context, Element_LocalIndex begin, Element_LocalIndex end );
 	
 #endif /* __Snac_Stress_h__ */
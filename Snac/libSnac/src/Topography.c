@@ -0,0 +1,484 @@
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+**
+** Copyright (C), 2003,
+**	Steve Quenette, 110 Victoria Street, Melbourne, Victoria, 3053, Australia.
+**	Californian Institute of Technology, 1200 East California Boulevard, Pasadena, California, 91125, USA.
+**	University of Texas, 1 University Station, Austin, Texas, 78712, USA.
+**
+** Authors:
+**	Stevan M. Quenette, Senior Software Engineer, VPAC. (steve@vpac.org)
+**	Stevan M. Quenette, Visitor in Geophysics, Caltech.
+**	Luc Lavier, Research Scientist, The University of Texas. (luc@utig.ug.utexas.edu)
+**	Luc Lavier, Research Scientist, Caltech.
+**
+** This program is free software; you can redistribute it and/or modify it
+** under the terms of the GNU General Public License as published by the
+** Free Software Foundation; either version 2, or (at your option) any
+** later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program; if not, write to the Free Software
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+**
+** $Id$
+**
+**~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#include <mpi.h>
+#include <StGermain/StGermain.h>
+#include <StGermain/FD/FD.h>
+
+#include "units.h"
+#include "types.h"
+#include "shortcuts.h"
+#include "Material.h"
+#include "Tetrahedra.h"
+#include "TetrahedraTables.h"
+#include "Node.h"
+#include "Element.h"
+#include "Context.h"
+#include "UpdateNode.h"
+#include "Topography.h"
+
+#include <math.h>
+#include <string.h>
+
+#define R			6371000.0
+
+/* Textual name of this class */
+const Type Snac_Topography_Type = "Snac_Topography";
+
+
+Snac_Topography* Snac_Topography_New( Snac_Context* context ) {
+	return _Snac_Topography_New( 
+		sizeof(Snac_Topography), 
+		Snac_Topography_Type, 
+		_Snac_Topography_Delete, 
+		Snac_Topography_Print, 
+		NULL, 
+		context );
+}
+
+
+void Snac_Topography_Init( Snac_Topography* self, Snac_Context* context ) {
+	/* General info */
+	self->type = Snac_Topography_Type;
+	self->_sizeOfSelf = sizeof( Snac_Topography );
+	self->_deleteSelf = False;
+
+	/* Virtual info */
+	self->_delete = _Snac_Topography_Delete;
+	self->_print = Snac_Topography_Print;
+	self->_copy = NULL;
+	_Stg_Class_Init( (Stg_Class*)self );
+
+	/* Snac_Topography info */
+	_Snac_Topography_Init( self, context );
+}
+
+
+Snac_Topography* _Snac_Topography_New(
+		SizeT					_sizeOfSelf,
+		Type					type,
+		Stg_Class_DeleteFunction*		_delete,
+		Stg_Class_PrintFunction*		_print,
+		Stg_Class_CopyFunction*			_copy, 
+		Snac_Context*				context )
+{
+	Snac_Topography* self;
+
+	/* Allocate memory */
+	self = (Snac_Topography*)_Stg_Class_New( _sizeOfSelf, type, _delete, _print, _copy );
+
+	/* General info */
+
+	/* Virtual info */
+
+	/* Snac_Topography info */
+	_Snac_Topography_Init( self, context );
+
+	return self;
+}
+
+
+void _Snac_Topography_Init( Snac_Topography* self, Snac_Context* context ) {
+	self->context = context;
+	self->isBuilt = False;
+	self->alongI = False;
+	self->alongK = False;
+	self->sizeI = 0;
+	self->sizeK = 0;
+	self->node = 0;
+	self->x = 0;
+	self->y = 0;
+	self->z = 0;
+	self->dh = 0;
+	self->interiorCount = 0;
+	self->interior = 0;
+	self->edgeCount = 0;
+	self->edge = 0;
+	self->edgeNeighbour = 0;
+	self->gradMaxLocal = 0.0;
+	self->gradMaxGlobal = 0.0;
+	self->gradMaxRequest = MPI_REQUEST_NULL;
+	self->gradMaxPending = False;
+}
+
+
+void _Snac_Topography_Delete( void* topography ) {
+	Snac_Topography*	self = (Snac_Topography*)topography;
+
+	if( self->gradMaxPending ) {
+		MPI_Wait( &self->gradMaxRequest, MPI_STATUS_IGNORE );
+	}
+	if( self->node ) {
+		Memory_Free( self->node );
+		Memory_Free( self->x );
+		Memory_Free( self->y );
+		Memory_Free( self->z );
+		Memory_Free( self->dh );
+	}
+	if( self->interior ) {
+		Memory_Free( self->interior );
+	}
+	if( self->edge ) {
+		Memory_Free( self->edge );
+		Memory_Free( self->edgeNeighbour );
+	}
+
+	/* Stg_Class_Delete parent class */
+	_Stg_Class_Delete( topography );
+}
+
+
+void Snac_Topography_Print( void* topography, Stream* stream ) {
+	Snac_Topography* self = (Snac_Topography*)topography;
+
+	/* General info */
+	Journal_Printf( stream, "Snac_Topography (%p):\n", self );
+
+	/* Virtual info */
+
+	/* Snac_Topography info */
+	Journal_Printf( stream, "\tgrid: %u x %u\n", self->sizeI, self->sizeK );
+	Journal_Printf( stream, "\tinteriorCount: %u\n", self->interiorCount );
+	Journal_Printf( stream, "\tedgeCount: %u\n", self->edgeCount );
+
+	/* Parent class info */
+	_Stg_Class_Print( topography, stream );
+}
+
+
+/* The cell (di, dk) away from "cell", checking the node there is one this processor has */
+static Index _Snac_Topography_Neighbour( Snac_Topography* self, Index cell, int di, int dk ) {
+	Mesh*			mesh = self->context->mesh;
+	const int		i = (int)( cell % self->sizeI ) + di;
+	const int		k = (int)( cell / self->sizeI ) + dk;
+	const Index		neighbour = (Index)( i + k * (int)self->sizeI );
+
+	Journal_Firewall( 
+		i >= 0 && i < (int)self->sizeI && k >= 0 && k < (int)self->sizeK && 
+		self->node[neighbour] < mesh->nodeDomainCount, 
+		self->context->snacError, 
+		"Surface node %u's neighbour is not on this processor: topography diffusion needs a shadow depth of 1!!\n", 
+		self->node[cell] );
+	return neighbour;
+}
+
+
+void Snac_Topography_Build( void* topography ) {
+	Snac_Topography*	self = (Snac_Topography*)topography;
+	Mesh*			mesh = self->context->mesh;
+	HexaMD*			decomp = (HexaMD*)mesh->layout->decomp;
+	const Index		top = decomp->nodeGlobal3DCounts[1] - 1;
+	const Index		noCell = (Index)-1;
+	Node_DomainIndex	node_dI;
+	IJK			ijk;
+	IJK			lo = { (Index)-1, 0, (Index)-1 };
+	IJK			hi = { 0, 0, 0 };
+	Index			cellCount;
+	Index			cell_I;
+
+	self->isBuilt = True;
+	self->alongI = decomp->nodeGlobal3DCounts[0] > 2;
+	self->alongK = decomp->nodeGlobal3DCounts[2] > 2;
+	if( !self->alongI && !self->alongK )
+		return;
+
+	/* The extent of the surface nodes this processor has, shadows included */
+	for( node_dI = 0; node_dI < mesh->nodeDomainCount; node_dI++ ) {
+		RegularMeshUtils_Node_1DTo3D( decomp, Mesh_NodeMapDomainToGlobal( mesh, node_dI ), &ijk[0], &ijk[1], &ijk[2] );
+		if( ijk[1] != top )
+			continue;
+		if( ijk[0] < lo[0] ) lo[0] = ijk[0];
+		if( ijk[0] > hi[0] ) hi[0] = ijk[0];
+		if( ijk[2] < lo[2] ) lo[2] = ijk[2];
+		if( ijk[2] > hi[2] ) hi[2] = ijk[2];
+	}
+	if( lo[0] == (Index)-1 )
+		return;
+
+	self->sizeI = hi[0] - lo[0] + 1;
+	self->sizeK = hi[2] - lo[2] + 1;
+	cellCount = self->sizeI * self->sizeK;
+	self->node = Memory_Alloc_Array( Node_DomainIndex, cellCount, "Snac_Topography->node" );
+	self->x = Memory_Alloc_Array( double, cellCount, "Snac_Topography->x" );
+	self->y = Memory_Alloc_Array( double, cellCount, "Snac_Topography->y" );
+	self->z = Memory_Alloc_Array( double, cellCount, "Snac_Topography->z" );
+	self->dh = Memory_Alloc_Array( double, cellCount, "Snac_Topography->dh" );
+	for( cell_I = 0; cell_I < cellCount; cell_I++ )
+		self->node[cell_I] = mesh->nodeDomainCount;
+	for( node_dI = 0; node_dI < mesh->nodeDomainCount; node_dI++ ) {
+		RegularMeshUtils_Node_1DTo3D( decomp, Mesh_NodeMapDomainToGlobal( mesh, node_dI ), &ijk[0], &ijk[1], &ijk[2] );
+		if( ijk[1] == top )
+			self->node[( ijk[0] - lo[0] ) + ( ijk[2] - lo[2] ) * self->sizeI] = node_dI;
+	}
+
+	/* The local surface nodes away from the global edges are diffused; those on them copy their inner neighbours */
+	self->interior = Memory_Alloc_Array( Index, cellCount, "Snac_Topography->interior" );
+	self->edge = Memory_Alloc_Array( Index, cellCount, "Snac_Topography->edge" );
+	self->edgeNeighbour = Memory_Alloc_Array( Index, 2 * cellCount, "Snac_Topography->edgeNeighbour" );
+	for( cell_I = 0; cell_I < cellCount; cell_I++ ) {
+		const Index	i = lo[0] + cell_I % self->sizeI;
+		const Index	k = lo[2] + cell_I / self->sizeI;
+		const Bool	edgeI = self->alongI && ( i == 0 || i == decomp->nodeGlobal3DCounts[0] - 1 );
+		const Bool	edgeK = self->alongK && ( k == 0 || k == decomp->nodeGlobal3DCounts[2] - 1 );
+
+		if( self->node[cell_I] >= mesh->nodeLocalCount )
+			continue;
+
+		if( !edgeI && !edgeK ) {
+			if( self->alongI ) {
+				_Snac_Topography_Neighbour( self, cell_I, 1, 0 );
+				_Snac_Topography_Neighbour( self, cell_I, -1, 0 );
+			}
+			if( self->alongK ) {
+				_Snac_Topography_Neighbour( self, cell_I, 0, 1 );
+				_Snac_Topography_Neighbour( self, cell_I, 0, -1 );
+			}
+			self->interior[self->interiorCount++] = cell_I;
+		}
+		else {
+			self->edgeNeighbour[2 * self->edgeCount] = !edgeI ? noCell : 
+				_Snac_Topography_Neighbour( self, cell_I, i == 0 ? 1 : -1, 0 );
+			self->edgeNeighbour[2 * self->edgeCount + 1] = !edgeK ? noCell : 
+				_Snac_Topography_Neighbour( self, cell_I, 0, k == 0 ? 1 : -1 );
+			self->edge[self->edgeCount++] = cell_I;
+		}
+	}
+
+	Journal_DPrintf( self->context->snacDebug, "%s: %u x %u surface grid, %u interior and %u edge nodes\n", 
+		__func__, self->sizeI, self->sizeK, self->interiorCount, self->edgeCount );
+}
+
+
+/* Gather the surface coordinates; in spherical (x, y, z) = (colatitude, radius, azimuth) */
+static void _Snac_Topography_Gather( Snac_Topography* self ) {
+	Snac_Context*		context = self->context;
+	Mesh*			mesh = context->mesh;
+	const Index		cellCount = self->sizeI * self->sizeK;
+	Index			cell_I;
+
+	for( cell_I = 0; cell_I < cellCount; cell_I++ ) {
+		Coord*		coord;
+
+		if( self->node[cell_I] >= mesh->nodeDomainCount )
+			continue;
+		coord = Snac_NodeCoord_P( context, self->node[cell_I] );
+		if( context->spherical ) {
+			double		XC[3];
+
+			Cart2Spherical_Coord( coord, XC );
+			self->x[cell_I] = XC[0];
+			self->y[cell_I] = XC[1];
+			self->z[cell_I] = XC[2];
+		}
+		else {
+			self->x[cell_I] = (*coord)[0];
+			self->y[cell_I] = (*coord)[1];
+			self->z[cell_I] = (*coord)[2];
+		}
+	}
+}
+
+
+/* The largest |grad(y)| over the interior nodes, one-sided towards +i and +k (-i and -k in spherical) */
+static double _Snac_Topography_GradMax( Snac_Topography* self ) {
+	const double*		x = self->x;
+	const double*		y = self->y;
+	const double*		z = self->z;
+	const int		di = self->alongI ? 1 : 0;
+	const int		dk = self->alongK ? (int)self->sizeI : 0;
+	double			gradMax = 0.0;
+	Index			interior_I;
+
+	if( self->context->spherical ) {
+		for( interior_I = 0; interior_I < self->interiorCount; interior_I++ ) {
+			const Index	p = self->interior[interior_I];
+			const double	dydx = dk ? ( y[p - dk] - y[p] ) / ( x[p - dk] - x[p] ) : 0.0;
+			const double	dydz = di ? ( y[p - di] - y[p] ) / ( z[p - di] - z[p] ) / sin( x[p] ) : 0.0;
+			const double	grad = sqrt( dydx * dydx + dydz * dydz ) / R;
+
+			if( grad > gradMax )
+				gradMax = grad;
+		}
+	}
+	else {
+		for( interior_I = 0; interior_I < self->interiorCount; interior_I++ ) {
+			const Index	p = self->interior[interior_I];
+			const double	dydx = di ? ( y[p + di] - y[p] ) / ( x[p + di] - x[p] ) : 0.0;
+			const double	dydz = dk ? ( y[p + dk] - y[p] ) / ( z[p + dk] - z[p] ) : 0.0;
+			const double	grad = sqrt( dydx * dydx + dydz * dydz );
+
+			if( grad > gradMax )
+				gradMax = grad;
+		}
+	}
+	return gradMax;
+}
+
+
+/* dh = kappa * dt * laplacian(y) at the interior nodes */
+static void _Snac_Topography_Laplacian( Snac_Topography* self ) {
+	const double*		x = self->x;
+	const double*		y = self->y;
+	const double*		z = self->z;
+	double*			dh = self->dh;
+	const int		di = self->alongI ? 1 : 0;
+	const int		dk = self->alongK ? (int)self->sizeI : 0;
+	const double		factor = self->context->topo_kappa * self->context->dt;
+	Index			interior_I;
+
+	if( self->context->spherical ) {
+		/* Along k (colatitude) from xF = -k to xB = +k, along i (azimuth) from xR = -i to xL = +i */
+		for( interior_I = 0; interior_I < self->interiorCount; interior_I++ ) {
+			const Index	p = self->interior[interior_I];
+			double		d2ydx2 = 0.0;
+			double		d2ydz2 = 0.0;
+
+			if( dk ) {
+				const double	dydx1 = ( y[p - dk] - y[p] ) / ( x[p - dk] - x[p] );
+				const double	dydx2 = ( y[p] - y[p + dk] ) / ( x[p] - x[p + dk] );
+
+				d2ydx2 = ( dydx1 - dydx2 ) / ( 0.5f * ( x[p - dk] - x[p + dk] ) );
+				d2ydx2 += cos( x[p] ) / sin( x[p] ) * dydx1;
+			}
+			if( di ) {
+				const double	dydz1 = ( y[p - di] - y[p] ) / ( z[p - di] - z[p] );
+				const double	dydz2 = ( y[p] - y[p + di] ) / ( z[p] - z[p + di] );
+
+				d2ydz2 = ( dydz1 - dydz2 ) / ( 0.5f * ( z[p - di] - z[p + di] ) ) / ( sin( x[p] ) * sin( x[p] ) );
+			}
+			dh[p] = factor * ( d2ydx2 + d2ydz2 ) / ( R * R );
+		}
+	}
+	else {
+		/* Along i from xL = -i to xR = +i, along k from xB = -k to xF = +k */
+		for( interior_I = 0; interior_I < self->interiorCount; interior_I++ ) {
+			const Index	p = self->interior[interior_I];
+			double		d2ydx2 = 0.0;
+			double		d2ydz2 = 0.0;
+
+			if( di ) {
+				const double	dydx1 = ( y[p + di] - y[p] ) / ( x[p + di] - x[p] );
+				const double	dydx2 = ( y[p] - y[p - di] ) / ( x[p] - x[p - di] );
+
+				d2ydx2 = ( dydx1 - dydx2 ) / ( 0.5f * ( x[p + di] - x[p - di] ) );
+			}
+			if( dk ) {
+				const double	dydz1 = ( y[p + dk] - y[p] ) / ( z[p + dk] - z[p] );
+				const double	dydz2 = ( y[p] - y[p - dk] ) / ( z[p] - z[p - dk] );
+
+				d2ydz2 = ( dydz1 - dydz2 ) / ( 0.5f * ( z[p + dk] - z[p - dk] ) );
+			}
+			dh[p] = factor * ( d2ydx2 + d2ydz2 );
+		}
+	}
+}
+
+
+/* Set the height (radius in spherical) of the node at "cell", keeping its position on the surface */
+static void _Snac_Topography_SetHeight( Snac_Topography* self, Index cell, double height ) {
+	Coord*			coord = Snac_NodeCoord_P( self->context, self->node[cell] );
+
+	if( self->context->spherical ) {
+		(*coord)[0] = height * sin( self->x[cell] ) * cos( self->z[cell] );
+		(*coord)[1] = height * sin( self->x[cell] ) * sin( self->z[cell] );
+		(*coord)[2] = height * cos( self->x[cell] );
+	}
+	else {
+		(*coord)[1] = height;
+	}
+}
+
+
+/* The height (radius in spherical) of the node at "cell" as it is now */
+static double _Snac_Topography_Height( Snac_Topography* self, Index cell ) {
+	Coord*			coord = Snac_NodeCoord_P( self->context, self->node[cell] );
+
+	if( self->context->spherical )
+		return sqrt( (*coord)[0] * (*coord)[0] + (*coord)[1] * (*coord)[1] + (*coord)[2] * (*coord)[2] );
+	return (*coord)[1];
+}
+
+
+void Snac_Topography_Diffuse( void* _context ) {
+	Snac_Context*		context = (Snac_Context*)_context;
+	Snac_Topography*	self = context->topography;
+	const Index		noCell = (Index)-1;
+	Index			interior_I;
+	Index			edge_I;
+
+	if( context->topo_kappa <= 0 || context->timeStep <= 1 )
+		return;
+	if( !self->isBuilt )
+		Snac_Topography_Build( self );
+
+	/* The global maximum gradient started reducing last step; it is the largest seen so far that decides */
+	if( self->gradMaxPending ) {
+		MPI_Wait( &self->gradMaxRequest, MPI_STATUS_IGNORE );
+		self->gradMaxPending = False;
+		if( self->gradMaxGlobal > context->topoGradMax )
+			context->topoGradMax = self->gradMaxGlobal;
+	}
+
+	_Snac_Topography_Gather( self );
+	self->gradMaxLocal = _Snac_Topography_GradMax( self );
+#if MPI_VERSION >= 3
+	MPI_Iallreduce( &self->gradMaxLocal, &self->gradMaxGlobal, 1, MPI_DOUBLE, MPI_MAX, context->communicator, 
+		&self->gradMaxRequest );
+#else
+	MPI_Allreduce( &self->gradMaxLocal, &self->gradMaxGlobal, 1, MPI_DOUBLE, MPI_MAX, context->communicator );
+	self->gradMaxRequest = MPI_REQUEST_NULL;
+#endif
+	self->gradMaxPending = True;
+
+	if( context->topoGradMax < context->topoGradCriterion )
+		return;
+
+	/* Diffuse the interior, all from the same snapshot of the surface, then bring the edges level with it */
+	_Snac_Topography_Laplacian( self );
+	for( interior_I = 0; interior_I < self->interiorCount; interior_I++ ) {
+		const Index	p = self->interior[interior_I];
+
+		Journal_Firewall( (!isinf( self->dh[p] )), context->snacError, "The computation of topo change went wrong!!\n");
+		Snac_Node_At( context, self->node[p] )->dh = self->dh[p];
+		_Snac_Topography_SetHeight( self, p, self->y[p] + self->dh[p] );
+	}
+	for( edge_I = 0; edge_I < self->edgeCount; edge_I++ ) {
+		const Index	n1 = self->edgeNeighbour[2 * edge_I];
+		const Index	n2 = self->edgeNeighbour[2 * edge_I + 1];
+		double		height;
+
+		if( n1 != noCell && n2 != noCell )
+			height = 0.5f * ( _Snac_Topography_Height( self, n1 ) + _Snac_Topography_Height( self, n2 ) );
+		else
+			height = _Snac_Topography_Height( self, n1 != noCell ? n1 : n2 );
+		_Snac_Topography_SetHeight( self, self->edge[edge_I], height );
+	}
+}
@@ -0,0 +1,116 @@
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+**
+** Copyright (C), 2003,
+**	Steve Quenette, 110 Victoria Street, Melbourne, Victoria, 3053, Australia.
+**	Californian Institute of Technology, 1200 East California Boulevard, Pasadena, California, 91125, USA.
+**	University of Texas, 1 University Station, Austin, Texas, 78712, USA.
+**
+** Authors:
+**	Stevan M. Quenette, Senior Software Engineer, VPAC. (steve@vpac.org)
+**	Stevan M. Quenette, Visitor in Geophysics, Caltech.
+**	Luc Lavier, Research Scientist, The University of Texas. (luc@utig.ug.utexas.edu)
+**	Luc Lavier, Research Scientist, Caltech.
+**
+** This program is free software; you can redistribute it and/or modify it
+** under the terms of the GNU General Public License as published by the
+** Free Software Foundation; either version 2, or (at your option) any
+** later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program; if not, write to the Free Software
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+**
+*/
+/** \file
+** Role:
+**	Diffusion of the top surface. The top-surface nodes this processor can see (local and shadow) are laid out once
+**	as a 2D grid over their global (i,k), so each step gathers their coordinates into compact arrays and applies the
+**	gradient and laplacian stencils as sweeps over the local surface nodes, then writes the new heights back.
+**
+** Assumptions:
+**	Regular hex mesh with the surface at the top of J; a shadow depth of at least one. Remeshing moves the nodes but
+**	keeps their numbering, so the grid is built only once.
+**
+** Comments:
+**	The global maximum of the topography gradient is reduced without blocking and is consulted a step later.
+**
+** $Id$
+**
+**~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#ifndef __Snac_Topography_h__
+#define __Snac_Topography_h__
+
+	/* Textual name of this class */
+	extern const Type Snac_Topography_Type;
+
+	/* Snac_Topography info */
+	#define __Snac_Topography \
+		/* General info */ \
+		__Stg_Class \
+		\
+		/* Virtual info */ \
+		\
+		/* Snac_Topography info */ \
+		Snac_Context*			context; \
+		Bool				isBuilt; \
+		Bool				alongI; \
+		Bool				alongK; \
+		Index				sizeI; \
+		Index				sizeK; \
+		Node_DomainIndex*		node;			/* per grid cell, nodeDomainCount if none */ \
+		double*				x;			/* gathered coordinates, spherical: colatitude */ \
+		double*				y;			/* height, spherical: radius */ \
+		double*				z;			/* spherical: azimuth */ \
+		double*				dh; \
+		Index				interiorCount; \
+		Index*				interior;		/* cells of the local nodes diffused */ \
+		Index				edgeCount; \
+		Index*				edge;			/* cells of the local edge nodes, then... */ \
+		Index*				edgeNeighbour;		/* ...the two cells they copy from, or sizeI*sizeK */ \
+		double				gradMaxLocal; \
+		double				gradMaxGlobal; \
+		MPI_Request			gradMaxRequest; \
+		Bool				gradMaxPending;
+
+	struct _Snac_Topography { __Snac_Topography };
+
+
+	/* Create a new Snac_Topography and initialise */
+	Snac_Topography* Snac_Topography_New( Snac_Context* context );
+
+	/* Initialise a Snac_Topography */
+	void Snac_Topography_Init( Snac_Topography* self, Snac_Context* context );
+
+	/* Creation implementation / Virtual constructor */
+	Snac_Topography* _Snac_Topography_New(
+		SizeT					_sizeOfSelf,
+		Type					type,
+		Stg_Class_DeleteFunction*		_delete,
+		Stg_Class_PrintFunction*		_print,
+		Stg_Class_CopyFunction*			_copy, 
+		Snac_Context*				context );
+
+	/* Initialisation implementation */
+	void _Snac_Topography_Init( Snac_Topography* self, Snac_Context* context );
+
+
+	/* Stg_Class_Delete implementation */
+	void _Snac_Topography_Delete( void* topography );
+
+	/* Print implementation */
+	void Snac_Topography_Print( void* topography, Stream* stream );
+
+
+	/* Lay out the surface grid and the stencils; needs the mesh and its node neighbour table built */
+	void Snac_Topography_Build( void* topography );
+
+	/* The "Snac_DiffTopo" hook of the LoopNodesMomentum entry point: diffuse the surface once the nodes have moved */
+	void Snac_Topography_Diffuse( void* context );
+
+#endif /* __Snac_Topography_h__ */
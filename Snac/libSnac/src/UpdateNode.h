@@ -45,9 +45,8 @@
 
 	void Snac_UpdateNodeMomentum( void* context, Node_LocalIndex node_lI, Mass inertialMass, Force force );
 	void Snac_UpdateNodeMomentum_PreProcess( void* context, Node_LocalIndex node_lI, Mass inertialMass, Force force );
-	void Snac_UpdateNodeMomentum_DiffTopo( void* context, Node_LocalIndex node_lI, Mass inertialMass, Force force );
-	void Snac_UpdateNodeMomentum_UpdateInteriorTopo( void* context, Node_LocalIndex node_lI, Mass inertialMass, Force force );
-	void Snac_UpdateNodeMomentum_AdjustEdgeTopo( void* context, Node_LocalIndex node_lI, Mass inertialMass, Force force );
-	void getMaxTopoGrad( void* context, Node_LocalIndex node_lI );
+
+	/* (0, 1, 2) = (colatitude, radius, azimuth) of a cartesian coordinate */
+	void Cart2Spherical_Coord( Coord *X, double CX[] );
 
 #endif /* __Snac_UpdateNode_h__ */
@@ -0,0 +1,255 @@
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+**
+** Copyright (C), 2003,
+**	Steve Quenette, 110 Victoria Street, Melbourne, Victoria, 3053, Australia.
+**	Californian Institute of Technology, 1200 East California Boulevard, Pasadena, California, 91125, USA.
+**	University of Texas, 1 University Station, Austin, Texas, 78712, USA.
+**
+** Authors:
+**	Stevan M. Quenette, Senior Software Engineer, VPAC. (steve@vpac.org)
+**	Stevan M. Quenette, Visitor in Geophysics, Caltech.
+**	Luc Lavier, Research Scientist, The University of Texas. (luc@utig.ug.utexas.edu)
+**	Luc Lavier, Research Scientist, Caltech.
+**
+** This program is free software; you can redistribute it and/or modify it
+** under the terms of the GNU General Public License as published by the
+** Free Software Foundation; either version 2, or (at your option) any
+** later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program; if not, write to the Free Software
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+**
+** $Id$
+**
+**~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#include <mpi.h>
+#include <StGermain/StGermain.h>
+#include <StGermain/FD/FD.h>
+
+#include "units.h"
+#include "types.h"
+#include "shortcuts.h"
+#include "Material.h"
+#include "Node.h"
+#include "Tetrahedra.h"
+#include "TetrahedraTables.h"
+#include "Element.h"
+#include "EntryPoint.h"
+#include "Context.h"
+#include "Yield.h"
+#include <math.h>
+#include <string.h>
+#include <assert.h>
+
+#ifndef PI
+#ifndef M_PIl
+#ifndef M_PI
+#define PI 4.0*atan(1.0)
+#else
+#define PI M_PI
+#endif
+#else
+#define PI M_PIl
+#endif
+#endif
+
+
+void Snac_Yield_BuildSoftening( Snac_Material* material ) {
+	const double		degrad = PI / 180.0f;
+	const unsigned int	nsegments = material->nsegments;
+	unsigned int		i;
+
+	material->frictionSlope = (double*)malloc( sizeof(double) * nsegments );
+	material->dilationSlope = (double*)malloc( sizeof(double) * nsegments );
+	material->cohesionSlope = (double*)malloc( sizeof(double) * nsegments );
+	material->anphi = (double*)malloc( sizeof(double) * (nsegments+1) );
+	material->sqrtAnphi = (double*)malloc( sizeof(double) * (nsegments+1) );
+	material->anpsi = (double*)malloc( sizeof(double) * (nsegments+1) );
+	material->tanFriction = (double*)malloc( sizeof(double) * (nsegments+1) );
+
+	for( i = 0; i < nsegments; i++ ) {
+		const double pl1 = material->plstrain[i];
+		const double pl2 = material->plstrain[i+1];
+
+		material->frictionSlope[i] = (material->frictionAngle[i+1] - material->frictionAngle[i]) / (pl2 - pl1);
+		material->dilationSlope[i] = (material->dilationAngle[i+1] - material->dilationAngle[i]) / (pl2 - pl1);
+		material->cohesionSlope[i] = (material->cohesion[i+1] - material->cohesion[i]) / (pl2 - pl1);
+	}
+	for( i = 0; i < nsegments + 1; i++ ) {
+		const double sphi = sin( material->frictionAngle[i] * degrad );
+		const double spsi = sin( material->dilationAngle[i] * degrad );
+
+		material->anphi[i] = (1.0f + sphi) / (1.0f - sphi);
+		material->sqrtAnphi[i] = sqrt( material->anphi[i] );
+		material->anpsi[i] = (1.0f + spsi) / (1.0f - spsi);
+		material->tanFriction[i] = tan( material->frictionAngle[i] * degrad );
+	}
+}
+
+
+void Snac_YieldBatch_Init( Snac_YieldBatch* batch, double cohesion, double frictionAngle, double dilationAngle ) {
+	batch->count = 0;
+	batch->cohesion = cohesion;
+	batch->frictionAngle = frictionAngle;
+	batch->dilationAngle = dilationAngle;
+}
+
+
+void Snac_Yield_MohrCoulomb(
+		void*				_context,
+		Element_LocalIndex		element_lI,
+		const Snac_Material*		material,
+		Snac_YieldBatch*		batch,
+		Strain*				plasticStrain,
+		Bool				hardening )
+{
+	Snac_Context*			context = (Snac_Context*)_context;
+	const double			degrad = PI / 180.0f;
+	const double			a1 = material->lambda + 2.0f * material->mu;
+	const double			a2 = material->lambda;
+	double				cohesion[Tetrahedra_Count];
+	double				slope[Tetrahedra_Count];
+	double				cutoff[Tetrahedra_Count];
+	double				anphi[Tetrahedra_Count];
+	double				sqrtAnphi[Tetrahedra_Count];
+	double				anpsi[Tetrahedra_Count];
+	double				hardeningSlope = 0.0f;
+	double				tension_cutoff = 0.0;
+	Index				lane_I;
+
+	Journal_Firewall( material->yieldcriterion == mohrcoulomb, context->snacError,
+		"In %s: \"mohrcoulomb\" is the only available yield criterion.\n", __func__ );
+
+	/* Softened properties, lane by lane. The segment search runs top down so that, as before, the last
+	   segment containing the plastic strain wins; the trigonometric factors come from the table whenever
+	   the angle is constant over that segment. */
+	for( lane_I = 0; lane_I < batch->count; lane_I++ ) {
+		const Strain	strain = plasticStrain[lane_I];
+		int		friction_I = -1;
+		int		dilation_I = -1;
+		unsigned int	seg_I;
+
+		for( seg_I = material->nsegments; seg_I > 0; seg_I-- ) {
+			const double pl1 = material->plstrain[seg_I-1];
+			const double pl2 = material->plstrain[seg_I];
+
+			if( strain >= pl1 && strain <= pl2 ) {
+				const unsigned int i = seg_I - 1;
+
+				batch->frictionAngle = material->frictionAngle[i] + material->frictionSlope[i] * (strain - pl1);
+				batch->dilationAngle = material->dilationAngle[i] + material->dilationSlope[i] * (strain - pl1);
+				batch->cohesion = material->cohesion[i] + material->cohesionSlope[i] * (strain - pl1);
+				hardeningSlope = material->cohesionSlope[i];
+				if( material->frictionSlope[i] == 0.0 ) friction_I = i;
+				if( material->dilationSlope[i] == 0.0 ) dilation_I = i;
+				break;
+			}
+		}
+
+		if( batch->frictionAngle < 0.0f ) {
+			if( strain < 0.0 ) {
+				plasticStrain[lane_I] = 0.0;
+				fprintf(stderr,"Warning: negative plastic strain. Setting to zero, but check if remesher is on and this happended for an external tet. rank:%d elem:%d tet:%d plasticStrain=%e frictionAngle=%e\n",context->rank,element_lI,lane_I,plasticStrain[lane_I],batch->frictionAngle);
+				batch->frictionAngle = material->frictionAngle[0];
+				batch->dilationAngle = material->dilationAngle[0];
+				batch->cohesion = material->cohesion[0];
+				friction_I = 0;
+				dilation_I = 0;
+			}
+			else {
+				/* frictionAngle < 0.0 violates second law of thermodynamics */
+				fprintf(stderr,"Error due to an unknown reason: rank:%d elem:%d tet:%d plasticStrain=%e frictionAngle=%e\n",context->rank,element_lI,lane_I,strain,batch->frictionAngle);
+				assert(0);
+			}
+		}
+		else {
+			tension_cutoff = material->ten_off;
+			/* tension_cutoff is 0 by default. If not set by a user, it is set here.*/
+			if( batch->frictionAngle > 0.0 && tension_cutoff == 0.0 ) {
+				tension_cutoff = batch->cohesion /
+					(friction_I >= 0 ? material->tanFriction[friction_I] : tan( batch->frictionAngle * degrad ));
+			}
+		}
+
+		if( friction_I >= 0 ) {
+			anphi[lane_I] = material->anphi[friction_I];
+			sqrtAnphi[lane_I] = material->sqrtAnphi[friction_I];
+		}
+		else {
+			const double sphi = sin( batch->frictionAngle * degrad );
+
+			anphi[lane_I] = (1.0f + sphi) / (1.0f - sphi);
+			sqrtAnphi[lane_I] = sqrt( anphi[lane_I] );
+		}
+		if( dilation_I >= 0 ) {
+			anpsi[lane_I] = material->anpsi[dilation_I];
+		}
+		else {
+			const double spsi = sin( batch->dilationAngle * degrad );
+
+			anpsi[lane_I] = (1.0f + spsi) / (1.0f - spsi);
+		}
+		cohesion[lane_I] = batch->cohesion;
+		slope[lane_I] = hardeningSlope;
+		cutoff[lane_I] = tension_cutoff;
+	}
+
+	/* Composite yield test and return map for all lanes. Both the shear and the tensile returns are
+	   evaluated and the applicable one is selected, so this loop carries no branches. */
+	for( lane_I = 0; lane_I < batch->count; lane_I++ ) {
+		const double	s0 = batch->s[0][lane_I];
+		const double	s1 = batch->s[1][lane_I];
+		const double	s2 = batch->s[2][lane_I];
+		const double	fs = s0 - s2 * anphi[lane_I] + 2 * cohesion[lane_I] * sqrtAnphi[lane_I];
+		const double	ft = s2 - cutoff[lane_I];
+		const double	aP = sqrt( 1.0f + anphi[lane_I] * anphi[lane_I] ) + anphi[lane_I];
+		const double	sP = cutoff[lane_I] * anphi[lane_I] - 2 * cohesion[lane_I] * sqrtAnphi[lane_I];
+		const double	h = s2 - cutoff[lane_I] + aP * ( s0 - sP );
+		const double	denominator = a1 - a2 * anpsi[lane_I] + a1 * anphi[lane_I] * anpsi[lane_I] - a2 * anphi[lane_I];
+		const Bool	yield = ( fs < 0.0f || ft > 0.0f );
+		const Bool	shear = ( h < 0.0f );
+		const double	alam = shear ?
+					fs / ( hardening ? denominator + 2.0*sqrtAnphi[lane_I]*slope[lane_I] : denominator ) :
+					ft / a1;
+		const double	d0 = shear ? alam * ( a1 - a2 * anpsi[lane_I] ) : alam * a2;
+		const double	d1 = shear ? alam * a2 * ( 1.0f - anpsi[lane_I] ) : alam * a2;
+		const double	d2 = shear ? alam * ( a2 - a1 * anpsi[lane_I] ) : alam * a1;
+		const double	dep1 = shear ? alam : 0.0f;
+		const double	dep2 = 0.0f;
+		const double	dep3 = shear ? -alam * anpsi[lane_I] : alam;
+		const double	depm = ( dep1 + dep2 + dep3 ) / 3.0f;
+		/* Second invariant of accumulated plastic increment  */
+		const double	dPlasticStrain = sqrt( 0.5f * ((dep1-depm) * (dep1-depm) + (dep2-depm) * (dep2-depm) + (dep3-depm) * (dep3-depm) + depm*depm) );
+
+		batch->s[0][lane_I] = yield ? s0 - d0 : s0;
+		batch->s[1][lane_I] = yield ? s1 - d1 : s1;
+		batch->s[2][lane_I] = yield ? s2 - d2 : s2;
+		plasticStrain[lane_I] = yield ? plasticStrain[lane_I] + dPlasticStrain : plasticStrain[lane_I];
+		batch->yielded[lane_I] = yield;
+	}
+
+	/* Stress projection back to euclidean coordinates, for the lanes that yielded */
+	for( lane_I = 0; lane_I < batch->count; lane_I++ ) {
+		StressTensor*	stress = batch->stress[lane_I];
+		unsigned int	k, m, n;
+
+		if( !batch->yielded[lane_I] )
+			continue;
+
+		memset( stress, 0, sizeof((*stress)) );
+		for( m = 0; m < 3; m++ ) {
+			for( n = m; n < 3; n++ ) {
+				for( k = 0; k < 3; k++ ) {
+					(*stress)[m][n] += batch->cn[lane_I][m][k] * batch->cn[lane_I][n][k] * batch->s[k][lane_I];
+				}
+			}
+		}
+	}
+}
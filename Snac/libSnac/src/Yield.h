@@ -0,0 +1,80 @@
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+**
+** Copyright (C), 2003, 
+**	Steve Quenette, 110 Victoria Street, Melbourne, Victoria, 3053, Australia.
+**	Californian Institute of Technology, 1200 East California Boulevard, Pasadena, California, 91125, USA.
+**	University of Texas, 1 University Station, Austin, Texas, 78712, USA.
+**
+** Authors:
+**	Stevan M. Quenette, Senior Software Engineer, VPAC. (steve@vpac.org)
+**	Stevan M. Quenette, Visitor in Geophysics, Caltech.
+**	Luc Lavier, Research Scientist, The University of Texas. (luc@utig.ug.utexas.edu)
+**	Luc Lavier, Research Scientist, Caltech.
+**
+** This program is free software; you can redistribute it and/or modify it
+** under the terms of the GNU General Public License as published by the
+** Free Software Foundation; either version 2, or (at your option) any
+** later version.
+** 
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+** 
+** You should have received a copy of the GNU General Public License
+** along with this program; if not, write to the Free Software
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+**
+*/
+/** \file
+** Role:
+**	Mohr-Coulomb return mapping shared by the plastic rheologies. The tetrahedra of an element are
+**	treated as one batch: the softened properties are looked up lane by lane from the material's
+**	precomputed softening table, then the yield test and return map run over all lanes with the
+**	shear/tensile branches resolved by select rather than by jumping.
+**
+** Assumptions:
+**	The caller has placed each tetrahedra's trial stress in principal axes (s, cn) before calling.
+**
+** Comments:
+**	None as yet.
+**
+** $Id$
+**
+**~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#ifndef __Snac_Yield_h__
+#define __Snac_Yield_h__
+	
+	/* A batch of tetrahedra in principal axes. "stress" is rewritten in global axes for the lanes that yield. */
+	struct _Snac_YieldBatch {
+		Index				count;
+		StressTensor*			stress[Tetrahedra_Count];
+		double				s[3][Tetrahedra_Count];
+		double				cn[Tetrahedra_Count][3][3];
+		Bool				yielded[Tetrahedra_Count];
+		
+		/* Properties used by a lane whose plastic strain lies outside every softening segment; they carry over
+		   from the previous lane, as the per-tetrahedra loops always did. */
+		double				cohesion;
+		double				frictionAngle;
+		double				dilationAngle;
+	};
+	
+	/* Fill in the material's softening table (slopes and Mohr-Coulomb factors) from its segments */
+	void Snac_Yield_BuildSoftening( Snac_Material* material );
+	
+	/* Start a batch, with the properties a lane falls back on before any lane has found its segment */
+	void Snac_YieldBatch_Init( Snac_YieldBatch* batch, double cohesion, double frictionAngle, double dilationAngle );
+	
+	/* Apply the Mohr-Coulomb criterion to every lane of the batch, updating "plasticStrain" (one entry per lane).
+	   "hardening" adds the cohesion slope to the shear return, as the viscoplastic rheology does. */
+	void Snac_Yield_MohrCoulomb(
+		void*				context,
+		Element_LocalIndex		element_lI,
+		const Snac_Material*		material,
+		Snac_YieldBatch*		batch,
+		Strain*				plasticStrain,
+		Bool				hardening );
+	
+#endif /* __Snac_Yield_h__ */
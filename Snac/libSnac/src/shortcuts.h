@@ -57,6 +57,9 @@
 	#define Snac_Element_Neighbour_P( self, element, index )	((Snac_Element*)Element_Neighbour_P( self, element, index ))
 	#define Snac_Element_Node_P( self, element, index )		((Snac_Node*)Element_Node_P( self, element, index ))
 	
+	#define Snac_Node_ExtensionView( self, handle )			ExtensionManager_GetView( (self)->mesh->nodeExtensionMgr, (self)->mesh->node, (handle) )
+	#define Snac_Element_ExtensionView( self, handle )		ExtensionManager_GetView( (self)->mesh->elementExtensionMgr, (self)->mesh->element, (handle) )
+	
 	#define Snac_NodeCoord_P( self, node_I )			(&(self)->mesh->nodeCoord[node_I])
 	#define Snac_Element_NodeCoord(self, element, index)		(self)->mesh->nodeCoord[(self)->mesh->elementNodeTbl[element][index]]
 	
@@ -69,6 +69,7 @@
 	
 	/* Context types/classes */
 	typedef struct _Snac_Material			Snac_Material;
+	typedef struct _Snac_YieldBatch			Snac_YieldBatch;
 	typedef struct _Snac_Node			Snac_Node;
 	typedef struct _Snac_Element_Tetrahedra_Surface	Snac_Element_Tetrahedra_Surface;
 	typedef struct _Snac_Element_Tetrahedra		Snac_Element_Tetrahedra;
@@ -76,6 +77,7 @@
 	typedef struct _Snac_Particle			Snac_Particle;
 	typedef struct _Snac_EntryPoint			Snac_EntryPoint;
 	typedef struct _Snac_Parallel			Snac_Parallel;
+	typedef struct _Snac_Topography			Snac_Topography;
 	typedef struct _Snac_Context			Snac_Context;
 	typedef struct _SnacSync			SnacSync;
 
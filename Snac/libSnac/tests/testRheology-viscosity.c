@@ -0,0 +1,144 @@
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+**
+** Copyright (C), 2003, 
+**	Steve Quenette, 110 Victoria Street, Melbourne, Victoria, 3053, Australia.
+**	Californian Institute of Technology, 1200 East California Boulevard, Pasadena, California, 91125, USA.
+**	University of Texas, 1 University Station, Austin, Texas, 78712, USA.
+**
+** Authors:
+**	Stevan M. Quenette, Senior Software Engineer, VPAC. (steve@vpac.org)
+**	Stevan M. Quenette, Visitor in Geophysics, Caltech.
+**	Luc Lavier, Research Scientist, The University of Texas. (luc@utig.ug.utexas.edu)
+**	Luc Lavier, Research Scientist, Caltech.
+**
+** This program is free software; you can redistribute it and/or modify it
+** under the terms of the GNU General Public License as published by the
+** Free Software Foundation; either version 2, or (at your option) any
+** later version.
+** 
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+** 
+** You should have received a copy of the GNU General Public License
+** along with this program; if not, write to the Free Software
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+**
+** Role:
+**	Tests Snac_Rheology_Viscosity against the power-law/Arrhenius viscosity as the rheologies used to evaluate it,
+**	refvisc * pow(srJ2/refsrate, 1/n-1) * exp(H/R * (1/(T+273.15) - 1/(reftemp+273.15))), over a range of strain rates
+**	and temperatures. testMaxwell-constitutive-4-4-4 times the SnacMaxwell hook that uses it against the code it replaced.
+**
+** $Id$
+**
+**~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#include <mpi.h>
+#include <StGermain/StGermain.h>
+#include <StGermain/FD/FD.h>
+#include "Snac/Snac.h"
+
+#include "stdio.h"
+#include "stdlib.h"
+#include "string.h"
+#include "math.h"
+
+#define SrateCount	41
+#define TempCount	33
+#define SampleCount	( SrateCount * TempCount )
+#define TOL		1.0e-12
+
+struct _Node {
+	struct { __Snac_Node };
+};
+
+struct _Element {
+	struct { __Snac_Element };
+};
+
+/* The viscosity as the Maxwell and viscoplastic rheologies computed it per tetrahedra */
+static double referenceViscosity( const Snac_Material* material, double srJ2, double avgTemp ) {
+	const double	R = 8.31448;
+	double		viscosity;
+
+	viscosity = material->refvisc * pow( ( srJ2 / material->refsrate ), ( 1. / material->srexponent - 1. ) )
+		* exp( material->activationE / R * ( 1. / ( avgTemp + 273.15 ) - 1. / ( material->reftemp + 273.15 ) ) );
+	if( viscosity < material->vis_min ) viscosity = material->vis_min;
+	if( viscosity > material->vis_max ) viscosity = material->vis_max;
+	return viscosity;
+}
+
+int main( int argc, char* argv[] ) {
+	MPI_Comm		CommWorld;
+	int			rank;
+	int			numProcessors;
+	int			procToWatch;
+	Snac_Material		material;
+	double			srJ2[SampleCount];
+	double			temperature[SampleCount];
+	double			viscosity[SampleCount];
+	double			reference[SampleCount];
+	/* n, H, refvisc, vis_min, vis_max: Newtonian, dislocation creep, and the latter clamped as the defaults do */
+	const double		cases[][5] = {
+		{ 1.0, 0.0, 1.0e21, 0.0, HUGE_VAL },
+		{ 1.0, 120.0e3, 1.0e21, 0.0, HUGE_VAL },
+		{ 3.0, 276.0e3, 1.0e24, 0.0, HUGE_VAL },
+		{ 3.5, 535.0e3, 1.0e22, 0.0, HUGE_VAL },
+		{ 3.0, 276.0e3, 1.0e24, 1.0e18, 3.0e27 } };
+	const Index		caseCount = sizeof(cases) / sizeof(cases[0]);
+	Index			case_I;
+	Index			sample_I;
+
+	/* Initialise MPI, get world info */
+	MPI_Init( &argc, &argv );
+	MPI_Comm_dup( MPI_COMM_WORLD, &CommWorld );
+	MPI_Comm_size( CommWorld, &numProcessors );
+	MPI_Comm_rank( CommWorld, &rank );
+	if( argc >= 2 ) {
+		procToWatch = atoi( argv[1] );
+	}
+	else {
+		procToWatch = 0;
+	}
+	if( rank == procToWatch ) printf( "Watching rank: %i\n", rank );
+
+	/* Strain rates from 1e-20 to 1e-10 per second and temperatures from 0 to 1600 C */
+	for( sample_I = 0; sample_I < SampleCount; sample_I++ ) {
+		srJ2[sample_I] = pow( 10.0, -20.0 + 10.0 * ( sample_I % SrateCount ) / ( SrateCount - 1 ) );
+		temperature[sample_I] = 1600.0 * ( sample_I / SrateCount ) / ( TempCount - 1 );
+	}
+
+	for( case_I = 0; case_I < caseCount; case_I++ ) {
+		double		maxDiff = 0.0;
+
+		memset( &material, 0, sizeof(material) );
+		material.srexponent = cases[case_I][0];
+		material.activationE = cases[case_I][1];
+		material.refvisc = cases[case_I][2];
+		material.vis_min = cases[case_I][3];
+		material.vis_max = cases[case_I][4];
+		material.refsrate = 1.0e-15;
+		material.reftemp = 1300.0;
+		Snac_Rheology_BuildViscosity( &material );
+
+		Snac_Rheology_Viscosity( &material, SampleCount, srJ2, temperature, viscosity );
+		for( sample_I = 0; sample_I < SampleCount; sample_I++ ) {
+			double		diff;
+
+			reference[sample_I] = referenceViscosity( &material, srJ2[sample_I], temperature[sample_I] );
+			diff = fabs( viscosity[sample_I] - reference[sample_I] ) / reference[sample_I];
+			if( !( diff <= maxDiff ) )
+				maxDiff = diff;
+		}
+		if( rank == procToWatch ) {
+			printf( "n = %g, H = %g, vis_min = %g: relative difference below %g: %s\n",
+				material.srexponent, material.activationE, material.vis_min, TOL, maxDiff < TOL ? "True" : "False" );
+		}
+	}
+
+	/* Close off MPI */
+	MPI_Finalize();
+
+	return 0; /* success */
+}
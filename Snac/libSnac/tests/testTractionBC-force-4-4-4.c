@@ -0,0 +1,134 @@
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+**
+** Copyright (C), 2003, 
+**	Steve Quenette, 110 Victoria Street, Melbourne, Victoria, 3053, Australia.
+**	Californian Institute of Technology, 1200 East California Boulevard, Pasadena, California, 91125, USA.
+**	University of Texas, 1 University Station, Austin, Texas, 78712, USA.
+**
+** Authors:
+**	Stevan M. Quenette, Senior Software Engineer, VPAC. (steve@vpac.org)
+**	Stevan M. Quenette, Visitor in Geophysics, Caltech.
+**	Luc Lavier, Research Scientist, The University of Texas. (luc@utig.ug.utexas.edu)
+**	Luc Lavier, Research Scientist, Caltech.
+**
+** This program is free software; you can redistribute it and/or modify it
+** under the terms of the GNU General Public License as published by the
+** Free Software Foundation; either version 2, or (at your option) any
+** later version.
+** 
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+** 
+** You should have received a copy of the GNU General Public License
+** along with this program; if not, write to the Free Software
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+**
+** Role:
+**	Tests the SnacTractionBC plugin's loads against the traction times the wall area on a 4x4x4 element box, as built
+**	and stretched: each node of the "right" wall must take a quarter of the traction on each of its element faces
+**	there, and no other node may be loaded.
+**
+** $Id$
+**
+**~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+
+#include <mpi.h>
+#include <StGermain/StGermain.h>
+#include <StGermain/FD/FD.h>
+#include "Snac/Snac.h"
+#include "TestUtilities.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+
+extern int				numProcessors;
+extern int				procToWatch;
+extern int				rank;
+extern MPI_Comm			CommWorld;
+extern Dictionary*			dictionary;
+extern Snac_Context*			snacContext;
+
+#define TOL		1.0e-12
+
+/* The traction of the plugin's stress on the "right" wall, whose outward normal is x */
+static const double		traction = 1.0e+08;
+
+int main( int argc, char* argv[] ) {
+	Mesh*				mesh;
+	HexaMD*				decomp;
+	EntryPoint*			forceEP;
+	Hook*				hook;
+	Mass*				mass;
+	Force*				balance;
+	Node_LocalIndex			node_lI;
+	Index				case_I;
+	/* The box as built is 1 by 1 by 1; stretching it by 1.5 in y and 3 in z makes the wall 4.5 in area. */
+	const double			stretch[][3] = { { 1.0, 1.0, 1.0 }, { 1.0, 1.5, 3.0 } };
+
+	SnacTest_SetUp( argc, argv );
+	mesh = snacContext->mesh;
+	decomp = (HexaMD*)mesh->layout->decomp;
+	mass = Memory_Alloc_Array( Mass, mesh->nodeLocalCount, "testTractionBC" );
+	balance = Memory_Alloc_Array( Force, mesh->nodeLocalCount, "testTractionBC" );
+	forceEP = (EntryPoint*)Context_GetEntryPoint( snacContext, Snac_EP_Force );
+	hook = (Hook*)Stg_ObjectList_Get( forceEP->hooks, "SnacTractionBC" );
+
+	for( case_I = 0; case_I < sizeof(stretch) / sizeof(stretch[0]); case_I++ ) {
+		double		wallArea = stretch[case_I][1] * stretch[case_I][2];
+		double		faceArea = wallArea / 
+					( ( decomp->nodeGlobal3DCounts[1] - 1 ) * ( decomp->nodeGlobal3DCounts[2] - 1 ) );
+		Force		sum = { 0.0, 0.0, 0.0 };
+		Bool		asExpected = True;
+
+		/* Stretch the box from the previous case's shape; the first is the box as built. */
+		for( node_lI = 0; node_lI < mesh->nodeDomainCount && case_I > 0; node_lI++ ) {
+			double*		coord = mesh->nodeCoord[node_lI];
+
+			coord[1] *= stretch[case_I][1] / stretch[case_I - 1][1];
+			coord[2] *= stretch[case_I][2] / stretch[case_I - 1][2];
+		}
+
+		/* Only the plugin's force hook: the loads alone go onto the zeroed node forces. */
+		for( node_lI = 0; node_lI < mesh->nodeLocalCount; node_lI++ )
+			memset( Snac_Node_At( snacContext, node_lI )->force, 0, sizeof(Force) );
+		memset( balance, 0, sizeof(Force) * mesh->nodeLocalCount );
+		((Snac_Force_RangeCast*)hook->funcPtr)( snacContext, 0, mesh->nodeLocalCount, 0.0, mass, balance );
+
+		for( node_lI = 0; node_lI < mesh->nodeLocalCount; node_lI++ ) {
+			double*			force = Snac_Node_At( snacContext, node_lI )->force;
+			Force			expected = { 0.0, 0.0, 0.0 };
+			IJK			ijk;
+			Index			d;
+
+			RegularMeshUtils_Node_1DTo3D( decomp, mesh->nodeL2G[node_lI], &ijk[0], &ijk[1], &ijk[2] );
+			if( ijk[0] == decomp->nodeGlobal3DCounts[0] - 1 ) {
+				/* A wall node is on 1, 2 or 4 element faces, as it is on the wall's corner, edge or inside. */
+				Index		faceCount = 
+					( ijk[1] == 0 || ijk[1] == decomp->nodeGlobal3DCounts[1] - 1 ? 1 : 2 ) * 
+					( ijk[2] == 0 || ijk[2] == decomp->nodeGlobal3DCounts[2] - 1 ? 1 : 2 );
+
+				expected[0] = traction * 0.25 * faceArea * faceCount;
+			}
+			for( d = 0; d < 3; d++ ) {
+				sum[d] += force[d];
+				if( !( fabs( force[d] - expected[d] ) <= TOL * traction * faceArea ) )
+					asExpected = False;
+			}
+		}
+		printf( "Right wall of area %g: summed force (%g %g %g), traction times area (%g 0 0)\n", wallArea, 
+			sum[0], sum[1], sum[2], traction * wallArea );
+		printf( "Right wall of area %g: a quarter of each face's load on its nodes, none elsewhere: %s\n", wallArea, 
+			asExpected ? "True" : "False" );
+	}
+
+	Memory_Free( mass );
+	Memory_Free( balance );
+	SnacTest_TearDown();
+	return 0; /* success */
+}
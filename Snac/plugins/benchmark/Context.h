@@ -0,0 +1,60 @@
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+**
+** Copyright (C), 2003,
+**	Steve Quenette, 110 Victoria Street, Melbourne, Victoria, 3053, Australia.
+**	Californian Institute of Technology, 1200 East California Boulevard, Pasadena, California, 91125, USA.
+**	University of Texas, 1 University Station, Austin, Texas, 78712, USA.
+**
+** Authors:
+**	Stevan M. Quenette, Senior Software Engineer, VPAC. (steve@vpac.org)
+**	Stevan M. Quenette, Visitor in Geophysics, Caltech.
+**	Luc Lavier, Research Scientist, The University of Texas. (luc@utig.ug.utexas.edu)
+**	Luc Lavier, Research Scientist, Caltech.
+**
+** This program is free software; you can redistribute it and/or modify it
+** under the terms of the GNU General Public License as published by the
+** Free Software Foundation; either version 2, or (at your option) any
+** later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program; if not, write to the Free Software
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+**
+** $Id: Context.h $
+**
+**~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#ifndef __SnacBenchmark_Context_h__
+#define __SnacBenchmark_Context_h__
+	
+	/* The phases timed, each bracketing the hooks of one entry point */
+	typedef enum {
+		SnacBenchmark_Execute = 0,
+		SnacBenchmark_Solve,
+		SnacBenchmark_LoopElementsEnergy,
+		SnacBenchmark_LoopNodesEnergy,
+		SnacBenchmark_CalcStresses,
+		SnacBenchmark_LoopNodesMomentum,
+		SnacBenchmark_LoopElementsMomentum,
+		SnacBenchmark_Sync,
+		SnacBenchmark_Dump,
+		SnacBenchmark_PhaseCount
+	} SnacBenchmark_Phase;
+	
+	/* Context Information */
+	struct _SnacBenchmark_Context {
+		/* Wall time spent in, and calls made to, each phase on this processor */
+		double				start[SnacBenchmark_PhaseCount];
+		double				total[SnacBenchmark_PhaseCount];
+		unsigned int			calls[SnacBenchmark_PhaseCount];
+		
+		/* Report written by rank 0 into the output path */
+		char*				filename;
+	};
+	
+#endif /* __SnacBenchmark_Context_h__ */
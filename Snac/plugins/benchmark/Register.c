@@ -0,0 +1,125 @@
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+**
+** Copyright (C), 2003,
+**	Steve Quenette, 110 Victoria Street, Melbourne, Victoria, 3053, Australia.
+**	Californian Institute of Technology, 1200 East California Boulevard, Pasadena, California, 91125, USA.
+**	University of Texas, 1 University Station, Austin, Texas, 78712, USA.
+**
+** Authors:
+**	Stevan M. Quenette, Senior Software Engineer, VPAC. (steve@vpac.org)
+**	Stevan M. Quenette, Visitor in Geophysics, Caltech.
+**	Luc Lavier, Research Scientist, The University of Texas. (luc@utig.ug.utexas.edu)
+**	Luc Lavier, Research Scientist, Caltech.
+**
+** This program is free software; you can redistribute it and/or modify it
+** under the terms of the GNU General Public License as published by the
+** Free Software Foundation; either version 2, or (at your option) any
+** later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program; if not, write to the Free Software
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+**
+** $Id: Register.c $
+**
+**~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#include <mpi.h>
+#include <StGermain/StGermain.h>
+#include <StGermain/FD/FD.h>
+#include "Snac/Snac.h"
+#include "types.h"
+#include "Context.h"
+#include "Timing.h"
+#include "Register.h"
+#include <stdio.h>
+
+/* Textual name of this class */
+const Type SnacBenchmark_Type = "SnacBenchmark";
+
+ExtensionInfo_Index SnacBenchmark_ContextHandle;
+
+
+Index _SnacBenchmark_Register( PluginsManager* pluginsMgr ) {
+	return PluginsManager_Submit( pluginsMgr, 
+				      SnacBenchmark_Type, 
+				      "0", 
+				      _SnacBenchmark_DefaultNew );
+}
+
+
+void* _SnacBenchmark_DefaultNew( Name name ) {
+	return _Codelet_New( sizeof(Codelet), 
+			     SnacBenchmark_Type, 
+			     _Codelet_Delete, 
+			     _Codelet_Print, 
+			     _Codelet_Copy, 
+			     _SnacBenchmark_DefaultNew, 
+			     _SnacBenchmark_Construct, 
+			     _Codelet_Build, 
+			     _Codelet_Initialise, 
+			     _Codelet_Execute, 
+			     _Codelet_Destroy, 
+			     name );
+}
+
+
+void _SnacBenchmark_Construct( void* component, Stg_ComponentFactory* cf, void* data ) {
+	Snac_Context*			context;
+	SnacBenchmark_Context*		contextExt;
+	Index				phase_I;
+	
+	/* Retrieve context. */
+	context = (Snac_Context*)Stg_ComponentFactory_ConstructByName( cf, "context", Snac_Context, True, data ); 
+	
+	#ifdef DEBUG
+		printf( "In: %s()\n", __func__ );
+	#endif
+	
+	{
+		/* The entry point each phase brackets, in phase order */
+		const Name	entryPoint[SnacBenchmark_PhaseCount] = {
+			AbstractContext_EP_Execute,
+			AbstractContext_EP_Solve,
+			Snac_EP_LoopElementsEnergy,
+			Snac_EP_LoopNodesEnergy,
+			Snac_EP_CalcStresses,
+			Snac_EP_LoopNodesMomentum,
+			Snac_EP_LoopElementsMomentum,
+			AbstractContext_EP_Sync,
+			AbstractContext_EP_Dump };
+		
+		/* Add extensions to the context */
+		SnacBenchmark_ContextHandle = ExtensionManager_Add( context->extensionMgr, SnacBenchmark_Type, 
+			sizeof(SnacBenchmark_Context) );
+		
+		/* Add extensions to the entry points. Each phase is bracketed outside every other plugin's hooks, 
+		   whenever those are added. */
+		for( phase_I = 0; phase_I < SnacBenchmark_PhaseCount; phase_I++ ) {
+			EntryPoint_Prepend_AlwaysFirst(
+				Context_GetEntryPoint( context, entryPoint[phase_I] ),
+				"SnacBenchmark_Start",
+				SnacBenchmark_StartHook[phase_I],
+				SnacBenchmark_Type );
+			EntryPoint_Append_AlwaysLast(
+				Context_GetEntryPoint( context, entryPoint[phase_I] ),
+				"SnacBenchmark_Stop",
+				SnacBenchmark_StopHook[phase_I],
+				SnacBenchmark_Type );
+		}
+	}
+	
+	/* Construct. */
+	contextExt = ExtensionManager_Get( context->extensionMgr, context, SnacBenchmark_ContextHandle );
+	for( phase_I = 0; phase_I < SnacBenchmark_PhaseCount; phase_I++ ) {
+		contextExt->start[phase_I] = 0.0;
+		contextExt->total[phase_I] = 0.0;
+		contextExt->calls[phase_I] = 0;
+	}
+	contextExt->filename = Dictionary_GetString_WithDefault( context->dictionary, "benchmarkFile", "benchmark.csv" );
+}
@@ -0,0 +1,183 @@
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+**
+** Copyright (C), 2003,
+**	Steve Quenette, 110 Victoria Street, Melbourne, Victoria, 3053, Australia.
+**	Californian Institute of Technology, 1200 East California Boulevard, Pasadena, California, 91125, USA.
+**	University of Texas, 1 University Station, Austin, Texas, 78712, USA.
+**
+** Authors:
+**	Stevan M. Quenette, Senior Software Engineer, VPAC. (steve@vpac.org)
+**	Stevan M. Quenette, Visitor in Geophysics, Caltech.
+**	Luc Lavier, Research Scientist, The University of Texas. (luc@utig.ug.utexas.edu)
+**	Luc Lavier, Research Scientist, Caltech.
+**
+** This program is free software; you can redistribute it and/or modify it
+** under the terms of the GNU General Public License as published by the
+** Free Software Foundation; either version 2, or (at your option) any
+** later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program; if not, write to the Free Software
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+**
+** $Id: Timing.c $
+**
+**~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#include <mpi.h>
+#include <StGermain/StGermain.h>
+#include <StGermain/FD/FD.h>
+#include "Snac/Snac.h"
+#include "types.h"
+#include "Context.h"
+#include "Timing.h"
+#include "Register.h"
+#include <stdio.h>
+#include <limits.h>
+#include <sys/time.h>
+#include <sys/resource.h>
+
+const Name SnacBenchmark_PhaseName[SnacBenchmark_PhaseCount] = {
+	"Execute",
+	"Solve",
+	"LoopElementsEnergy",
+	"LoopNodesEnergy",
+	"CalcStresses",
+	"LoopNodesMomentum",
+	"LoopElementsMomentum",
+	"Sync",
+	"Dump" };
+
+
+static void _SnacBenchmark_Start( void* _context, SnacBenchmark_Phase phase ) {
+	Snac_Context*			context = (Snac_Context*)_context;
+	SnacBenchmark_Context*		contextExt = ExtensionManager_Get(
+						context->extensionMgr,
+						context,
+						SnacBenchmark_ContextHandle );
+	
+	contextExt->start[phase] = MPI_Wtime();
+}
+
+
+static void _SnacBenchmark_Stop( void* _context, SnacBenchmark_Phase phase ) {
+	Snac_Context*			context = (Snac_Context*)_context;
+	SnacBenchmark_Context*		contextExt = ExtensionManager_Get(
+						context->extensionMgr,
+						context,
+						SnacBenchmark_ContextHandle );
+	
+	contextExt->total[phase] += MPI_Wtime() - contextExt->start[phase];
+	contextExt->calls[phase]++;
+}
+
+
+/* Entry point hooks are handed only the context, so each phase gets its own pair */
+#define SnacBenchmark_PhaseHooks( phase ) \
+	static void _SnacBenchmark_Start_##phase( void* context ) { _SnacBenchmark_Start( context, SnacBenchmark_##phase ); } \
+	static void _SnacBenchmark_Stop_##phase( void* context ) { _SnacBenchmark_Stop( context, SnacBenchmark_##phase ); }
+
+SnacBenchmark_PhaseHooks( Solve )
+SnacBenchmark_PhaseHooks( LoopElementsEnergy )
+SnacBenchmark_PhaseHooks( LoopNodesEnergy )
+SnacBenchmark_PhaseHooks( CalcStresses )
+SnacBenchmark_PhaseHooks( LoopNodesMomentum )
+SnacBenchmark_PhaseHooks( LoopElementsMomentum )
+SnacBenchmark_PhaseHooks( Sync )
+SnacBenchmark_PhaseHooks( Dump )
+
+static void _SnacBenchmark_Start_Execute( void* context ) {
+	_SnacBenchmark_Start( context, SnacBenchmark_Execute );
+}
+
+/* The run is over once the time loop returns */
+static void _SnacBenchmark_Stop_Execute( void* context ) {
+	_SnacBenchmark_Stop( context, SnacBenchmark_Execute );
+	_SnacBenchmark_Report( context );
+}
+
+const Func_Ptr SnacBenchmark_StartHook[SnacBenchmark_PhaseCount] = {
+	_SnacBenchmark_Start_Execute,
+	_SnacBenchmark_Start_Solve,
+	_SnacBenchmark_Start_LoopElementsEnergy,
+	_SnacBenchmark_Start_LoopNodesEnergy,
+	_SnacBenchmark_Start_CalcStresses,
+	_SnacBenchmark_Start_LoopNodesMomentum,
+	_SnacBenchmark_Start_LoopElementsMomentum,
+	_SnacBenchmark_Start_Sync,
+	_SnacBenchmark_Start_Dump };
+
+const Func_Ptr SnacBenchmark_StopHook[SnacBenchmark_PhaseCount] = {
+	_SnacBenchmark_Stop_Execute,
+	_SnacBenchmark_Stop_Solve,
+	_SnacBenchmark_Stop_LoopElementsEnergy,
+	_SnacBenchmark_Stop_LoopNodesEnergy,
+	_SnacBenchmark_Stop_CalcStresses,
+	_SnacBenchmark_Stop_LoopNodesMomentum,
+	_SnacBenchmark_Stop_LoopElementsMomentum,
+	_SnacBenchmark_Stop_Sync,
+	_SnacBenchmark_Stop_Dump };
+
+
+void _SnacBenchmark_Report( void* _context ) {
+	Snac_Context*			context = (Snac_Context*)_context;
+	SnacBenchmark_Context*		contextExt = ExtensionManager_Get(
+						context->extensionMgr,
+						context,
+						SnacBenchmark_ContextHandle );
+	MeshDecomp*			decomp = context->meshLayout->decomp;
+	const int			count = SnacBenchmark_PhaseCount + 1;
+	double				local[SnacBenchmark_PhaseCount + 1];
+	double				minimum[SnacBenchmark_PhaseCount + 1];
+	double				maximum[SnacBenchmark_PhaseCount + 1];
+	double				sum[SnacBenchmark_PhaseCount + 1];
+	struct rusage			usage;
+	Index				phase_I;
+	
+	#ifdef DEBUG
+		printf( "In: %s()\n", __func__ );
+	#endif
+	
+	/* The last entry is the memory high-water mark, in kB on Linux */
+	for( phase_I = 0; phase_I < SnacBenchmark_PhaseCount; phase_I++ )
+		local[phase_I] = contextExt->total[phase_I];
+	getrusage( RUSAGE_SELF, &usage );
+	local[SnacBenchmark_PhaseCount] = (double)usage.ru_maxrss;
+	
+	MPI_Reduce( local, minimum, count, MPI_DOUBLE, MPI_MIN, 0, context->communicator );
+	MPI_Reduce( local, maximum, count, MPI_DOUBLE, MPI_MAX, 0, context->communicator );
+	MPI_Reduce( local, sum, count, MPI_DOUBLE, MPI_SUM, 0, context->communicator );
+	
+	if( context->rank == 0 ) {
+		char				tmpBuf[PATH_MAX];
+		FILE*				out;
+		
+		sprintf( tmpBuf, "%s/%s", context->outputPath, contextExt->filename );
+		if( (out = fopen( tmpBuf, "w" )) == NULL ) {
+			Journal_Firewall( 0, context->snacError, "\"%s\"  failed to open file for writing", tmpBuf );
+		}
+		
+		/* Totals per processor, summarised over the processors: the max is the one that sets the pace */
+		fprintf( out, "# SnacBenchmark ranks=%d elements=%u steps=%u\n", 
+			 context->nproc, decomp->elementGlobalCount, contextExt->calls[SnacBenchmark_Solve] );
+		fprintf( out, "metric,unit,calls,min,mean,max\n" );
+		for( phase_I = 0; phase_I < SnacBenchmark_PhaseCount; phase_I++ ) {
+			fprintf( out, "%s,s,%u,%.6e,%.6e,%.6e\n", 
+				 SnacBenchmark_PhaseName[phase_I], 
+				 contextExt->calls[phase_I], 
+				 minimum[phase_I], 
+				 sum[phase_I] / context->nproc, 
+				 maximum[phase_I] );
+		}
+		fprintf( out, "MemoryHighWater,kB,1,%.0f,%.0f,%.0f\n", 
+			 minimum[SnacBenchmark_PhaseCount], 
+			 sum[SnacBenchmark_PhaseCount] / context->nproc, 
+			 maximum[SnacBenchmark_PhaseCount] );
+		fclose( out );
+	}
+}
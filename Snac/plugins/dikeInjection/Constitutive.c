@@ -36,6 +36,7 @@
 #include "Snac/ViscoPlastic/ViscoPlastic.h"
 #include "types.h"
 #include "Context.h"
+#include "TetraList.h"
 #include "Constitutive.h"
 #include "Register.h"
 #include <math.h>
@@ -56,16 +57,13 @@
 
 //#define DEBUG
 
-void SnacDikeInjection_Constitutive( void* _context, Element_LocalIndex element_lI ) {
+void SnacDikeInjection_Constitutive_Range( void* _context, Element_LocalIndex begin, Element_LocalIndex end ) {
 
 	Snac_Context			*context = (Snac_Context*)_context;
 	SnacDikeInjection_Context*	contextExt = ExtensionManager_Get(
 												context->extensionMgr,
 												context,
 												SnacDikeInjection_ContextHandle );
-	Snac_Element			*element = Snac_Element_At( context, element_lI );
-	SnacViscoPlastic_Element* viscoplasticElement = ExtensionManager_Get( context->mesh->elementExtensionMgr, element, SnacViscoPlastic_ElementHandle );
-	const Snac_Material		*material = &context->materialProperty[element->material_I];
 	
 	/* make local copies. */
 	double startX = contextExt->startX;
@@ -74,35 +72,49 @@ void SnacDikeInjection_Constitutive( void* _context, Element_LocalIndex element_
 	double endZ = contextExt->endZ;
 	double dX = endX-startX;
 	double dZ = endZ-startZ;
+	double denom = sqrt( dX*dX + dZ*dZ );
 	double elem_dX = 0.0;
 	double epsilon_xx = 0.0;
-	Tetrahedra_Index	tetra_I;
-
-	/* Some convenience stuffs. */
-	MeshLayout*			meshLayout = (MeshLayout*)context->meshLayout;
-	HexaMD*				decomp = (HexaMD*)meshLayout->decomp;
-	IJK				ijk;
-	Element_GlobalIndex		element_gI = _MeshDecomp_Element_LocalToGlobal1D( decomp, element_lI );
-	RegularMeshUtils_Element_1DTo3D( decomp, element_gI, &ijk[0], &ijk[1], &ijk[2] );
-	
-	elem_dX = 0.25*( 
-					(Snac_Element_NodeCoord( context, element_lI, 1)[0]-Snac_Element_NodeCoord( context, element_lI, 0)[0]) + 
-					(Snac_Element_NodeCoord( context, element_lI, 2)[0]-Snac_Element_NodeCoord( context, element_lI, 3)[0]) + 
-					(Snac_Element_NodeCoord( context, element_lI, 5)[0]-Snac_Element_NodeCoord( context, element_lI, 4)[0]) + 
-					(Snac_Element_NodeCoord( context, element_lI, 6)[0]-Snac_Element_NodeCoord( context, element_lI, 7)[0]) 
-					 );
-	/* fprintf(stderr,"elem_dX=%e dikeWidth=%e\n",elem_dX,contextExt->dikeWidth); */
-	epsilon_xx = (contextExt->injectionRate*context->dt)/elem_dX;
-	/*	epsilon_xx = (contextExt->injectionRate*context->dt)/contextExt->dikeWidth; */
-	
-	for( tetra_I = 0; tetra_I < Tetrahedra_Count; tetra_I++ ) {
+	Element_LocalIndex	element_lI = end;
+	Index			first = 0;
+	Index			last = contextExt->tetraCount;
+	Index			list_I;
+
+	assert( denom > 0.0 );
+
+	/* Only the listed tetras can be in the dike: find the first one of the range. */
+	while( first < last ) {
+		Index		middle = first + (last - first) / 2;
+
+		if( contextExt->tetraList[middle].element_lI < begin )
+			first = middle + 1;
+		else
+			last = middle;
+	}
+
+	for( list_I = first; list_I < contextExt->tetraCount && contextExt->tetraList[list_I].element_lI < end; list_I++ ) {
+		Tetrahedra_Index	tetra_I = contextExt->tetraList[list_I].tetra_I;
+		Snac_Element		*element;
 		Coord baryCenter;
 		double distance = 0.0;
 		double numer = 0.0;
-		double denom = 1.0;
 		Node_LocalIndex node_lI;
 		unsigned int dim;
 
+		element = Snac_Element_At( context, contextExt->tetraList[list_I].element_lI );
+		if( contextExt->tetraList[list_I].element_lI != element_lI ) {
+			element_lI = contextExt->tetraList[list_I].element_lI;
+			elem_dX = 0.25*( 
+							(Snac_Element_NodeCoord( context, element_lI, 1)[0]-Snac_Element_NodeCoord( context, element_lI, 0)[0]) + 
+							(Snac_Element_NodeCoord( context, element_lI, 2)[0]-Snac_Element_NodeCoord( context, element_lI, 3)[0]) + 
+							(Snac_Element_NodeCoord( context, element_lI, 5)[0]-Snac_Element_NodeCoord( context, element_lI, 4)[0]) + 
+							(Snac_Element_NodeCoord( context, element_lI, 6)[0]-Snac_Element_NodeCoord( context, element_lI, 7)[0]) 
+							 );
+			/* fprintf(stderr,"elem_dX=%e dikeWidth=%e\n",elem_dX,contextExt->dikeWidth); */
+			epsilon_xx = (contextExt->injectionRate*context->dt)/elem_dX;
+			/*	epsilon_xx = (contextExt->injectionRate*context->dt)/contextExt->dikeWidth; */
+		}
+
 		/*
 		  First decide whther this tet is a part of the dike.
 		*/
@@ -118,8 +130,6 @@ void SnacDikeInjection_Constitutive( void* _context, Element_LocalIndex element_
 
 		/* The following is the general formula for distance from a line to a point. */
 		numer = fabs( dX*(startZ-baryCenter[2])-(startX-baryCenter[0])*dZ );
-		denom = sqrt( dX*dX + dZ*dZ );
-		assert( denom > 0.0 );
 		distance = numer/denom;
 
 		/* 
@@ -131,11 +141,9 @@ void SnacDikeInjection_Constitutive( void* _context, Element_LocalIndex element_
 		 */
 		if( (distance <= contextExt->dikeWidth) && (baryCenter[1] >= contextExt->dikeDepth) ) {
 			StressTensor*		stress = &element->tetra[tetra_I].stress;
+			SnacViscoPlastic_Element* viscoplasticElement = ExtensionManager_Get( context->mesh->elementExtensionMgr, element, SnacViscoPlastic_ElementHandle );
+			const Snac_Material		*material = &context->materialProperty[element->material_I];
 
-/* 			fprintf(stderr,"el=%d (%d %d %d) tet=%d (%e %e %e) distance=%e startX=%e width=%e\n", */
-/* 					element_lI,ijk[0],ijk[1],ijk[2],tetra_I, */
-/* 					baryCenter[0], baryCenter[1], baryCenter[2], */
-/* 					distance,startX,contextExt->dikeWidth); */
 			(*stress)[0][0] -= (material->lambda + 2.0f * material->mu) * epsilon_xx;
 			(*stress)[1][1] -= material->lambda * epsilon_xx;
 			(*stress)[2][2] -= material->lambda * epsilon_xx;
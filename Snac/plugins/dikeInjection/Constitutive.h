@@ -28,7 +28,7 @@
 */
 /** \file
 ** Role:
-**	Calculates the plastic properties for a given element. 
+**	Adds the dike's injection strain to the stresses of the tetras in the dike. 
 **
 ** Assumptions:
 **	None as yet.
@@ -40,9 +40,11 @@
 **
 **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
-#ifndef __SnacDikeInjection_h__
-#define __SnacDikeInjection_h__
+#ifndef __SnacDikeInjection_Constitutive_h__
+#define __SnacDikeInjection_Constitutive_h__
 	
-	void SnacDikeInjection_Constitutive( void* context, Element_LocalIndex element_lI );
+	/* Adjust the stresses of the tetras of elements [begin,end) in the dike. Only the tetras in the context's
+	   list are looked at. */
+	void SnacDikeInjection_Constitutive_Range( void* context, Element_LocalIndex begin, Element_LocalIndex end );
 	
-#endif /* __SnacDikeInjection_h__ */
+#endif /* __SnacDikeInjection_Constitutive_h__ */
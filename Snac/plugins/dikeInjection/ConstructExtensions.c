@@ -73,4 +73,16 @@ void _SnacDikeInjection_ConstructExtensions( void* _context, void* data ) {
 			Dictionary_GetDefault( context->dictionary, "injectionRate", 
 								   Dictionary_Entry_Value_FromDouble( 4.8e+03 ) ) ); /* a fraction of applied plate vel. */
 
+	/* The list of tetras that may be in the dike is rebuilt when a node has moved further than this. */
+	contextExt->tetraListMargin = Dictionary_Entry_Value_AsDouble(
+			Dictionary_GetDefault( context->dictionary, "dikeTetraListMargin", 
+								   Dictionary_Entry_Value_FromDouble( 0.5 * contextExt->dikeWidth ) ) );
+	contextExt->tetraList = NULL;
+	contextExt->tetraCount = 0;
+	contextExt->tetraSize = 0;
+	contextExt->tetraListCoord = NULL;
+	contextExt->tetraListBuildCount = 0;
+	contextExt->remesherHandle = (unsigned)-1;
+	contextExt->remeshingCount = 0;
+
 }
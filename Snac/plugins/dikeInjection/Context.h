@@ -52,6 +52,21 @@
 		double dikeDepth;
 		double dikeWidth;
 		double injectionRate;
+
+		/* The (element, tetra) pairs that may lie in the dike, by increasing element. It is built with every
+		   tetra whose barycenter is within dikeWidth of the line, and above dikeDepth, allowing for any node
+		   moving up to tetraListMargin in each direction; so it stays complete until a node has moved further
+		   than that from tetraListCoord, or the mesh is remeshed. */
+		SnacDikeInjection_Tetra*	tetraList;
+		Index				tetraCount;
+		Index				tetraSize;
+		double				tetraListMargin;
+		Coord*				tetraListCoord;
+		Index				tetraListBuildCount;
+
+		/* The remesher, if loaded, whose remeshes invalidate the list. */
+		ExtensionInfo_Index		remesherHandle;
+		Index				remeshingCount;
 	};
 	
 	/* Print the contents of the context extension */
@@ -41,10 +41,11 @@
 #ifndef __SnacDikeInjection_h__
 #define __SnacDikeInjection_h__
 	
+#include "types.h"
+#include "Context.h"
+#include "TetraList.h"
 #include "Constitutive.h"
 #include "ConstructExtensions.h"
-#include "Context.h"
 #include "Register.h" 
-#include "types.h"
 
 #endif /* __SnacDikeInjection_h__ */
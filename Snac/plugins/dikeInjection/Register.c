@@ -34,9 +34,10 @@
 #include <StGermain/FD/FD.h>
 #include "Snac/Snac.h"
 #include "types.h"
+#include "Context.h"
+#include "TetraList.h"
 #include "Constitutive.h"
 #include "ConstructExtensions.h"
-#include "Context.h"
 #include "Register.h"
 #include <stdio.h>
 
@@ -86,10 +87,25 @@ void _SnacDikeInjection_Construct( void* component, Stg_ComponentFactory* cf, vo
 		sizeof(SnacDikeInjection_Context) );
 
 	/* Add extensions to the entry points */
-	EntryPoint_Append( 
+	Snac_EntryPoint_AppendRangeHook( 
 		Context_GetEntryPoint( context,	Snac_EP_Constitutive ),
 		SnacDikeInjection_Type, 
-		SnacDikeInjection_Constitutive, 
+		SnacDikeInjection_Constitutive_Range, 
+		SnacDikeInjection_Type );
+	EntryPoint_Append( 
+		Context_GetEntryPoint( context,	AbstractContext_EP_Initialise ),
+		"SnacDikeInjection_InitialiseTetraList", 
+		_SnacDikeInjection_InitialiseTetraList, 
+		SnacDikeInjection_Type );
+	EntryPoint_Prepend( /* the list must be good for this step's coordinates before any stresses are calculated */
+		Context_GetEntryPoint( context,	Snac_EP_CalcStresses ),
+		"SnacDikeInjection_UpdateTetraList", 
+		_SnacDikeInjection_UpdateTetraList, 
+		SnacDikeInjection_Type );
+	EntryPoint_Append( 
+		Context_GetEntryPoint( context,	AbstractContext_EP_DestroyExtensions ),
+		"SnacDikeInjection_DeleteTetraList", 
+		_SnacDikeInjection_DeleteTetraList, 
 		SnacDikeInjection_Type );
 
 	/* Construct. */
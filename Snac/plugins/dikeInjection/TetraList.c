@@ -0,0 +1,243 @@
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+**
+** Copyright (C), 2003,
+**	Steve Quenette, 110 Victoria Street, Melbourne, Victoria, 3053, Australia.
+**	Californian Institute of Technology, 1200 East California Boulevard, Pasadena, California, 91125, USA.
+**	University of Texas, 1 University Station, Austin, Texas, 78712, USA.
+**
+** Authors:
+**	Stevan M. Quenette, Senior Software Engineer, VPAC. (steve@vpac.org)
+**	Stevan M. Quenette, Visitor in Geophysics, Caltech.
+**	Luc Lavier, Research Scientist, The University of Texas. (luc@utig.ug.utexas.edu)
+**	Luc Lavier, Research Scientist, Caltech.
+**
+** This program is free software; you can redistribute it and/or modify it
+** under the terms of the GNU General Public License as published by the
+** Free Software Foundation; either version 2, or (at your option) any
+** later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program; if not, write to the Free Software
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+**
+** $Id: TetraList.c $
+**
+**~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#include <mpi.h>
+#include <StGermain/StGermain.h>
+#include <StGermain/FD/FD.h>
+#include "Snac/Snac.h"
+#include "Snac/Remesher/Remesher.h"
+#include "types.h"
+#include "Context.h"
+#include "TetraList.h"
+#include "Register.h"
+#include <math.h>
+#include <string.h>
+#include <assert.h>
+
+//#define DEBUG
+
+void SnacDikeInjection_BuildTetraList( void* _context ) {
+	Snac_Context*			context = (Snac_Context*)_context;
+	SnacDikeInjection_Context*	contextExt = ExtensionManager_Get(
+						context->extensionMgr,
+						context,
+						SnacDikeInjection_ContextHandle );
+	Mesh*				mesh = context->mesh;
+	double				startX = contextExt->startX;
+	double				startZ = contextExt->startZ;
+	double				dX = contextExt->endX - contextExt->startX;
+	double				dZ = contextExt->endZ - contextExt->startZ;
+	double				denom = sqrt( dX*dX + dZ*dZ );
+	double				margin = contextExt->tetraListMargin;
+	double				width;
+	double				depth = contextExt->dikeDepth - margin;
+	Element_LocalIndex		element_lI;
+	
+	#ifdef DEBUG
+		printf( "In: %s()\n", __func__ );
+	#endif
+	
+	/* Moving every node by up to margin in x and in z moves a barycenter's distance from the line by up to 
+	   margin * (|dX| + |dZ|) / denom. */
+	assert( denom > 0.0 );
+	width = contextExt->dikeWidth + margin * (fabs( dX ) + fabs( dZ )) / denom;
+	
+	contextExt->tetraCount = 0;
+	for( element_lI = 0; element_lI < mesh->elementLocalCount; element_lI++ ) {
+		Coord			min;
+		Coord			max;
+		double			distMin;
+		double			distMax;
+		Index			node_I;
+		Index			corner_I;
+		Index			dim;
+		Tetrahedra_Index	tetra_I;
+		
+		/* Bounding-box prefilter: the signed distance from the line is linear in x and z, so over the element's 
+		   box it lies between its values at the four x-z corners. */
+		for( dim = 0; dim < 3; dim++ ) {
+			min[dim] = mesh->nodeCoord[mesh->elementNodeTbl[element_lI][0]][dim];
+			max[dim] = min[dim];
+		}
+		for( node_I = 1; node_I < mesh->elementNodeCountTbl[element_lI]; node_I++ ) {
+			double*		coord = mesh->nodeCoord[mesh->elementNodeTbl[element_lI][node_I]];
+			
+			for( dim = 0; dim < 3; dim++ ) {
+				if( coord[dim] < min[dim] )
+					min[dim] = coord[dim];
+				if( coord[dim] > max[dim] )
+					max[dim] = coord[dim];
+			}
+		}
+		if( max[1] < depth )
+			continue;
+		
+		distMin = HUGE_VAL;
+		distMax = -HUGE_VAL;
+		for( corner_I = 0; corner_I < 4; corner_I++ ) {
+			double		x = (corner_I & 1) ? max[0] : min[0];
+			double		z = (corner_I & 2) ? max[2] : min[2];
+			double		dist = ( dX*(startZ-z)-(startX-x)*dZ ) / denom;
+			
+			if( dist < distMin )
+				distMin = dist;
+			if( dist > distMax )
+				distMax = dist;
+		}
+		if( distMin > width || distMax < -width )
+			continue;
+		
+		/* The element straddles the widened slab: keep its tetras whose barycenters are in it. */
+		for( tetra_I = 0; tetra_I < Tetrahedra_Count; tetra_I++ ) {
+			Coord			baryCenter;
+			double			distance;
+			
+			for( dim = 0; dim < 3; dim++ ) 
+				baryCenter[dim] = 0.0;
+			for( node_I = 0; node_I < 4; node_I++ ) {
+				double*		coord = Snac_Element_NodeCoord( context, element_lI, TetraToNode[tetra_I][node_I] );
+				
+				for( dim = 0; dim < 3; dim++ ) 
+					baryCenter[dim] += 0.25 * coord[dim];
+			}
+			distance = fabs( dX*(startZ-baryCenter[2])-(startX-baryCenter[0])*dZ ) / denom;
+			if( distance > width || baryCenter[1] < depth )
+				continue;
+			
+			if( contextExt->tetraCount == contextExt->tetraSize ) {
+				contextExt->tetraSize = contextExt->tetraSize ? 2 * contextExt->tetraSize : 64;
+				contextExt->tetraList = Memory_Realloc_Array( 
+					contextExt->tetraList, 
+					SnacDikeInjection_Tetra, 
+					contextExt->tetraSize );
+			}
+			contextExt->tetraList[contextExt->tetraCount].element_lI = element_lI;
+			contextExt->tetraList[contextExt->tetraCount].tetra_I = tetra_I;
+			contextExt->tetraCount++;
+		}
+	}
+	
+	/* The coordinates the list is good for, give or take the margin. */
+	if( !contextExt->tetraListCoord )
+		contextExt->tetraListCoord = Memory_Alloc_Array( Coord, mesh->nodeDomainCount, "SnacDikeInjection" );
+	memcpy( contextExt->tetraListCoord, mesh->nodeCoord, sizeof(Coord) * mesh->nodeDomainCount );
+	contextExt->tetraListBuildCount++;
+	
+	Journal_DPrintf( context->debug, "SnacDikeInjection: %u of %u tetras may be in the dike\n", 
+		contextExt->tetraCount, mesh->elementLocalCount * Tetrahedra_Count );
+}
+
+
+void _SnacDikeInjection_InitialiseTetraList( void* _context, void* data ) {
+	Snac_Context*			context = (Snac_Context*)_context;
+	SnacDikeInjection_Context*	contextExt = ExtensionManager_Get(
+						context->extensionMgr,
+						context,
+						SnacDikeInjection_ContextHandle );
+	
+	#ifdef DEBUG
+		printf( "In: %s()\n", __func__ );
+	#endif
+	
+	contextExt->remesherHandle = ExtensionManager_GetHandle( context->extensionMgr, "SnacRemesher" );
+	if( contextExt->remesherHandle != (unsigned)-1 ) {
+		SnacRemesher_Context*		remesherExt = ExtensionManager_Get(
+							context->extensionMgr,
+							context,
+							contextExt->remesherHandle );
+		
+		contextExt->remeshingCount = remesherExt->remeshingCount;
+	}
+	
+	SnacDikeInjection_BuildTetraList( context );
+}
+
+
+void _SnacDikeInjection_UpdateTetraList( void* _context ) {
+	Snac_Context*			context = (Snac_Context*)_context;
+	SnacDikeInjection_Context*	contextExt = ExtensionManager_Get(
+						context->extensionMgr,
+						context,
+						SnacDikeInjection_ContextHandle );
+	Mesh*				mesh = context->mesh;
+	double				margin = contextExt->tetraListMargin;
+	Node_DomainIndex		node_dI;
+	
+	if( contextExt->remesherHandle != (unsigned)-1 ) {
+		SnacRemesher_Context*		remesherExt = ExtensionManager_Get(
+							context->extensionMgr,
+							context,
+							contextExt->remesherHandle );
+		
+		if( remesherExt->remeshingCount != contextExt->remeshingCount ) {
+			contextExt->remeshingCount = remesherExt->remeshingCount;
+			SnacDikeInjection_BuildTetraList( context );
+			return;
+		}
+	}
+	
+	for( node_dI = 0; node_dI < mesh->nodeDomainCount; node_dI++ ) {
+		double*		coord = mesh->nodeCoord[node_dI];
+		double*		listCoord = contextExt->tetraListCoord[node_dI];
+		
+		if( fabs( coord[0] - listCoord[0] ) > margin || 
+		    fabs( coord[1] - listCoord[1] ) > margin || 
+		    fabs( coord[2] - listCoord[2] ) > margin )
+		{
+			SnacDikeInjection_BuildTetraList( context );
+			return;
+		}
+	}
+}
+
+
+void _SnacDikeInjection_DeleteTetraList( void* _context, void* data ) {
+	Snac_Context*			context = (Snac_Context*)_context;
+	SnacDikeInjection_Context*	contextExt = ExtensionManager_Get(
+						context->extensionMgr,
+						context,
+						SnacDikeInjection_ContextHandle );
+	
+	#ifdef DEBUG
+		printf( "In: %s()\n", __func__ );
+	#endif
+	
+	if( contextExt->tetraList ) {
+		Memory_Free( contextExt->tetraList );
+		contextExt->tetraList = NULL;
+	}
+	if( contextExt->tetraListCoord ) {
+		Memory_Free( contextExt->tetraListCoord );
+		contextExt->tetraListCoord = NULL;
+	}
+	contextExt->tetraCount = 0;
+	contextExt->tetraSize = 0;
+}
@@ -0,0 +1,52 @@
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+**
+** Copyright (C), 2003,
+**	Steve Quenette, 110 Victoria Street, Melbourne, Victoria, 3053, Australia.
+**	Californian Institute of Technology, 1200 East California Boulevard, Pasadena, California, 91125, USA.
+**	University of Texas, 1 University Station, Austin, Texas, 78712, USA.
+**
+** Authors:
+**	Stevan M. Quenette, Senior Software Engineer, VPAC. (steve@vpac.org)
+**	Stevan M. Quenette, Visitor in Geophysics, Caltech.
+**	Luc Lavier, Research Scientist, The University of Texas. (luc@utig.ug.utexas.edu)
+**	Luc Lavier, Research Scientist, Caltech.
+**
+** This program is free software; you can redistribute it and/or modify it
+** under the terms of the GNU General Public License as published by the
+** Free Software Foundation; either version 2, or (at your option) any
+** later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program; if not, write to the Free Software
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+**
+** $Id: TetraList.h $
+**
+**~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#ifndef __SnacDikeInjection_TetraList_h__
+#define __SnacDikeInjection_TetraList_h__
+	
+	/* A tetra that may lie in the dike */
+	struct _SnacDikeInjection_Tetra {
+		Element_LocalIndex		element_lI;
+		Tetrahedra_Index		tetra_I;
+	};
+	
+	/* (Re)build the list of the tetras that may lie in the dike from the current node coordinates */
+	void SnacDikeInjection_BuildTetraList( void* _context );
+	
+	/* Build the list once the mesh is in place */
+	void _SnacDikeInjection_InitialiseTetraList( void* _context, void* data );
+	
+	/* Before the stresses: rebuild the list if the mesh was remeshed or moved past its margin since it was built */
+	void _SnacDikeInjection_UpdateTetraList( void* _context );
+	
+	void _SnacDikeInjection_DeleteTetraList( void* _context, void* data );
+	
+#endif /* __SnacDikeInjection_TetraList_h__ */
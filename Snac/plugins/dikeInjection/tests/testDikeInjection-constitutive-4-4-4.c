@@ -0,0 +1,228 @@
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+**
+** Copyright (C), 2003, 
+**	Steve Quenette, 110 Victoria Street, Melbourne, Victoria, 3053, Australia.
+**	Californian Institute of Technology, 1200 East California Boulevard, Pasadena, California, 91125, USA.
+**	University of Texas, 1 University Station, Austin, Texas, 78712, USA.
+**
+** Authors:
+**	Stevan M. Quenette, Senior Software Engineer, VPAC. (steve@vpac.org)
+**	Stevan M. Quenette, Visitor in Geophysics, Caltech.
+**	Luc Lavier, Research Scientist, The University of Texas. (luc@utig.ug.utexas.edu)
+**	Luc Lavier, Research Scientist, Caltech.
+**
+** This program is free software; you can redistribute it and/or modify it
+** under the terms of the GNU General Public License as published by the
+** Free Software Foundation; either version 2, or (at your option) any
+** later version.
+** 
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+** 
+** You should have received a copy of the GNU General Public License
+** along with this program; if not, write to the Free Software
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+**
+** Role:
+**	Tests the SnacDikeInjection plugin's constitutive hook on a 4x4x4 element box of 0.25 wide elements, cut by a
+**	dike 0.25 either side of x=0.5 and above y=-0.5. Every tetrahedra of the elements 1 and 2 in x and 2 and 3 in y
+**	must take the stress increment of the injection rate over one element's width, and have its plastic strain
+**	zeroed; every other tetrahedra must be left alone. It does so on the initial mesh, with the nodes moved less
+**	than the list's margin, and with the nodes moved an element's width, past it.
+**
+** $Id$
+**
+**~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#include <mpi.h>
+#include <StGermain/StGermain.h>
+#include <StGermain/FD/FD.h>
+#include "Snac/Snac.h"
+#include "Snac/ViscoPlastic/ViscoPlastic.h"
+#include "Snac/DikeInjection/DikeInjection.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <assert.h>
+
+#define TOL		1.0e-12
+
+struct _Node {
+	struct { __Snac_Node };
+};
+
+struct _Element {
+	struct { __Snac_Element };
+};
+
+/* The stress every tetrahedra starts from */
+static double InitialStress( Element_LocalIndex element_lI, Tetrahedra_Index tetra_I, Index i, Index j ) {
+	double		phase = 0.37 * ( element_lI * Tetrahedra_Count + tetra_I );
+
+	return 1.0e7 * sin( 0.7 * phase + 2 * ( i < j ? i : j ) + ( i < j ? j : i ) );
+}
+
+int main( int argc, char* argv[] ) {
+	MPI_Comm			CommWorld;
+	int				rank;
+	int				numProcessors;
+	int				procToWatch;
+	Dictionary*			dictionary;
+	XML_IO_Handler*			ioHandler;
+	Snac_Context*			snacContext;
+	Mesh*				mesh;
+	HexaMD*				decomp;
+	ExtensionInfo_Index		viscoPlasticElementHandle;
+	SnacDikeInjection_Context*	contextExt;
+	EntryPoint*			constitutiveEP;
+	EntryPoint*			calcStressesEP;
+	Hook*				hook;
+	Hook*				updateHook;
+	Element_LocalIndex		elementCount;
+	Element_LocalIndex		element_lI;
+	Node_LocalIndex			node_lI;
+	Coord*				initialCoord;
+	const Snac_Material*		material;
+	double				epsilon_xx;
+	double				increment[3];
+	Index				case_I;
+	const char*			caseName[] = { "Initial mesh", "Nodes moved within the margin", "Nodes moved past the margin" };
+	/* The list's margin is dikeWidth/2 = 0.125. A tetrahedra's barycenter is at least a quarter of an element's 
+	   width, 0.0625, inside it, so moving all the nodes by less than that keeps the same tetrahedra in the dike. */
+	const double			shift[][3] = { { 0.0, 0.0, 0.0 }, { 0.05, 0.05, 0.05 }, { -0.25, 0.0, 0.0 } };
+	const Index			firstI[] = { 1, 1, 2 };
+
+	/* Initialise MPI, get world info */
+	MPI_Init( &argc, &argv );
+	MPI_Comm_dup( MPI_COMM_WORLD, &CommWorld );
+	MPI_Comm_size( CommWorld, &numProcessors );
+	MPI_Comm_rank( CommWorld, &rank );
+
+	Snac_Init( &argc, &argv );
+
+	if( argc >= 2 ) {
+		procToWatch = atoi( argv[1] );
+	}
+	else {
+		procToWatch = 0;
+	}
+	if( rank == procToWatch ) printf( "Watching rank: %i\n", rank );
+
+	/* Read input */
+	dictionary = Dictionary_New();
+	dictionary->add( dictionary, "rank", Dictionary_Entry_Value_FromUnsignedInt( rank ) );
+	dictionary->add( dictionary, "numProcessors", Dictionary_Entry_Value_FromUnsignedInt( numProcessors ) );
+	ioHandler = XML_IO_Handler_New();
+	IO_Handler_ReadAllFromCommandLine( ioHandler, argc, argv, dictionary );
+
+	/* Build the context */
+	snacContext = Snac_Context_New( 0.0f, 10.0f, sizeof(Snac_Node), sizeof(Snac_Element), CommWorld, dictionary );
+	Stg_Component_Construct( snacContext, 0 /* dummy */, &snacContext, True );
+	Stg_Component_Build( snacContext, 0 /* dummy */, False );
+	Stg_Component_Initialise( snacContext, 0 /* dummy */, False );
+
+	mesh = snacContext->mesh;
+	decomp = (HexaMD*)mesh->layout->decomp;
+	elementCount = mesh->elementLocalCount;
+	viscoPlasticElementHandle = ExtensionManager_GetHandle( mesh->elementExtensionMgr, "SnacViscoPlastic" );
+	contextExt = ExtensionManager_Get( snacContext->extensionMgr, snacContext, 
+		ExtensionManager_GetHandle( snacContext->extensionMgr, "SnacDikeInjection" ) );
+
+	constitutiveEP = (EntryPoint*)Context_GetEntryPoint( snacContext, Snac_EP_Constitutive );
+	hook = (Hook*)Stg_ObjectList_Get( constitutiveEP->hooks, "SnacDikeInjection" );
+	calcStressesEP = (EntryPoint*)Context_GetEntryPoint( snacContext, Snac_EP_CalcStresses );
+	updateHook = (Hook*)Stg_ObjectList_Get( calcStressesEP->hooks, "SnacDikeInjection_UpdateTetraList" );
+
+	/* Opening the dike by injectionRate * dt over an element's width */
+	material = &snacContext->materialProperty[0];
+	epsilon_xx = contextExt->injectionRate * snacContext->dt / 0.25;
+	increment[0] = -( material->lambda + 2.0f * material->mu ) * epsilon_xx;
+	increment[1] = -material->lambda * epsilon_xx;
+	increment[2] = -material->lambda * epsilon_xx;
+	if( rank == procToWatch )
+		printf( "Stress increment in the dike: (%g, %g, %g)\n", increment[0], increment[1], increment[2] );
+
+	initialCoord = Memory_Alloc_Array( Coord, mesh->nodeDomainCount, "testDikeInjection" );
+	memcpy( initialCoord, mesh->nodeCoord, sizeof(Coord) * mesh->nodeDomainCount );
+
+	for( case_I = 0; case_I < sizeof(shift) / sizeof(shift[0]); case_I++ ) {
+		Index		inDikeCount = 0;
+		Bool		asExpected = True;
+
+		for( node_lI = 0; node_lI < mesh->nodeDomainCount; node_lI++ ) {
+			Index		dim;
+
+			for( dim = 0; dim < 3; dim++ )
+				mesh->nodeCoord[node_lI][dim] = initialCoord[node_lI][dim] + shift[case_I][dim];
+		}
+		for( element_lI = 0; element_lI < elementCount; element_lI++ ) {
+			Snac_Element*			element = Snac_Element_At( snacContext, element_lI );
+			SnacViscoPlastic_Element*	viscoplasticElement = ExtensionManager_Get( mesh->elementExtensionMgr, 
+								element, viscoPlasticElementHandle );
+			Tetrahedra_Index		tetra_I;
+			Index				i, j;
+
+			for( tetra_I = 0; tetra_I < Tetrahedra_Count; tetra_I++ ) {
+				for( i = 0; i < 3; i++ ) {
+					for( j = 0; j < 3; j++ )
+						element->tetra[tetra_I].stress[i][j] = InitialStress( element_lI, tetra_I, i, j );
+				}
+				viscoplasticElement->plasticStrain[tetra_I] = 1.0;
+			}
+		}
+
+		/* The plugin's hooks, over ranges of elements as the stress calculation splits them */
+		((EntryPoint_VoidPtr_Cast*)updateHook->funcPtr)( snacContext );
+		for( element_lI = 0; element_lI < elementCount; element_lI += 7 )
+			((Snac_Constitutive_RangeCast*)hook->funcPtr)( snacContext, element_lI, 
+				element_lI + 7 < elementCount ? element_lI + 7 : elementCount );
+
+		for( element_lI = 0; element_lI < elementCount; element_lI++ ) {
+			Snac_Element*			element = Snac_Element_At( snacContext, element_lI );
+			SnacViscoPlastic_Element*	viscoplasticElement = ExtensionManager_Get( mesh->elementExtensionMgr, 
+								element, viscoPlasticElementHandle );
+			IJK				ijk;
+			Bool				inDike;
+			Tetrahedra_Index		tetra_I;
+			Index				i, j;
+
+			RegularMeshUtils_Element_1DTo3D( decomp, decomp->elementMapLocalToGlobal( decomp, element_lI ), 
+				&ijk[0], &ijk[1], &ijk[2] );
+			inDike = ijk[0] >= firstI[case_I] && ijk[0] <= firstI[case_I] + 1 && ijk[1] >= 2;
+			for( tetra_I = 0; tetra_I < Tetrahedra_Count; tetra_I++ ) {
+				for( i = 0; i < 3; i++ ) {
+					for( j = 0; j < 3; j++ ) {
+						double		expected = InitialStress( element_lI, tetra_I, i, j ) + 
+									( inDike && i == j ? increment[i] : 0.0 );
+
+						if( !( fabs( element->tetra[tetra_I].stress[i][j] - expected ) <= TOL * fabs( increment[0] ) ) )
+							asExpected = False;
+					}
+				}
+				if( viscoplasticElement->plasticStrain[tetra_I] != ( inDike ? 0.0 : 1.0 ) )
+					asExpected = False;
+				if( inDike )
+					inDikeCount++;
+			}
+		}
+
+		if( rank == procToWatch ) {
+			printf( "%s: list built %u times, %u of %u tetrahedra in the elements %u to %u in x and 2 to 3 in y\n", 
+				caseName[case_I], contextExt->tetraListBuildCount, inDikeCount, elementCount * Tetrahedra_Count, 
+				firstI[case_I], firstI[case_I] + 1 );
+			printf( "%s: only those took the increment and lost their plastic strain: %s\n", caseName[case_I], 
+				asExpected ? "True" : "False" );
+		}
+	}
+
+	Memory_Free( initialCoord );
+	Stg_Class_Delete( snacContext );
+	Stg_Class_Delete( ioHandler );
+	Stg_Class_Delete( dictionary );
+	MPI_Finalize();
+	return 0; /* success */
+}
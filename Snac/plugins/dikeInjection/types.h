@@ -45,5 +45,6 @@
 	
 	/* Plastic */
 	typedef struct _SnacDikeInjection_Context	SnacDikeInjection_Context;
+	typedef struct _SnacDikeInjection_Tetra		SnacDikeInjection_Tetra;
 	
 #endif /* __SnacDikeInjection_types_h__ */
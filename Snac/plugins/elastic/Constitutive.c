@@ -64,3 +64,11 @@ void _SnacElastic_Constitutive( void* _context, Element_LocalIndex element_dI )
 		}
 	}
 }
+
+
+void _SnacElastic_Constitutive_Range( void* _context, Element_LocalIndex begin, Element_LocalIndex end ) {
+	Element_LocalIndex		element_lI;
+
+	for( element_lI = begin; element_lI < end; element_lI++ )
+		_SnacElastic_Constitutive( _context, element_lI );
+}
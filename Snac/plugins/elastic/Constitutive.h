@@ -41,5 +41,6 @@
 #define __SnacElastic_Constitutive_h__
 	
 	void _SnacElastic_Constitutive( void* _context, Element_LocalIndex element_lI );
+	void _SnacElastic_Constitutive_Range( void* _context, Element_LocalIndex begin, Element_LocalIndex end );
 	
 #endif /* __SnacElastic_Constitutive_h__ */
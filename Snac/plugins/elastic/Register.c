@@ -91,10 +91,10 @@ void _SnacElastic_Construct( void* component, Stg_ComponentFactory* cf, void* da
 		SnacElastic_Type,
 		_SnacElastic_InitialConditions,
 		SnacElastic_Type );
-	EntryPoint_Append(
+	Snac_EntryPoint_AppendRangeHook(
 		Context_GetEntryPoint( context, Snac_EP_Constitutive ),
 		SnacElastic_Type,
-		_SnacElastic_Constitutive,
+		_SnacElastic_Constitutive_Range,
 		SnacElastic_Type );
 	EntryPoint_Append(
 		Context_GetEntryPoint( context, AbstractContext_EP_DestroyExtensions ),
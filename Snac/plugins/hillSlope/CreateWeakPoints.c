@@ -101,7 +101,7 @@ void SnacHillSlope_CreateWeakPoints( void* _context ) {
 
     Element_LocalIndex		element_lI;
     Element_GlobalIndex		element_gI;
-    int                         index, index_I,index_J,index_K;
+    int                         index_I,index_J,index_K;
     IJK				ijk;
 
 
@@ -133,7 +133,6 @@ void SnacHillSlope_CreateWeakPoints( void* _context ) {
 	double			subDomainMinCohesion = contextExt->subDomainMinCohesion;
 	double			subDomainMaxCohesion = contextExt->subDomainMaxCohesion;
 	unsigned int		numberSubDomainPoints,numberWeakPoints;
-	unsigned int		*shuffleIndexListPtr, *randomNumberListPtr;
 	int			subDomain_I_element_range,subDomain_J_element_range,subDomain_K_element_range,subDomain_I_element_left_position;
 	/*  Report HillSlope plugin variables picked up (?) from xml parameter file */
 	Journal_Printf( context->snacInfo, "\tRNG seed = %u\n", rngSeed );
@@ -162,130 +161,66 @@ void SnacHillSlope_CreateWeakPoints( void* _context ) {
 
 	numberSubDomainPoints = subDomain_I_element_range*subDomain_J_element_range*subDomain_K_element_range;
 	numberWeakPoints = (unsigned int)((float)numberSubDomainPoints*fractionWeakPoints);
-	Journal_Printf(context->snacInfo,  "Number of weak points = %u/%u\n", numberWeakPoints,numberSubDomainPoints);
+	Journal_Printf(context->snacInfo,  "Expected number of weak points = %u/%u\n", numberWeakPoints,numberSubDomainPoints);
 	
 	/*
-	 *  Seed RNG (random number generator) using seed value from input xml file
-	 */
-	srand( rngSeed );
-	shuffleIndexListPtr=(unsigned int *)malloc((size_t)(numberSubDomainPoints*sizeof(unsigned int)));
-	randomNumberListPtr=(unsigned int *)malloc((size_t)(numberSubDomainPoints*sizeof(unsigned int)));
-	/*
-	 *  Create (1) ordered sequence of element indices, (2) parallel list of random variates
-	 */
-	index=0;
-	for(index_K = 0; index_K < subDomain_K_element_range; index_K++) {
-	    for(index_J = 0; index_J < subDomain_J_element_range; index_J++) {
-		for(index_I = 0; index_I < subDomain_I_element_range; index_I++) {
-		    /*
-		     *  Work out the element index from the i,j,k and the required location of the subDomain
-		     */
-		    element_gI = index_I + subDomain_I_element_left_position
-			+ full_I_element_range*(full_J_element_range-1-index_J)
-			+ full_I_element_range*full_J_element_range*(index_K+(full_K_element_range-subDomain_K_element_range)/2);
-		    element_lI = Mesh_ElementMapGlobalToLocal( mesh, element_gI );
-
-
-		    /*
-		     *  Impose heterogeneous cohesion within whole subDomain - if min/max values are non-neg
-		     */
-		    if(element_lI < mesh->elementLocalCount && subDomainMinCohesion>0.0) {
-			Snac_Element		*element;
-			Snac_Material	    	*material;
-			SnacPlastic_Element	*plasticElement;
-			Tetrahedra_Index	tetra_I;
-			double			localRandomCohesion
-			    = subDomainMinCohesion+((drand48()+drand48())/2.0)*(subDomainMaxCohesion-subDomainMinCohesion);
-			/*
-			 *  Naughty use of drand48 to generate triangular pdf variates spanning [subMin, subMax) 
-			 */
-
-			element = Snac_Element_At( context, element_lI );
-			material = &context->materialProperty[element->material_I];
-			plasticElement = ExtensionManager_Get(  mesh->elementExtensionMgr, element, SnacPlastic_ElementHandle );
-			for( tetra_I = 0; tetra_I < Tetrahedra_Count; tetra_I++ ) {
-			    plasticElement->plasticStrain[tetra_I] = PlasticStrainFromCohesion(material,localRandomCohesion);
-#ifdef DEBUG2	    
-			    if(tetra_I==0) 
-				Journal_Printf( context->snacInfo,
-						"Heterogeneous cohesion:  timeStep=%d  element (%d,%d,%d)#=%d->%d  cohesion=%g  plasticStrain=%g\n",
-						context->timeStep, index_I,index_J,index_K, element_gI, element_lI, 
-						localRandomCohesion, plasticElement->plasticStrain[tetra_I] );
-#endif
-			    
-			}
-		    } // End if
-
-		    
-		    shuffleIndexListPtr[index]=element_lI;
-		    randomNumberListPtr[index]=rand();
-		    index++;
-		    if(index-1>numberSubDomainPoints) break;
-		}
-		if(index>0 && index-1>numberSubDomainPoints) break;
-	    }
-	    if(index>0 && index-1>numberSubDomainPoints) {fprintf(stderr, "We miscalculated the subDomain index\n"); break;}
-	}
-	/*
-	 *  Sort the list of sub-domain local (ie global set pared down for this CPU) 
-	 *  indices according to the random numbers
-	 *    - i.e., randomize the index list
-	 */
-	if (numberWeakPoints>0) {
-	    ShellSort( randomNumberListPtr, shuffleIndexListPtr, numberSubDomainPoints );
-#ifdef DEBUG2
-	    for(index = 0; index < numberSubDomainPoints; index++) {
-		Journal_Printf( context->snacInfo, "\t SubDomain point #%d = %d, RNG var=%d\n", 
-				index, shuffleIndexListPtr[index],randomNumberListPtr[index] );
-	    }
-#endif
-	}
-	/*
-	 *  Now the subDomain index list is shuffled and the random number list is ordered
+	 *  Each subDomain element draws its own variates, keyed by its global index and the rngSeed, so the weak points
+	 *  do not depend on the decomposition and each CPU only visits its own elements:
+	 *    - stream 0 makes it a weak point with probability fractionWeakPoints
+	 *    - streams 1 and 2 give it a triangular pdf cohesion spanning [subMin, subMax)
 	 */
+	for(element_lI = 0; element_lI < mesh->elementLocalCount; element_lI++) {
+	    Snac_Element		*element;
+	    Snac_Material	    	*material;
+	    SnacPlastic_Element		*plasticElement;
+	    Tetrahedra_Index		tetra_I;
 
+	    element_gI = Mesh_ElementMapLocalToGlobal( mesh, element_lI );
+	    RegularMeshUtils_Element_1DTo3D( decomp, element_gI, &ijk[0], &ijk[1], &ijk[2] );
+	    index_I = (int)ijk[0] - subDomain_I_element_left_position;
+	    index_J = full_J_element_range-1-(int)ijk[1];
+	    index_K = (int)ijk[2] - (full_K_element_range-subDomain_K_element_range)/2;
+	    if(index_I < 0 || index_I >= subDomain_I_element_range || index_J < 0 || index_J >= subDomain_J_element_range
+	       || index_K < 0 || index_K >= subDomain_K_element_range)
+		continue;
 
-	/*
-	 *  Loop over the shuffled subDomain index list BUT only up to the number of weak points within it
-	 *   - i.e., subset the subDomain and allocate weak points to only a random fraction of them
-	 */
-	for(index = 0; index < numberWeakPoints; index++) {
-	    element_lI = shuffleIndexListPtr[index];
+	    element = Snac_Element_At( context, element_lI );
+	    material = &context->materialProperty[element->material_I];
+	    plasticElement = ExtensionManager_Get(  mesh->elementExtensionMgr, element, SnacPlastic_ElementHandle );
 
-#ifdef DEBUG2
-	    Journal_Printf(context->snacInfo,  "Shuffled weak point # %d  -> %d \n", index,  element_lI);
-#endif
-	    
 	    /*
-	     *  At each point, force low cohesion by imposing a degree of plastic strain
+	     *  Impose heterogeneous cohesion within whole subDomain - if min/max values are non-neg
 	     */
-	    if(element_lI < mesh->elementLocalCount) {
-		Snac_Element		*element;
-		Snac_Material	    	*material;
-		SnacPlastic_Element	*plasticElement;
-		Tetrahedra_Index	tetra_I;
-		
-		element = Snac_Element_At( context, element_lI );
-		material = &context->materialProperty[element->material_I];
-		plasticElement = ExtensionManager_Get(  mesh->elementExtensionMgr, element, SnacPlastic_ElementHandle );
+	    if(subDomainMinCohesion>0.0) {
+		double			localRandomCohesion
+		    = subDomainMinCohesion+((Snac_Random_Uniform(rngSeed,1,element_gI)+Snac_Random_Uniform(rngSeed,2,element_gI))/2.0)
+		    *(subDomainMaxCohesion-subDomainMinCohesion);
+
 		for( tetra_I = 0; tetra_I < Tetrahedra_Count; tetra_I++ ) {
-		    plasticElement->plasticStrain[tetra_I] = PlasticStrainFromCohesion(material,(double)contextExt->weakPointCohesion);
+		    plasticElement->plasticStrain[tetra_I] = PlasticStrainFromCohesion(material,localRandomCohesion);
+		}
 #ifdef DEBUG2	    
-		    if(tetra_I==0) 
-			Journal_Printf( context->snacInfo,"Weak points: timeStep=%d  element (%d,%d,%d)#=%d->%d  cohesion=%g  plasticStrain=%g\n",
-					context->timeStep, index_I,index_J,index_K, element_gI, element_lI,  
-					contextExt->weakPointCohesion, plasticElement->plasticStrain[tetra_I] );
+		Journal_Printf( context->snacInfo,
+				"Heterogeneous cohesion:  timeStep=%d  element (%d,%d,%d)#=%d->%d  cohesion=%g  plasticStrain=%g\n",
+				context->timeStep, index_I,index_J,index_K, element_gI, element_lI, 
+				localRandomCohesion, plasticElement->plasticStrain[0] );
 #endif
+	    } // End if
 
+	    /*
+	     *  At each weak point, force low cohesion by imposing a degree of plastic strain
+	     */
+	    if(Snac_Random_Uniform(rngSeed,0,element_gI) < fractionWeakPoints) {
+		for( tetra_I = 0; tetra_I < Tetrahedra_Count; tetra_I++ ) {
+		    plasticElement->plasticStrain[tetra_I] = PlasticStrainFromCohesion(material,(double)contextExt->weakPointCohesion);
 		}
+#ifdef DEBUG2	    
+		Journal_Printf( context->snacInfo,"Weak points: timeStep=%d  element (%d,%d,%d)#=%d->%d  cohesion=%g  plasticStrain=%g\n",
+				context->timeStep, index_I,index_J,index_K, element_gI, element_lI,  
+				contextExt->weakPointCohesion, plasticElement->plasticStrain[0] );
+#endif
 	    } // End if
-	    
 	} // End for
-	/*
-	 *  Free up allocated memory for shuffling arrays
-	 */
-	free(shuffleIndexListPtr);
-	free(randomNumberListPtr);
     } // End if (check fraction of weak points is in valid range [0,1]
 
 
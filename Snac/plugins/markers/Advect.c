@@ -0,0 +1,67 @@
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+**
+** Copyright (C), 2003,
+**	Steve Quenette, 110 Victoria Street, Melbourne, Victoria, 3053, Australia.
+**	Californian Institute of Technology, 1200 East California Boulevard, Pasadena, California, 91125, USA.
+**	University of Texas, 1 University Station, Austin, Texas, 78712, USA.
+**
+** Authors:
+**	Stevan M. Quenette, Senior Software Engineer, VPAC. (steve@vpac.org)
+**	Stevan M. Quenette, Visitor in Geophysics, Caltech.
+**	Luc Lavier, Research Scientist, The University of Texas. (luc@utig.ug.utexas.edu)
+**	Luc Lavier, Research Scientist, Caltech.
+**
+** This program is free software; you can redistribute it and/or modify it
+** under the terms of the GNU General Public License as published by the
+** Free Software Foundation; either version 2, or (at your option) any
+** later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program; if not, write to the Free Software
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+**
+** $Id: Advect.c $
+**
+**~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#include <mpi.h>
+#include <StGermain/StGermain.h>
+#include <StGermain/FD/FD.h>
+#include "Snac/Snac.h"
+#include "types.h"
+#include "Marker.h"
+#include "Context.h"
+#include "Locate.h"
+#include "InitialConditions.h"
+#include "Register.h"
+#include "Advect.h"
+
+void _SnacMarkers_Advect( void* _context ) {
+	Snac_Context*			context = (Snac_Context*)_context;
+	SnacMarkers_Context*		contextExt = ExtensionManager_Get(
+						context->extensionMgr,
+						context,
+						SnacMarkers_ContextHandle );
+	Swarm*				swarm = contextExt->swarm;
+	Particle_Index			lParticle_I;
+	
+	#ifdef DEBUG
+		printf( "In: %s()\n", __func__ );
+	#endif
+	
+	/* The nodes have just moved by their velocities; markers at fixed weights move with the same piecewise-linear 
+	   velocity field, and keep sampling their element's history until the next remesh. */
+	for( lParticle_I = 0; lParticle_I < swarm->particleLocalCount; lParticle_I++ ) {
+		SnacMarkers_Marker*	marker = (SnacMarkers_Marker*)Swarm_ParticleAt( swarm, lParticle_I );
+		
+		if( marker->owningCell >= swarm->cellLocalCount )
+			continue;
+		SnacMarkers_Position( context->mesh, marker );
+		SnacMarkers_Sample( context, marker->owningCell, marker );
+	}
+}
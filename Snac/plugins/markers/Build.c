@@ -0,0 +1,114 @@
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+**
+** Copyright (C), 2003,
+**	Steve Quenette, 110 Victoria Street, Melbourne, Victoria, 3053, Australia.
+**	Californian Institute of Technology, 1200 East California Boulevard, Pasadena, California, 91125, USA.
+**	University of Texas, 1 University Station, Austin, Texas, 78712, USA.
+**
+** Authors:
+**	Stevan M. Quenette, Senior Software Engineer, VPAC. (steve@vpac.org)
+**	Stevan M. Quenette, Visitor in Geophysics, Caltech.
+**	Luc Lavier, Research Scientist, The University of Texas. (luc@utig.ug.utexas.edu)
+**	Luc Lavier, Research Scientist, Caltech.
+**
+** This program is free software; you can redistribute it and/or modify it
+** under the terms of the GNU General Public License as published by the
+** Free Software Foundation; either version 2, or (at your option) any
+** later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program; if not, write to the Free Software
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+**
+** $Id: Build.c $
+**
+**~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#include <mpi.h>
+#include <StGermain/StGermain.h>
+#include <StGermain/FD/FD.h>
+#include "Snac/Snac.h"
+#include "Snac/Remesher/Remesher.h"
+#include "types.h"
+#include "Marker.h"
+#include "Context.h"
+#include "Locate.h"
+#include "Register.h"
+#include "Build.h"
+#include <string.h>
+
+void _SnacMarkers_Build( void* _context, void* data ) {
+	Snac_Context*			context = (Snac_Context*)_context;
+	SnacMarkers_Context*		contextExt = ExtensionManager_Get(
+						context->extensionMgr,
+						context,
+						SnacMarkers_ContextHandle );
+	SnacMarkers_Marker		marker;
+	Dictionary_Entry_Value*		materialList = Dictionary_Get( context->dictionary, "materials" );
+	
+	#ifdef DEBUG
+		printf( "In: %s()\n", __func__ );
+	#endif
+	
+	/* Plugins holding element history we transfer, and the remesher whose remeshes we follow, if loaded. */
+	contextExt->plasticHandle = ExtensionManager_GetHandle( context->mesh->elementExtensionMgr, "SnacPlastic" );
+	contextExt->viscoPlasticHandle = ExtensionManager_GetHandle( context->mesh->elementExtensionMgr, "SnacViscoPlastic" );
+	contextExt->remesherHandle = ExtensionManager_GetHandle( context->extensionMgr, "SnacRemesher" );
+	
+	/* The markers carry the element values across remeshes, so the remesher need not search for and interpolate 
+	   them itself. */
+	if( contextExt->remesherHandle != (unsigned)-1 ) {
+		SnacRemesher_Context*	remesherExt = ExtensionManager_Get( 
+						context->extensionMgr, 
+						context, 
+						contextExt->remesherHandle );
+		
+		remesherExt->interpolateElements = False;
+	}
+	
+	/* One vote counter per phase of the "materials" list (a single phase without one). */
+	contextExt->phaseCount = materialList ? Dictionary_Entry_Value_GetCount( materialList ) : 1;
+	contextExt->phaseVotes = Memory_Alloc_Array( Particle_InCellIndex, contextExt->phaseCount, "SnacMarkers" );
+	memset( contextExt->phaseVotes, 0, contextExt->phaseCount * sizeof(Particle_InCellIndex) );
+	
+	/* One cell per element. The element layout locates points in the undeformed block, so the cell layout's 
+	   point location is replaced with a search of the deformed elements' tetrahedra. */
+	contextExt->cellLayout = ElementCellLayout_New( "markersCellLayout", context->mesh );
+	contextExt->cellLayout->_cellOf = _SnacMarkers_CellOf;
+	contextExt->cellLayout->_isInCell = _SnacMarkers_IsInCell;
+	
+	/* Same count per element; placement is ours so that every marker starts inside a tetrahedron. */
+	contextExt->particleLayout = RandomParticleLayout_New( 
+		"markersParticleLayout", 
+		contextExt->markersPerElement, 
+		Dictionary_GetUnsignedInt_WithDefault( context->dictionary, "markersSeed", 13 ) );
+	contextExt->particleLayout->_initialiseParticlesOfCell = _SnacMarkers_InitialiseParticlesOfCell;
+	
+	contextExt->extensionMgr_Register = ExtensionManager_Register_New();
+	contextExt->swarm = Swarm_New( 
+		"markers", 
+		contextExt->cellLayout, 
+		contextExt->particleLayout, 
+		3, 
+		sizeof(SnacMarkers_Marker), 
+		contextExt->extensionMgr_Register, 
+		context->variable_Register, 
+		context->communicator );
+	Swarm_NewScalarVariable(
+		contextExt->swarm,
+		"Phase",
+		(ArithPointer)&marker.phase - (ArithPointer)&marker,
+		Variable_DataType_Int );
+	Swarm_NewScalarVariable(
+		contextExt->swarm,
+		"PlasticStrain",
+		(ArithPointer)&marker.plasticStrain - (ArithPointer)&marker,
+		Variable_DataType_Double );
+	
+	Stg_Component_Build( contextExt->swarm, context, False );
+}
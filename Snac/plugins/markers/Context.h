@@ -0,0 +1,58 @@
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+**
+** Copyright (C), 2003,
+**	Steve Quenette, 110 Victoria Street, Melbourne, Victoria, 3053, Australia.
+**	Californian Institute of Technology, 1200 East California Boulevard, Pasadena, California, 91125, USA.
+**	University of Texas, 1 University Station, Austin, Texas, 78712, USA.
+**
+** Authors:
+**	Stevan M. Quenette, Senior Software Engineer, VPAC. (steve@vpac.org)
+**	Stevan M. Quenette, Visitor in Geophysics, Caltech.
+**	Luc Lavier, Research Scientist, The University of Texas. (luc@utig.ug.utexas.edu)
+**	Luc Lavier, Research Scientist, Caltech.
+**
+** This program is free software; you can redistribute it and/or modify it
+** under the terms of the GNU General Public License as published by the
+** Free Software Foundation; either version 2, or (at your option) any
+** later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program; if not, write to the Free Software
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+**
+** $Id: Context.h $
+**
+**~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#ifndef __SnacMarkers_Context_h__
+#define __SnacMarkers_Context_h__
+	
+	/* Context Information */
+	struct _SnacMarkers_Context {
+		ElementCellLayout*		cellLayout;
+		RandomParticleLayout*		particleLayout;
+		Swarm*				swarm;
+		ExtensionManager_Register*	extensionMgr_Register;
+		Particle_InCellIndex		markersPerElement;
+		
+		/* Per-phase marker counts for the element majority vote, left zeroed between votes */
+		Material_Index			phaseCount;
+		Particle_InCellIndex*		phaseVotes;
+		
+		/* Where the element history lives: the plastic rheology's element extension, if one is loaded */
+		ExtensionInfo_Index		plasticHandle;
+		ExtensionInfo_Index		viscoPlasticHandle;
+		
+		/* The remesher's context extension, and its remesh count when the markers were last relocated */
+		ExtensionInfo_Index		remesherHandle;
+		Index				remeshingCount;
+		
+		Stream*				info;
+	};
+	
+#endif /* __SnacMarkers_Context_h__ */
@@ -0,0 +1,123 @@
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+**
+** Copyright (C), 2003,
+**	Steve Quenette, 110 Victoria Street, Melbourne, Victoria, 3053, Australia.
+**	Californian Institute of Technology, 1200 East California Boulevard, Pasadena, California, 91125, USA.
+**	University of Texas, 1 University Station, Austin, Texas, 78712, USA.
+**
+** Authors:
+**	Stevan M. Quenette, Senior Software Engineer, VPAC. (steve@vpac.org)
+**	Stevan M. Quenette, Visitor in Geophysics, Caltech.
+**	Luc Lavier, Research Scientist, The University of Texas. (luc@utig.ug.utexas.edu)
+**	Luc Lavier, Research Scientist, Caltech.
+**
+** This program is free software; you can redistribute it and/or modify it
+** under the terms of the GNU General Public License as published by the
+** Free Software Foundation; either version 2, or (at your option) any
+** later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program; if not, write to the Free Software
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+**
+** $Id: InitialConditions.c $
+**
+**~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#include <mpi.h>
+#include <StGermain/StGermain.h>
+#include <StGermain/FD/FD.h>
+#include "Snac/Snac.h"
+#include "Snac/Plastic/Plastic.h"
+#include "Snac/ViscoPlastic/ViscoPlastic.h"
+#include "Snac/Remesher/Remesher.h"
+#include "types.h"
+#include "Marker.h"
+#include "Context.h"
+#include "Register.h"
+#include "InitialConditions.h"
+#include <string.h>
+
+void _SnacMarkers_InitialConditions( void* _context, void* data ) {
+	Snac_Context*			context = (Snac_Context*)_context;
+	SnacMarkers_Context*		contextExt = ExtensionManager_Get(
+						context->extensionMgr,
+						context,
+						SnacMarkers_ContextHandle );
+	Swarm*				swarm = contextExt->swarm;
+	Particle_Index			lParticle_I;
+	
+	#ifdef DEBUG
+		printf( "In: %s()\n", __func__ );
+	#endif
+	
+	/* Seeds the markers, by the layout set up in _SnacMarkers_Build. */
+	Stg_Component_Initialise( swarm, context, False );
+	
+	for( lParticle_I = 0; lParticle_I < swarm->particleLocalCount; lParticle_I++ ) {
+		SnacMarkers_Marker*	marker = (SnacMarkers_Marker*)Swarm_ParticleAt( swarm, lParticle_I );
+		
+		marker->phase = Snac_Element_At( context, marker->owningCell )->material_I;
+		Journal_Firewall( marker->phase < contextExt->phaseCount, context->snacError, 
+			"Element material %u is not in the materials list.\n", marker->phase );
+		SnacMarkers_Sample( context, marker->owningCell, marker );
+	}
+	
+	if( contextExt->remesherHandle != (unsigned)-1 ) {
+		SnacRemesher_Context*	remesherExt = ExtensionManager_Get( 
+							context->extensionMgr, 
+							context, 
+							contextExt->remesherHandle );
+		
+		contextExt->remeshingCount = remesherExt->remeshingCount;
+	}
+}
+
+
+Strain* SnacMarkers_ElementPlasticStrain( void* _context, Element_LocalIndex element_lI, Strain** aps ) {
+	Snac_Context*			context = (Snac_Context*)_context;
+	SnacMarkers_Context*		contextExt = ExtensionManager_Get(
+						context->extensionMgr,
+						context,
+						SnacMarkers_ContextHandle );
+	Snac_Element*			element = Snac_Element_At( context, element_lI );
+	
+	if( contextExt->plasticHandle != (unsigned)-1 ) {
+		SnacPlastic_Element*	plasticElement = ExtensionManager_Get( 
+							context->mesh->elementExtensionMgr, 
+							element, 
+							contextExt->plasticHandle );
+		
+		if( aps )
+			*aps = &plasticElement->aps;
+		return plasticElement->plasticStrain;
+	}
+	if( contextExt->viscoPlasticHandle != (unsigned)-1 ) {
+		SnacViscoPlastic_Element*	viscoPlasticElement = ExtensionManager_Get( 
+							context->mesh->elementExtensionMgr, 
+							element, 
+							contextExt->viscoPlasticHandle );
+		
+		if( aps )
+			*aps = &viscoPlasticElement->aps;
+		return viscoPlasticElement->plasticStrain;
+	}
+	
+	return NULL;
+}
+
+
+void SnacMarkers_Sample( void* _context, Element_LocalIndex element_lI, SnacMarkers_Marker* marker ) {
+	Snac_Element_Tetrahedra*	tetra = &Snac_Element_At( (Snac_Context*)_context, element_lI )->tetra[marker->tetra];
+	Strain*				plasticStrain = SnacMarkers_ElementPlasticStrain( _context, element_lI, NULL );
+	
+	marker->plasticStrain = plasticStrain ? plasticStrain[marker->tetra] : 0.0;
+	memcpy( marker->strain, tetra->strain, sizeof(StrainTensor) );
+	memcpy( marker->stress, tetra->stress, sizeof(StressTensor) );
+	marker->density = tetra->density;
+}
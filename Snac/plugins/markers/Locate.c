@@ -0,0 +1,218 @@
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+**
+** Copyright (C), 2003,
+**	Steve Quenette, 110 Victoria Street, Melbourne, Victoria, 3053, Australia.
+**	Californian Institute of Technology, 1200 East California Boulevard, Pasadena, California, 91125, USA.
+**	University of Texas, 1 University Station, Austin, Texas, 78712, USA.
+**
+** Authors:
+**	Stevan M. Quenette, Senior Software Engineer, VPAC. (steve@vpac.org)
+**	Stevan M. Quenette, Visitor in Geophysics, Caltech.
+**	Luc Lavier, Research Scientist, The University of Texas. (luc@utig.ug.utexas.edu)
+**	Luc Lavier, Research Scientist, Caltech.
+**
+** This program is free software; you can redistribute it and/or modify it
+** under the terms of the GNU General Public License as published by the
+** Free Software Foundation; either version 2, or (at your option) any
+** later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program; if not, write to the Free Software
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+**
+** $Id: Locate.c $
+**
+**~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#include <mpi.h>
+#include <StGermain/StGermain.h>
+#include <StGermain/FD/FD.h>
+#include "Snac/Snac.h"
+#include "types.h"
+#include "Marker.h"
+#include "Locate.h"
+#include <math.h>
+#include <string.h>
+
+/* The first five tetrahedra of TetraToNode tile the element; the second five tile it again the other way. */
+#define SnacMarkers_TetraCount		5
+
+/* Barycentric weights this far below zero still count as inside, so points on a shared face are never lost. */
+static const double SnacMarkers_Tolerance = 1.0e-10;
+
+
+/* Six times the signed volume of a tetrahedron */
+static double _SnacMarkers_Volume( double* a, double* b, double* c, double* d ) {
+	double	ab[3], ac[3], ad[3];
+	int	i;
+
+	for( i = 0; i < 3; i++ ) {
+		ab[i] = b[i] - a[i];
+		ac[i] = c[i] - a[i];
+		ad[i] = d[i] - a[i];
+	}
+	return ab[0] * ( ac[1] * ad[2] - ac[2] * ad[1] ) - 
+		ab[1] * ( ac[0] * ad[2] - ac[2] * ad[0] ) + 
+		ab[2] * ( ac[0] * ad[1] - ac[1] * ad[0] );
+}
+
+
+Bool SnacMarkers_Locate( Mesh* mesh, Element_DomainIndex element_dI, Coord point, Tetrahedra_Index* tetra, 
+			 double* weights )
+{
+	Tetrahedra_Index	tetra_I;
+	Tetrahedra_Index	best_I = 0;
+	double			bestW[Tetrahedra_Point_Count] = { 0.25, 0.25, 0.25, 0.25 };
+	double			bestMin = -HUGE_VAL;
+	Index			point_I;
+
+	for( tetra_I = 0; tetra_I < SnacMarkers_TetraCount; tetra_I++ ) {
+		double*		crds[Tetrahedra_Point_Count];
+		double		w[Tetrahedra_Point_Count];
+		double		volume;
+		double		minW;
+
+		for( point_I = 0; point_I < Tetrahedra_Point_Count; point_I++ )
+			crds[point_I] = mesh->nodeCoord[mesh->elementNodeTbl[element_dI][TetraToNode[tetra_I][point_I]]];
+
+		volume = _SnacMarkers_Volume( crds[0], crds[1], crds[2], crds[3] );
+		if( volume == 0.0 )
+			continue;
+		w[0] = _SnacMarkers_Volume( point, crds[1], crds[2], crds[3] ) / volume;
+		w[1] = _SnacMarkers_Volume( crds[0], point, crds[2], crds[3] ) / volume;
+		w[2] = _SnacMarkers_Volume( crds[0], crds[1], point, crds[3] ) / volume;
+		w[3] = 1.0 - w[0] - w[1] - w[2];
+
+		minW = w[0];
+		for( point_I = 1; point_I < Tetrahedra_Point_Count; point_I++ )
+			if( w[point_I] < minW )
+				minW = w[point_I];
+		if( minW > bestMin ) {
+			bestMin = minW;
+			best_I = tetra_I;
+			memcpy( bestW, w, sizeof(w) );
+		}
+		if( minW >= -SnacMarkers_Tolerance )
+			break;
+	}
+
+	/* Outside the element, report the nearest tetrahedron with its weights clipped onto it. */
+	if( bestMin < -SnacMarkers_Tolerance ) {
+		double	sum = 0.0;
+
+		for( point_I = 0; point_I < Tetrahedra_Point_Count; point_I++ ) {
+			if( bestW[point_I] < 0.0 )
+				bestW[point_I] = 0.0;
+			sum += bestW[point_I];
+		}
+		for( point_I = 0; point_I < Tetrahedra_Point_Count; point_I++ )
+			bestW[point_I] = sum > 0.0 ? bestW[point_I] / sum : 0.25;
+	}
+	if( tetra )
+		*tetra = best_I;
+	if( weights )
+		memcpy( weights, bestW, sizeof(bestW) );
+
+	return bestMin >= -SnacMarkers_Tolerance;
+}
+
+
+void SnacMarkers_Place( Mesh* mesh, Element_LocalIndex element_lI, Particle_InCellIndex cParticle_I, 
+			SnacMarkers_Marker* marker )
+{
+	/* Tetrahedron 4 is the central one and holds a third of the volume, the four corner ones a sixth each. */
+	static const Tetrahedra_Index	slots[6] = { 0, 1, 2, 3, 4, 4 };
+	double				sum = 0.0;
+	Index				point_I;
+
+	/* Normalised exponential variates are uniformly distributed over the tetrahedron. */
+	marker->owningCell = element_lI;
+	marker->tetra = slots[cParticle_I % 6];
+	for( point_I = 0; point_I < Tetrahedra_Point_Count; point_I++ ) {
+		marker->weights[point_I] = -log( Swarm_Random_Random_WithMinMax( 0.0, 1.0 ) );
+		sum += marker->weights[point_I];
+	}
+	for( point_I = 0; point_I < Tetrahedra_Point_Count; point_I++ )
+		marker->weights[point_I] /= sum;
+
+	SnacMarkers_Position( mesh, marker );
+}
+
+
+void SnacMarkers_Position( Mesh* mesh, SnacMarkers_Marker* marker ) {
+	Element_NodeIndex*	elementNodes = mesh->elementNodeTbl[marker->owningCell];
+	Index			point_I;
+
+	marker->coord[0] = marker->coord[1] = marker->coord[2] = 0.0;
+	for( point_I = 0; point_I < Tetrahedra_Point_Count; point_I++ ) {
+		double*		crd = mesh->nodeCoord[elementNodes[TetraToNode[marker->tetra][point_I]]];
+
+		marker->coord[0] += marker->weights[point_I] * crd[0];
+		marker->coord[1] += marker->weights[point_I] * crd[1];
+		marker->coord[2] += marker->weights[point_I] * crd[2];
+	}
+}
+
+
+Cell_Index _SnacMarkers_CellOf( void* elementCellLayout, void* _particle ) {
+	ElementCellLayout*	self = (ElementCellLayout*)elementCellLayout;
+	Mesh*			mesh = self->mesh;
+	GlobalParticle*		particle = (GlobalParticle*)_particle;
+	Element_DomainIndex	hint = particle->owningCell;
+	Element_DomainIndex	element_dI;
+
+	/* Markers rarely move further than the elements sharing a node with their last one. */
+	if( hint < mesh->elementDomainCount ) {
+		Index		node_I;
+
+		if( SnacMarkers_Locate( mesh, hint, particle->coord, NULL, NULL ) )
+			return hint;
+
+		for( node_I = 0; node_I < mesh->elementNodeCountTbl[hint]; node_I++ ) {
+			Node_DomainIndex	node_dI = mesh->elementNodeTbl[hint][node_I];
+			Index			nodeElement_I;
+
+			for( nodeElement_I = 0; nodeElement_I < mesh->nodeElementCountTbl[node_dI]; nodeElement_I++ ) {
+				element_dI = mesh->nodeElementTbl[node_dI][nodeElement_I];
+				if( element_dI < mesh->elementDomainCount && element_dI != hint && 
+				    SnacMarkers_Locate( mesh, element_dI, particle->coord, NULL, NULL ) )
+				{
+					return element_dI;
+				}
+			}
+		}
+	}
+
+	/* Check the lot. */
+	for( element_dI = 0; element_dI < mesh->elementDomainCount; element_dI++ ) {
+		if( SnacMarkers_Locate( mesh, element_dI, particle->coord, NULL, NULL ) )
+			return element_dI;
+	}
+
+	return mesh->elementDomainCount;
+}
+
+
+Bool _SnacMarkers_IsInCell( void* elementCellLayout, Cell_Index cellIndex, void* _particle ) {
+	ElementCellLayout*	self = (ElementCellLayout*)elementCellLayout;
+	GlobalParticle*		particle = (GlobalParticle*)_particle;
+
+	return SnacMarkers_Locate( self->mesh, cellIndex, particle->coord, NULL, NULL );
+}
+
+
+void _SnacMarkers_InitialiseParticlesOfCell( void* particleLayout, void* _swarm, Cell_Index cell_I ) {
+	Swarm*			swarm = (Swarm*)_swarm;
+	Mesh*			mesh = ((ElementCellLayout*)swarm->cellLayout)->mesh;
+	Particle_InCellIndex	cParticle_I;
+
+	for( cParticle_I = 0; cParticle_I < swarm->cellParticleCountTbl[cell_I]; cParticle_I++ ) {
+		SnacMarkers_Place( mesh, cell_I, cParticle_I, 
+				   (SnacMarkers_Marker*)Swarm_ParticleInCellAt( swarm, cell_I, cParticle_I ) );
+	}
+}
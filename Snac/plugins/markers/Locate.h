@@ -0,0 +1,55 @@
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+**
+** Copyright (C), 2003,
+**	Steve Quenette, 110 Victoria Street, Melbourne, Victoria, 3053, Australia.
+**	Californian Institute of Technology, 1200 East California Boulevard, Pasadena, California, 91125, USA.
+**	University of Texas, 1 University Station, Austin, Texas, 78712, USA.
+**
+** Authors:
+**	Stevan M. Quenette, Senior Software Engineer, VPAC. (steve@vpac.org)
+**	Stevan M. Quenette, Visitor in Geophysics, Caltech.
+**	Luc Lavier, Research Scientist, The University of Texas. (luc@utig.ug.utexas.edu)
+**	Luc Lavier, Research Scientist, Caltech.
+**
+** This program is free software; you can redistribute it and/or modify it
+** under the terms of the GNU General Public License as published by the
+** Free Software Foundation; either version 2, or (at your option) any
+** later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program; if not, write to the Free Software
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+**
+** $Id: Locate.h $
+**
+**~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#ifndef __SnacMarkers_Locate_h__
+#define __SnacMarkers_Locate_h__
+	
+	/* Find which of the five tetrahedra tiling a domain element holds the point, and the point's barycentric
+	   weights in it. Either output may be NULL. Returns False if the element does not hold the point. */
+	Bool SnacMarkers_Locate( Mesh* mesh, Element_DomainIndex element_dI, Coord point, Tetrahedra_Index* tetra, 
+				 double* weights );
+	
+	/* Place a marker at a random point of an element, choosing the tetrahedron in proportion to its volume */
+	void SnacMarkers_Place( Mesh* mesh, Element_LocalIndex element_lI, Particle_InCellIndex cParticle_I, 
+				SnacMarkers_Marker* marker );
+	
+	/* Position of a marker from its tetrahedron and weights in the current mesh */
+	void SnacMarkers_Position( Mesh* mesh, SnacMarkers_Marker* marker );
+	
+	/* Cell layout overrides: locate markers in the deformed mesh, starting from the owning element and its
+	   node-sharing neighbours, rather than in the undeformed block the element layout assumes */
+	Cell_Index _SnacMarkers_CellOf( void* elementCellLayout, void* _particle );
+	Bool _SnacMarkers_IsInCell( void* elementCellLayout, Cell_Index cellIndex, void* _particle );
+	
+	/* Particle layout override: seed each element by SnacMarkers_Place */
+	void _SnacMarkers_InitialiseParticlesOfCell( void* particleLayout, void* _swarm, Cell_Index cell_I );
+	
+#endif /* __SnacMarkers_Locate_h__ */
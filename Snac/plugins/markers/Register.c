@@ -0,0 +1,128 @@
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+**
+** Copyright (C), 2003,
+**	Steve Quenette, 110 Victoria Street, Melbourne, Victoria, 3053, Australia.
+**	Californian Institute of Technology, 1200 East California Boulevard, Pasadena, California, 91125, USA.
+**	University of Texas, 1 University Station, Austin, Texas, 78712, USA.
+**
+** Authors:
+**	Stevan M. Quenette, Senior Software Engineer, VPAC. (steve@vpac.org)
+**	Stevan M. Quenette, Visitor in Geophysics, Caltech.
+**	Luc Lavier, Research Scientist, The University of Texas. (luc@utig.ug.utexas.edu)
+**	Luc Lavier, Research Scientist, Caltech.
+**
+** This program is free software; you can redistribute it and/or modify it
+** under the terms of the GNU General Public License as published by the
+** Free Software Foundation; either version 2, or (at your option) any
+** later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program; if not, write to the Free Software
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+**
+** $Id: Register.c $
+**
+**~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#include <mpi.h>
+#include <StGermain/StGermain.h>
+#include <StGermain/FD/FD.h>
+#include "Snac/Snac.h"
+#include "types.h"
+#include "Marker.h"
+#include "Context.h"
+#include "Build.h"
+#include "InitialConditions.h"
+#include "Advect.h"
+#include "Remesh.h"
+#include "DeleteExtensions.h"
+#include "Register.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Textual name of this class */
+const Type SnacMarkers_Type = "SnacMarkers";
+
+ExtensionInfo_Index SnacMarkers_ContextHandle;
+
+
+Index _SnacMarkers_Register( PluginsManager* pluginsMgr ) {
+	return PluginsManager_Submit( pluginsMgr, 
+				      SnacMarkers_Type, 
+				      "0", 
+				      _SnacMarkers_DefaultNew );
+}
+
+
+void* _SnacMarkers_DefaultNew( Name name ) {
+	return _Codelet_New( sizeof(Codelet), 
+			     SnacMarkers_Type, 
+			     _Codelet_Delete, 
+			     _Codelet_Print, 
+			     _Codelet_Copy, 
+			     _SnacMarkers_DefaultNew, 
+			     _SnacMarkers_Construct, 
+			     _Codelet_Build, 
+			     _Codelet_Initialise, 
+			     _Codelet_Execute, 
+			     _Codelet_Destroy, 
+			     name );
+}
+
+
+void _SnacMarkers_Construct( void* component, Stg_ComponentFactory* cf, void* data ) {
+	Snac_Context*		context;
+	SnacMarkers_Context*	contextExt;
+
+	/* Retrieve context. */
+	context = (Snac_Context*)Stg_ComponentFactory_ConstructByName( cf, "context", Snac_Context, True, data ); 
+
+	#ifdef DEBUG
+		printf( "In: %s()\n", __func__ );
+	#endif
+
+	/* Add extensions to the context */
+	SnacMarkers_ContextHandle = ExtensionManager_Add( context->extensionMgr, SnacMarkers_Type, sizeof(SnacMarkers_Context) );
+
+	/* Add extensions to the entry points. The sync hook must follow the remesher's, so list SnacMarkers after 
+	   SnacRemesher in the extensions. */
+	EntryPoint_Append(
+		Context_GetEntryPoint( context, AbstractContext_EP_Build ),
+		SnacMarkers_Type,
+		_SnacMarkers_Build,
+		SnacMarkers_Type );
+	EntryPoint_Append(
+		Context_GetEntryPoint( context, AbstractContext_EP_Initialise ),
+		SnacMarkers_Type,
+		_SnacMarkers_InitialConditions,
+		SnacMarkers_Type );
+	EntryPoint_Append(
+		Context_GetEntryPoint( context, Snac_EP_LoopNodesMomentum ),
+		SnacMarkers_Type,
+		_SnacMarkers_Advect,
+		SnacMarkers_Type );
+	EntryPoint_Append(
+		Context_GetEntryPoint( context, AbstractContext_EP_Sync ),
+		SnacMarkers_Type,
+		_SnacMarkers_Remesh,
+		SnacMarkers_Type );
+	EntryPoint_Append(
+		Context_GetEntryPoint( context, AbstractContext_EP_DestroyExtensions ),
+		SnacMarkers_Type,
+		_SnacMarkers_DeleteExtensions,
+		SnacMarkers_Type );
+
+	/* Construct. */
+	contextExt = ExtensionManager_Get( context->extensionMgr, context, SnacMarkers_ContextHandle );
+	memset( contextExt, 0, sizeof(SnacMarkers_Context) );
+	contextExt->markersPerElement = Dictionary_GetUnsignedInt_WithDefault( context->dictionary, "markersPerElement", 8 );
+	contextExt->plasticHandle = (unsigned)-1;
+	contextExt->viscoPlasticHandle = (unsigned)-1;
+	contextExt->remesherHandle = (unsigned)-1;
+	contextExt->info = Journal_Register( Info_Type, SnacMarkers_Type );
+}
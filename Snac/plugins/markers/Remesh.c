@@ -0,0 +1,171 @@
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+**
+** Copyright (C), 2003,
+**	Steve Quenette, 110 Victoria Street, Melbourne, Victoria, 3053, Australia.
+**	Californian Institute of Technology, 1200 East California Boulevard, Pasadena, California, 91125, USA.
+**	University of Texas, 1 University Station, Austin, Texas, 78712, USA.
+**
+** Authors:
+**	Stevan M. Quenette, Senior Software Engineer, VPAC. (steve@vpac.org)
+**	Stevan M. Quenette, Visitor in Geophysics, Caltech.
+**	Luc Lavier, Research Scientist, The University of Texas. (luc@utig.ug.utexas.edu)
+**	Luc Lavier, Research Scientist, Caltech.
+**
+** This program is free software; you can redistribute it and/or modify it
+** under the terms of the GNU General Public License as published by the
+** Free Software Foundation; either version 2, or (at your option) any
+** later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program; if not, write to the Free Software
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+**
+** $Id: Remesh.c $
+**
+**~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#include <mpi.h>
+#include <StGermain/StGermain.h>
+#include <StGermain/FD/FD.h>
+#include "Snac/Snac.h"
+#include "Snac/Remesher/Remesher.h"
+#include "types.h"
+#include "Marker.h"
+#include "Context.h"
+#include "Locate.h"
+#include "InitialConditions.h"
+#include "Register.h"
+#include "Remesh.h"
+#include <string.h>
+
+void _SnacMarkers_Remesh( void* _context, void* data ) {
+	Snac_Context*			context = (Snac_Context*)_context;
+	SnacMarkers_Context*		contextExt = ExtensionManager_Get(
+						context->extensionMgr,
+						context,
+						SnacMarkers_ContextHandle );
+	Mesh*				mesh = context->mesh;
+	Swarm*				swarm = contextExt->swarm;
+	SnacRemesher_Context*		remesherExt;
+	Particle_Index			lParticle_I;
+	Element_LocalIndex		element_lI;
+	Index				reseedCount = 0;
+	
+	if( contextExt->remesherHandle == (unsigned)-1 )
+		return;
+	remesherExt = ExtensionManager_Get( context->extensionMgr, context, contextExt->remesherHandle );
+	if( remesherExt->remeshingCount == contextExt->remeshingCount )
+		return;
+	contextExt->remeshingCount = remesherExt->remeshingCount;
+	
+	#ifdef DEBUG
+		printf( "In: %s()\n", __func__ );
+	#endif
+	
+	/* The markers kept their positions through the remesh: find their new elements, handing any that left the 
+	   local elements to the processor now holding them, and their new weights. Remeshing pulls the boundary back 
+	   to where it started, so first snap the markers it stranded outside the mesh onto their element. The element 
+	   arrays still hold the values from before the remesh, so take those along too. */
+	for( lParticle_I = 0; lParticle_I < swarm->particleLocalCount; lParticle_I++ ) {
+		SnacMarkers_Marker*	marker = (SnacMarkers_Marker*)Swarm_ParticleAt( swarm, lParticle_I );
+		
+		SnacMarkers_Sample( context, marker->owningCell, marker );
+		if( CellLayout_CellOf( swarm->cellLayout, marker ) == mesh->elementDomainCount ) {
+			SnacMarkers_Locate( mesh, marker->owningCell, marker->coord, &marker->tetra, marker->weights );
+			SnacMarkers_Position( mesh, marker );
+		}
+	}
+	Swarm_UpdateAllParticleOwners( swarm );
+	for( lParticle_I = 0; lParticle_I < swarm->particleLocalCount; lParticle_I++ ) {
+		SnacMarkers_Marker*	marker = (SnacMarkers_Marker*)Swarm_ParticleAt( swarm, lParticle_I );
+		
+		SnacMarkers_Locate( mesh, marker->owningCell, marker->coord, &marker->tetra, marker->weights );
+	}
+	
+	/* Re-project per element: the majority phase and the mean history of its markers. Elements left without 
+	   markers keep the values their index held before the remesh, and are seeded afresh from them. */
+	for( element_lI = 0; element_lI < mesh->elementLocalCount; element_lI++ ) {
+		Snac_Element*		element = Snac_Element_At( context, element_lI );
+		Particle_InCellIndex	count = swarm->cellParticleCountTbl[element_lI];
+		Strain*			aps;
+		Strain*			plasticStrain = SnacMarkers_ElementPlasticStrain( context, element_lI, &aps );
+		Particle_InCellIndex	cParticle_I;
+		
+		if( count == 0 ) {
+			for( cParticle_I = 0; cParticle_I < contextExt->markersPerElement; cParticle_I++ ) {
+				SnacMarkers_Marker*	marker;
+				Particle_Index		newParticle_I;
+				
+				marker = (SnacMarkers_Marker*)Swarm_CreateNewParticle( swarm, &newParticle_I );
+				SnacMarkers_Place( mesh, element_lI, cParticle_I, marker );
+				Swarm_AddParticleToCell( swarm, element_lI, newParticle_I );
+				marker->phase = element->material_I;
+				SnacMarkers_Sample( context, element_lI, marker );
+			}
+			reseedCount++;
+		}
+		else {
+			Material_Index		phase = element->material_I;
+			Particle_InCellIndex	phaseVotes = 0;
+			Strain			meanPlasticStrain = 0.0;
+			StrainTensor		meanStrain;
+			StressTensor		meanStress;
+			Density			meanDensity = 0.0;
+			Tetrahedra_Index	tetra_I;
+			Index			i, j;
+			
+			memset( meanStrain, 0, sizeof(StrainTensor) );
+			memset( meanStress, 0, sizeof(StressTensor) );
+			for( cParticle_I = 0; cParticle_I < count; cParticle_I++ ) {
+				SnacMarkers_Marker*	marker = (SnacMarkers_Marker*)Swarm_ParticleInCellAt( 
+								swarm, element_lI, cParticle_I );
+				
+				contextExt->phaseVotes[marker->phase]++;
+				meanPlasticStrain += marker->plasticStrain / count;
+				for( i = 0; i < 3; i++ ) {
+					for( j = 0; j < 3; j++ ) {
+						meanStrain[i][j] += marker->strain[i][j] / count;
+						meanStress[i][j] += marker->stress[i][j] / count;
+					}
+				}
+				meanDensity += marker->density / count;
+			}
+			
+			/* The first marker, in cell order, of a phase with the most votes wins; then clear the counts. */
+			for( cParticle_I = 0; cParticle_I < count; cParticle_I++ ) {
+				SnacMarkers_Marker*	marker = (SnacMarkers_Marker*)Swarm_ParticleInCellAt( 
+								swarm, element_lI, cParticle_I );
+				
+				if( contextExt->phaseVotes[marker->phase] > phaseVotes ) {
+					phase = marker->phase;
+					phaseVotes = contextExt->phaseVotes[marker->phase];
+				}
+			}
+			for( cParticle_I = 0; cParticle_I < count; cParticle_I++ ) {
+				contextExt->phaseVotes[((SnacMarkers_Marker*)Swarm_ParticleInCellAt( 
+					swarm, element_lI, cParticle_I ))->phase] = 0;
+			}
+			
+			element->material_I = phase;
+			for( tetra_I = 0; tetra_I < Tetrahedra_Count; tetra_I++ ) {
+				memcpy( element->tetra[tetra_I].strain, meanStrain, sizeof(StrainTensor) );
+				memcpy( element->tetra[tetra_I].stress, meanStress, sizeof(StressTensor) );
+				element->tetra[tetra_I].density = meanDensity;
+				element->tetra[tetra_I].material_I = phase;
+			}
+			if( plasticStrain ) {
+				for( tetra_I = 0; tetra_I < Tetrahedra_Count; tetra_I++ )
+					plasticStrain[tetra_I] = meanPlasticStrain;
+				*aps = meanPlasticStrain;
+			}
+		}
+	}
+	
+	Journal_Printf( contextExt->info, "Markers: %u local, %u elements re-seeded\n", 
+			swarm->particleLocalCount, reseedCount );
+}
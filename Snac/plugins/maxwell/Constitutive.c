@@ -44,28 +44,92 @@
 
 #include <assert.h>
 
-void _SnacMaxwell_Constitutive( void* _context, Element_LocalIndex element_lI ) {
+void _SnacMaxwell_UpdateTemperatures( void* _context ) {
 	Snac_Context*			context = (Snac_Context*)_context;
+	ExtensionView			nodeView;
+	Element_LocalIndex		element_lI;
+
+	/* Without the temperature plugin's energy loop the viscosity is the reference one. */
+	if( !Context_GetEntryPoint( context, "Snac_EP_LoopElementsEnergy" ) )
+		return;
+
+	nodeView = Snac_Node_ExtensionView( context, SnacTemperature_NodeHandle );
+	for( element_lI = 0; element_lI < context->mesh->elementLocalCount; element_lI++ ) {
+		Snac_Element*			element = Snac_Element_At( context, element_lI );
+		SnacMaxwell_Element*		elementExt = ExtensionManager_Get(
+							context->mesh->elementExtensionMgr,
+							element,
+							SnacMaxwell_ElementHandle );
+		Tetrahedra_Index		tetra_I;
+
+		if( !( context->materialProperty[element->material_I].rheology & Snac_Material_Maxwell ) )
+			continue;
+
+		/* Not tetra->avgTemp: the temperature plugin takes that before reapplying its boundary conditions. */
+		for( tetra_I = 0; tetra_I < Tetrahedra_Count; tetra_I++ ) {
+			Node_LocalIndex			node_lI;
+
+			elementExt->temperature[tetra_I] = 0.0;
+			for( node_lI = 0; node_lI < 4; node_lI++ ) {
+				SnacTemperature_Node*		temperatureNodeExt = ExtensionView_At( nodeView, 
+					Snac_Element_Node_I( context, element_lI, TetraToNode[tetra_I][node_lI] ) );
+
+				elementExt->temperature[tetra_I] += 0.25 * temperatureNodeExt->temperature;
+			}
+			assert( !isnan(elementExt->temperature[tetra_I]) && !isinf(elementExt->temperature[tetra_I]) );
+		}
+	}
+}
+
+
+static void _SnacMaxwell_Constitutive_Element(
+		Snac_Context*			context,
+		Element_LocalIndex		element_lI,
+		SnacMaxwell_Element*		elementExt,
+		SnacTemperature_Element*	temperatureElement,
+		EntryPoint*			temperatureEP )
+{
 	Snac_Element*			element = Snac_Element_At( context, element_lI );
-	SnacMaxwell_Element*		elementExt = ExtensionManager_Get(
-						context->mesh->elementExtensionMgr,
-						element,
-						SnacMaxwell_ElementHandle );
-	SnacTemperature_Element* temperatureElement = ExtensionManager_Get(
-						context->mesh->elementExtensionMgr,
-						element,
-						SnacTemperature_ElementHandle );
 	const Snac_Material*		material = &context->materialProperty[element->material_I];
 
-	EntryPoint* 			temperatureEP;
-	temperatureEP = Context_GetEntryPoint( context,	"Snac_EP_LoopElementsEnergy" );
-
 	/* If this is a Maxwell material, calculate its stress. */
 	if( material->rheology & Snac_Material_Maxwell ) {
 		Tetrahedra_Index		tetra_I;
+		const double			bulkm = material->lambda + 2.0f * material->mu/3.0f;
+		const double			rmu = material->mu;
+		double				srJ2[Tetrahedra_Count];
+
+		/* Viscosity of every tetrahedra, from its strain rate and the mean temperature of its nodes ( Hall et. al., 
+		   EPSL, 2003 ), as _SnacMaxwell_UpdateTemperatures took it for this step. */
+		if( temperatureEP ) {
+			for( tetra_I = 0; tetra_I < Tetrahedra_Count; tetra_I++ ) {
+				StrainTensor*			strain = &element->tetra[tetra_I].strain;
+				double				trace_strain;
+				double				straind0,straind1,straind2;
+
+				trace_strain = element->tetra[tetra_I].volume/element->tetra[tetra_I].old_volume-1.0f;
+				straind0 =  (*strain)[0][0] -  (trace_strain) / 3.0f;
+				straind1 =  (*strain)[1][1] -  (trace_strain) / 3.0f;
+				straind2 =  (*strain)[2][2] -  (trace_strain) / 3.0f;
+
+				srJ2[tetra_I] = sqrt(fabs(straind1*straind2+straind2*straind0+straind0*straind1 -(*strain)[0][1]*(*strain)[0][1]-(*strain)[0][2]*(*strain)[0][2]-(*strain)[1][2]*(*strain)[1][2]))/context->dt;
+				if(srJ2[tetra_I] == 0.0f) srJ2[tetra_I] = material->refsrate; // temporary. should be vmax/length_scale
+			}
+			Snac_Rheology_Viscosity( material, Tetrahedra_Count, srJ2, elementExt->temperature, elementExt->viscosity );
+			for( tetra_I = 0; tetra_I < Tetrahedra_Count; tetra_I++ ) {
+				if( isnan(elementExt->viscosity[tetra_I]) || isinf(elementExt->viscosity[tetra_I]) ) {
+					fprintf(stderr,"rvisc=%e Erattio=%e T=%e viscosity=%e\n",
+						material->refvisc,(srJ2[tetra_I]/material->refsrate),elementExt->temperature[tetra_I],elementExt->viscosity[tetra_I] );
+				}
+				assert(!isnan(elementExt->viscosity[tetra_I]) && !isinf(elementExt->viscosity[tetra_I]));
+			}
+		}
+		else {
+			for( tetra_I = 0; tetra_I < Tetrahedra_Count; tetra_I++ )
+				elementExt->viscosity[tetra_I] = material->refvisc;
+		}
 
 		for( tetra_I = 0; tetra_I < Tetrahedra_Count; tetra_I++ ) {
-			const double			bulkm = material->lambda + 2.0f * material->mu/3.0f;
 			StressTensor*			stress = &element->tetra[tetra_I].stress;
 			StrainTensor*			strain = &element->tetra[tetra_I].strain;
 			Maxwell*			viscosity = &elementExt->viscosity[tetra_I];
@@ -76,33 +140,7 @@ void _SnacMaxwell_Constitutive( void* _context, Element_LocalIndex element_lI )
 			double				vic1;
 			double				vic2;
 			double				VolumicStress;
-			double				rviscosity=material->refvisc;
-                        double                          rmu= material->mu;
-			double				srJ2;
-			double				avgTemp;
 
-			Node_LocalIndex			node_lI;
-			/* For now reference values of viscosity, second invariant of deviatoric */
-			/* strain rate and reference temperature  are being hard wired ( these specific */
-			/* values are from paper by Hall et. al., EPSL, 2003 */
-			double				rstrainrate = material->refsrate;
-			double				rTemp = material->reftemp;
-			double				H = material->activationE; // kJ/mol
-			double				srexponent = material->srexponent;
-			const double			R=8.31448;  // J/mol/K
-#if 0
-			double				a2 = material->lambda;
-			double				sh2 = 2.0 * material->mu;
-			double				s00,s11,s22,s01,s02,s12;
-
-			/*	elastic update */
-		/* 	s00=(*stress)[0][0] + sh2 * (*strain)[0][0] + a2 * (trace_strain ); */
-/*  			s11=(*stress)[1][1] + sh2 * (*strain)[1][1] + a2 * (trace_strain ); */
-/* 			s22=(*stress)[2][2] + sh2 * (*strain)[2][2] + a2 * (trace_strain ); */
-/* 			s01=(*stress)[0][1] + sh2 * (*strain)[0][1]; */
-/* 			s02=(*stress)[0][2] + sh2 * (*strain)[0][2]; */
-/* 			s12=(*stress)[1][2] + sh2 * (*strain)[1][2]; */
-#endif
 			if( context->computeThermalStress ) {
 				(*stress)[0][0] += temperatureElement->thermalStress[tetra_I];
 				(*stress)[1][1] += temperatureElement->thermalStress[tetra_I];
@@ -120,46 +158,12 @@ void _SnacMaxwell_Constitutive( void* _context, Element_LocalIndex element_lI )
 			stressd0 =  (*stress)[0][0] -  (trace_stress) / 3.0f;
 			stressd1 =  (*stress)[1][1] -  (trace_stress) / 3.0f;
 			stressd2 =  (*stress)[2][2] -  (trace_stress) / 3.0f;
-			if( temperatureEP ) {
-				srJ2 = sqrt(fabs(straind1*straind2+straind2*straind0+straind0*straind1 -(*strain)[0][1]*(*strain)[0][1]-(*strain)[0][2]*(*strain)[0][2]-(*strain)[1][2]*(*strain)[1][2]))/context->dt;
-				if(srJ2 == 0.0f) srJ2 = rstrainrate; // temporary. should be vmax/length_scale
-
-				avgTemp=0.0;
-				for(node_lI=0; node_lI<4; node_lI++) {
-					Snac_Node* contributingNode = Snac_Element_Node_P( context, element_lI, TetraToNode[tetra_I][node_lI] );
-					SnacTemperature_Node* temperatureNodeExt = ExtensionManager_Get(
-												 context->mesh->nodeExtensionMgr,contributingNode,
-												 SnacTemperature_NodeHandle );
-
-					avgTemp += 0.25 * temperatureNodeExt->temperature;
-					assert( !isnan(avgTemp) && !isinf(avgTemp) );
-				}
-
-				(*viscosity)= rviscosity*pow((srJ2/rstrainrate),(1./srexponent-1.))
-					*exp(H/R*(1./(avgTemp+273.15)-1./(rTemp+273.15)));
-				if((*viscosity) < material->vis_min) (*viscosity) = material->vis_min;
-				if((*viscosity) > material->vis_max) (*viscosity) = material->vis_max;
-
-				if( isnan((*viscosity)) || isinf((*viscosity))) {
-					fprintf(stderr,"rvisc=%e Erattio=%e pow(E)=%e, dT=%e exp=%e\n",
-						rviscosity,(srJ2/rstrainrate),pow((srJ2/rstrainrate),(1./srexponent-1.)),
-						exp(H/R*(1./(avgTemp+273.15)-1./(rTemp+273.15))),(1./(avgTemp+273.15)-1./(rTemp+273.15)) );
-				}
-				assert(!isnan((*viscosity)) && !isinf((*viscosity)));
-			}
-			else
-				(*viscosity) = rviscosity;
-			assert(!isnan((*viscosity)) && !isinf((*viscosity)));
 
-                       /*   *viscosity=material->refvisc; */
 			/* Non dimensional parameters elastic/viscous */
 			temp = rmu / (2.0f* (*viscosity)) * context->dt;
 
-
 			vic1 = 1.0f - temp;
 			vic2 = 1.0f / (1.0f + temp);
-                       /*   printf("temp=%g\t rmu=%g\t viscosity=%g\t\n",temp,rmu,*viscosity); */
-/*                          printf("trace_stress=%g\t trace_strain=%g\t vic1=%g\t vic2=%g\n",trace_stress,trace_strain,vic1,vic2); */
 
 			/* Deviatoric Stress Update */
 
@@ -182,3 +186,33 @@ void _SnacMaxwell_Constitutive( void* _context, Element_LocalIndex element_lI )
 		}
 	}
 }
+
+
+void _SnacMaxwell_Constitutive( void* _context, Element_LocalIndex element_lI ) {
+	Snac_Context*			context = (Snac_Context*)_context;
+	Snac_Element*			element = Snac_Element_At( context, element_lI );
+
+	_SnacMaxwell_Constitutive_Element( context, element_lI,
+		ExtensionManager_Get( context->mesh->elementExtensionMgr, element, SnacMaxwell_ElementHandle ),
+		ExtensionManager_Get( context->mesh->elementExtensionMgr, element, SnacTemperature_ElementHandle ),
+		Context_GetEntryPoint( context, "Snac_EP_LoopElementsEnergy" ) );
+}
+
+
+void _SnacMaxwell_Constitutive_Range( void* _context, Element_LocalIndex begin, Element_LocalIndex end ) {
+	Snac_Context*			context = (Snac_Context*)_context;
+	ExtensionView			maxwellView = Snac_Element_ExtensionView( context, SnacMaxwell_ElementHandle );
+	EntryPoint*			temperatureEP = Context_GetEntryPoint( context, "Snac_EP_LoopElementsEnergy" );
+	ExtensionView			temperatureView;
+	Element_LocalIndex		element_lI;
+
+	/* The temperature extension is only read for the thermal stress */
+	if( context->computeThermalStress )
+		temperatureView = Snac_Element_ExtensionView( context, SnacTemperature_ElementHandle );
+	for( element_lI = begin; element_lI < end; element_lI++ ) {
+		_SnacMaxwell_Constitutive_Element( context, element_lI,
+			(SnacMaxwell_Element*)ExtensionView_At( maxwellView, element_lI ),
+			context->computeThermalStress ? (SnacTemperature_Element*)ExtensionView_At( temperatureView, element_lI ) : NULL,
+			temperatureEP );
+	}
+}
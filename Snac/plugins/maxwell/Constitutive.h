@@ -40,6 +40,10 @@
 #ifndef __SnacMaxwell_Constitutive_h__
 #define __SnacMaxwell_Constitutive_h__
 	
+	/* Before the stresses: average the node temperatures of each Maxwell tetrahedra, once per step */
+	void _SnacMaxwell_UpdateTemperatures( void* _context );
+	
 	void _SnacMaxwell_Constitutive( void* _context, Element_LocalIndex element_lI );
+	void _SnacMaxwell_Constitutive_Range( void* _context, Element_LocalIndex begin, Element_LocalIndex end );
 	
 #endif /* __SnacMaxwell_Constitutive_h__ */
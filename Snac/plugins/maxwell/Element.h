@@ -43,6 +43,8 @@
 	/* Element Information */
 	struct _SnacMaxwell_Element {
 		double						viscosity[Tetrahedra_Count];
+		/* Mean temperature of each tetrahedra's nodes, taken before the stresses of each step */
+		double						temperature[Tetrahedra_Count];
 	};
 
 	/* Print the contents of an Element */
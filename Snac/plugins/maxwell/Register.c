@@ -113,10 +113,15 @@ void _SnacMaxwell_Construct( void* component, Stg_ComponentFactory* cf, void* da
 		SnacMaxwell_Type,
 		_SnacMaxwell_InitialConditions,
 		SnacMaxwell_Type );
-	EntryPoint_Append(
+	EntryPoint_Prepend( /* the temperatures must be this step's before any stresses are calculated */
+		Context_GetEntryPoint( context, Snac_EP_CalcStresses ),
+		"SnacMaxwell_UpdateTemperatures",
+		_SnacMaxwell_UpdateTemperatures,
+		SnacMaxwell_Type );
+	Snac_EntryPoint_AppendRangeHook(
 		Context_GetEntryPoint( context, Snac_EP_Constitutive ),
 		SnacMaxwell_Type,
-		_SnacMaxwell_Constitutive,
+		_SnacMaxwell_Constitutive_Range,
 		SnacMaxwell_Type );
 	EntryPoint_Append(
 		Context_GetEntryPoint( context, AbstractContext_EP_DestroyExtensions ),
@@ -0,0 +1,373 @@
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+**
+** Copyright (C), 2003, 
+**	Steve Quenette, 110 Victoria Street, Melbourne, Victoria, 3053, Australia.
+**	Californian Institute of Technology, 1200 East California Boulevard, Pasadena, California, 91125, USA.
+**	University of Texas, 1 University Station, Austin, Texas, 78712, USA.
+**
+** Authors:
+**	Stevan M. Quenette, Senior Software Engineer, VPAC. (steve@vpac.org)
+**	Stevan M. Quenette, Visitor in Geophysics, Caltech.
+**	Luc Lavier, Research Scientist, The University of Texas. (luc@utig.ug.utexas.edu)
+**	Luc Lavier, Research Scientist, Caltech.
+**
+** This program is free software; you can redistribute it and/or modify it
+** under the terms of the GNU General Public License as published by the
+** Free Software Foundation; either version 2, or (at your option) any
+** later version.
+** 
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+** 
+** You should have received a copy of the GNU General Public License
+** along with this program; if not, write to the Free Software
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+**
+** Role:
+**	Tests the SnacMaxwell plugin's constitutive hook against the per-tetrahedra evaluation it replaced (copied below
+**	as it was), on a 4x4x4 element mesh with varied strains and node temperatures. Given "--repeats=N" it also times
+**	both over the whole mesh.
+**
+** $Id$
+**
+**~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#include <mpi.h>
+#include <StGermain/StGermain.h>
+#include <StGermain/FD/FD.h>
+#include "Snac/Snac.h"
+#include "Snac/Temperature/Temperature.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <assert.h>
+
+#define TOL		1.0e-12
+
+struct _Node {
+	struct { __Snac_Node };
+};
+
+struct _Element {
+	struct { __Snac_Element };
+};
+
+ExtensionInfo_Index			temperatureNodeHandle;
+ExtensionInfo_Index			temperatureElementHandle;
+ExtensionInfo_Index			maxwellElementHandle;
+
+/* _SnacMaxwell_Constitutive as it was before it evaluated the viscosities per element through Snac_Rheology_Viscosity */
+static void PreviousMaxwell_Constitutive( void* _context, Element_LocalIndex element_lI ) {
+	Snac_Context*			context = (Snac_Context*)_context;
+	Snac_Element*			element = Snac_Element_At( context, element_lI );
+	double*				elementViscosity = ExtensionManager_Get(
+						context->mesh->elementExtensionMgr,
+						element,
+						maxwellElementHandle );
+	SnacTemperature_Element* temperatureElement = ExtensionManager_Get(
+						context->mesh->elementExtensionMgr,
+						element,
+						temperatureElementHandle );
+	const Snac_Material*		material = &context->materialProperty[element->material_I];
+
+	EntryPoint* 			temperatureEP;
+	temperatureEP = Context_GetEntryPoint( context,	"Snac_EP_LoopElementsEnergy" );
+
+	/* If this is a Maxwell material, calculate its stress. */
+	if( material->rheology & Snac_Material_Maxwell ) {
+		Tetrahedra_Index		tetra_I;
+
+		for( tetra_I = 0; tetra_I < Tetrahedra_Count; tetra_I++ ) {
+			const double			bulkm = material->lambda + 2.0f * material->mu/3.0f;
+			StressTensor*			stress = &element->tetra[tetra_I].stress;
+			StrainTensor*			strain = &element->tetra[tetra_I].strain;
+			double*				viscosity = &elementViscosity[tetra_I];
+			double				straind0,straind1,straind2,stressd0,stressd1,stressd2;
+			double				trace_strain;
+			double				trace_stress;
+			double				temp;
+			double				vic1;
+			double				vic2;
+			double				VolumicStress;
+			double				rviscosity=material->refvisc;
+			double				rmu= material->mu;
+			double				srJ2;
+			double				avgTemp;
+
+			Node_LocalIndex			node_lI;
+			double				rstrainrate = material->refsrate;
+			double				rTemp = material->reftemp;
+			double				H = material->activationE; // kJ/mol
+			double				srexponent = material->srexponent;
+			const double			R=8.31448;  // J/mol/K
+
+			if( context->computeThermalStress ) {
+				(*stress)[0][0] += temperatureElement->thermalStress[tetra_I];
+				(*stress)[1][1] += temperatureElement->thermalStress[tetra_I];
+				(*stress)[2][2] += temperatureElement->thermalStress[tetra_I];
+			}
+
+			trace_stress = (*stress)[0][0] + (*stress)[1][1] + (*stress)[2][2];
+			trace_strain = element->tetra[tetra_I].volume/element->tetra[tetra_I].old_volume-1.0f;
+
+			/* Deviatoric Stresses and Strains */
+			straind0 =  (*strain)[0][0] -  (trace_strain) / 3.0f;
+			straind1 =  (*strain)[1][1] -  (trace_strain) / 3.0f;
+			straind2 =  (*strain)[2][2] -  (trace_strain) / 3.0f;
+
+			stressd0 =  (*stress)[0][0] -  (trace_stress) / 3.0f;
+			stressd1 =  (*stress)[1][1] -  (trace_stress) / 3.0f;
+			stressd2 =  (*stress)[2][2] -  (trace_stress) / 3.0f;
+			if( temperatureEP ) {
+				srJ2 = sqrt(fabs(straind1*straind2+straind2*straind0+straind0*straind1 -(*strain)[0][1]*(*strain)[0][1]-(*strain)[0][2]*(*strain)[0][2]-(*strain)[1][2]*(*strain)[1][2]))/context->dt;
+				if(srJ2 == 0.0f) srJ2 = rstrainrate; // temporary. should be vmax/length_scale
+
+				avgTemp=0.0;
+				for(node_lI=0; node_lI<4; node_lI++) {
+					Snac_Node* contributingNode = Snac_Element_Node_P( context, element_lI, TetraToNode[tetra_I][node_lI] );
+					SnacTemperature_Node* temperatureNodeExt = ExtensionManager_Get(
+												 context->mesh->nodeExtensionMgr,contributingNode,
+												 temperatureNodeHandle );
+
+					avgTemp += 0.25 * temperatureNodeExt->temperature;
+					assert( !isnan(avgTemp) && !isinf(avgTemp) );
+				}
+
+				(*viscosity)= rviscosity*pow((srJ2/rstrainrate),(1./srexponent-1.))
+					*exp(H/R*(1./(avgTemp+273.15)-1./(rTemp+273.15)));
+				if((*viscosity) < material->vis_min) (*viscosity) = material->vis_min;
+				if((*viscosity) > material->vis_max) (*viscosity) = material->vis_max;
+
+				if( isnan((*viscosity)) || isinf((*viscosity))) {
+					fprintf(stderr,"rvisc=%e Erattio=%e pow(E)=%e, dT=%e exp=%e\n",
+						rviscosity,(srJ2/rstrainrate),pow((srJ2/rstrainrate),(1./srexponent-1.)),
+						exp(H/R*(1./(avgTemp+273.15)-1./(rTemp+273.15))),(1./(avgTemp+273.15)-1./(rTemp+273.15)) );
+				}
+				assert(!isnan((*viscosity)) && !isinf((*viscosity)));
+			}
+			else
+				(*viscosity) = rviscosity;
+			assert(!isnan((*viscosity)) && !isinf((*viscosity)));
+
+			/* Non dimensional parameters elastic/viscous */
+			temp = rmu / (2.0f* (*viscosity)) * context->dt;
+
+			vic1 = 1.0f - temp;
+			vic2 = 1.0f / (1.0f + temp);
+
+			/* Deviatoric Stress Update */
+
+			stressd0 =  (stressd0 * vic1 + 2.0f * rmu * straind0) * vic2 ;
+			stressd1 =  (stressd1 * vic1 + 2.0f * rmu * straind1) * vic2 ;
+			stressd2 =  (stressd2 * vic1 + 2.0f * rmu * straind2) * vic2 ;
+
+			(*stress)[0][1] =((*stress)[0][1] * vic1 + 2.0f * rmu * (*strain)[0][1]) * vic2;
+			(*stress)[0][2] =((*stress)[0][2] * vic1 + 2.0f * rmu * (*strain)[0][2]) * vic2;
+			(*stress)[1][2] =((*stress)[1][2] * vic1 + 2.0f * rmu * (*strain)[1][2]) * vic2;
+
+			/* Isotropic stress is elastic,
+			   WARNING:volumic Strain may be better defined as
+			   volumique change in the mesh */
+			VolumicStress = trace_stress / 3.0f + bulkm * trace_strain;
+
+			(*stress)[0][0] = stressd0 + VolumicStress;
+			(*stress)[1][1] = stressd1 + VolumicStress;
+			(*stress)[2][2] = stressd2 + VolumicStress;
+		}
+	}
+}
+
+/* Largest relative difference between two arrays */
+static double MaxRelativeDiff( const double* a, const double* b, Index count ) {
+	double		maxDiff = 0.0;
+	Index		i;
+
+	for( i = 0; i < count; i++ ) {
+		double		diff = fabs( a[i] - b[i] ) / ( fabs( b[i] ) > 0.0 ? fabs( b[i] ) : 1.0 );
+
+		if( !( diff <= maxDiff ) )
+			maxDiff = diff;
+	}
+	return maxDiff;
+}
+
+int main( int argc, char* argv[] ) {
+	MPI_Comm			CommWorld;
+	int				rank;
+	int				numProcessors;
+	int				procToWatch;
+	Dictionary*			dictionary;
+	XML_IO_Handler*			ioHandler;
+	Snac_Context*			snacContext;
+	Mesh*				mesh;
+	EntryPoint*			calcStressesEP;
+	EntryPoint*			constitutiveEP;
+	Hook*				temperatureHook;
+	Hook*				hook;
+	Element_LocalIndex		elementCount;
+	Element_LocalIndex		element_lI;
+	Node_LocalIndex			node_lI;
+	Tetrahedra_Index		tetra_I;
+	Index				valueCount;
+	double*				initialStress;
+	double*				stress;
+	double*				viscosity;
+	double*				previousStress;
+	double*				previousViscosity;
+	unsigned int			repeats;
+
+	/* Initialise MPI, get world info */
+	MPI_Init( &argc, &argv );
+	MPI_Comm_dup( MPI_COMM_WORLD, &CommWorld );
+	MPI_Comm_size( CommWorld, &numProcessors );
+	MPI_Comm_rank( CommWorld, &rank );
+
+	Snac_Init( &argc, &argv );
+
+	if( argc >= 2 ) {
+		procToWatch = atoi( argv[1] );
+	}
+	else {
+		procToWatch = 0;
+	}
+	if( rank == procToWatch ) printf( "Watching rank: %i\n", rank );
+
+	/* Read input */
+	dictionary = Dictionary_New();
+	dictionary->add( dictionary, "rank", Dictionary_Entry_Value_FromUnsignedInt( rank ) );
+	dictionary->add( dictionary, "numProcessors", Dictionary_Entry_Value_FromUnsignedInt( numProcessors ) );
+	ioHandler = XML_IO_Handler_New();
+	IO_Handler_ReadAllFromCommandLine( ioHandler, argc, argv, dictionary );
+
+	/* Build the context */
+	snacContext = Snac_Context_New( 0.0f, 10.0f, sizeof(Snac_Node), sizeof(Snac_Element), CommWorld, dictionary );
+	Stg_Component_Construct( snacContext, 0 /* dummy */, &snacContext, True );
+	Stg_Component_Build( snacContext, 0 /* dummy */, False );
+	Stg_Component_Initialise( snacContext, 0 /* dummy */, False );
+
+	mesh = snacContext->mesh;
+	elementCount = mesh->elementLocalCount;
+	repeats = Dictionary_Entry_Value_AsUnsignedInt( 
+		Dictionary_GetDefault( dictionary, "repeats", Dictionary_Entry_Value_FromUnsignedInt( 0 ) ) );
+	temperatureNodeHandle = ExtensionManager_GetHandle( mesh->nodeExtensionMgr, "SnacTemperature" );
+	temperatureElementHandle = ExtensionManager_GetHandle( mesh->elementExtensionMgr, "SnacTemperature" );
+	maxwellElementHandle = ExtensionManager_GetHandle( mesh->elementExtensionMgr, "SnacMaxwell" );
+
+	/* Node temperatures from 200 to 1400 C, and strains, volume changes and stresses that differ between tetrahedra */
+	for( node_lI = 0; node_lI < mesh->nodeDomainCount; node_lI++ ) {
+		SnacTemperature_Node*	temperatureNode = ExtensionManager_Get( mesh->nodeExtensionMgr, 
+						Snac_Node_At( snacContext, node_lI ), temperatureNodeHandle );
+		double*			coord = mesh->nodeCoord[node_lI];
+
+		temperatureNode->temperature = 800.0 - 600.0 * cos( 3.0 * coord[0] + 2.0 * coord[1] + 5.0 * coord[2] );
+	}
+	for( element_lI = 0; element_lI < elementCount; element_lI++ ) {
+		Snac_Element*		element = Snac_Element_At( snacContext, element_lI );
+
+		for( tetra_I = 0; tetra_I < Tetrahedra_Count; tetra_I++ ) {
+			Snac_Element_Tetrahedra*	tetra = &element->tetra[tetra_I];
+			double				phase = 0.37 * ( element_lI * Tetrahedra_Count + tetra_I );
+			Index				i, j;
+
+			for( i = 0; i < 3; i++ ) {
+				for( j = i; j < 3; j++ ) {
+					/* Strain rates of about 1e-17 to 1e-13 per second over the 3e6 s time step */
+					tetra->strain[i][j] = tetra->strain[j][i] = 
+						3.0e-9 * pow( 10.0, 2.0 * sin( phase + i + 3 * j ) ) * cos( 1.3 * phase + i * j );
+					tetra->stress[i][j] = tetra->stress[j][i] = 1.0e7 * sin( 0.7 * phase + 2 * i + j );
+				}
+			}
+			tetra->old_volume = 1.0;
+			tetra->volume = 1.0 + 1.0e-9 * sin( 1.9 * phase );
+		}
+	}
+
+	valueCount = elementCount * Tetrahedra_Count;
+	initialStress = Memory_Alloc_Array( double, valueCount * 9, "testMaxwell" );
+	stress = Memory_Alloc_Array( double, valueCount * 9, "testMaxwell" );
+	viscosity = Memory_Alloc_Array( double, valueCount, "testMaxwell" );
+	previousStress = Memory_Alloc_Array( double, valueCount * 9, "testMaxwell" );
+	previousViscosity = Memory_Alloc_Array( double, valueCount, "testMaxwell" );
+	for( element_lI = 0; element_lI < elementCount; element_lI++ ) {
+		Snac_Element*		element = Snac_Element_At( snacContext, element_lI );
+
+		for( tetra_I = 0; tetra_I < Tetrahedra_Count; tetra_I++ )
+			memcpy( &initialStress[( element_lI * Tetrahedra_Count + tetra_I ) * 9], element->tetra[tetra_I].stress, 
+				sizeof(StressTensor) );
+	}
+
+	/* The plugin's per step temperatures and constitutive hook alone, then the previous evaluation from the same 
+	   stresses */
+	calcStressesEP = (EntryPoint*)Context_GetEntryPoint( snacContext, Snac_EP_CalcStresses );
+	temperatureHook = (Hook*)Stg_ObjectList_Get( calcStressesEP->hooks, "SnacMaxwell_UpdateTemperatures" );
+	constitutiveEP = (EntryPoint*)Context_GetEntryPoint( snacContext, Snac_EP_Constitutive );
+	hook = (Hook*)Stg_ObjectList_Get( constitutiveEP->hooks, "SnacMaxwell" );
+	((EntryPoint_VoidPtr_Cast*)temperatureHook->funcPtr)( snacContext );
+	((Snac_Constitutive_RangeCast*)hook->funcPtr)( snacContext, 0, elementCount );
+	for( element_lI = 0; element_lI < elementCount; element_lI++ ) {
+		Snac_Element*		element = Snac_Element_At( snacContext, element_lI );
+		double*			elementViscosity = ExtensionManager_Get( mesh->elementExtensionMgr, element, 
+						maxwellElementHandle );
+
+		for( tetra_I = 0; tetra_I < Tetrahedra_Count; tetra_I++ ) {
+			Index		value_I = element_lI * Tetrahedra_Count + tetra_I;
+
+			memcpy( &stress[value_I * 9], element->tetra[tetra_I].stress, sizeof(StressTensor) );
+			viscosity[value_I] = elementViscosity[tetra_I];
+			memcpy( element->tetra[tetra_I].stress, &initialStress[value_I * 9], sizeof(StressTensor) );
+		}
+		PreviousMaxwell_Constitutive( snacContext, element_lI );
+		for( tetra_I = 0; tetra_I < Tetrahedra_Count; tetra_I++ ) {
+			Index		value_I = element_lI * Tetrahedra_Count + tetra_I;
+
+			memcpy( &previousStress[value_I * 9], element->tetra[tetra_I].stress, sizeof(StressTensor) );
+			previousViscosity[value_I] = elementViscosity[tetra_I];
+		}
+	}
+
+	if( rank == procToWatch ) {
+		printf( "Viscosities match the previous evaluation within %g: %s\n", TOL, 
+			MaxRelativeDiff( viscosity, previousViscosity, valueCount ) < TOL ? "True" : "False" );
+		printf( "Stresses match the previous evaluation within %g: %s\n", TOL, 
+			MaxRelativeDiff( stress, previousStress, valueCount * 9 ) < TOL ? "True" : "False" );
+	}
+
+	if( repeats && rank == procToWatch ) {
+		double			start;
+		double			hookTime;
+		double			previousTime;
+		unsigned int		repeat_I;
+
+		start = MPI_Wtime();
+		for( repeat_I = 0; repeat_I < repeats; repeat_I++ ) {
+			((EntryPoint_VoidPtr_Cast*)temperatureHook->funcPtr)( snacContext );
+			((Snac_Constitutive_RangeCast*)hook->funcPtr)( snacContext, 0, elementCount );
+		}
+		hookTime = MPI_Wtime() - start;
+
+		start = MPI_Wtime();
+		for( repeat_I = 0; repeat_I < repeats; repeat_I++ ) {
+			for( element_lI = 0; element_lI < elementCount; element_lI++ )
+				PreviousMaxwell_Constitutive( snacContext, element_lI );
+		}
+		previousTime = MPI_Wtime() - start;
+
+		printf( "Per tetrahedra: previous %g ns, current %g ns\n", 
+			previousTime * 1.0e9 / ( (double)repeats * valueCount ), hookTime * 1.0e9 / ( (double)repeats * valueCount ) );
+	}
+
+	Memory_Free( initialStress );
+	Memory_Free( stress );
+	Memory_Free( viscosity );
+	Memory_Free( previousStress );
+	Memory_Free( previousViscosity );
+	Stg_Class_Delete( snacContext );
+	Stg_Class_Delete( ioHandler );
+	Stg_Class_Delete( dictionary );
+	MPI_Finalize();
+	return 0; /* success */
+}
@@ -34,7 +34,6 @@
 #include <stdio.h>
 #include <string.h>
 #include <assert.h>
-#include <time.h>
 #include <StGermain/StGermain.h>
 #include <StGermain/FD/FD.h>
 #include "Snac/Snac.h"
@@ -42,22 +41,23 @@
 #include "Register.h"
 #include "Snac/Plastic/Plastic.h"
 
+/* Each element of the band is the top of a seed with this probability; a seed weakens its column of elements from 
+   there up through the whole of J. */
+static const double SnacPlSeeds_Probability = 0.02;
+static const int SnacPlSeeds_BandWidth = 5;
+
 void _SnacPlSeeds_InitialConditions( void* _context, void* data ) {
 	Snac_Context*			context = (Snac_Context*)_context;
 	Mesh*				mesh = context->mesh;
 	MeshLayout*			layout = (MeshLayout*)mesh->layout;
 	HexaMD*				decomp = (HexaMD*)layout->decomp;
+	ExtensionView			plasticView = Snac_Element_ExtensionView( context, SnacPlastic_ElementHandle );
+	unsigned int			seed;
 	Element_LocalIndex		element_lI;
-	Element_GlobalIndex		element_gI;
-	int				index_I,index_J,global_I_range,global_J_range,global_K_range;
 	IJK				ijk;
-	Snac_Element*			element;
-	const Snac_Material*		material;
-	Tetrahedra_Index		tetra_I;
-	SnacPlastic_Element*		plasticElement;
-	float				rand_num;
-	int				NUM_SEED;
-	int				incZ = 0;
+	int				bandLeft;
+	int				band_I;
+	int*				firstSeedK;
 	
 	if( context->restartTimestep > 0 )
 		return;
@@ -66,54 +66,45 @@ void _SnacPlSeeds_InitialConditions( void* _context, void* data ) {
 	printf( "In: %s\n", __func__ );
 #endif
 
-    srand( (unsigned int)time(NULL) );
-    global_I_range = 5; //decomp->elementGlobal3DCounts[0]/8;
-    global_J_range = decomp->elementGlobal3DCounts[1];
-    global_K_range = decomp->elementGlobal3DCounts[2]; //10;
-    NUM_SEED = decomp->elementGlobal3DCounts[2] * global_I_range * 0.02;
-
-    for(index_I = 0; index_I < NUM_SEED; index_I++) {
-        rand_num = rand()/(RAND_MAX+1.0);
-        ijk[2] = decomp->elementGlobal3DCounts[2]*rand_num;
-        rand_num = rand()/(RAND_MAX+1.0);
-        ijk[0] = global_I_range * rand_num;
-        ijk[0] = decomp->elementGlobal3DCounts[0]/2 - (ijk[0]-global_I_range/2);
-
-        incZ = 0;
-        //ijk[2] -= global_K_range/2;
-        while( incZ < global_K_range && ijk[2] >=0 && ijk[2] < decomp->elementGlobal3DCounts[2] ) {
-            ijk[1] = decomp->elementGlobal3DCounts[1]-1;
-            for(index_J = 0; index_J < global_J_range; index_J++) {
-                element_gI = ijk[0] + decomp->elementGlobal3DCounts[0]*ijk[1] + decomp->elementGlobal3DCounts[0]*decomp->elementGlobal3DCounts[1]*ijk[2];
-                element_lI = Mesh_ElementMapGlobalToLocal( mesh, element_gI );
-
-                if(element_lI < mesh->elementLocalCount) {
-
-                    element = Snac_Element_At( context, element_lI );
-                    material = &context->materialProperty[element->material_I];
-                    plasticElement = ExtensionManager_Get(
-                                                          mesh->elementExtensionMgr,
-                                                          element,
-                                                          SnacPlastic_ElementHandle );
-
-                    for( tetra_I = 0; tetra_I < Tetrahedra_Count; tetra_I++ ) {
-                        plasticElement->plasticStrain[tetra_I] = 1.1 * material->plstrain[1];
-
-                        Journal_Printf(
-                                       context->snacVerbose,
-                                       "timeStep=%d ijk=%d %d %d plasticE=%e\n",
-                                       context->timeStep,
-                                       ijk[0],
-                                       ijk[1],
-                                       ijk[2],
-                                       plasticElement->plasticStrain[tetra_I] );
-                    }
-                    fprintf(stderr,"me=%d seeds(%d/%d) ijk=%d %d %d\n",context->rank,index_I,NUM_SEED,ijk[0],ijk[1],ijk[2]);
-                }
-                ijk[1]--;
-            }
-            ijk[2]++;
-            incZ++;
-        }
-    }
+	seed = Dictionary_Entry_Value_AsUnsignedInt( 
+		Dictionary_GetDefault( context->dictionary, "randomSeed", Dictionary_Entry_Value_FromUnsignedInt( 1 ) ) );
+	bandLeft = decomp->elementGlobal3DCounts[0] / 2 + SnacPlSeeds_BandWidth / 2 - SnacPlSeeds_BandWidth + 1;
+	
+	/* The lowest seed of each column of the band. The draws are keyed by the global index of the column's top 
+	   element at each K, so every processor finds the same seeds whatever the decomposition. */
+	firstSeedK = Memory_Alloc_Array( int, SnacPlSeeds_BandWidth, "SnacPlSeeds firstSeedK" );
+	for( band_I = 0; band_I < SnacPlSeeds_BandWidth; band_I++ ) {
+		firstSeedK[band_I] = decomp->elementGlobal3DCounts[2];
+		if( bandLeft + band_I < 0 || bandLeft + band_I >= (int)decomp->elementGlobal3DCounts[0] )
+			continue;
+		for( ijk[2] = 0; ijk[2] < decomp->elementGlobal3DCounts[2]; ijk[2]++ ) {
+			Element_GlobalIndex	element_gI = RegularMeshUtils_Element_3DTo1D( decomp, 
+				bandLeft + band_I, decomp->elementGlobal3DCounts[1] - 1, ijk[2] );
+			
+			if( Snac_Random_Uniform( seed, 0, element_gI ) < SnacPlSeeds_Probability ) {
+				firstSeedK[band_I] = ijk[2];
+				break;
+			}
+		}
+	}
+	
+	for( element_lI = 0; element_lI < mesh->elementLocalCount; element_lI++ ) {
+		Snac_Element*		element = Snac_Element_At( context, element_lI );
+		const Snac_Material*	material = &context->materialProperty[element->material_I];
+		SnacPlastic_Element*	plasticElement = ExtensionView_At( plasticView, element_lI );
+		Element_GlobalIndex	element_gI = Mesh_ElementMapLocalToGlobal( mesh, element_lI );
+		Tetrahedra_Index	tetra_I;
+		
+		RegularMeshUtils_Element_1DTo3D( decomp, element_gI, &ijk[0], &ijk[1], &ijk[2] );
+		band_I = (int)ijk[0] - bandLeft;
+		if( band_I < 0 || band_I >= SnacPlSeeds_BandWidth || (int)ijk[2] < firstSeedK[band_I] )
+			continue;
+		
+		for( tetra_I = 0; tetra_I < Tetrahedra_Count; tetra_I++ ) {
+			plasticElement->plasticStrain[tetra_I] = 1.1 * material->plstrain[1];
+		}
+		Journal_Printf( context->snacVerbose, "timeStep=%d ijk=%d %d %d plasticE=%e\n", context->timeStep, 
+			ijk[0], ijk[1], ijk[2], plasticElement->plasticStrain[0] );
+	}
+	Memory_Free( firstSeedK );
 }
@@ -249,12 +249,16 @@ void SnacPlastic_Constitutive( void* _context, Element_LocalIndex element_lI ) {
 int principal_stresses(StressTensor* stress, double sp[3], double cn[3][3])
 {
 
-	double **a,**v,*d;
+	double aData[4][4],vData[4][4],d[4];
+	double *a[4],*v[4];
 	int i,j;
 
-	a = dmatrix(1,3,1,3);
-	v = dmatrix(1,3,1,3);
-	d = dvector(1,3);
+	/* Unit-offset 3x3 matrices and 3-vector for jacobi()/eigsrt(), on the stack rather than malloc'd and freed
+	   for every tetrahedra; row and column 0 are unused */
+	for( i = 0; i < 4; i++ ) {
+		a[i] = aData[i];
+		v[i] = vData[i];
+	}
 
 	a[1][1] = (*stress)[0][0];
 	a[2][2] = (*stress)[1][1];
@@ -285,10 +289,6 @@ int principal_stresses(StressTensor* stress, double sp[3], double cn[3][3])
 		}
 	}
 
-	free_dmatrix(a,1,3,1,3);
-	free_dmatrix(v,1,3,1,3);
-	free_dvector(d,1,3);
-
 	return(1);
 }
 
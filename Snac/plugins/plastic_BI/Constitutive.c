@@ -56,14 +56,10 @@
 #endif
 
 
-void SnacPlastic_Constitutive( void* _context, Element_LocalIndex element_lI ) {
-	Snac_Context*			context = (Snac_Context*)_context;
+static void _SnacPlastic_Constitutive( Snac_Context* context, Element_LocalIndex element_lI, SnacPlastic_Element* plasticElement ) {
 	Snac_Element*			element = Snac_Element_At( context, element_lI );
-	SnacPlastic_Element*	plasticElement = ExtensionManager_Get( context->mesh->elementExtensionMgr, element, SnacPlastic_ElementHandle );
 	const Snac_Material*	material = &context->materialProperty[element->material_I];
 
-	EntryPoint*				temperatureEP = Context_GetEntryPoint( context,	"Snac_EP_LoopElementsEnergy" );
-
 	/* If this is a Plastic material, calculate its stress. */
 	if ( material->rheology & Snac_Material_Plastic ) {
 		Tetrahedra_Index	tetra_I;
@@ -71,33 +67,21 @@ void SnacPlastic_Constitutive( void* _context, Element_LocalIndex element_lI ) {
 		/* plastic material properties */
 		StressTensor*		stress;
 		StrainTensor*		strain;
-		Strain		        plasticStrain;
 		double				trace_strain;
-		plModel             yieldcriterion=material->yieldcriterion;
-		/* elasto-plastic material properties */
-		double				cohesion = 30.0e6;
-		double				frictionAngle = 30.0f;
-		double				dilationAngle = 0.0f;
-		double				tension_cutoff=0.0;
-		const double		degrad = PI / 180.0f;
+		Snac_YieldBatch		batch;
 		double				totalVolume=0.0f,depls=0.0f;
-		unsigned int		i;
-		double				tmp=0.0;
-		const double		a1 = material->lambda + 2.0f * material->mu ;
-		const double		a2 = material->lambda ;
-		int					ind=0;
 		int principal_stresses(StressTensor* stress,double sp[],double cn[3][3]);
 		int principal_stresses_orig(StressTensor* stress, double sp[3], double cn[3][3]);
 
-		/* Work out the plastic material properties of this element */
+		/* elasto-plastic material properties used until a tetrahedra finds its softening segment */
+		Snac_YieldBatch_Init( &batch, 30.0e6, 30.0f, 0.0f );
+
+		/* Elastic trial stress of every tetrahedra, in principal axes */
 		for( tetra_I = 0; tetra_I < Tetrahedra_Count; tetra_I++ ) {
-			double			cn[3][3] = {{0.0,0.0,0.0},{0.0,0.0,0.0},{0.0,0.0,0.0}};
 			double			s[3] = {0.0,0.0,0.0};
-			double			alam, dep1, dep2, dep3, depm;
 
 			stress = &element->tetra[tetra_I].stress;
 			strain = &element->tetra[tetra_I].strain;
-			plasticStrain = plasticElement->plasticStrain[tetra_I];
 
 			trace_strain = (*strain)[0][0] + (*strain)[1][1] + (*strain)[2][2];
 
@@ -111,124 +95,22 @@ void SnacPlastic_Constitutive( void* _context, Element_LocalIndex element_lI ) {
 			(*stress)[2][0] = (*stress)[0][2];
 			(*stress)[2][1] = (*stress)[1][2];
 
-			principal_stresses(stress,s,cn); /*principal_stresses_orig(stress,s,cn);*/
-
-			/* compute friction and dilation angles based on accumulated plastic strain in tetrahedra */
-			/* Piece-wise linear softening */
-			/* Find current properties from linear interpolation */
-			for( i = 0; i < material->nsegments; i++ ) {
-				const double pl1 = material->plstrain[i];
-				const double pl2 = material->plstrain[i+1];
-
-				if( plasticStrain >= pl1 && plasticStrain <= pl2 ) {
-					const double	tgf = (material->frictionAngle[i+1] - material->frictionAngle[i]) / (pl2 - pl1);
-					const double	tgd = (material->dilationAngle[i+1] - material->dilationAngle[i]) / (pl2 - pl1);
-					const double	tgc = (material->cohesion[i+1] - material->cohesion[i]) / (pl2 - pl1);
-
-					frictionAngle = material->frictionAngle[i] + tgf * (plasticStrain - pl1);
-					dilationAngle = material->dilationAngle[i] + tgd * (plasticStrain - pl1);
-					cohesion = material->cohesion[i] + tgc * (plasticStrain - pl1);
-				}
-			}
-
-			if( frictionAngle >= 0.0f ) {
-				tension_cutoff = material->ten_off;
-				/* tension_cutoff is 0 by default. If not set by a user, it is set here.*/
-				if( frictionAngle > 0.0 && tension_cutoff == 0.0 ) {
-					tension_cutoff = cohesion / tan( frictionAngle * degrad);
-					/* tmp = cohesion / tan( frictionAngle * degrad);
-					if(tmp < tension_cutoff) tension_cutoff=tmp; */
-				}
-			}
-			else {
-				if( plasticStrain < 0.0 ) {
-					plasticElement->plasticStrain[tetra_I] = 0.0;
-					plasticStrain = plasticElement->plasticStrain[tetra_I];
-					fprintf(stderr,"Warning: negative plastic strain. Setting to zero, but check if remesher is on and this happended for an external tet. rank:%d elem:%d tet:%d plasticStrain=%e frictionAngle=%e\n",context->rank,element_lI,tetra_I,plasticStrain,frictionAngle);
-					frictionAngle = material->frictionAngle[0];
-					dilationAngle = material->dilationAngle[0];
-					cohesion = material->cohesion[0];
-				}
-				else {
-					/* frictionAngle < 0.0 violates second law of thermodynamics */
-					fprintf(stderr,"Error due to an unknown reason: rank:%d elem:%d tet:%d plasticStrain=%e frictionAngle=%e\n",context->rank,element_lI,tetra_I,plasticStrain,frictionAngle);
-					assert(0);
-				}
-			}
-
-			if( yieldcriterion == mohrcoulomb )
-				{
-
-					double sphi = sin( frictionAngle * degrad );
-					double spsi = sin( dilationAngle * degrad );
-					double anphi = (1.0f + sphi) / (1.0f - sphi);
-					double anpsi = (1.0f + spsi) / (1.0f - spsi);
-					double fs = s[0] - s[2] * anphi + 2 * cohesion * sqrt( anphi );
-					double ft = s[2] - tension_cutoff;
-					/* CHECK FOR COMPOSITE YIELD CRITERION  */
-					ind=0;
-					if( fs < 0.0f || ft > 0.0f ) {
-						/*! Failure: shear or tensile */
-						double aP = sqrt( 1.0f + anphi * anphi ) + anphi;
-						double sP = tension_cutoff * anphi - 2 * cohesion * sqrt( anphi );
-						double h = s[2] - tension_cutoff + aP * ( s[0] - sP );
-
-						ind=1;
-
-						if( h < 0.0f ) {
-							/* !shear failure  */
-							alam = fs / ( a1 - a2 * anpsi + a1 * anphi * anpsi - a2 * anphi );
-							s[0] -= alam * ( a1 - a2 * anpsi );
-							s[1] -= alam * a2 * ( 1.0f - anpsi );
-							s[2] -= alam * ( a2 - a1 * anpsi );
-							dep1 = alam;
-							dep2 = 0.0f;
-							dep3 = -alam * anpsi;
-						}
-						else {
-							/* tensile failure */
-							alam = ft / a1;
-							s[0] -= alam * a2;
-							s[1] -= alam * a2;
-							s[2] -= alam * a1;
-							dep1 = 0.0f;
-							dep2 = 0.0f;
-							dep3 = alam;
-						}
-					}
-					else {
-						/* ! no failure - just elastic increment */
+			principal_stresses(stress,s,batch.cn[tetra_I]); /*principal_stresses_orig(stress,s,cn);*/
+			batch.stress[tetra_I] = stress;
+			batch.s[0][tetra_I] = s[0];
+			batch.s[1][tetra_I] = s[1];
+			batch.s[2][tetra_I] = s[2];
+		}
+		batch.count = Tetrahedra_Count;
 
-						dep1 = 0.0f;
-						dep2 = 0.0f;
-						dep3 = 0.0f;
-					}
-					if(ind) {
-						unsigned int k,m,n;
-						/* Second invariant of accumulated plastic increment  */
-						depm = ( dep1 + dep2 + dep3 ) / 3.0f;
-						plasticElement->plasticStrain[tetra_I] += sqrt( 0.5f * ((dep1-depm) * (dep1-depm) + (dep2-depm) * (dep2-depm) + (dep3-depm) * (dep3-depm) + depm*depm) );
-
-						/* Stress projection back to euclidean coordinates */
-						memset( stress, 0, sizeof((*stress)) );
-						/* Resolve back to global axes  */
-						for( m = 0; m < 3; m++ ) {
-							for( n = m; n < 3; n++ ) {
-								for( k = 0; k < 3; k++ ) {
-									/* (*stress)[m][n] += cn[k][m] * cn[k][n] * s[k]; */
-									(*stress)[m][n] += cn[m][k] * cn[n][k] * s[k];
-								}
-							}
-						}
-					}
-				}
-			else
-				Journal_Firewall( (0>1), "In %s: \"mohrcoulomb\" is the only available yield criterion.\n", __func__ );
+		/* Piece-wise linear softening and the return map, for all tetrahedra at once */
+		Snac_Yield_MohrCoulomb( context, element_lI, material, &batch, plasticElement->plasticStrain, False );
 
+		for( tetra_I = 0; tetra_I < Tetrahedra_Count; tetra_I++ ) {
 			/* linear healing: applied whether this tet has yielded or not. 
 			   Parameters are hardwired for now, but should be given through an input file. */
 			/* plasticElement->plasticStrain[tetra_I] *= (1.0/(1.0+context->dt/1.0e+12)); */
-			/* plasticElement->plasticStrain[tetra_I] *= (1.0/(1.0+context->dt/(ind?1.0e+13:5.0e+11))); */
+			/* plasticElement->plasticStrain[tetra_I] *= (1.0/(1.0+context->dt/(batch.yielded[tetra_I]?1.0e+13:5.0e+11))); */
 			depls += plasticElement->plasticStrain[tetra_I]*element->tetra[tetra_I].volume;
 			totalVolume += element->tetra[tetra_I].volume;
 		}
@@ -237,6 +119,24 @@ void SnacPlastic_Constitutive( void* _context, Element_LocalIndex element_lI ) {
 	}
 }
 
+void SnacPlastic_Constitutive( void* _context, Element_LocalIndex element_lI ) {
+	Snac_Context*			context = (Snac_Context*)_context;
+	Snac_Element*			element = Snac_Element_At( context, element_lI );
+
+	_SnacPlastic_Constitutive( context, element_lI,
+		ExtensionManager_Get( context->mesh->elementExtensionMgr, element, SnacPlastic_ElementHandle ) );
+}
+
+void SnacPlastic_Constitutive_Range( void* _context, Element_LocalIndex begin, Element_LocalIndex end ) {
+	Snac_Context*			context = (Snac_Context*)_context;
+	ExtensionView			plasticView = Snac_Element_ExtensionView( context, SnacPlastic_ElementHandle );
+	Element_LocalIndex		element_lI;
+
+	for( element_lI = begin; element_lI < end; element_lI++ )
+		_SnacPlastic_Constitutive( context, element_lI, (SnacPlastic_Element*)ExtensionView_At( plasticView, element_lI ) );
+}
+
+
 int principal_stresses(StressTensor* stress, double d[3], double V[3][3])
 {
 
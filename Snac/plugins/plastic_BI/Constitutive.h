@@ -55,6 +55,7 @@
 #define __SnacPlastic_h__
 	
 	void SnacPlastic_Constitutive( void* context, Element_LocalIndex element_lI );
+	void SnacPlastic_Constitutive_Range( void* context, Element_LocalIndex begin, Element_LocalIndex end );
 	
 	double** dmatrix(long nrl, long nrh, long ncl, long nch);
 	double *dvector(long nl, long nh);
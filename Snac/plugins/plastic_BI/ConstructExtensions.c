@@ -35,6 +35,7 @@
 #include "Snac/Snac.h"
 #include "types.h"
 #include "Context.h"
+#include "Element.h"
 #include "Register.h"
 #include "ConstructExtensions.h"
 #include <assert.h>
@@ -49,12 +50,37 @@ void _SnacPlastic_ConstructExtensions( void* _context, void* data ) {
 												context->extensionMgr,
 												context,
 												SnacPlastic_ContextHandle );
+	Snac_Element				tmpElement;
+	SnacPlastic_Element*		tmpElementExt = ExtensionManager_Get(
+												context->mesh->elementExtensionMgr,
+												&tmpElement,
+												SnacPlastic_ElementHandle );
 	char						tmpBuf[PATH_MAX];
 
+	/* The accumulated plastic strain is not an array by itself either, so it is wrapped the generic way too */
+	Index						plasticStrainOffsetCount = 1;
+	SizeT						plasticStrainOffsets[] = {
+		(SizeT)((char*)&tmpElementExt->aps - (char*)&tmpElement) };
+	Variable_DataType			plasticStrainDataTypes[] = { Variable_DataType_Double };
+	Index						plasticStrainDataTypeCounts[] = { 1 };
+
 #if DEBUG
 	printf( "In %s()\n", __func__ );
 #endif
 
+	/* Create the StGermain variable plasticStrain, which is stored on an element extension */
+	Variable_New( 
+		"plasticStrain", 
+		plasticStrainOffsetCount, 
+		plasticStrainOffsets, 
+		plasticStrainDataTypes, 
+		plasticStrainDataTypeCounts, 
+		0, 
+		&ExtensionManager_GetFinalSize( context->mesh->elementExtensionMgr ),
+		&context->mesh->layout->decomp->elementDomainCount,
+		(void**)&context->mesh->element,
+		context->variable_Register );
+
 	/* Prepare the dump and checkpoint file */
 	sprintf( tmpBuf, "%s/plStrain.%u", context->outputPath, context->rank );
 	if( (contextExt->plStrainOut = fopen( tmpBuf, "w+" )) == NULL ) {
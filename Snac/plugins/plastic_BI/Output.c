@@ -61,17 +61,14 @@ void _SnacPlastic_DumpPlasticStrain( void* _context ) {
 												context,
 												SnacPlastic_ContextHandle );
 	Element_LocalIndex			element_lI;
+	ExtensionView				plasticView = Snac_Element_ExtensionView( context, SnacPlastic_ElementHandle );
 	
 #if DEBUG
 	printf( "In %s()\n", __func__ );
 #endif
 	
 	for( element_lI = 0; element_lI < context->mesh->elementLocalCount; element_lI++ ) {
-		Snac_Element* 				element = Snac_Element_At( context, element_lI );
-		SnacPlastic_Element*		elementExt = ExtensionManager_Get(
-													context->mesh->elementExtensionMgr,
-													element,
-													SnacPlastic_ElementHandle );
+		SnacPlastic_Element*		elementExt = ExtensionView_At( plasticView, element_lI );
 		float plasticStrain = elementExt->aps;
 		/* Take average of tetra plastic strain for the element */
 		fwrite( &plasticStrain, sizeof(float), 1, contextExt->plStrainOut );
@@ -87,17 +84,14 @@ void _SnacPlastic_CheckpointPlasticStrain( void* _context ) {
 												context,
 												SnacPlastic_ContextHandle );
 	Element_LocalIndex			element_lI;
+	ExtensionView				plasticView = Snac_Element_ExtensionView( context, SnacPlastic_ElementHandle );
 
 #if DEBUG
 	printf( "In %s()\n", __func__ );
 #endif
 	
 	for( element_lI = 0; element_lI < context->mesh->elementLocalCount; element_lI++ ) {
-		Snac_Element* 				element = Snac_Element_At( context, element_lI );
-		SnacPlastic_Element*		plasticElement = ExtensionManager_Get(
-														context->mesh->elementExtensionMgr,
-														element,
-														SnacPlastic_ElementHandle );
+		SnacPlastic_Element*		plasticElement = ExtensionView_At( plasticView, element_lI );
 		Tetrahedra_Index	tetra_I;
 		for( tetra_I = 0; tetra_I < Tetrahedra_Count; tetra_I++ ) {
 			float plasticStrain = plasticElement->plasticStrain[tetra_I];
@@ -91,10 +91,10 @@ void _SnacPlastic_Construct( void* component, Stg_ComponentFactory* cf, void* da
 	SnacPlastic_ContextHandle = ExtensionManager_Add( context->extensionMgr, SnacPlastic_Type, sizeof(SnacPlastic_Context) );
 
 	/* Add extensions to the entry points */
-	EntryPoint_Append( 
+	Snac_EntryPoint_AppendRangeHook(
 		Context_GetEntryPoint( context,	Snac_EP_Constitutive ),
 		SnacPlastic_Type, 
-		SnacPlastic_Constitutive, 
+		SnacPlastic_Constitutive_Range, 
 		SnacPlastic_Type );
 	EntryPoint_InsertBefore( 
 		Context_GetEntryPoint( context,	AbstractContext_EP_Initialise ),
@@ -225,4 +225,5 @@ void _SnacRemesher_ConstructExtensions( void* _context, void* data ) {
 	}
 	/* initialize remeshing counter */
 	contextExt->remeshingCount = 0;
+	contextExt->interpolateElements = True;
 }
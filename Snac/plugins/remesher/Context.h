@@ -59,6 +59,7 @@
 		
 		EntryPoint_Index		interpolateNodeK;	/* Key to node interpolation entry point (for speed) */
 		EntryPoint_Index		interpolateElementK;	/* Key to element interpolation entry point (for speed) */
+		Bool				interpolateElements;	/* False once another plugin (SnacMarkers) carries the element values */
 
 		Stream*				debugIC;
 		Stream*				debugCoords;
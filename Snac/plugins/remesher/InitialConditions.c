@@ -71,7 +71,9 @@ void _SnacRemesher_InitialConditions( void* _context, void* data ) {
 		IndexSet*		planeNodes, 
 		unsigned		gYInd, 
 		unsigned*		nTriNodes, 
-		unsigned**	triToDomain );
+		unsigned**	triToDomain, 
+		unsigned*		gridSize, 
+		unsigned*		gridOrigin );
 	
 	
 	/*
@@ -161,7 +163,9 @@ void _SnacRemesher_InitialConditions( void* _context, void* data ) {
 			walls[4], 
 			decomp->nodeGlobal3DCounts[1] - 1, 
 			&meshExt->nTopTriNodes, 
-			&meshExt->topTriToDomain );
+			&meshExt->topTriToDomain, 
+			meshExt->topTriGridSize, 
+			meshExt->topTriGridOrigin );
 	}
 	else {
 		meshExt->nTopTriNodes = 0;
@@ -169,7 +173,8 @@ void _SnacRemesher_InitialConditions( void* _context, void* data ) {
 	}
 	
 	if( walls[5]->membersCount > 0 ) {
-		_SnacRemesher_TriangulateXZPlane( context, walls[5], 0, &meshExt->nBotTriNodes, &meshExt->botTriToDomain );
+		_SnacRemesher_TriangulateXZPlane( context, walls[5], 0, &meshExt->nBotTriNodes, &meshExt->botTriToDomain, 
+						  meshExt->botTriGridSize, meshExt->botTriGridOrigin );
 	}
 	else {
 		meshExt->nBotTriNodes = 0;
@@ -505,93 +510,42 @@ void _SnacRemesher_TriangulateXZPlane(
 	IndexSet*		planeNodes, 
 	unsigned		gYInd, 
 	unsigned*		nTriNodes, 
-	unsigned**	triToDomain )
+	unsigned**	triToDomain, 
+	unsigned*		gridSize, 
+	unsigned*		gridOrigin )
 {
 	Snac_Context*		context = (Snac_Context*)_context;
 	Mesh*			mesh = context->mesh;
 	HexaMD*			decomp = (HexaMD*)mesh->layout->decomp;
-	IJK				gSize;
-	IJK				dSize;
 	IJK				pos;
+	unsigned			min[2], max[2];
+	Bool				found = False;
+	Node_DomainIndex	dNode_i;
+	unsigned			cell_i;
 	
 	
 	/*
-	** Definitley not the fastest way of doing this, but it should work none-the-less.
+	** The domain's part of the plane is a block of the global grid, so its extents come straight from the domain 
+	** nodes lying in the plane.
 	*/
 	
-	gSize[0] = decomp->nodeGlobal3DCounts[0];
-	gSize[1] = decomp->nodeGlobal3DCounts[1];
-	gSize[2] = decomp->nodeGlobal3DCounts[2];
-	pos[1] = gYInd;
-	
-	/* Calculate the domain x size. */
-	for( pos[2] = 0; pos[2] < gSize[2]; pos[2]++ ) {
-		unsigned	xMin, xMax;
-		Bool		found = False;
-		
-		xMax = 0;
+	for( dNode_i = 0; dNode_i < mesh->nodeDomainCount; dNode_i++ ) {
+		Node_GlobalIndex	gNodeInd = Mesh_NodeMapDomainToGlobal( mesh, dNode_i );
 		
-		for( pos[0] = 0; pos[0] < gSize[0]; pos[0]++ ) {
-			Node_GlobalIndex	gNodeInd;
-			Node_DomainIndex	dNodeInd;
-			
-			gNodeInd = RegularMeshUtils_Node_Global3DToGlobal1D( decomp, pos[0], pos[1], pos[2] );
-			dNodeInd = Mesh_NodeMapGlobalToDomain( mesh, gNodeInd );
-			
-			if( !found && dNodeInd < mesh->nodeDomainCount ) {
-				xMin = pos[0];
-				found = True;
-			}
-			else if( found && dNodeInd >= mesh->nodeDomainCount ) {
-				xMax = pos[0];
-				break;
-			}
+		RegularMeshUtils_Node_1DTo3D( decomp, gNodeInd, &pos[0], &pos[1], &pos[2] );
+		if( pos[1] != gYInd ) {
+			continue;
 		}
-		
-		if( found ) {
-			if( xMax == 0 ) {
-				dSize[0] = gSize[0] - xMin;
-			}
-			else {
-				dSize[0] = xMax - xMin;
-			}
-			break;
-		}
-	}
-	
-	/* Calculate the domain z size. */
-	for( pos[0] = 0; pos[0] < gSize[0]; pos[0]++ ) {
-		unsigned	zMin, zMax;
-		Bool		found = False;
-		
-		zMax = 0;
-		
-		for( pos[2] = 0; pos[2] < gSize[2]; pos[2]++ ) {
-			Node_GlobalIndex	gNodeInd;
-			Node_DomainIndex	dNodeInd;
-			
-			gNodeInd = RegularMeshUtils_Node_Global3DToGlobal1D( decomp, pos[0], pos[1], pos[2] );
-			dNodeInd = Mesh_NodeMapGlobalToDomain( mesh, gNodeInd );
-			
-			if( !found && dNodeInd < mesh->nodeDomainCount ) {
-				zMin = pos[2];
-				found = True;
-			}
-			else if( found && dNodeInd >= mesh->nodeDomainCount ) {
-				zMax = pos[2];
-				break;
-			}
-		}
-		
-		if( found ) {
-			if( zMax == 0 ) {
-				dSize[2] = gSize[2] - zMin;
-			}
-			else {
-				dSize[2] = zMax - zMin;
-			}
-			break;
+		if( !found ) {
+			min[0] = max[0] = pos[0];
+			min[1] = max[1] = pos[2];
+			found = True;
+			continue;
 		}
+		if( pos[0] < min[0] ) min[0] = pos[0];
+		if( pos[0] > max[0] ) max[0] = pos[0];
+		if( pos[2] < min[1] ) min[1] = pos[2];
+		if( pos[2] > max[1] ) max[1] = pos[2];
 	}
 	
 	
@@ -599,45 +553,59 @@ void _SnacRemesher_TriangulateXZPlane(
 	** Set up the destination values/arrays.
 	*/
 	
-	*nTriNodes = (dSize[0] - 1) * (dSize[2] - 1) * 6;
+	if( !found || max[0] == min[0] || max[1] == min[1] ) {
+		*nTriNodes = 0;
+		*triToDomain = NULL;
+		gridSize[0] = gridSize[1] = 0;
+		return;
+	}
+	gridOrigin[0] = min[0];
+	gridOrigin[1] = min[1];
+	gridSize[0] = max[0] - min[0];
+	gridSize[1] = max[1] - min[1];
+	*nTriNodes = gridSize[0] * gridSize[1] * 6;
 	*triToDomain = Memory_Alloc_Array( Node_DomainIndex, *nTriNodes, "SnacRemesher" );
 	
 	
 	/*
-	** Do the triangulation.
+	** Do the triangulation.  Cells with a corner outside the domain get invalid node indices and are skipped when
+	** remapping.
 	*/
 	
-	{
-		unsigned	curTri = 0;
-		
-		for( pos[2] = 0; pos[2] < gSize[2] - 1; pos[2]++ ) {
-			for( pos[0] = 0; pos[0] < gSize[0] - 1; pos[0]++ ) {
-				Node_GlobalIndex	gNodeInd;
-				Node_DomainIndex	dNodeInd[4];
-				
-				gNodeInd = RegularMeshUtils_Node_Global3DToGlobal1D( decomp, pos[0], pos[1], pos[2] );
-				dNodeInd[0] = Mesh_NodeMapGlobalToDomain( mesh, gNodeInd );
-				gNodeInd = RegularMeshUtils_Node_Global3DToGlobal1D( decomp, pos[0] + 1, pos[1], pos[2] );
-				dNodeInd[1] = Mesh_NodeMapGlobalToDomain( mesh, gNodeInd );
-				gNodeInd = RegularMeshUtils_Node_Global3DToGlobal1D( decomp, pos[0] + 1, pos[1], pos[2] + 1 );
-				dNodeInd[2] = Mesh_NodeMapGlobalToDomain( mesh, gNodeInd );
-				gNodeInd = RegularMeshUtils_Node_Global3DToGlobal1D( decomp, pos[0], pos[1], pos[2] + 1 );
-				dNodeInd[3] = Mesh_NodeMapGlobalToDomain( mesh, gNodeInd );
-				
-				if( dNodeInd[0] < mesh->nodeDomainCount && dNodeInd[1] < mesh->nodeDomainCount && 
-				    dNodeInd[2] < mesh->nodeDomainCount && dNodeInd[3] < mesh->nodeDomainCount )
-				{
-					/* If we are here then we've found a valid planar element and can proceed to triangulate it. */
-					(*triToDomain)[(curTri * 3) + 0] = dNodeInd[0];
-					(*triToDomain)[(curTri * 3) + 1] = dNodeInd[1];
-					(*triToDomain)[(curTri * 3) + 2] = dNodeInd[3];
-					curTri++;
-					
-					(*triToDomain)[(curTri * 3) + 0] = dNodeInd[1];
-					(*triToDomain)[(curTri * 3) + 1] = dNodeInd[2];
-					(*triToDomain)[(curTri * 3) + 2] = dNodeInd[3];
-					curTri++;
-				}
+	pos[1] = gYInd;
+	for( cell_i = 0; cell_i < gridSize[0] * gridSize[1]; cell_i++ ) {
+		Node_DomainIndex*	tri = (*triToDomain) + cell_i * 6;
+		Node_GlobalIndex	gNodeInd;
+		Node_DomainIndex	dNodeInd[4];
+		
+		pos[0] = gridOrigin[0] + cell_i % gridSize[0];
+		pos[2] = gridOrigin[1] + cell_i / gridSize[0];
+		
+		gNodeInd = RegularMeshUtils_Node_Global3DToGlobal1D( decomp, pos[0], pos[1], pos[2] );
+		dNodeInd[0] = Mesh_NodeMapGlobalToDomain( mesh, gNodeInd );
+		gNodeInd = RegularMeshUtils_Node_Global3DToGlobal1D( decomp, pos[0] + 1, pos[1], pos[2] );
+		dNodeInd[1] = Mesh_NodeMapGlobalToDomain( mesh, gNodeInd );
+		gNodeInd = RegularMeshUtils_Node_Global3DToGlobal1D( decomp, pos[0] + 1, pos[1], pos[2] + 1 );
+		dNodeInd[2] = Mesh_NodeMapGlobalToDomain( mesh, gNodeInd );
+		gNodeInd = RegularMeshUtils_Node_Global3DToGlobal1D( decomp, pos[0], pos[1], pos[2] + 1 );
+		dNodeInd[3] = Mesh_NodeMapGlobalToDomain( mesh, gNodeInd );
+		
+		if( dNodeInd[0] < mesh->nodeDomainCount && dNodeInd[1] < mesh->nodeDomainCount && 
+		    dNodeInd[2] < mesh->nodeDomainCount && dNodeInd[3] < mesh->nodeDomainCount )
+		{
+			tri[0] = dNodeInd[0];
+			tri[1] = dNodeInd[1];
+			tri[2] = dNodeInd[3];
+			
+			tri[3] = dNodeInd[1];
+			tri[4] = dNodeInd[2];
+			tri[5] = dNodeInd[3];
+		}
+		else {
+			unsigned	triNode_i;
+			
+			for( triNode_i = 0; triNode_i < 6; triNode_i++ ) {
+				tri[triNode_i] = mesh->nodeDomainCount;
 			}
 		}
 	}
@@ -141,26 +141,27 @@ void _SnacRemesher_Remesh( void* _context, void* data ) {
 			dstNode->residualFt = srcNode->residualFt;
 		}
 		
-		/* Interpolate current elemental values onto new coordinates. */
-		meshExt->newElements = (Snac_Element*)ExtensionManager_Malloc( mesh->elementExtensionMgr, mesh->elementLocalCount );
+		/* Interpolate current elemental values onto new coordinates, unless they are carried by another plugin. */
+		if( contextExt->interpolateElements ) {
+			meshExt->newElements = (Snac_Element*)ExtensionManager_Malloc( mesh->elementExtensionMgr, mesh->elementLocalCount );
 
-		/* Do the nearest neighbor transfer between tets. */
-		_SnacRemesher_InterpolateElements( context );
-		
+			/* Do the nearest neighbor transfer between tets. */
+			_SnacRemesher_InterpolateElements( context );
+			memcpy( mesh->element, meshExt->newElements, mesh->elementExtensionMgr->finalSize * mesh->elementLocalCount );
+			ExtensionManager_Free( mesh->elementExtensionMgr, meshExt->newElements );
+			meshExt->newElements = NULL;
+		}
 
-		/* Copy accross the new coord, node & element information to the current arrays. */
+		/* Copy accross the new coord & node information to the current arrays. */
 		memcpy( mesh->nodeCoord, meshExt->newNodeCoords, mesh->nodeLocalCount * sizeof(Coord) );
 		memcpy( mesh->node, meshExt->newNodes, mesh->nodeExtensionMgr->finalSize * mesh->nodeLocalCount );
-		memcpy( mesh->element, meshExt->newElements, mesh->elementExtensionMgr->finalSize * mesh->elementLocalCount );
 		
 		/* Update element attributes based on the new coordinates and the transferred variables. */
 		_SnacRemesher_UpdateElements( context );
 		
 		/* Free some space, as it won't be needed until the next remesh. */
 		ExtensionManager_Free( mesh->nodeExtensionMgr, meshExt->newNodes );
-		ExtensionManager_Free( mesh->elementExtensionMgr, meshExt->newElements );
 		meshExt->newNodes = NULL;
-		meshExt->newElements = NULL;
 		
 		
 		/*
@@ -427,6 +427,11 @@ void SPR( void* _context )
 	Mesh*				mesh = context->mesh;
 	NodeLayout*			nLayout = mesh->layout->nodeLayout;
 	Node_LocalIndex		node_lI;
+	Element_DomainIndex	elements[8];
+	/* The least-squares system of every node is solved in the same scratch space, rather than malloc'd and freed
+	   per node: a 4x4 matrix, then 26 4-vectors. */
+	double				scratch[16 + 26 * 4];
+	size_t				permData[4];
 
 	/* Populate field variables by SPR */
 	for( node_lI = 0; node_lI < mesh->nodeLocalCount; node_lI++ ) {
@@ -434,7 +439,8 @@ void SPR( void* _context )
 		Coord*					coord = Snac_NodeCoord_P( context, node_lI );
 		Index 					nodeElementCount = context->mesh->nodeElementCountTbl[node_lI];
 		Index 					nodeElement_I;
-		Element_DomainIndex*	elements;
+		gsl_matrix_view			matAView;
+		gsl_vector_view			vecViews[26];
 		gsl_matrix*				matA;
 		gsl_vector* 			vecaStrain[6];
 		gsl_vector*				vecaStress[6];
@@ -444,15 +450,19 @@ void SPR( void* _context )
 		gsl_vector* 			vecbplStrain;
 		Index 	 	 	 	 	i,j; 
 		
-		// initialize gsl vectors and matrix.
-		matA = gsl_matrix_alloc(4,4); gsl_matrix_set_zero( matA );
-		vecaplStrain = gsl_vector_alloc(4); gsl_vector_set_zero( vecaplStrain );
-		vecbplStrain = gsl_vector_alloc(4); gsl_vector_set_zero( vecbplStrain );
+		// initialize gsl vectors and matrix as views over the zeroed scratch space.
+		memset( scratch, 0, sizeof(scratch) );
+		matAView = gsl_matrix_view_array( scratch, 4, 4 );
+		matA = &matAView.matrix;
+		for(i=0;i<26;i++)
+			vecViews[i] = gsl_vector_view_array( scratch + 16 + 4 * i, 4 );
+		vecaplStrain = &vecViews[24].vector;
+		vecbplStrain = &vecViews[25].vector;
 		for(i=0;i<6;i++) {
-			vecaStrain[i] = gsl_vector_alloc(4); gsl_vector_set_zero( vecaStrain[i] );
-			vecaStress[i] = gsl_vector_alloc(4); gsl_vector_set_zero( vecaStress[i] );
-			vecbStrain[i] = gsl_vector_alloc(4); gsl_vector_set_zero( vecbStrain[i] );
-			vecbStress[i] = gsl_vector_alloc(4); gsl_vector_set_zero( vecbStress[i] );
+			vecaStrain[i] = &vecViews[i].vector;
+			vecaStress[i] = &vecViews[6 + i].vector;
+			vecbStrain[i] = &vecViews[12 + i].vector;
+			vecbStress[i] = &vecViews[18 + i].vector;
 		}
 			
 		/* For each incident element, find inicident tets. */
@@ -467,7 +477,6 @@ void SPR( void* _context )
 				{
 					Element_GlobalIndex	element_gI;
 					
-					elements = Memory_Alloc_Array( Node_DomainIndex, nodeElementCount, "SnacRemesher" );
 					element_gI = Mesh_ElementMapDomainToGlobal( mesh, element_dI );
 					nLayout->buildElementNodes( nLayout, element_gI, elements );
 				}
@@ -476,7 +485,7 @@ void SPR( void* _context )
 				{
 					unsigned	eltNode_i;
 					
-					for( eltNode_i = 0; eltNode_i < nodeElementCount; eltNode_i++ ) {
+					for( eltNode_i = 0; eltNode_i < 8; eltNode_i++ ) {
 						elements[eltNode_i] = Mesh_NodeMapGlobalToDomain( mesh, elements[eltNode_i] );
 					}
 				}
@@ -541,8 +550,11 @@ void SPR( void* _context )
 		// compute parameter vectors.
 		{
 			int s;
-			gsl_permutation * p = gsl_permutation_alloc (4);
-     
+			gsl_permutation perm;
+			gsl_permutation * p = &perm;
+
+			perm.size = 4;
+			perm.data = permData;
 			gsl_linalg_LU_decomp (matA, p, &s);
 			
 			for(i=0;i<6;i++) {
@@ -551,7 +563,6 @@ void SPR( void* _context )
 			}
 /* 			printf ("x = \n"); */
 /* 			gsl_vector_fprintf (stdout, x, "%g"); */
-			gsl_permutation_free (p);
 		}	
 
 		// zero the arrays to store recovered field.
@@ -570,19 +581,6 @@ void SPR( void* _context )
 				node->stressSPR[j] += gsl_vector_get(vecaStress[j],i+1)*(*coord)[i];
 			}
 		}
-
-		// free gsl vectors and matrix.
-		gsl_matrix_free( matA );
-		gsl_vector_free( vecaplStrain );
-		gsl_vector_free( vecbplStrain );
-		for(i=0;i<6;i++) {
-			gsl_vector_free( vecaStrain[i] );
-			gsl_vector_free( vecaStress[i] );
-			gsl_vector_free( vecbStrain[i] );
-			gsl_vector_free( vecbStress[i] );
-		}
-		/* Free the element node array. */
-		FreeArray( elements );
 	} // end of recovery.
 }
 
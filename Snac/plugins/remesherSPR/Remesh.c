@@ -116,7 +116,9 @@ void _SnacRemesher_Remesh( void* _context, void* data ) {
 			}
 		}
 		
-		_SnacRemesher_RecoverNodes( context );
+		/* Recover the element fields at the nodes, unless they are carried by another plugin. */
+		if( contextExt->interpolateElements )
+			_SnacRemesher_RecoverNodes( context );
 
 		/* Sync the mesh. */
 		if( mesh->layout->decomp->procsInUse > 1 ) {
@@ -159,7 +161,8 @@ void _SnacRemesher_Remesh( void* _context, void* data ) {
 		}
 
 		/* Simply average the recovered fields at the barycenter of each tet and run updateElements. */
-   		_SnacRemesher_InterpolateElements( context );
+		if( contextExt->interpolateElements )
+			_SnacRemesher_InterpolateElements( context );
    		_SnacRemesher_UpdateElements( context );
 		
 		/* Free some space, as it won't be needed until the next remesh. */
@@ -67,8 +67,10 @@ void _SnacRemesher_Build( void* _context, void* data ) {
 	meshExt->botInternToLocal = NULL;
 	meshExt->nTopTriNodes = 0;
 	meshExt->topTriToDomain = NULL;
+	meshExt->topTriGridSize[0] = meshExt->topTriGridSize[1] = 0;
 	meshExt->nBotTriNodes = 0;
 	meshExt->botTriToDomain = NULL;
+	meshExt->botTriGridSize[0] = meshExt->botTriGridSize[1] = 0;
 	meshExt->nYLines = 0;
 	meshExt->yLineLTerm = NULL;
 	meshExt->yLineUTerm = NULL;
@@ -91,10 +91,16 @@
 		unsigned			nBotInternNodes;
 		Node_LocalIndex*	botInternToLocal;
 		
+		/* Surface triangulations: two triangles per cell of a grid over the domain's part of the surface, laid 
+		   out x fastest, starting at the global x,z node indices given by the origin. */
 		unsigned			nTopTriNodes;
 		Node_DomainIndex*	topTriToDomain;
+		unsigned			topTriGridSize[2];
+		unsigned			topTriGridOrigin[2];
 		unsigned			nBotTriNodes;
 		Node_DomainIndex*	botTriToDomain;
+		unsigned			botTriGridSize[2];
+		unsigned			botTriGridOrigin[2];
 		
 		/* Used for interpolating bulk nodes. */
 		unsigned			nYLines;
@@ -143,23 +143,33 @@ void _SnacRemesher_Remesh( void* _context, void* data ) {
 			dstNode->residualFt = srcNode->residualFt;
 		}
 		
-		/* Interpolate current elemental values onto new coordinates. */
-		/* Barycentric coordinates of the old domain hex element set. */
-		meshExt->oldBarycenters = Memory_Alloc_Array( Coord, mesh->elementDomainCount, "OldBarycenters" );
-		/* Barycentric coordinates of the new local hex element set. */
-		meshExt->newBarycenters = Memory_Alloc_Array( Coord, mesh->elementLocalCount, "NewBarycenters" );
-		/* Coefficients for evaluating interpolation weight - function of old barycenters only. */
-		meshExt->barcoef =  Memory_Alloc_Array( SnacRemesher_ElementBarcoef, mesh->elementDomainCount, "BarCoef" );
-		meshExt->barcord =  Memory_Alloc_Array( SnacRemesher_ElementBarcord, mesh->elementLocalCount, "BarCord" );
-		/* Since ghost elements are numbered after local elements, 
-		   a mapping from domain id to an ordered id listis constructed for straightforward interpolation:
-		   i.e. orderedToDomain: ordered ID -> domainID. */
-		meshExt->orderedToDomain =  Memory_Alloc_Array( Element_DomainIndex, mesh->elementDomainCount, "OrderedToDomain" );
-		meshExt->newElements = Memory_Alloc_Array( SnacRemesher_Element, mesh->elementLocalCount, "NewElements" );
-		//memcpy( meshExt->newElements, mesh->element, mesh->elementExtensionMgr->finalSize * mesh->elementDomainCount );
+		/* Interpolate current elemental values onto new coordinates, unless they are carried by another plugin. */
+		if( contextExt->interpolateElements ) {
+			/* Barycentric coordinates of the old domain hex element set. */
+			meshExt->oldBarycenters = Memory_Alloc_Array( Coord, mesh->elementDomainCount, "OldBarycenters" );
+			/* Barycentric coordinates of the new local hex element set. */
+			meshExt->newBarycenters = Memory_Alloc_Array( Coord, mesh->elementLocalCount, "NewBarycenters" );
+			/* Coefficients for evaluating interpolation weight - function of old barycenters only. */
+			meshExt->barcoef =  Memory_Alloc_Array( SnacRemesher_ElementBarcoef, mesh->elementDomainCount, "BarCoef" );
+			meshExt->barcord =  Memory_Alloc_Array( SnacRemesher_ElementBarcord, mesh->elementLocalCount, "BarCord" );
+			/* Since ghost elements are numbered after local elements, 
+			   a mapping from domain id to an ordered id listis constructed for straightforward interpolation:
+			   i.e. orderedToDomain: ordered ID -> domainID. */
+			meshExt->orderedToDomain =  Memory_Alloc_Array( Element_DomainIndex, mesh->elementDomainCount, "OrderedToDomain" );
+			meshExt->newElements = Memory_Alloc_Array( SnacRemesher_Element, mesh->elementLocalCount, "NewElements" );
+			//memcpy( meshExt->newElements, mesh->element, mesh->elementExtensionMgr->finalSize * mesh->elementDomainCount );
 
-		/* Do the linear interpolation between grids of barycenters. */
-		_SnacRemesher_InterpolateElements( context );
+			/* Do the linear interpolation between grids of barycenters. */
+			_SnacRemesher_InterpolateElements( context );
+
+			/* Free some space, as it won't be needed until the next remesh. */
+			Memory_Free( meshExt->oldBarycenters );
+			Memory_Free( meshExt->newBarycenters ); 
+			Memory_Free( meshExt->barcoef );
+			Memory_Free( meshExt->barcord );
+			Memory_Free( meshExt->orderedToDomain ); 
+			Memory_Free( meshExt->newElements );
+		}
 
 		/* Copy accross the new coord, node & element information to the current arrays. */
 		memcpy( mesh->nodeCoord, meshExt->newNodeCoords, mesh->nodeLocalCount * sizeof(Coord) );
@@ -180,13 +190,6 @@ void _SnacRemesher_Remesh( void* _context, void* data ) {
 		_SnacRemesher_UpdateElements( context );
 		
 		/* Free some space, as it won't be needed until the next remesh. */
-		Memory_Free( meshExt->oldBarycenters );
-		Memory_Free( meshExt->newBarycenters ); 
-		Memory_Free( meshExt->barcoef );
-		Memory_Free( meshExt->barcord );
-		Memory_Free( meshExt->orderedToDomain ); 
-		Memory_Free( meshExt->newElements );
-
 		ExtensionManager_Free( mesh->nodeExtensionMgr, meshExt->newNodes );
 		//ExtensionManager_Free( mesh->elementExtensionMgr, meshExt->newElements );
 		meshExt->newNodes = NULL;
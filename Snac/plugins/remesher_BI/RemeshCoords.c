@@ -64,7 +64,9 @@ void _SnacRemesher_NewCoords( void* _context ) {
 							   unsigned			nSurfNodes,
 							   Node_LocalIndex*		surfNodeMap,
 							   unsigned			nTris,
-							   Node_DomainIndex*	triNodeMap );
+							   Node_DomainIndex*	triNodeMap,
+							   unsigned*			gridSize,
+							   unsigned*			gridOrigin );
 
 
 	/*
@@ -90,7 +92,9 @@ void _SnacRemesher_NewCoords( void* _context ) {
 							   meshExt->nBotInternNodes,
 							   meshExt->botInternToLocal,
 							   meshExt->nBotTriNodes,
-							   meshExt->botTriToDomain );
+							   meshExt->botTriToDomain,
+							   meshExt->botTriGridSize,
+							   meshExt->botTriGridOrigin );
 	}
 
 
@@ -102,7 +106,9 @@ void _SnacRemesher_NewCoords( void* _context ) {
 						   meshExt->nTopInternNodes,
 						   meshExt->topInternToLocal,
 						   meshExt->nTopTriNodes,
-						   meshExt->topTriToDomain );
+						   meshExt->topTriToDomain,
+						   meshExt->topTriGridSize,
+						   meshExt->topTriGridOrigin );
 
 
 	/*
@@ -181,10 +187,13 @@ void _SnacRemesher_RemapSurface( void*				_context,
 						   unsigned			nSurfNodes,
 						   Node_LocalIndex*		surfNodeMap,
 						   unsigned			nTriNodes,
-						   Node_DomainIndex*	triNodeMap )
+						   Node_DomainIndex*	triNodeMap,
+						   unsigned*			gridSize,
+						   unsigned*			gridOrigin )
 {
 	Snac_Context*			context = (Snac_Context*)_context;
 	Mesh*				mesh = context->mesh;
+	HexaMD*				decomp = (HexaMD*)mesh->layout->decomp;
 	SnacRemesher_Mesh*		meshExt = ExtensionManager_Get(
 							context->meshExtensionMgr,
 							mesh,
@@ -193,9 +202,10 @@ void _SnacRemesher_RemapSurface( void*				_context,
 
 	Bool _SnacRemesher_PointInTri( Coord pnt, Coord a, Coord b, Coord c );
 	void _SnacRemesher_TriBarycenter( Coord tri[3], Coord pnt, Coord dst );
+	Bool _SnacRemesher_InterpolateInTri( Mesh* mesh, Node_DomainIndex* triNodes, Coord newCoord, Coord center );
 
 
-	if( nSurfNodes == 0 ) {
+	if( nSurfNodes == 0 || nTriNodes == 0 ) {
 		return;
 	}
 
@@ -208,46 +218,109 @@ void _SnacRemesher_RemapSurface( void*				_context,
 	for( surfNode_i = 0; surfNode_i < nSurfNodes; surfNode_i++ ) {
 		Node_LocalIndex	lNodeInd = surfNodeMap[surfNode_i];
 		Coord			newCoord;
+		Coord			center;
+		IJK				pos;
+		int				cell[2];
+		unsigned			step_i;
 		unsigned			triNode_i;
+		Bool			found = False;
 
 		/* Grab the new x and z coords. */
 		newCoord[0] = meshExt->newNodeCoords[lNodeInd][0];
 		newCoord[1] = 0.0;
 		newCoord[2] = meshExt->newNodeCoords[lNodeInd][2];
 
-		/* Find the triangle it's in and interpolate. */
-		for( triNode_i = 0; triNode_i < nTriNodes; triNode_i += 3 ) {
-			Coord	tri[3];
+		/* Start from the cell the node heads in the grid and walk towards the point: the old surface has only 
+		   drifted since the last remesh, so this rarely takes more than a step or two. */
+		RegularMeshUtils_Node_1DTo3D( decomp, Mesh_NodeMapLocalToGlobal( mesh, lNodeInd ), &pos[0], &pos[1], &pos[2] );
+		cell[0] = (int)pos[0] - (int)gridOrigin[0];
+		cell[1] = (int)pos[2] - (int)gridOrigin[1];
+		for( step_i = 0; step_i < gridSize[0] + gridSize[1]; step_i++ ) {
+			Node_DomainIndex*	triNodes;
+			Coord			tri[3];
+			int				prev[2];
+			unsigned			d_i;
+
+			for( d_i = 0; d_i < 2; d_i++ ) {
+				if( cell[d_i] < 0 ) cell[d_i] = 0;
+				if( cell[d_i] >= (int)gridSize[d_i] ) cell[d_i] = gridSize[d_i] - 1;
+			}
+			triNodes = triNodeMap + (cell[1] * gridSize[0] + cell[0]) * 6;
+			if( triNodes[0] >= mesh->nodeDomainCount ) {
+				break;
+			}
+			if( _SnacRemesher_InterpolateInTri( mesh, triNodes, newCoord, center ) || 
+			    _SnacRemesher_InterpolateInTri( mesh, triNodes + 3, newCoord, center ) )
+			{
+				found = True;
+				break;
+			}
 
-			/* Collect the coords of the tri and clear the y component. */
-			Vector_Set( tri[0], mesh->nodeCoord[triNodeMap[triNode_i + 0]] );
+			/* The first triangle's barycentric coords about its 2nd and 3rd nodes are the cell's local x and z. */
+			Vector_Set( tri[0], mesh->nodeCoord[triNodes[0]] );
 			tri[0][1] = 0.0;
-			Vector_Set( tri[1], mesh->nodeCoord[triNodeMap[triNode_i + 1]] );
+			Vector_Set( tri[1], mesh->nodeCoord[triNodes[1]] );
 			tri[1][1] = 0.0;
-			Vector_Set( tri[2], mesh->nodeCoord[triNodeMap[triNode_i + 2]] );
+			Vector_Set( tri[2], mesh->nodeCoord[triNodes[2]] );
 			tri[2][1] = 0.0;
+			_SnacRemesher_TriBarycenter( tri, newCoord, center );
+			prev[0] = cell[0];
+			prev[1] = cell[1];
+			if( center[1] < 0.0 && cell[0] > 0 ) cell[0]--;
+			else if( center[1] > 1.0 && cell[0] < (int)gridSize[0] - 1 ) cell[0]++;
+			if( center[2] < 0.0 && cell[1] > 0 ) cell[1]--;
+			else if( center[2] > 1.0 && cell[1] < (int)gridSize[1] - 1 ) cell[1]++;
+			if( cell[0] == prev[0] && cell[1] == prev[1] ) {
+				break;
+			}
+		}
+
+		/* The walk can stall against holes or folds in the old surface: search the lot. */
+		for( triNode_i = 0; !found && triNode_i < nTriNodes; triNode_i += 3 ) {
+			if( triNodeMap[triNode_i] < mesh->nodeDomainCount ) {
+				found = _SnacRemesher_InterpolateInTri( mesh, triNodeMap + triNode_i, newCoord, center );
+			}
+		}
+
+		/* Update the y-axis of the new node coords.  Note that if the new coord couldn't be projected onto the 
+		   triangulated surface (the mesh has either contracted too far, drifted too far or there is not enough 
+		   shadow depth), then the current y coord will be left as is. */
+		if( found ) {
+			meshExt->newNodeCoords[lNodeInd][1] = newCoord[1];
+		}
+	}
+}
 
-			if( _SnacRemesher_PointInTri( newCoord, tri[0], tri[1], tri[2] ) == True ) {
-				Coord	center;
 
-				/* Calculate the barycentric coords of the new point in the triangle, then
-				   interpolate. */
-				_SnacRemesher_TriBarycenter( tri, newCoord, center );
-				newCoord[1] = center[0] * mesh->nodeCoord[triNodeMap[triNode_i + 0]][1] +
-						    center[1] * mesh->nodeCoord[triNodeMap[triNode_i + 1]][1] +
-						    center[2] * mesh->nodeCoord[triNodeMap[triNode_i + 2]][1];
+/*
+** If the point lies in the triangle's projection on the x-z plane, interpolate its y coord there.
+*/
 
-				/* Update the y-axis of the new node coords. */
-				meshExt->newNodeCoords[lNodeInd][1] = newCoord[1];
+Bool _SnacRemesher_InterpolateInTri( Mesh* mesh, Node_DomainIndex* triNodes, Coord newCoord, Coord center ) {
+	Coord	tri[3];
+	
+	Bool _SnacRemesher_PointInTri( Coord pnt, Coord a, Coord b, Coord c );
+	void _SnacRemesher_TriBarycenter( Coord tri[3], Coord pnt, Coord dst );
 
-				break;
-			}
-		}
+	/* Collect the coords of the tri and clear the y component. */
+	Vector_Set( tri[0], mesh->nodeCoord[triNodes[0]] );
+	tri[0][1] = 0.0;
+	Vector_Set( tri[1], mesh->nodeCoord[triNodes[1]] );
+	tri[1][1] = 0.0;
+	Vector_Set( tri[2], mesh->nodeCoord[triNodes[2]] );
+	tri[2][1] = 0.0;
 
-		/* Note that if the new coord couldn't be projected onto the triangulated surface (the mesh has either
-		   contracted too far, drifted too far or there is not enough shadow depth), then the current y coord will
-		   be left as is. */
+	if( _SnacRemesher_PointInTri( newCoord, tri[0], tri[1], tri[2] ) == False ) {
+		return False;
 	}
+
+	/* Calculate the barycentric coords of the new point in the triangle, then interpolate. */
+	_SnacRemesher_TriBarycenter( tri, newCoord, center );
+	newCoord[1] = center[0] * mesh->nodeCoord[triNodes[0]][1] +
+		      center[1] * mesh->nodeCoord[triNodes[1]][1] +
+		      center[2] * mesh->nodeCoord[triNodes[2]][1];
+
+	return True;
 }
 
 
@@ -44,15 +44,24 @@
 #include <math.h>
 #include <assert.h>
 
+static void _Snac_Heat(
+		Snac_Context*			context,
+		Node_LocalIndex			node_lI,
+		double				sourceterm,
+		ExtensionView			nodeView,
+		ExtensionView			elementView );
+
 void SnacTemperature_LoopNodes( void* _context ) {
 	Snac_Context*			context = (Snac_Context*)_context;
 	Node_LocalIndex			node_lI;
+	ExtensionView			nodeView = Snac_Node_ExtensionView( context, SnacTemperature_NodeHandle );
+	ExtensionView			elementView = Snac_Element_ExtensionView( context, SnacTemperature_ElementHandle );
 
 	Journal_Printf( context->debug, "In %s(): updating temperature of all nodes.\n", __func__ );
 	//Journal_Printf( context->snacInfo, "In %s(): updating temperature of all nodes.\n", __func__ );
 
 	for( node_lI = 0; node_lI < context->mesh->nodeLocalCount; node_lI++ )  {
-		Snac_Heat( context, node_lI, 0 );
+		_Snac_Heat( context, node_lI, 0, nodeView, elementView );
 	}
 
 	/* update tetra average temp to recompute density later in Snac_Stress(). */
@@ -63,14 +72,25 @@ void SnacTemperature_LoopNodes( void* _context ) {
 
 void Snac_Heat( void* _context, Node_LocalIndex node_lI, double sourceterm ) {
 	Snac_Context*			context = (Snac_Context*)_context;
-	SnacTemperature_Context*	contextExt = ExtensionManager_Get(
-						context->extensionMgr,
-						context,
-						SnacTemperature_ContextHandle );
+
+	_Snac_Heat(
+		context,
+		node_lI,
+		sourceterm,
+		Snac_Node_ExtensionView( context, SnacTemperature_NodeHandle ),
+		Snac_Element_ExtensionView( context, SnacTemperature_ElementHandle ) );
+}
+
+static void _Snac_Heat(
+		Snac_Context*			context,
+		Node_LocalIndex			node_lI,
+		double				sourceterm,
+		ExtensionView			nodeView,
+		ExtensionView			elementView )
+{
 	Node_ElementIndex		nodeElement_I;
 	Node_ElementIndex		nodeElementCount;
-	Snac_Node*			node = Snac_Node_At( context, node_lI );
-	SnacTemperature_Node*		nodeExt = ExtensionManager_Get( context->mesh->nodeExtensionMgr, node, SnacTemperature_NodeHandle );
+	SnacTemperature_Node*		nodeExt = ExtensionView_At( nodeView, node_lI );
 	double				energy=0.0f, source=0.0f, dt_thermal_to_mech=0.0f;
 	double				lumpVolume=0.0f;
 
@@ -84,10 +104,7 @@ void Snac_Heat( void* _context, Node_LocalIndex node_lI, double sourceterm ) {
 		if( element_lI < context->mesh->elementDomainCount ) {
 			Snac_Element*			element = Snac_Element_At( context, element_lI );
 			const Snac_Material* material = &context->materialProperty[element->material_I];
-			SnacTemperature_Element*	elementExt = ExtensionManager_Get(
-								context->mesh->elementExtensionMgr,
-								element,
-								SnacTemperature_ElementHandle );
+			SnacTemperature_Element*	elementExt = ExtensionView_At( elementView, element_lI );
 			Index				index;
 
 			for( index = 0; index < Node_Element_Tetrahedra_Count; index++ ) {
@@ -147,6 +164,7 @@ void UpdateAverageTemp_LoopElements( void* _context )
 	Element_LocalIndex      element_lI;
 	Tetrahedra_Index	    tetra_I;
 	Index                   tetraNode_I;
+	ExtensionView           nodeView = Snac_Node_ExtensionView( context, SnacTemperature_NodeHandle );
 
 	for( element_lI = 0; element_lI < context->mesh->elementLocalCount; element_lI++ ) {
 		Snac_Element*		element = Snac_Element_At( context, element_lI );
@@ -156,14 +174,9 @@ void UpdateAverageTemp_LoopElements( void* _context )
 
 			tetra->avgTemp = 0.0;
 			for(tetraNode_I = 0; tetraNode_I < Tetrahedra_Point_Count; tetraNode_I++ ) {
-				Snac_Node* contributingNode = Snac_Element_Node_P(
-					context,
-					element_lI,
-					TetraToNode[tetra_I][tetraNode_I] );
-				SnacTemperature_Node* temperatureNodeExt = ExtensionManager_Get(
-					context->mesh->nodeExtensionMgr,
-					contributingNode,
-					SnacTemperature_NodeHandle );
+				SnacTemperature_Node* temperatureNodeExt = ExtensionView_At(
+					nodeView,
+					Snac_Element_Node_I( context, element_lI, TetraToNode[tetra_I][tetraNode_I] ) );
 
 				tetra->avgTemp += temperatureNodeExt->temperature/(1.0f*Tetrahedra_Point_Count);
 			}
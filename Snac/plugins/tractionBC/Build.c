@@ -0,0 +1,112 @@
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+**
+** Copyright (C), 2003,
+**	Steve Quenette, 110 Victoria Street, Melbourne, Victoria, 3053, Australia.
+**	Californian Institute of Technology, 1200 East California Boulevard, Pasadena, California, 91125, USA.
+**	University of Texas, 1 University Station, Austin, Texas, 78712, USA.
+**
+** Authors:
+**	Stevan M. Quenette, Senior Software Engineer, VPAC. (steve@vpac.org)
+**	Stevan M. Quenette, Visitor in Geophysics, Caltech.
+**	Luc Lavier, Research Scientist, The University of Texas. (luc@utig.ug.utexas.edu)
+**	Luc Lavier, Research Scientist, Caltech.
+**
+** This program is free software; you can redistribute it and/or modify it
+** under the terms of the GNU General Public License as published by the
+** Free Software Foundation; either version 2, or (at your option) any
+** later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program; if not, write to the Free Software
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+**
+** $Id: Build.c $
+**
+**~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#include <mpi.h>
+#include <StGermain/StGermain.h>
+#include <StGermain/FD/FD.h>
+#include "Snac/Snac.h"
+#include "types.h"
+#include "Context.h"
+#include "Force.h"
+#include "Register.h"
+#include "Build.h"
+#include <stdio.h>
+
+void _SnacTractionBC_Build( void* _context, void* data ) {
+	Snac_Context*			context = (Snac_Context*)_context;
+	SnacTractionBC_Context*		contextExt = ExtensionManager_Get(
+						context->extensionMgr,
+						context,
+						SnacTractionBC_ContextHandle );
+	Mesh*				mesh = context->mesh;
+	HexaMD*				decomp = (HexaMD*)mesh->layout->decomp;
+	const double			factor4 = 1.0f / 4.0f;
+	Index				pass;
+	
+	#ifdef DEBUG
+		printf( "In: %s()\n", __func__ );
+	#endif
+	
+	/* Count the faces, then fill them in. */
+	contextExt->faces = NULL;
+	for( pass = 0; pass < 2; pass++ ) {
+		Node_LocalIndex			node_lI;
+		
+		contextExt->faceCount = 0;
+		for( node_lI = 0; node_lI < mesh->nodeLocalCount; node_lI++ ) {
+			Node_GlobalIndex		node_gI = mesh->nodeL2G[node_lI];
+			IJK				ijk;
+			Node_ElementIndex		nodeElement_I;
+			
+			/* Only the "right" wall is loaded. */
+			RegularMeshUtils_Node_1DTo3D( decomp, node_gI, &ijk[0], &ijk[1], &ijk[2] );
+			if( ijk[0] != decomp->nodeGlobal3DCounts[0] - 1 )
+				continue;
+			
+			for( nodeElement_I = 0; nodeElement_I < mesh->nodeElementCountTbl[node_lI]; nodeElement_I++ ) {
+				Element_DomainIndex		element_dI = mesh->nodeElementTbl[node_lI][nodeElement_I];
+				
+				if( element_dI >= mesh->elementDomainCount )
+					continue;
+				if( contextExt->faces ) {
+					SnacTractionBC_Face*		face = &contextExt->faces[contextExt->faceCount];
+					
+					face->node_lI = node_lI;
+					face->element_dI = element_dI;
+					face->weight = factor4;
+				}
+				contextExt->faceCount++;
+			}
+		}
+		
+		if( pass == 0 ) 
+			contextExt->faces = Memory_Alloc_Array( SnacTractionBC_Face, contextExt->faceCount + 1, "SnacTractionBC" );
+	}
+}
+
+
+void _SnacTractionBC_DeleteExtensions( void* _context, void* data ) {
+	Snac_Context*			context = (Snac_Context*)_context;
+	SnacTractionBC_Context*		contextExt = ExtensionManager_Get(
+						context->extensionMgr,
+						context,
+						SnacTractionBC_ContextHandle );
+	
+	#ifdef DEBUG
+		printf( "In: %s()\n", __func__ );
+	#endif
+	
+	if( contextExt->faces ) {
+		Memory_Free( contextExt->faces );
+		contextExt->faces = NULL;
+	}
+	contextExt->faceCount = 0;
+}
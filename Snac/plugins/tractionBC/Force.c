@@ -34,31 +34,35 @@
 #include <StGermain/FD/FD.h>
 #include "Snac/Snac.h"
 #include "types.h"
+#include "Context.h"
 #include "Force.h"
 #include "Register.h"
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
 
-void _SnacTractionBC_Force_Apply(
+/* The two outward facing surface triangles of the "right" face of an element: the only wall loaded, for now */
+const Index SnacTractionBC_FaceTriangles[2][3] = { { 1, 2, 6 }, { 1, 6, 5 } };
+
+
+void _SnacTractionBC_Force_Apply_Range(
 		void*				_context,
-		Node_LocalIndex			node_lI,
+		Node_LocalIndex			begin,
+		Node_LocalIndex			end,
 		double				speedOfSound,
 		Mass*				mass,
-		Mass*				inertialMass,
-		Force*				force,
 		Force*				balance )
 {
 	Snac_Context*			context = (Snac_Context*)_context;
-	MeshLayout*				meshLayout = (MeshLayout*)context->meshLayout;
-	double					area, normal1[3], normal2[3], normal[3];
-	Node_ElementIndex		nodeElement_I, nodeElementCount;
-	const double			factor4 = 1.0f / 4.0f;
-
-	/* loop over all the elements surrounding node_dI */
-	HexaMD*					decomp = (HexaMD*)meshLayout->decomp;
-	Node_GlobalIndex		node_gI = context->mesh->nodeL2G[node_lI];
-	IJK						ijk;
+	SnacTractionBC_Context*		contextExt = ExtensionManager_Get(
+						context->extensionMgr,
+						context,
+						SnacTractionBC_ContextHandle );
+	SnacTractionBC_Face*		faces = contextExt->faces;
+	double				area, normal1[3], normal2[3], normal[3];
+	Index				first = 0;
+	Index				last = contextExt->faceCount;
+	Index				face_I;
 	
 	double 				 	pressure;
 	StressTensor 			stress;
@@ -75,196 +79,64 @@ void _SnacTractionBC_Force_Apply(
 	stress[2][1] = 0.0;
 	stress[2][2] = 0.0;
 	
-	RegularMeshUtils_Node_1DTo3D( decomp, node_gI, &ijk[0], &ijk[1], &ijk[2] );
-
-#if 0
-	if(ijk[0]==0) { /* for the "left" wall. */
-		nodeElementCount = context->mesh->nodeElementCountTbl[node_lI];
-		for( nodeElement_I = 0; nodeElement_I < nodeElementCount; nodeElement_I++ ) {
-			Element_LocalIndex		element_lI = context->mesh->nodeElementTbl[node_lI][nodeElement_I];
-
-			if( element_lI < context->mesh->elementDomainCount ) {
-				/* for the "left" face of the elements on the "left" wall. */
-				area = Tetrahedra_SurfaceArea( Snac_Element_NodeCoord( context, element_lI, 0 ),
-											   Snac_Element_NodeCoord( context, element_lI, 7 ),
-											   Snac_Element_NodeCoord( context, element_lI, 3 ) ) +
-					Tetrahedra_SurfaceArea( Snac_Element_NodeCoord( context, element_lI, 0 ),
-											Snac_Element_NodeCoord( context, element_lI, 4 ),
-											Snac_Element_NodeCoord( context, element_lI, 7 ) );
-				Tetrahedra_SurfaceNormal( Snac_Element_NodeCoord( context, element_lI, 0 ),
-										  Snac_Element_NodeCoord( context, element_lI, 7 ),
-										  Snac_Element_NodeCoord( context, element_lI, 3 ),
-										  &normal1 );
-				Tetrahedra_SurfaceNormal( Snac_Element_NodeCoord( context, element_lI, 0 ),
-										  Snac_Element_NodeCoord( context, element_lI, 4 ),
-										  Snac_Element_NodeCoord( context, element_lI, 7 ),
-										  &normal2 );
-#endif
-#if 0
-	if(ijk[1]==0) { /* for the "bottom" wall. */
-		nodeElementCount = context->mesh->nodeElementCountTbl[node_lI];
-		for( nodeElement_I = 0; nodeElement_I < nodeElementCount; nodeElement_I++ ) {
-			Element_LocalIndex		element_lI = context->mesh->nodeElementTbl[node_lI][nodeElement_I];
-
-			if( element_lI < context->mesh->elementDomainCount ) {
-				/* for the "bottom" face of the elements on the "bottom" wall. */
-				area = Tetrahedra_SurfaceArea( Snac_Element_NodeCoord( context, element_lI, 0 ),
-											   Snac_Element_NodeCoord( context, element_lI, 1 ),
-											   Snac_Element_NodeCoord( context, element_lI, 5 ) ) +
-					Tetrahedra_SurfaceArea( Snac_Element_NodeCoord( context, element_lI, 0 ),
-											Snac_Element_NodeCoord( context, element_lI, 5 ),
-											Snac_Element_NodeCoord( context, element_lI, 4 ) );
-				Tetrahedra_SurfaceNormal( Snac_Element_NodeCoord( context, element_lI, 0 ),
-										  Snac_Element_NodeCoord( context, element_lI, 1 ),
-										  Snac_Element_NodeCoord( context, element_lI, 5 ),
-										  &normal1 );
-				Tetrahedra_SurfaceNormal( Snac_Element_NodeCoord( context, element_lI, 0 ),
-										  Snac_Element_NodeCoord( context, element_lI, 5 ),
-										  Snac_Element_NodeCoord( context, element_lI, 4 ),
-										  &normal2 );
-#endif
-#if 0
-	if(ijk[1]==0) { /* for the "bottom" wall. */
-		nodeElementCount = context->mesh->nodeElementCountTbl[node_lI];
-		for( nodeElement_I = 0; nodeElement_I < nodeElementCount; nodeElement_I++ ) {
-			Element_LocalIndex		element_lI = context->mesh->nodeElementTbl[node_lI][nodeElement_I];
-
-			if( element_lI < context->mesh->elementDomainCount ) {
-				/* for the "bottom" face of the elements on the "bottom" wall. */
-				area = Tetrahedra_SurfaceArea( Snac_Element_NodeCoord( context, element_lI, 0 ),
-											   Snac_Element_NodeCoord( context, element_lI, 1 ),
-											   Snac_Element_NodeCoord( context, element_lI, 5 ) ) +
-					Tetrahedra_SurfaceArea( Snac_Element_NodeCoord( context, element_lI, 0 ),
-											Snac_Element_NodeCoord( context, element_lI, 5 ),
-											Snac_Element_NodeCoord( context, element_lI, 4 ) );
-				Tetrahedra_SurfaceNormal( Snac_Element_NodeCoord( context, element_lI, 0 ),
-										  Snac_Element_NodeCoord( context, element_lI, 1 ),
-										  Snac_Element_NodeCoord( context, element_lI, 5 ),
-										  &normal1 );
-				Tetrahedra_SurfaceNormal( Snac_Element_NodeCoord( context, element_lI, 0 ),
-										  Snac_Element_NodeCoord( context, element_lI, 5 ),
-										  Snac_Element_NodeCoord( context, element_lI, 4 ),
-										  &normal2 );
-#endif
-#if 0
-	if(ijk[1]==(decomp->nodeGlobal3DCounts[1]-1)) { /* for the "top" wall. */
-		nodeElementCount = context->mesh->nodeElementCountTbl[node_lI];
-		for( nodeElement_I = 0; nodeElement_I < nodeElementCount; nodeElement_I++ ) {
-			Element_LocalIndex		element_lI = context->mesh->nodeElementTbl[node_lI][nodeElement_I];
-
-			if( element_lI < context->mesh->elementDomainCount ) {
-				/* for the "top" face of the elements on the "top" wall. */
-				area = Tetrahedra_SurfaceArea( Snac_Element_NodeCoord( context, element_lI, 2 ),
-											   Snac_Element_NodeCoord( context, element_lI, 3 ),
-											   Snac_Element_NodeCoord( context, element_lI, 7 ) ) +
-					Tetrahedra_SurfaceArea( Snac_Element_NodeCoord( context, element_lI, 2 ),
-											Snac_Element_NodeCoord( context, element_lI, 7 ),
-											Snac_Element_NodeCoord( context, element_lI, 6 ) );
-				Tetrahedra_SurfaceNormal( Snac_Element_NodeCoord( context, element_lI, 2 ),
-										  Snac_Element_NodeCoord( context, element_lI, 3 ),
-										  Snac_Element_NodeCoord( context, element_lI, 7 ),
-										  &normal1 );
-				Tetrahedra_SurfaceNormal( Snac_Element_NodeCoord( context, element_lI, 2 ),
-										  Snac_Element_NodeCoord( context, element_lI, 7 ),
-										  Snac_Element_NodeCoord( context, element_lI, 6 ),
-										  &normal2 );
-#endif
-#if 0
-	if(ijk[2]==0)) { /* for the "back" wall. */
-		nodeElementCount = context->mesh->nodeElementCountTbl[node_lI];
-		for( nodeElement_I = 0; nodeElement_I < nodeElementCount; nodeElement_I++ ) {
-			Element_LocalIndex		element_lI = context->mesh->nodeElementTbl[node_lI][nodeElement_I];
-
-			if( element_lI < context->mesh->elementDomainCount ) {
-				/* for the "back" face of the elements on the "back" wall. */
-				area = Tetrahedra_SurfaceArea( Snac_Element_NodeCoord( context, element_lI, 0 ),
-											   Snac_Element_NodeCoord( context, element_lI, 2 ),
-											   Snac_Element_NodeCoord( context, element_lI, 1 ) ) +
-					Tetrahedra_SurfaceArea( Snac_Element_NodeCoord( context, element_lI, 0 ),
-											Snac_Element_NodeCoord( context, element_lI, 3 ),
-											Snac_Element_NodeCoord( context, element_lI, 2 ) );
-				Tetrahedra_SurfaceNormal( Snac_Element_NodeCoord( context, element_lI, 0 ),
-										  Snac_Element_NodeCoord( context, element_lI, 2 ),
-										  Snac_Element_NodeCoord( context, element_lI, 1 ),
-										  &normal1 );
-				Tetrahedra_SurfaceNormal( Snac_Element_NodeCoord( context, element_lI, 0 ),
-										  Snac_Element_NodeCoord( context, element_lI, 3 ),
-										  Snac_Element_NodeCoord( context, element_lI, 2 ),
-										  &normal2 );
-#endif
-#if 0
-	if(ijk[2]==(decomp->nodeGlobal3DCounts[2]-1)) { /* for the "front" wall. */
-		nodeElementCount = context->mesh->nodeElementCountTbl[node_lI];
-		for( nodeElement_I = 0; nodeElement_I < nodeElementCount; nodeElement_I++ ) {
-			Element_LocalIndex		element_lI = context->mesh->nodeElementTbl[node_lI][nodeElement_I];
-
-			if( element_lI < context->mesh->elementDomainCount ) {
-				/* for the "front" face of the elements on the "front" wall. */
-				area = Tetrahedra_SurfaceArea( Snac_Element_NodeCoord( context, element_lI, 4 ),
-											   Snac_Element_NodeCoord( context, element_lI, 5 ),
-											   Snac_Element_NodeCoord( context, element_lI, 6 ) ) +
-					Tetrahedra_SurfaceArea( Snac_Element_NodeCoord( context, element_lI, 4 ),
-											Snac_Element_NodeCoord( context, element_lI, 6 ),
-											Snac_Element_NodeCoord( context, element_lI, 7 ) );
-				Tetrahedra_SurfaceNormal( Snac_Element_NodeCoord( context, element_lI, 4 ),
-										  Snac_Element_NodeCoord( context, element_lI, 5 ),
-										  Snac_Element_NodeCoord( context, element_lI, 6 ),
-										  &normal1 );
-				Tetrahedra_SurfaceNormal( Snac_Element_NodeCoord( context, element_lI, 4 ),
-										  Snac_Element_NodeCoord( context, element_lI, 6 ),
-										  Snac_Element_NodeCoord( context, element_lI, 7 ),
-										  &normal2 );
-#endif
-	if(ijk[0]==(decomp->nodeGlobal3DCounts[0]-1)) { /* for the "right" wall. */
-		nodeElementCount = context->mesh->nodeElementCountTbl[node_lI];
-		for( nodeElement_I = 0; nodeElement_I < nodeElementCount; nodeElement_I++ ) {
-			Element_LocalIndex		element_lI = context->mesh->nodeElementTbl[node_lI][nodeElement_I];
-
-			if( element_lI < context->mesh->elementDomainCount ) {
-				/* for the "right" face of the elements on the "right" wall. */
-				area = Tetrahedra_SurfaceArea( Snac_Element_NodeCoord( context, element_lI, 1 ),
-											   Snac_Element_NodeCoord( context, element_lI, 2 ),
-											   Snac_Element_NodeCoord( context, element_lI, 6 ) ) +
-					Tetrahedra_SurfaceArea( Snac_Element_NodeCoord( context, element_lI, 1 ),
-											Snac_Element_NodeCoord( context, element_lI, 6 ),
-											Snac_Element_NodeCoord( context, element_lI, 5 ) );
-				Tetrahedra_SurfaceNormal( Snac_Element_NodeCoord( context, element_lI, 1 ),
-										  Snac_Element_NodeCoord( context, element_lI, 2 ),
-										  Snac_Element_NodeCoord( context, element_lI, 6 ),
-										  &normal1 );
-				Tetrahedra_SurfaceNormal( Snac_Element_NodeCoord( context, element_lI, 1 ),
-										  Snac_Element_NodeCoord( context, element_lI, 6 ),
-										  Snac_Element_NodeCoord( context, element_lI, 5 ),
-										  &normal2 );
-				
-				normal[0] = 0.5f * ( normal1[0] + normal2[0] );
-				normal[1] = 0.5f * ( normal1[1] + normal2[1] );
-				normal[2] = 0.5f * ( normal1[2] + normal2[2] );
-				
+	/* Only the nodes with faces in the list are loaded: find the first of the range. */
+	while( first < last ) {
+		Index		middle = first + (last - first) / 2;
+		
+		if( faces[middle].node_lI < begin )
+			first = middle + 1;
+		else
+			last = middle;
+	}
+	
+	for( face_I = first; face_I < contextExt->faceCount && faces[face_I].node_lI < end; face_I++ ) {
+		Node_LocalIndex			node_lI = faces[face_I].node_lI;
+		Element_DomainIndex		element_dI = faces[face_I].element_dI;
+		const Index			(*triangle)[3] = SnacTractionBC_FaceTriangles;
+		Force*				force = &Snac_Node_At( context, node_lI )->force;
+		Force*				nodeBalance = &balance[node_lI - begin];
+		
+		area = Tetrahedra_SurfaceArea( Snac_Element_NodeCoord( context, element_dI, triangle[0][0] ),
+									   Snac_Element_NodeCoord( context, element_dI, triangle[0][1] ),
+									   Snac_Element_NodeCoord( context, element_dI, triangle[0][2] ) ) +
+			Tetrahedra_SurfaceArea( Snac_Element_NodeCoord( context, element_dI, triangle[1][0] ),
+									Snac_Element_NodeCoord( context, element_dI, triangle[1][1] ),
+									Snac_Element_NodeCoord( context, element_dI, triangle[1][2] ) );
+		Tetrahedra_SurfaceNormal( Snac_Element_NodeCoord( context, element_dI, triangle[0][0] ),
+								  Snac_Element_NodeCoord( context, element_dI, triangle[0][1] ),
+								  Snac_Element_NodeCoord( context, element_dI, triangle[0][2] ),
+								  &normal1 );
+		Tetrahedra_SurfaceNormal( Snac_Element_NodeCoord( context, element_dI, triangle[1][0] ),
+								  Snac_Element_NodeCoord( context, element_dI, triangle[1][1] ),
+								  Snac_Element_NodeCoord( context, element_dI, triangle[1][2] ),
+								  &normal2 );
+		
+		normal[0] = 0.5f * ( normal1[0] + normal2[0] );
+		normal[1] = 0.5f * ( normal1[1] + normal2[1] );
+		normal[2] = 0.5f * ( normal1[2] + normal2[2] );
+		
 #if 0
-				/* Directly applying tractions [N/m^2]. */
-				(*force)[0] += factor4 * area * traction[0];
-				(*force)[1] += factor4 * area * traction[1];
-				(*force)[2] += factor4 * area * traction[2];
+		/* Directly applying tractions [N/m^2]. */
+		(*force)[0] += faces[face_I].weight * area * traction[0];
+		(*force)[1] += faces[face_I].weight * area * traction[1];
+		(*force)[2] += faces[face_I].weight * area * traction[2];
 #endif
 #if 0
-				/* When a pressure is the source. */
-				(*force)[0] += factor4 * ( pressure * area * normal[0] );
-				(*force)[1] += factor4 * ( pressure * area * normal[1] );
-				(*force)[2] += factor4 * ( pressure * area * normal[2] );
+		/* When a pressure is the source. */
+		(*force)[0] += faces[face_I].weight * ( pressure * area * normal[0] );
+		(*force)[1] += faces[face_I].weight * ( pressure * area * normal[1] );
+		(*force)[2] += faces[face_I].weight * ( pressure * area * normal[2] );
 #endif
-				/* When a full stress tensor is the source. */
-				(*force)[0] += factor4 * area *
-					( stress[0][0]*normal[0]+stress[0][1]*normal[1]+stress[0][2]*normal[2] );
-				(*force)[1] += factor4 * area *
-					( stress[1][0]*normal[0]+stress[1][1]*normal[1]+stress[1][2]*normal[2] );
-				(*force)[2] += factor4 * area *
-					( stress[2][0]*normal[0]+stress[2][1]*normal[1]+stress[2][2]*normal[2] );
-				
-				(*balance)[0] += fabs( (*force)[0] );
-				(*balance)[1] += fabs( (*force)[1] );
-				(*balance)[2] += fabs( (*force)[2] );
-			}
-		}
+		/* When a full stress tensor is the source. */
+		(*force)[0] += faces[face_I].weight * area *
+			( stress[0][0]*normal[0]+stress[0][1]*normal[1]+stress[0][2]*normal[2] );
+		(*force)[1] += faces[face_I].weight * area *
+			( stress[1][0]*normal[0]+stress[1][1]*normal[1]+stress[1][2]*normal[2] );
+		(*force)[2] += faces[face_I].weight * area *
+			( stress[2][0]*normal[0]+stress[2][1]*normal[1]+stress[2][2]*normal[2] );
+		
+		(*nodeBalance)[0] += fabs( (*force)[0] );
+		(*nodeBalance)[1] += fabs( (*force)[1] );
+		(*nodeBalance)[2] += fabs( (*force)[2] );
 	}
 }
@@ -26,7 +26,7 @@
 ** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 **
 ** Role:
-**	Handles the temperature initial and boundary conditions
+**	Applies tractions to the forces of the nodes on the loaded walls
 **
 ** Assumptions:
 **	None as yet.
@@ -41,13 +41,15 @@
 #ifndef __SnacTractionBC_Force_h__
 #define __SnacTractionBC_Force_h__
 
-	void _SnacTractionBC_Force_Apply(
+	extern const Index SnacTractionBC_FaceTriangles[2][3];
+
+	/* Add the tractions on the loaded walls to the forces of nodes [begin,end), streaming through the face list */
+	void _SnacTractionBC_Force_Apply_Range(
 		void*				context,
-		Node_LocalIndex			node_lI,
+		Node_LocalIndex			begin,
+		Node_LocalIndex			end,
 		double				speedOfSound,
 		Mass*				mass,
-		Mass*				inertialMass,
-		Force*				force,
 		Force*				balance );
 
-#endif /* __SnacTractionBC_Forc_h__ */
+#endif /* __SnacTractionBC_Force_h__ */
@@ -35,12 +35,16 @@
 #include <StGermain/FD/FD.h>
 #include "Snac/Snac.h"
 #include "types.h"
+#include "Context.h"
 #include "Force.h"
+#include "Build.h"
 #include "Register.h"
 
 /* Textual name of this class */
 const Type SnacTractionBC_Type = "SnacTractionBC";
 
+ExtensionInfo_Index SnacTractionBC_ContextHandle;
+
 
 Index _SnacTractionBC_Register( PluginsManager* pluginsMgr ) {
 	return PluginsManager_Submit( pluginsMgr, 
@@ -76,9 +80,23 @@ void _SnacTractionBC_Construct( void* component, Stg_ComponentFactory* cf, void*
 	#endif
 
 	/* Add extensions to nodes, elements and the context */
+	SnacTractionBC_ContextHandle = ExtensionManager_Add( context->extensionMgr, SnacTractionBC_Type, 
+		sizeof(SnacTractionBC_Context) );
+
+	/* Add extensions to the entry points */
 	EntryPoint_Append(
+		Context_GetEntryPoint( context, AbstractContext_EP_Build ),
+		SnacTractionBC_Type,
+		_SnacTractionBC_Build,
+		SnacTractionBC_Type );
+	EntryPoint_Append(
+		Context_GetEntryPoint( context, AbstractContext_EP_DestroyExtensions ),
+		SnacTractionBC_Type,
+		_SnacTractionBC_DeleteExtensions,
+		SnacTractionBC_Type );
+	Snac_EntryPoint_AppendRangeHook(
 		Context_GetEntryPoint( context, Snac_EP_Force ),
 		SnacTractionBC_Type,
-		_SnacTractionBC_Force_Apply,
+		_SnacTractionBC_Force_Apply_Range,
 		SnacTractionBC_Type );
 }
@@ -44,6 +44,8 @@
 	/* Textual name of this class */
 	extern const Type SnacTractionBC_Type;
 
+	extern ExtensionInfo_Index SnacTractionBC_ContextHandle;
+
 	Index _SnacTractionBC_Register( PluginsManager* pluginsMgr );
 
 	void* _SnacTractionBC_DefaultNew( Name name );
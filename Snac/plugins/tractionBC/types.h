@@ -43,4 +43,7 @@
 #ifndef __SnacTractionBC_types_h__
 #define __SnacTractionBC_types_h__
 
+	typedef struct _SnacTractionBC_Face		SnacTractionBC_Face;
+	typedef struct _SnacTractionBC_Context		SnacTractionBC_Context;
+
 #endif /* __SnacTractionBC_types_h__ */
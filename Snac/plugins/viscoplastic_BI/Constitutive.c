@@ -57,11 +57,14 @@
 #endif
 
 
-void SnacViscoPlastic_Constitutive( void* _context, Element_LocalIndex element_lI ) {
-	Snac_Context* context = (Snac_Context*)_context;
+static void _SnacViscoPlastic_Constitutive(
+		Snac_Context*			context,
+		Element_LocalIndex		element_lI,
+		SnacViscoPlastic_Element*	viscoplasticElement,
+		SnacTemperature_Element*	temperatureElement,
+		ExtensionView			temperatureNodeView )
+{
 	Snac_Element* element = Snac_Element_At( context, element_lI );
-	SnacViscoPlastic_Element* viscoplasticElement = ExtensionManager_Get( context->mesh->elementExtensionMgr, element, SnacViscoPlastic_ElementHandle );
-	SnacTemperature_Element* temperatureElement = ExtensionManager_Get( context->mesh->elementExtensionMgr, element, SnacTemperature_ElementHandle );
 	const Snac_Material* material = &context->materialProperty[element->material_I];
 
 	/*ccccc*/
@@ -85,7 +88,6 @@ void SnacViscoPlastic_Constitutive( void* _context, Element_LocalIndex element_l
 		const double		bulkm = material->lambda + 2.0f * material->mu/3.0f;
 		StressTensor*		stress;
 		StrainTensor*		strain;
-		Strain				plasticStrain;
 		double*				viscosity;
 		double				straind0,straind1,straind2,stressd0,stressd1,stressd2;
 		double				Stress0[3][3];
@@ -97,49 +99,70 @@ void SnacViscoPlastic_Constitutive( void* _context, Element_LocalIndex element_l
 		double				VolumicStress;
 		double				rviscosity=material->refvisc;
 		double				rmu= material->mu;
-		double				srJ2;
-		double				avgTemp;
-		plModel				yieldcriterion=material->yieldcriterion;
-
-		/* For now reference values of viscosity, second invariant of deviatoric */
-		/* strain rate and reference temperature  are being hard wired ( these specific */
-		/* values are from paper by Hall et. al., EPSL, 2003 */
+		double				srJ2[Tetrahedra_Count];
+		double				avgTemp[Tetrahedra_Count];
 		double				rstrainrate = material->refsrate;
-		double				rTemp = material->reftemp;
-		double				H = material->activationE; // kJ/mol
-		double				srexponent = material->srexponent;
-		double				srexponent1 = material->srexponent1;
-		double				srexponent2 = material->srexponent2;
-		const double		R=8.31448;  // J/mol/K
-		/* elasto-plastic material properties */
-		double				cohesion = 0.0f;
-		double				frictionAngle = 0.0f;
-		double				dilationAngle = 0.0f;
-		double				hardening = 0.0f;
-		double				tension_cutoff=0.0;
-		const double		degrad = PI / 180.0f;
+		Snac_YieldBatch		batch;
 		double				totalVolume=0.0f,depls=0.0f;
-		unsigned int		i;
-		double				tmp=0.0;
-		const double		a1 = material->lambda + 2.0f * material->mu ;
-		const double		a2 = material->lambda ;
-		int					ind=0;
 
 		int principal_stresses(StressTensor* stress,double sp[],double cn[3][3]);
 		int principal_stresses_orig(StressTensor* stress, double sp[3], double cn[3][3]);
 
 		/*    printf("Entered ViscoPlastic update \n"); */
 
-		/* Work out the plastic material properties of this element */
+		/* elasto-plastic material properties used until a tetrahedra finds its softening segment */
+		Snac_YieldBatch_Init( &batch, 0.0f, 0.0f, 0.0f );
+
+		/* Viscosity of every tetrahedra, from its strain rate and temperature (Hall et. al., 2004, G3) */
+		if( temperatureEP ) {
+			for( tetra_I = 0; tetra_I < Tetrahedra_Count; tetra_I++ ) {
+				strain = &element->tetra[tetra_I].strain;
+				trace_strain = (*strain)[0][0] + (*strain)[1][1] + (*strain)[2][2];
+				straind0 =  (*strain)[0][0] -  (trace_strain) / 3.0f;
+				straind1 =  (*strain)[1][1] -  (trace_strain) / 3.0f;
+				straind2 =  (*strain)[2][2] -  (trace_strain) / 3.0f;
+
+				srJ2[tetra_I] = sqrt(fabs(straind1*straind2+straind2*straind0+straind0*straind1 -(*strain)[0][1]*(*strain)[0][1]-(*strain)[0][2]*(*strain)[0][2]-(*strain)[1][2]*(*strain)[1][2]))/context->dt;
+				if(srJ2[tetra_I] == 0.0f) srJ2[tetra_I] = rstrainrate; // temporary. should be vmax/length_scale
+
+				avgTemp[tetra_I]=0.0;
+				for(node_lI=0; node_lI<4; node_lI++) {
+					SnacTemperature_Node* temperatureNodeExt = ExtensionView_At(
+																				temperatureNodeView,
+																				Snac_Element_Node_I( context, element_lI, TetraToNode[tetra_I][node_lI] ) );
+
+					avgTemp[tetra_I] += 0.25 * temperatureNodeExt->temperature;
+					assert( !isnan(avgTemp[tetra_I]) && !isinf(avgTemp[tetra_I]) );
+				}
+			}
+			Snac_Rheology_Viscosity( material, Tetrahedra_Count, srJ2, avgTemp, viscoplasticElement->viscosity );
+			for( tetra_I = 0; tetra_I < Tetrahedra_Count; tetra_I++ ) {
+				Journal_Firewall(
+								 !isnan(viscoplasticElement->viscosity[tetra_I]) && !isinf(viscoplasticElement->viscosity[tetra_I]),
+								 context->snacError,
+								 "rvisc=%e Erattio=%e T=%e viscosity=%e\n",
+								 rviscosity,
+								 (srJ2[tetra_I]/rstrainrate),
+								 avgTemp[tetra_I],
+								 viscoplasticElement->viscosity[tetra_I] );
+			}
+		}
+		else {
+			for( tetra_I = 0; tetra_I < Tetrahedra_Count; tetra_I++ )
+				viscoplasticElement->viscosity[tetra_I] = rviscosity;
+			Journal_Firewall(
+							 !isnan(rviscosity) && !isinf(rviscosity),
+							 context->snacError,
+							 "(*viscosity) is nan or inf\n" );
+		}
+
+		/* Viscoelastic trial stress of every tetrahedra, in principal axes */
 		for( tetra_I = 0; tetra_I < Tetrahedra_Count; tetra_I++ ) {
-			double			cn[3][3] = {{0.0,0.0,0.0},{0.0,0.0,0.0},{0.0,0.0,0.0}};
 			double			s[3] = {0.0,0.0,0.0};
-			double			alam, dep1, dep2, dep3, depm;
 			/*ccccc*/
 
 			stress = &element->tetra[tetra_I].stress;
 			strain = &element->tetra[tetra_I].strain;
-			plasticStrain = viscoplasticElement->plasticStrain[tetra_I];
 			viscosity = &viscoplasticElement->viscosity[tetra_I];
 
 			if( context->computeThermalStress ) {
@@ -170,53 +193,6 @@ void SnacViscoPlastic_Constitutive( void* _context, Element_LocalIndex element_l
 			stressd1 =  (*stress)[1][1] -  (trace_stress) / 3.0f;
 			stressd2 =  (*stress)[2][2] -  (trace_stress) / 3.0f;
 
-			/* compute viscosity and add thermal stress */
-			if( temperatureEP ) {
-
-				srJ2 = sqrt(fabs(straind1*straind2+straind2*straind0+straind0*straind1 -(*strain)[0][1]*(*strain)[0][1]-(*strain)[0][2]*(*strain)[0][2]-(*strain)[1][2]*(*strain)[1][2]))/context->dt;
-				if(srJ2 == 0.0f) srJ2 = rstrainrate; // temporary. should be vmax/length_scale
-
-				avgTemp=0.0;
-				for(node_lI=0; node_lI<4; node_lI++) {
-					Snac_Node* contributingNode = Snac_Element_Node_P(
-																	  context,
-																	  element_lI,
-																	  TetraToNode[tetra_I][node_lI] );
-					SnacTemperature_Node* temperatureNodeExt = ExtensionManager_Get(
-																					context->mesh->nodeExtensionMgr,contributingNode,
-																					SnacTemperature_NodeHandle );
-
-					avgTemp += 0.25 * temperatureNodeExt->temperature;
-					assert( !isnan(avgTemp) && !isinf(avgTemp) );
-				}
-				// Hall et. al., 2004, G3
-				(*viscosity)= rviscosity*pow((srJ2/rstrainrate),(1./srexponent-1.))
-					*exp(H/R*(1./(avgTemp+273.15)-1./(rTemp+273.15)));
-				if((*viscosity) < material->vis_min) (*viscosity) = material->vis_min;
-				if((*viscosity) > material->vis_max) (*viscosity) = material->vis_max;
-				Journal_Firewall(
-								 !isnan((*viscosity)) && !isinf((*viscosity)),
-								 context->snacError,
-								 "rvisc=%e Erattio=%e pow(E)=%e, dT=%e exp=%e\n",
-								 rviscosity,
-								 (srJ2/rstrainrate),
-								 pow((srJ2/rstrainrate),
-									 (1./srexponent-1.)),
-								 exp(H/R*(1./(avgTemp+273.15)-1./(rTemp+273.15))),
-								 (1./(avgTemp+273.15)-1./(rTemp+273.15)) );
-#if 0
-				// Lavier and Buck, JGR, 2002
-				(*viscosity) = pow(rviscosity,-1.0/srexponent1)*pow(srJ2,1.0/srexponent2-1)*exp(H/R/(avgTemp+273.15));
-#endif
-			}
-			else {
-				(*viscosity) = rviscosity;
-				Journal_Firewall(
-								 !isnan((*viscosity)) && !isinf((*viscosity)),
-								 context->snacError,
-								 "(*viscosity) is nan or inf\n" );
-			}
-
 			/* Non dimensional parameters elastic/viscous */
 			temp = rmu / (2.0f* (*viscosity)) * context->dt;
 
@@ -243,11 +219,12 @@ void SnacViscoPlastic_Constitutive( void* _context, Element_LocalIndex element_l
 			(*stress)[1][1] = stressd1 + VolumicStress;
 			(*stress)[2][2] = stressd2 + VolumicStress;
 
-			principal_stresses(stress,s,cn);
+			principal_stresses(stress,s,batch.cn[tetra_I]);
+			batch.stress[tetra_I] = stress;
+			batch.s[0][tetra_I] = s[0];
+			batch.s[1][tetra_I] = s[1];
+			batch.s[2][tetra_I] = s[2];
 
-			/* compute friction and dilation angles based on accumulated plastic strain in tetrahedra */
-			/* Piece-wise linear softening */
-			/* Find current properties from linear interpolation */
 #if 0
 			/*ccccc*/
 			if(material->putSeeds && context->loop <= 1) {
@@ -263,122 +240,20 @@ void SnacViscoPlastic_Constitutive( void* _context, Element_LocalIndex element_l
 			}
 			/*ccccc*/
 #endif
-			for( i = 0; i < material->nsegments; i++ ) {
-				const double pl1 = material->plstrain[i];
-				const double pl2 = material->plstrain[i+1];
-
-				if( plasticStrain >= pl1 && plasticStrain <= pl2 ) {
-					const double	tgf = (material->frictionAngle[i+1] - material->frictionAngle[i]) / (pl2 - pl1);
-					const double	tgd = (material->dilationAngle[i+1] - material->dilationAngle[i]) / (pl2 - pl1);
-					const double	tgc = (material->cohesion[i+1] - material->cohesion[i]) / (pl2 - pl1);
-
-					frictionAngle = material->frictionAngle[i] + tgf * (plasticStrain - pl1);
-					dilationAngle = material->dilationAngle[i] + tgd * (plasticStrain - pl1);
-					cohesion = material->cohesion[i] + tgc * (plasticStrain - pl1);
-					hardening = tgc;
-				}
-			}
-
-			if( frictionAngle >= 0.0f ) {
-				tension_cutoff = material->ten_off;
-				/* tension_cutoff is 0 by default. If not set by a user, it is set here.*/
-				if( frictionAngle > 0.0 && tension_cutoff == 0.0 ) {
-					tension_cutoff = cohesion / tan( frictionAngle * degrad);
-					/* tmp = cohesion / tan( frictionAngle * degrad);
-					if(tmp < tension_cutoff) tension_cutoff=tmp; */
-				}
-			}
-			else {
-				if( plasticStrain < 0.0 ) {
-					viscoplasticElement->plasticStrain[tetra_I] = 0.0;
-					plasticStrain = viscoplasticElement->plasticStrain[tetra_I];
-					fprintf(stderr,"Warning: negative plastic strain. Setting to zero, but check if remesher is on and this happended for an external tet. rank:%d elem:%d tet:%d plasticStrain=%e frictionAngle=%e\n",context->rank,element_lI,tetra_I,plasticStrain,frictionAngle);
-					frictionAngle = material->frictionAngle[0];
-					dilationAngle = material->dilationAngle[0];
-					cohesion = material->cohesion[0];
-				}
-				else {
-					/* frictionAngle < 0.0 violates second law of thermodynamics */
-					fprintf(stderr,"Error due to an unknown reason: rank:%d elem:%d tet:%d plasticStrain=%e frictionAngle=%e\n",context->rank,element_lI,tetra_I,plasticStrain,frictionAngle);
-					assert(0);
-				}
-			}
-
-			if( yieldcriterion == mohrcoulomb )
-				{
-
-					double sphi = sin( frictionAngle * degrad );
-					double spsi = sin( dilationAngle * degrad );
-					double anphi = (1.0f + sphi) / (1.0f - sphi);
-					double anpsi = (1.0f + spsi) / (1.0f - spsi);
-					double fs = s[0] - s[2] * anphi + 2 * cohesion * sqrt( anphi );
-					double ft = s[2] - tension_cutoff;
-					/* CHECK FOR COMPOSITE YIELD CRITERION  */
-					ind=0;
-					if( fs < 0.0f || ft > 0.0f ) {
-						/*! Failure: shear or tensile */
-						double aP = sqrt( 1.0f + anphi * anphi ) + anphi;
-						double sP = tension_cutoff * anphi - 2 * cohesion * sqrt( anphi );
-						double h = s[2] - tension_cutoff + aP * ( s[0] - sP );
-
-						ind=1;
-
-						if( h < 0.0f ) {
-							/* !shear failure  */
-							alam = fs / ( a1 - a2 * anpsi + a1 * anphi * anpsi - a2 * anphi + 2.0*sqrt(anphi)*hardening );
-							s[0] -= alam * ( a1 - a2 * anpsi );
-							s[1] -= alam * a2 * ( 1.0f - anpsi );
-							s[2] -= alam * ( a2 - a1 * anpsi );
-							dep1 = alam;
-							dep2 = 0.0f;
-							dep3 = -alam * anpsi;
-						}
-						else {
-							/* tensile failure */
-							alam = ft / a1;
-							s[0] -= alam * a2;
-							s[1] -= alam * a2;
-							s[2] -= alam * a1;
-							dep1 = 0.0f;
-							dep2 = 0.0f;
-							dep3 = alam;
-						}
-					}
-					else {
-						/* ! no failure - just elastic increment */
+		}
+		batch.count = Tetrahedra_Count;
 
-						dep1 = 0.0f;
-						dep2 = 0.0f;
-						dep3 = 0.0f;
-					}
-					if(ind) {
-						unsigned int k,m,n;
-						/* Second invariant of accumulated plastic increment  */
-						depm = ( dep1 + dep2 + dep3 ) / 3.0f;
-						viscoplasticElement->plasticStrain[tetra_I] += sqrt( 0.5f * ((dep1-depm) * (dep1-depm) + (dep2-depm) * (dep2-depm) + (dep3-depm) * (dep3-depm) + depm*depm) );
-
-						/* Stress projection back to euclidean coordinates */
-						memset( stress, 0, sizeof((*stress)) );
-						/* Resolve back to global axes  */
-						for( m = 0; m < 3; m++ ) {
-							for( n = m; n < 3; n++ ) {
-								for( k = 0; k < 3; k++ ) {
-									/* (*stress)[m][n] += cn[k][m] * cn[k][n] * s[k]; */
-									(*stress)[m][n] += cn[m][k] * cn[n][k] * s[k];
-								}
-							}
-						}
-					}
-				}
-			else
-				Journal_Firewall( (0>1), "In %s: \"mohrcoulomb\" is the only available yield criterion.\n", __func__ );
+		/* compute friction and dilation angles based on accumulated plastic strain in tetrahedra */
+		/* Piece-wise linear softening and the return map, for all tetrahedra at once */
+		Snac_Yield_MohrCoulomb( context, element_lI, material, &batch, viscoplasticElement->plasticStrain, True );
 
+		for( tetra_I = 0; tetra_I < Tetrahedra_Count; tetra_I++ ) {
 			/* linear healing: applied whether this tet has yielded or not. 
 			   Parameters are hardwired for now, but should be given through an input file. */
 			/* viscoplasticElement->plasticStrain[tetra_I] *= (1.0/(1.0+context->dt/1.0e+12)); */
 
             /* To use different healing rate according to whether yielding has occurred or not: */
-			/* viscoplasticElement->plasticStrain[tetra_I] *= (1.0/(1.0+context->dt/(ind?1.0e+13:5.0e+11))); */
+			/* viscoplasticElement->plasticStrain[tetra_I] *= (1.0/(1.0+context->dt/(batch.yielded[tetra_I]?1.0e+13:5.0e+11))); */
 
 			depls += viscoplasticElement->plasticStrain[tetra_I]*element->tetra[tetra_I].volume;
 			totalVolume += element->tetra[tetra_I].volume;
@@ -388,6 +263,36 @@ void SnacViscoPlastic_Constitutive( void* _context, Element_LocalIndex element_l
 	}
 }
 
+void SnacViscoPlastic_Constitutive( void* _context, Element_LocalIndex element_lI ) {
+	Snac_Context*			context = (Snac_Context*)_context;
+	Snac_Element*			element = Snac_Element_At( context, element_lI );
+
+	_SnacViscoPlastic_Constitutive(
+		context,
+		element_lI,
+		ExtensionManager_Get( context->mesh->elementExtensionMgr, element, SnacViscoPlastic_ElementHandle ),
+		ExtensionManager_Get( context->mesh->elementExtensionMgr, element, SnacTemperature_ElementHandle ),
+		Snac_Node_ExtensionView( context, SnacTemperature_NodeHandle ) );
+}
+
+void SnacViscoPlastic_Constitutive_Range( void* _context, Element_LocalIndex begin, Element_LocalIndex end ) {
+	Snac_Context*			context = (Snac_Context*)_context;
+	ExtensionView			viscoplasticView = Snac_Element_ExtensionView( context, SnacViscoPlastic_ElementHandle );
+	ExtensionView			temperatureView = Snac_Element_ExtensionView( context, SnacTemperature_ElementHandle );
+	ExtensionView			temperatureNodeView = Snac_Node_ExtensionView( context, SnacTemperature_NodeHandle );
+	Element_LocalIndex		element_lI;
+
+	for( element_lI = begin; element_lI < end; element_lI++ ) {
+		_SnacViscoPlastic_Constitutive(
+			context,
+			element_lI,
+			(SnacViscoPlastic_Element*)ExtensionView_At( viscoplasticView, element_lI ),
+			(SnacTemperature_Element*)ExtensionView_At( temperatureView, element_lI ),
+			temperatureNodeView );
+	}
+}
+
+
 int principal_stresses(StressTensor* stress, double d[3], double V[3][3])
 {
 
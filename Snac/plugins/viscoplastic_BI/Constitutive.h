@@ -57,6 +57,7 @@
 #define __SnacViscoPlastic_h__
 	
 	void SnacViscoPlastic_Constitutive( void* context, Element_LocalIndex element_lI );
+	void SnacViscoPlastic_Constitutive_Range( void* context, Element_LocalIndex begin, Element_LocalIndex end );
 	
 	double** dmatrix(long nrl, long nrh, long ncl, long nch);
 	double *dvector(long nl, long nh);
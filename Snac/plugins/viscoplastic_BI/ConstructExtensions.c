@@ -53,10 +53,30 @@ void _SnacViscoPlastic_ConstructExtensions( void* _context, void* data ) {
 																				 SnacViscoPlastic_ElementHandle );
 	char					tmpBuf[PATH_MAX];
 
+	/* The accumulated plastic strain is not an array by itself, so the "complex" constructor for Variable is needed */
+	Index					plasticStrainOffsetCount = 1;
+	SizeT					plasticStrainOffsets[] = {
+		(SizeT)((char*)&tmpElementExt->aps - (char*)&tmpElement) };
+	Variable_DataType			plasticStrainDataTypes[] = { Variable_DataType_Double };
+	Index					plasticStrainDataTypeCounts[] = { 1 };
+
 #if DEBUG
 	if( context->rank == 0 )		printf( "In %s()\n", __func__ );
 #endif
 
+	/* Create the StGermain variable plasticStrain, which is stored on an element extension */
+	Variable_New( 
+		"plasticStrain", 
+		plasticStrainOffsetCount, 
+		plasticStrainOffsets, 
+		plasticStrainDataTypes, 
+		plasticStrainDataTypeCounts, 
+		0, 
+		&ExtensionManager_GetFinalSize( context->mesh->elementExtensionMgr ),
+		&context->mesh->layout->decomp->elementDomainCount,
+		(void**)&context->mesh->element,
+		context->variable_Register );
+
 	/* Prepare the dump file */
 	sprintf( tmpBuf, "%s/plStrain.%u", context->outputPath, context->rank );
 	if( (contextExt->plStrainOut = fopen( tmpBuf, "w+" )) == NULL ) {
@@ -61,17 +61,14 @@ void _SnacViscoPlastic_DumpPlasticStrain( void* _context ) {
 												context,
 												SnacViscoPlastic_ContextHandle );
 	Element_LocalIndex			element_lI;
+	ExtensionView				viscoplasticView = Snac_Element_ExtensionView( context, SnacViscoPlastic_ElementHandle );
 
 #if DEBUG
 	printf( "In %s()\n", __func__ );
 #endif
 	
 	for( element_lI = 0; element_lI < context->mesh->elementLocalCount; element_lI++ ) {
-		Snac_Element* 				element = Snac_Element_At( context, element_lI );
-		SnacViscoPlastic_Element*	elementExt = ExtensionManager_Get(
-													context->mesh->elementExtensionMgr,
-													element,
-													SnacViscoPlastic_ElementHandle );
+		SnacViscoPlastic_Element*	elementExt = ExtensionView_At( viscoplasticView, element_lI );
 		float plasticStrain = elementExt->aps;
 		fwrite( &plasticStrain, sizeof(float), 1, contextExt->plStrainOut );
 	}
@@ -86,17 +83,14 @@ void _SnacViscoPlastic_CheckpointPlasticStrain( void* _context ) {
 												context,
 												SnacViscoPlastic_ContextHandle );
 	Element_LocalIndex			element_lI;
+	ExtensionView				viscoplasticView = Snac_Element_ExtensionView( context, SnacViscoPlastic_ElementHandle );
 
 #if DEBUG
 	printf( "In %s()\n", __func__ );
 #endif
 	
 	for( element_lI = 0; element_lI < context->mesh->elementLocalCount; element_lI++ ) {
-		Snac_Element* 				element = Snac_Element_At( context, element_lI );
-		SnacViscoPlastic_Element*	elementExt = ExtensionManager_Get(
-													context->mesh->elementExtensionMgr,
-													element,
-													SnacViscoPlastic_ElementHandle );
+		SnacViscoPlastic_Element*	elementExt = ExtensionView_At( viscoplasticView, element_lI );
 		float avgPlasticStrain = elementExt->aps;
 		Tetrahedra_Index	tetra_I;
 
@@ -127,17 +121,14 @@ void _SnacViscoPlastic_DumpViscosity( void* _context ) {
 												context,
 												SnacViscoPlastic_ContextHandle );
 	Element_LocalIndex			element_lI;
+	ExtensionView				viscoplasticView = Snac_Element_ExtensionView( context, SnacViscoPlastic_ElementHandle );
 
 #if DEBUG
 	printf( "In %s()\n", __func__ );
 #endif
 	
 	for( element_lI = 0; element_lI < context->mesh->elementLocalCount; element_lI++ ) {
-		Snac_Element* 				element = Snac_Element_At( context, element_lI );
-		SnacViscoPlastic_Element*	elementExt = ExtensionManager_Get(
-													context->mesh->elementExtensionMgr,
-													element,
-													SnacViscoPlastic_ElementHandle );
+		SnacViscoPlastic_Element*	elementExt = ExtensionView_At( viscoplasticView, element_lI );
 		Tetrahedra_Index			tetra_I;
 		double					    viscosity = 0.0f;
 		float						logviscosity = 0.0f;
@@ -160,17 +151,14 @@ void _SnacViscoPlastic_CheckpointViscosity( void* _context ) {
 												context,
 												SnacViscoPlastic_ContextHandle );
 	Element_LocalIndex			element_lI;
+	ExtensionView				viscoplasticView = Snac_Element_ExtensionView( context, SnacViscoPlastic_ElementHandle );
 	
 #if DEBUG
 	printf( "In %s()\n", __func__ );
 #endif
 	
 	for( element_lI = 0; element_lI < context->mesh->elementLocalCount; element_lI++ ) {
-		Snac_Element* 					element = Snac_Element_At( context, element_lI );
-		SnacViscoPlastic_Element*		elementExt = ExtensionManager_Get(
-														context->mesh->elementExtensionMgr,
-														element,
-														SnacViscoPlastic_ElementHandle );
+		SnacViscoPlastic_Element*		elementExt = ExtensionView_At( viscoplasticView, element_lI );
 		Tetrahedra_Index		tetra_I;
 		double					viscosity = 0.0f;
 		float					logviscosity = 0.0f;
@@ -92,10 +92,10 @@ void _SnacViscoPlastic_Construct( void* component, Stg_ComponentFactory* cf, voi
 	SnacViscoPlastic_ContextHandle = ExtensionManager_Add( context->extensionMgr, SnacViscoPlastic_Type, sizeof(SnacViscoPlastic_Context) );
 
 	/* Add extensions to the entry points */
-	EntryPoint_Append(
+	Snac_EntryPoint_AppendRangeHook(
 		Context_GetEntryPoint( context,	Snac_EP_Constitutive ),
 		SnacViscoPlastic_Type,
-		SnacViscoPlastic_Constitutive,
+		SnacViscoPlastic_Constitutive_Range,
 		SnacViscoPlastic_Type );
 	EntryPoint_InsertBefore(
 		Context_GetEntryPoint( context,	AbstractContext_EP_Initialise ),
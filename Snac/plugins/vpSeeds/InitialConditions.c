@@ -34,7 +34,6 @@
 #include <stdio.h>
 #include <string.h>
 #include <assert.h>
-#include <time.h>
 #include <StGermain/StGermain.h>
 #include <StGermain/FD/FD.h>
 #include "Snac/Snac.h"
@@ -43,81 +42,59 @@
 #include "Snac/ViscoPlastic/ViscoPlastic.h"
 #include "Snac/Plastic/Plastic.h"
 
-void _SnacVPSeeds_InitialConditions( void* _context, void* data ) {
-	Snac_Context*			    context = (Snac_Context*)_context;
-	Mesh*				        mesh = context->mesh;
-	MeshLayout*			        layout = (MeshLayout*)mesh->layout;
-	HexaMD*				        decomp = (HexaMD*)layout->decomp;
-	Element_LocalIndex		    element_lI;
-    Element_GlobalIndex         element_gI;
-    int                         index_I,index_J,global_I_range,global_J_range,global_K_range;
-    IJK				            ijk;
-    Snac_Element*			    element;
-    const Snac_Material*	    material;
-    Tetrahedra_Index		    tetra_I;
-    SnacViscoPlastic_Element*	viscoplasticElement;
-    float                       rand_num;
-    int                         NUM_SEED;
-    int                         incZ = 0;
+/* Each top element of the band, a quarter of the mesh wide about its centre, is weakened with this probability. */
+static const double SnacVPSeeds_Probability = 0.02;
 
-	int			restart = 0;
-	Dictionary_Entry_Value* pluginsList;
-	Dictionary_Entry_Value* plugin;
+void _SnacVPSeeds_InitialConditions( void* _context, void* data ) {
+	Snac_Context*			context = (Snac_Context*)_context;
+	Mesh*				mesh = context->mesh;
+	MeshLayout*			layout = (MeshLayout*)mesh->layout;
+	HexaMD*				decomp = (HexaMD*)layout->decomp;
+	ExtensionView			viscoplasticView = Snac_Element_ExtensionView( context, SnacViscoPlastic_ElementHandle );
+	unsigned int			seed;
+	Element_LocalIndex		element_lI;
+	IJK				ijk;
+	int				bandWidth;
+	int				bandLeft;
+	double*				uniforms;
 
 	if( context->restartTimestep > 0 )
 		return;
 
 #ifdef DEBUG
-    printf( "In: %s\n", __func__ );
+	printf( "In: %s\n", __func__ );
 #endif
 
-    srand( (unsigned int)time(NULL) );
-    global_I_range = decomp->elementGlobal3DCounts[0]/4;
-    global_J_range = 1; //decomp->elementGlobal3DCounts[1];
-    global_K_range = 1; //decomp->elementGlobal3DCounts[2]; //10;
-    NUM_SEED = decomp->elementGlobal3DCounts[2] * global_I_range * 0.02;
-
-    for(index_I = 0; index_I < NUM_SEED; index_I++) {
-        rand_num = rand()/(RAND_MAX+1.0);
-        ijk[2] = decomp->elementGlobal3DCounts[2]*rand_num;
-        rand_num = rand()/(RAND_MAX+1.0);
-        ijk[0] = global_I_range * rand_num;
-        ijk[0] = decomp->elementGlobal3DCounts[0]/2 - (ijk[0]-global_I_range/2);
-
-        incZ = 0;
-        //ijk[2] -= global_K_range/2;
-        while( incZ < global_K_range && ijk[2] >=0 && ijk[2] < decomp->elementGlobal3DCounts[2] ) {
-            ijk[1] = decomp->elementGlobal3DCounts[1]-1;
-            for(index_J = 0; index_J < global_J_range; index_J++) {
-                element_gI = ijk[0] + decomp->elementGlobal3DCounts[0]*ijk[1] + decomp->elementGlobal3DCounts[0]*decomp->elementGlobal3DCounts[1]*ijk[2];
-                element_lI = Mesh_ElementMapGlobalToLocal( mesh, element_gI );
-
-                if(element_lI < mesh->elementLocalCount) {
-
-                    element = Snac_Element_At( context, element_lI );
-                    material = &context->materialProperty[element->material_I];
-                    viscoplasticElement = ExtensionManager_Get(
-                                                               mesh->elementExtensionMgr,
-                                                               element,
-                                                               SnacViscoPlastic_ElementHandle );
-                    for( tetra_I = 0; tetra_I < Tetrahedra_Count; tetra_I++ ) {
-                        viscoplasticElement->plasticStrain[tetra_I] = 1.1 * material->plstrain[1];
-
-                        Journal_Printf(
-                                       context->snacVerbose,
-                                       "timeStep=%d ijk=%d %d %d plasticE=%e\n",
-                                       context->timeStep,
-                                       ijk[0],
-                                       ijk[1],
-                                       ijk[2],
-                                       viscoplasticElement->plasticStrain[tetra_I] );
-                    }
-                    //fprintf(stderr,"me=%d seeds(%d/%d) ijk=%d %d %d\n",context->rank,index_I,NUM_SEED,ijk[0],ijk[1],ijk[2]);
-                }
-                ijk[1]--;
-            }
-            ijk[2]++;
-            incZ++;
-        }
-    }
+	seed = Dictionary_Entry_Value_AsUnsignedInt( 
+		Dictionary_GetDefault( context->dictionary, "randomSeed", Dictionary_Entry_Value_FromUnsignedInt( 1 ) ) );
+	bandWidth = decomp->elementGlobal3DCounts[0] / 4;
+	bandLeft = decomp->elementGlobal3DCounts[0] / 2 + bandWidth / 2 - bandWidth + 1;
+	
+	/* The draws are keyed by global element index, so the seeds do not depend on the decomposition. */
+	uniforms = Memory_Alloc_Array( double, mesh->elementLocalCount, "SnacVPSeeds uniforms" );
+	Snac_Random_ElementUniforms( context, seed, 0, uniforms );
+	
+	for( element_lI = 0; element_lI < mesh->elementLocalCount; element_lI++ ) {
+		Snac_Element*			element = Snac_Element_At( context, element_lI );
+		const Snac_Material*		material = &context->materialProperty[element->material_I];
+		SnacViscoPlastic_Element*	viscoplasticElement = ExtensionView_At( viscoplasticView, element_lI );
+		Element_GlobalIndex		element_gI = Mesh_ElementMapLocalToGlobal( mesh, element_lI );
+		Tetrahedra_Index		tetra_I;
+		
+		if( uniforms[element_lI] >= SnacVPSeeds_Probability )
+			continue;
+		RegularMeshUtils_Element_1DTo3D( decomp, element_gI, &ijk[0], &ijk[1], &ijk[2] );
+		if( (int)ijk[0] < bandLeft || (int)ijk[0] >= bandLeft + bandWidth || 
+			ijk[1] != decomp->elementGlobal3DCounts[1] - 1 )
+		{
+			continue;
+		}
+		
+		for( tetra_I = 0; tetra_I < Tetrahedra_Count; tetra_I++ ) {
+			viscoplasticElement->plasticStrain[tetra_I] = 1.1 * material->plstrain[1];
+		}
+		Journal_Printf( context->snacVerbose, "timeStep=%d ijk=%d %d %d plasticE=%e\n", context->timeStep, 
+			ijk[0], ijk[1], ijk[2], viscoplasticElement->plasticStrain[0] );
+	}
+	Memory_Free( uniforms );
 }
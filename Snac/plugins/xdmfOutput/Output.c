@@ -0,0 +1,474 @@
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+**
+** Copyright (C), 2003,
+**	Steve Quenette, 110 Victoria Street, Melbourne, Victoria, 3053, Australia.
+**	Californian Institute of Technology, 1200 East California Boulevard, Pasadena, California, 91125, USA.
+**	University of Texas, 1 University Station, Austin, Texas, 78712, USA.
+**
+** Authors:
+**	Stevan M. Quenette, Senior Software Engineer, VPAC. (steve@vpac.org)
+**	Stevan M. Quenette, Visitor in Geophysics, Caltech.
+**	Luc Lavier, Research Scientist, The University of Texas. (luc@utig.ug.utexas.edu)
+**	Luc Lavier, Research Scientist, Caltech.
+**
+** This program is free software; you can redistribute it and/or modify it
+** under the terms of the GNU General Public License as published by the
+** Free Software Foundation; either version 2, or (at your option) any
+** later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program; if not, write to the Free Software
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+**
+** $Id: Output.c $
+**
+**~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#include <mpi.h>
+#include <StGermain/StGermain.h>
+#include <StGermain/FD/FD.h>
+#include "Snac/Snac.h"
+#include "types.h"
+#include "Context.h"
+#include "Output.h"
+#include "Register.h"
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <assert.h>
+#include <limits.h>
+#ifndef PATH_MAX
+	#define PATH_MAX 1024
+#endif
+#ifndef M_PI
+	#define M_PI 3.14159265358979323846
+#endif
+
+#define SnacXdmfOutput_MaxAttributes 16
+
+static void _SnacXdmfOutput_WriteArray( 
+		MPI_File				fh, 
+		MPI_Offset*				offset, 
+		const unsigned int			globalCounts[3], 
+		const unsigned int			localCounts[3], 
+		const unsigned int			offsets[3], 
+		unsigned int				componentCount, 
+		MPI_Datatype				etype, 
+		void*					buffer );
+static SnacXdmfOutput_Attribute* _SnacXdmfOutput_AddAttribute( 
+		SnacXdmfOutput_Attribute*		attributes, 
+		unsigned int*				attributeCount, 
+		const char*				name, 
+		const char*				center, 
+		unsigned int				componentCount, 
+		MPI_Offset				seek );
+static void _SnacXdmfOutput_WriteGrid( 
+		FILE*					xmlOut, 
+		const char*				heavyDataName, 
+		double					time, 
+		const unsigned int			nodeGlobalCounts[3], 
+		const unsigned int			elementGlobalCounts[3], 
+		SnacXdmfOutput_Attribute*		attributes, 
+		unsigned int				attributeCount );
+static void _SnacXdmfOutput_WriteCollection( Snac_Context* context, SnacXdmfOutput_Context* contextExt );
+
+
+void _SnacXdmfOutput_Write( void* _context ) {
+	Snac_Context*				context = (Snac_Context*) _context;
+
+	if( isTimeToDump( context ) )
+		_SnacXdmfOutput_Dump( context );
+}
+
+
+void _SnacXdmfOutput_Dump( void* _context ) {
+	Snac_Context*				context = (Snac_Context*) _context;
+	SnacXdmfOutput_Context*			contextExt = ExtensionManager_Get(
+							context->extensionMgr,
+							context,
+							SnacXdmfOutput_ContextHandle );
+	HexaMD*					decomp = (HexaMD*)context->mesh->layout->decomp;
+	Variable*				temperatureVar = Variable_Register_GetByName( context->variable_Register, "temperature" );
+	Variable*				plasticStrainVar = Variable_Register_GetByName( context->variable_Register, "plasticStrain" );
+	Bool					inUse = ( (Partition_Index)context->rank < decomp->procsInUse );
+	unsigned int				nodeGlobalCounts[3];
+	unsigned int				nodeLocalCounts[3] = { 0, 0, 0 };
+	unsigned int				nodeOwnedCounts[3] = { 0, 0, 0 };
+	unsigned int				nodeOffsets[3] = { 0, 0, 0 };
+	unsigned int				elementGlobalCounts[3];
+	unsigned int				elementLocalCounts[3] = { 0, 0, 0 };
+	unsigned int				elementOffsets[3] = { 0, 0, 0 };
+	Node_LocalIndex				nodeOwnedCount;
+	Element_LocalIndex			elementLocalCount;
+	SnacXdmfOutput_Attribute		attributes[SnacXdmfOutput_MaxAttributes];
+	unsigned int				attributeCount = 0;
+	SnacXdmfOutput_Attribute*		attribute;
+	float*					buffer;
+	float*					principalBuffer;
+	int*					phaseBuffer;
+	char					heavyDataName[PATH_MAX];
+	char					tmpBuf[PATH_MAX];
+	MPI_File				fh;
+	MPI_Offset				offset = 0;
+	unsigned int				dim_I, i, j, k;
+	Element_LocalIndex			element_lI;
+
+#if DEBUG
+	printf( "In %s()\n", __func__ );
+#endif
+
+	/*
+	 * Each rank owns the nodes of its local block except those on its upper faces, which belong to the neighbour (unless the
+	 * face is on the domain boundary). The owned blocks tile the global node grid exactly, as the element blocks do.
+	 */
+	for( dim_I = 0; dim_I < 3; dim_I++ ) {
+		nodeGlobalCounts[dim_I] = decomp->nodeGlobal3DCounts[dim_I];
+		elementGlobalCounts[dim_I] = decomp->elementGlobal3DCounts[dim_I];
+		if( inUse ) {
+			nodeLocalCounts[dim_I] = decomp->nodeLocal3DCounts[context->rank][dim_I];
+			nodeOffsets[dim_I] = decomp->_nodeOffsets[context->rank][dim_I];
+			nodeOwnedCounts[dim_I] = nodeLocalCounts[dim_I];
+			if( nodeOffsets[dim_I] + nodeLocalCounts[dim_I] < nodeGlobalCounts[dim_I] )
+				nodeOwnedCounts[dim_I]--;
+			elementLocalCounts[dim_I] = decomp->elementLocal3DCounts[context->rank][dim_I];
+			elementOffsets[dim_I] = decomp->_elementOffsets[context->rank][dim_I];
+		}
+	}
+	nodeOwnedCount = nodeOwnedCounts[0] * nodeOwnedCounts[1] * nodeOwnedCounts[2];
+	elementLocalCount = elementLocalCounts[0] * elementLocalCounts[1] * elementLocalCounts[2];
+	buffer = Memory_Alloc_Array( float, 6 * ( nodeOwnedCount > elementLocalCount ? nodeOwnedCount : elementLocalCount ) + 1, 
+		"SnacXdmfOutput" );
+	principalBuffer = Memory_Alloc_Array( float, 3 * elementLocalCount + 1, "SnacXdmfOutput" );
+	phaseBuffer = (int*)buffer;
+
+	if( temperatureVar )
+		Variable_Update( temperatureVar );
+	if( plasticStrainVar )
+		Variable_Update( plasticStrainVar );
+
+	sprintf( heavyDataName, "snac.%06u.bin", context->timeStep );
+	sprintf( tmpBuf, "%s/%s", context->outputPath, heavyDataName );
+	if( MPI_File_open( context->communicator, tmpBuf, MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL, &fh ) != MPI_SUCCESS ) {
+		Journal_Firewall( 0, context->snacError, "\"%s\"  failed to open file for writing", tmpBuf );
+	}
+	/* Truncate what a previous run left there; collective, so no rank can be writing yet. */
+	MPI_File_set_size( fh, 0 );
+
+	/* Coordinates */
+	#define PackOwnedNodes( expression ) \
+		for( k = 0; k < nodeOwnedCounts[2]; k++ ) \
+			for( j = 0; j < nodeOwnedCounts[1]; j++ ) \
+				for( i = 0; i < nodeOwnedCounts[0]; i++ ) { \
+					const Node_LocalIndex	node_lI = i + nodeLocalCounts[0] * ( j + nodeLocalCounts[1] * k ); \
+					const Index		owned_I = i + nodeOwnedCounts[0] * ( j + nodeOwnedCounts[1] * k ); \
+					expression; \
+				}
+	PackOwnedNodes( 
+		buffer[3*owned_I+0] = (float)context->mesh->nodeCoord[node_lI][0];
+		buffer[3*owned_I+1] = (float)context->mesh->nodeCoord[node_lI][1];
+		buffer[3*owned_I+2] = (float)context->mesh->nodeCoord[node_lI][2] );
+	_SnacXdmfOutput_AddAttribute( attributes, &attributeCount, "coord", "Node", 3, offset );
+	_SnacXdmfOutput_WriteArray( fh, &offset, nodeGlobalCounts, nodeOwnedCounts, nodeOffsets, 3, MPI_FLOAT, buffer );
+
+	/* Node fields */
+	PackOwnedNodes( 
+		Snac_Node* node = Snac_Node_At( context, node_lI );
+		buffer[3*owned_I+0] = (float)node->velocity[0];
+		buffer[3*owned_I+1] = (float)node->velocity[1];
+		buffer[3*owned_I+2] = (float)node->velocity[2] );
+	_SnacXdmfOutput_AddAttribute( attributes, &attributeCount, "velocity", "Node", 3, offset );
+	_SnacXdmfOutput_WriteArray( fh, &offset, nodeGlobalCounts, nodeOwnedCounts, nodeOffsets, 3, MPI_FLOAT, buffer );
+
+	PackOwnedNodes( 
+		Snac_Node* node = Snac_Node_At( context, node_lI );
+		buffer[3*owned_I+0] = (float)node->force[0];
+		buffer[3*owned_I+1] = (float)node->force[1];
+		buffer[3*owned_I+2] = (float)node->force[2] );
+	_SnacXdmfOutput_AddAttribute( attributes, &attributeCount, "force", "Node", 3, offset );
+	_SnacXdmfOutput_WriteArray( fh, &offset, nodeGlobalCounts, nodeOwnedCounts, nodeOffsets, 3, MPI_FLOAT, buffer );
+
+	/* Temperature is only there if the temperature plugin registered it */
+	if( temperatureVar ) {
+		PackOwnedNodes( buffer[owned_I] = (float)Variable_GetValueAsDouble( temperatureVar, node_lI ) );
+		_SnacXdmfOutput_AddAttribute( attributes, &attributeCount, "temperature", "Node", 1, offset );
+		_SnacXdmfOutput_WriteArray( fh, &offset, nodeGlobalCounts, nodeOwnedCounts, nodeOffsets, 1, MPI_FLOAT, buffer );
+	}
+	#undef PackOwnedNodes
+
+	/* Element fields. All local elements are owned, in the same (I fastest) order as the global grid. */
+	for( element_lI = 0; element_lI < elementLocalCount; element_lI++ )
+		buffer[element_lI] = (float)Snac_Element_At( context, element_lI )->strainRate;
+	_SnacXdmfOutput_AddAttribute( attributes, &attributeCount, "Strain rate", "Cell", 1, offset );
+	_SnacXdmfOutput_WriteArray( fh, &offset, elementGlobalCounts, elementLocalCounts, elementOffsets, 1, MPI_FLOAT, buffer );
+
+	for( element_lI = 0; element_lI < elementLocalCount; element_lI++ )
+		buffer[element_lI] = (float)Snac_Element_At( context, element_lI )->stress;
+	_SnacXdmfOutput_AddAttribute( attributes, &attributeCount, "Stress", "Cell", 1, offset );
+	_SnacXdmfOutput_WriteArray( fh, &offset, elementGlobalCounts, elementLocalCounts, elementOffsets, 1, MPI_FLOAT, buffer );
+
+	for( element_lI = 0; element_lI < elementLocalCount; element_lI++ )
+		buffer[element_lI] = (float)Snac_Element_At( context, element_lI )->hydroPressure;
+	_SnacXdmfOutput_AddAttribute( attributes, &attributeCount, "Pressure", "Cell", 1, offset );
+	_SnacXdmfOutput_WriteArray( fh, &offset, elementGlobalCounts, elementLocalCounts, elementOffsets, 1, MPI_FLOAT, buffer );
+
+	for( element_lI = 0; element_lI < elementLocalCount; element_lI++ )
+		phaseBuffer[element_lI] = (int)Snac_Element_At( context, element_lI )->material_I;
+	attribute = _SnacXdmfOutput_AddAttribute( attributes, &attributeCount, "Phase", "Cell", 1, offset );
+	attribute->numberType = "Int";
+	_SnacXdmfOutput_WriteArray( fh, &offset, elementGlobalCounts, elementLocalCounts, elementOffsets, 1, MPI_INT, phaseBuffer );
+
+	/* Plastic strain is only there if a plastic rheology registered it */
+	if( plasticStrainVar ) {
+		for( element_lI = 0; element_lI < elementLocalCount; element_lI++ )
+			buffer[element_lI] = (float)Variable_GetValueAsDouble( plasticStrainVar, element_lI );
+		_SnacXdmfOutput_AddAttribute( attributes, &attributeCount, "Plastic strain", "Cell", 1, offset );
+		_SnacXdmfOutput_WriteArray( fh, &offset, elementGlobalCounts, elementLocalCounts, elementOffsets, 1, MPI_FLOAT, buffer );
+	}
+
+	/* 
+	 * The volume averaged stress tensor, as in the stressTensor dump, and its principal values. The average is kept in double
+	 * precision until the eigenvalues are found.
+	 */
+	for( element_lI = 0; element_lI < elementLocalCount; element_lI++ ) {
+		Snac_Element*			element = Snac_Element_At( context, element_lI );
+		Tetrahedra_Index		tetra_I;
+		double				stress[3][3] = { { 0.0, 0.0, 0.0 }, { 0.0, 0.0, 0.0 }, { 0.0, 0.0, 0.0 } };
+		double				principal[3];
+		double				totalVolume = 0.0;
+		unsigned int			ii, jj;
+
+		for( tetra_I = 0; tetra_I < Tetrahedra_Count; tetra_I++ ) 
+			totalVolume += element->tetra[tetra_I].volume;
+		for( tetra_I = 0; tetra_I < Tetrahedra_Count; tetra_I++ ) {
+			const double		weight = element->tetra[tetra_I].volume / totalVolume;
+
+			for( ii = 0; ii < 3; ii++ )
+				for( jj = ii; jj < 3; jj++ )
+					stress[ii][jj] += element->tetra[tetra_I].stress[ii][jj] * weight;
+		}
+		stress[1][0] = stress[0][1];
+		stress[2][0] = stress[0][2];
+		stress[2][1] = stress[1][2];
+		SnacXdmfOutput_PrincipalStresses( stress, principal );
+
+		/* XDMF's Tensor6 order is xx, xy, xz, yy, yz, zz */
+		buffer[6*element_lI+0] = (float)stress[0][0];
+		buffer[6*element_lI+1] = (float)stress[0][1];
+		buffer[6*element_lI+2] = (float)stress[0][2];
+		buffer[6*element_lI+3] = (float)stress[1][1];
+		buffer[6*element_lI+4] = (float)stress[1][2];
+		buffer[6*element_lI+5] = (float)stress[2][2];
+		principalBuffer[3*element_lI+0] = (float)principal[0];
+		principalBuffer[3*element_lI+1] = (float)principal[1];
+		principalBuffer[3*element_lI+2] = (float)principal[2];
+	}
+	_SnacXdmfOutput_AddAttribute( attributes, &attributeCount, "Stress tensor", "Cell", 6, offset );
+	_SnacXdmfOutput_WriteArray( fh, &offset, elementGlobalCounts, elementLocalCounts, elementOffsets, 6, MPI_FLOAT, buffer );
+	_SnacXdmfOutput_AddAttribute( attributes, &attributeCount, "Principal stresses", "Cell", 3, offset );
+	_SnacXdmfOutput_WriteArray( fh, &offset, elementGlobalCounts, elementLocalCounts, elementOffsets, 3, MPI_FLOAT, 
+		principalBuffer );
+
+	MPI_File_close( &fh );
+	Memory_Free( principalBuffer );
+	Memory_Free( buffer );
+
+	/* The light data is small and identical for all ranks, so rank 0 writes it alone */
+	if( context->rank == 0 ) {
+		FILE*				xmlOut;
+
+		sprintf( tmpBuf, "%s/snac.%06u.xmf", context->outputPath, context->timeStep );
+		if( (xmlOut = fopen( tmpBuf, "w" )) == NULL ) {
+			Journal_Firewall( 0, context->snacError, "\"%s\"  failed to open file for writing", tmpBuf );
+		}
+		fprintf( xmlOut, "<?xml version=\"1.0\" ?>\n" );
+		fprintf( xmlOut, "<Xdmf Version=\"2.0\">\n" );
+		fprintf( xmlOut, "  <Domain>\n" );
+		_SnacXdmfOutput_WriteGrid( xmlOut, heavyDataName, context->currentTime, nodeGlobalCounts, elementGlobalCounts, 
+			attributes, attributeCount );
+		fprintf( xmlOut, "  </Domain>\n" );
+		fprintf( xmlOut, "</Xdmf>\n" );
+		fclose( xmlOut );
+
+		if( contextExt->dumpCount == contextExt->dumpSize ) {
+			contextExt->dumpSize = contextExt->dumpSize ? 2 * contextExt->dumpSize : 64;
+			contextExt->dumpTimeStep = Memory_Realloc_Array( contextExt->dumpTimeStep, unsigned int, contextExt->dumpSize );
+		}
+		contextExt->dumpTimeStep[contextExt->dumpCount] = context->timeStep;
+		contextExt->dumpCount++;
+		_SnacXdmfOutput_WriteCollection( context, contextExt );
+	}
+}
+
+
+void SnacXdmfOutput_PrincipalStresses( double stress[3][3], double principal[3] ) {
+	const double			offDiagonal = stress[0][1] * stress[0][1] + stress[0][2] * stress[0][2] + 
+						stress[1][2] * stress[1][2];
+	const double			mean = ( stress[0][0] + stress[1][1] + stress[2][2] ) / 3.0;
+	double				p, r, phi;
+	double				b[3][3];
+	unsigned int			ii, jj;
+
+	if( offDiagonal == 0.0 ) {
+		double			tmp;
+
+		principal[0] = stress[0][0];
+		principal[1] = stress[1][1];
+		principal[2] = stress[2][2];
+		if( principal[0] > principal[1] ) { tmp = principal[0]; principal[0] = principal[1]; principal[1] = tmp; }
+		if( principal[1] > principal[2] ) { tmp = principal[1]; principal[1] = principal[2]; principal[2] = tmp; }
+		if( principal[0] > principal[1] ) { tmp = principal[0]; principal[0] = principal[1]; principal[1] = tmp; }
+		return;
+	}
+
+	/* Closed form for symmetric 3x3 matrices: the deviator's eigenvalues are 2p cos( phi + 2k pi/3 ) */
+	p = ( stress[0][0] - mean ) * ( stress[0][0] - mean ) + ( stress[1][1] - mean ) * ( stress[1][1] - mean ) + 
+		( stress[2][2] - mean ) * ( stress[2][2] - mean ) + 2.0 * offDiagonal;
+	p = sqrt( p / 6.0 );
+	for( ii = 0; ii < 3; ii++ )
+		for( jj = 0; jj < 3; jj++ )
+			b[ii][jj] = ( stress[ii][jj] - ( ii == jj ? mean : 0.0 ) ) / p;
+	r = 0.5 * ( b[0][0] * ( b[1][1] * b[2][2] - b[1][2] * b[2][1] ) - 
+		    b[0][1] * ( b[1][0] * b[2][2] - b[1][2] * b[2][0] ) + 
+		    b[0][2] * ( b[1][0] * b[2][1] - b[1][1] * b[2][0] ) );
+	if( r <= -1.0 )
+		phi = M_PI / 3.0;
+	else if( r >= 1.0 )
+		phi = 0.0;
+	else
+		phi = acos( r ) / 3.0;
+
+	principal[2] = mean + 2.0 * p * cos( phi );
+	principal[0] = mean + 2.0 * p * cos( phi + 2.0 * M_PI / 3.0 );
+	principal[1] = 3.0 * mean - principal[0] - principal[2];
+}
+
+
+static void _SnacXdmfOutput_WriteArray( 
+		MPI_File				fh, 
+		MPI_Offset*				offset, 
+		const unsigned int			globalCounts[3], 
+		const unsigned int			localCounts[3], 
+		const unsigned int			offsets[3], 
+		unsigned int				componentCount, 
+		MPI_Datatype				etype, 
+		void*					buffer )
+{
+	const int			localCount = localCounts[0] * localCounts[1] * localCounts[2] * componentCount;
+	MPI_Datatype			filetype;
+	MPI_Status			status;
+	int				etypeSize;
+
+	MPI_Type_size( etype, &etypeSize );
+
+	/* The global array is stored K slowest, I then the component fastest, so this rank's block is a 4D subarray */
+	if( localCount ) {
+		int			sizes[4] = { globalCounts[2], globalCounts[1], globalCounts[0], componentCount };
+		int			subsizes[4] = { localCounts[2], localCounts[1], localCounts[0], componentCount };
+		int			starts[4] = { offsets[2], offsets[1], offsets[0], 0 };
+
+		MPI_Type_create_subarray( 4, sizes, subsizes, starts, MPI_ORDER_C, etype, &filetype );
+	}
+	else {
+		MPI_Type_contiguous( 0, etype, &filetype );
+	}
+	MPI_Type_commit( &filetype );
+	MPI_File_set_view( fh, *offset, etype, filetype, "native", MPI_INFO_NULL );
+	MPI_File_write_all( fh, buffer, localCount, etype, &status );
+	MPI_Type_free( &filetype );
+
+	*offset += (MPI_Offset)globalCounts[0] * globalCounts[1] * globalCounts[2] * componentCount * etypeSize;
+}
+
+
+static SnacXdmfOutput_Attribute* _SnacXdmfOutput_AddAttribute( 
+		SnacXdmfOutput_Attribute*		attributes, 
+		unsigned int*				attributeCount, 
+		const char*				name, 
+		const char*				center, 
+		unsigned int				componentCount, 
+		MPI_Offset				seek )
+{
+	SnacXdmfOutput_Attribute*		attribute = &attributes[*attributeCount];
+
+	assert( *attributeCount < SnacXdmfOutput_MaxAttributes );
+	strncpy( attribute->name, name, sizeof(attribute->name) - 1 );
+	attribute->name[sizeof(attribute->name) - 1] = '\0';
+	attribute->center = center;
+	attribute->attributeType = componentCount == 6 ? "Tensor6" : componentCount == 3 ? "Vector" : "Scalar";
+	attribute->numberType = "Float";
+	attribute->componentCount = componentCount;
+	attribute->seek = seek;
+	(*attributeCount)++;
+	return attribute;
+}
+
+
+static void _SnacXdmfOutput_WriteGrid( 
+		FILE*					xmlOut, 
+		const char*				heavyDataName, 
+		double					time, 
+		const unsigned int			nodeGlobalCounts[3], 
+		const unsigned int			elementGlobalCounts[3], 
+		SnacXdmfOutput_Attribute*		attributes, 
+		unsigned int				attributeCount )
+{
+	const unsigned int		one = 1;
+	const char*			endian = *(const char*)&one ? "Little" : "Big";
+	unsigned int			attribute_I;
+
+	fprintf( xmlOut, "    <Grid Name=\"snac\" GridType=\"Uniform\">\n" );
+	fprintf( xmlOut, "      <Time Value=\"%.9g\"/>\n", time );
+	fprintf( xmlOut, "      <Topology TopologyType=\"3DSMesh\" Dimensions=\"%u %u %u\"/>\n", 
+		 nodeGlobalCounts[2], nodeGlobalCounts[1], nodeGlobalCounts[0] );
+
+	/* The first attribute is always the coordinates */
+	for( attribute_I = 0; attribute_I < attributeCount; attribute_I++ ) {
+		SnacXdmfOutput_Attribute*	attribute = &attributes[attribute_I];
+		const unsigned int*		counts = strcmp( attribute->center, "Node" ) ? elementGlobalCounts : nodeGlobalCounts;
+
+		if( attribute_I == 0 )
+			fprintf( xmlOut, "      <Geometry GeometryType=\"XYZ\">\n" );
+		else
+			fprintf( xmlOut, "      <Attribute Name=\"%s\" AttributeType=\"%s\" Center=\"%s\">\n", 
+				 attribute->name, attribute->attributeType, attribute->center );
+		fprintf( xmlOut, "        <DataItem Dimensions=\"%u %u %u", counts[2], counts[1], counts[0] );
+		if( attribute->componentCount > 1 )
+			fprintf( xmlOut, " %u", attribute->componentCount );
+		fprintf( xmlOut, "\" NumberType=\"%s\" Precision=\"4\" Format=\"Binary\" Endian=\"%s\" Seek=\"%lld\">%s</DataItem>\n", 
+			 attribute->numberType, endian, (long long)attribute->seek, heavyDataName );
+		fprintf( xmlOut, attribute_I ? "      </Attribute>\n" : "      </Geometry>\n" );
+	}
+	fprintf( xmlOut, "    </Grid>\n" );
+}
+
+
+/*
+ * The temporal collection only refers to the per step files, so it can be rewritten cheaply at every dump and is always
+ * readable, even if the run dies.
+ */
+static void _SnacXdmfOutput_WriteCollection( Snac_Context* context, SnacXdmfOutput_Context* contextExt ) {
+	FILE*				xmlOut;
+	char				tmpBuf[PATH_MAX];
+	Index				dump_I;
+
+	sprintf( tmpBuf, "%s/snac.xmf", context->outputPath );
+	if( (xmlOut = fopen( tmpBuf, "w" )) == NULL ) {
+		Journal_Firewall( 0, context->snacError, "\"%s\"  failed to open file for writing", tmpBuf );
+	}
+	fprintf( xmlOut, "<?xml version=\"1.0\" ?>\n" );
+	fprintf( xmlOut, "<Xdmf Version=\"2.0\" xmlns:xi=\"http://www.w3.org/2001/XInclude\">\n" );
+	fprintf( xmlOut, "  <Domain>\n" );
+	fprintf( xmlOut, "    <Grid Name=\"TimeSeries\" GridType=\"Collection\" CollectionType=\"Temporal\">\n" );
+	for( dump_I = 0; dump_I < contextExt->dumpCount; dump_I++ )
+		fprintf( xmlOut, "      <xi:include href=\"snac.%06u.xmf\" xpointer=\"xpointer(//Xdmf/Domain/Grid)\"/>\n", 
+			 contextExt->dumpTimeStep[dump_I] );
+	fprintf( xmlOut, "    </Grid>\n" );
+	fprintf( xmlOut, "  </Domain>\n" );
+	fprintf( xmlOut, "</Xdmf>\n" );
+	fclose( xmlOut );
+}
@@ -0,0 +1,54 @@
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+**
+** Copyright (C), 2003,
+**	Steve Quenette, 110 Victoria Street, Melbourne, Victoria, 3053, Australia.
+**	Californian Institute of Technology, 1200 East California Boulevard, Pasadena, California, 91125, USA.
+**	University of Texas, 1 University Station, Austin, Texas, 78712, USA.
+**
+** Authors:
+**	Stevan M. Quenette, Senior Software Engineer, VPAC. (steve@vpac.org)
+**	Stevan M. Quenette, Visitor in Geophysics, Caltech.
+**	Luc Lavier, Research Scientist, The University of Texas. (luc@utig.ug.utexas.edu)
+**	Luc Lavier, Research Scientist, Caltech.
+**
+** This program is free software; you can redistribute it and/or modify it
+** under the terms of the GNU General Public License as published by the
+** Free Software Foundation; either version 2, or (at your option) any
+** later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program; if not, write to the Free Software
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+**
+** $Id: Output.h $
+**
+**~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#ifndef __SnacXdmfOutput_Output_h__
+#define __SnacXdmfOutput_Output_h__
+	
+	/* One array of the heavy data file, as described to the XDMF reader */
+	struct _SnacXdmfOutput_Attribute {
+		char				name[64];
+		const char*			center;		/* "Node" or "Cell" */
+		const char*			attributeType;	/* "Scalar", "Vector" or "Tensor6" */
+		const char*			numberType;	/* "Float" or "Int" */
+		unsigned int			componentCount;
+		MPI_Offset			seek;
+	};
+	
+	/* Entry point hook: write the XDMF output whenever the regular dump is written */
+	void _SnacXdmfOutput_Write( void* _context );
+	
+	/* Write one XDMF time step: a single heavy data file written collectively by all ranks, and its light XML */
+	void _SnacXdmfOutput_Dump( void* _context );
+	
+	/* Eigenvalues of a symmetric stress tensor, in ascending order (most compressive first) */
+	void SnacXdmfOutput_PrincipalStresses( double stress[3][3], double principal[3] );
+	
+#endif /* __SnacXdmfOutput_Output_h__ */
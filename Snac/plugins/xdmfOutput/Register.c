@@ -0,0 +1,104 @@
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+**
+** Copyright (C), 2003,
+**	Steve Quenette, 110 Victoria Street, Melbourne, Victoria, 3053, Australia.
+**	Californian Institute of Technology, 1200 East California Boulevard, Pasadena, California, 91125, USA.
+**	University of Texas, 1 University Station, Austin, Texas, 78712, USA.
+**
+** Authors:
+**	Stevan M. Quenette, Senior Software Engineer, VPAC. (steve@vpac.org)
+**	Stevan M. Quenette, Visitor in Geophysics, Caltech.
+**	Luc Lavier, Research Scientist, The University of Texas. (luc@utig.ug.utexas.edu)
+**	Luc Lavier, Research Scientist, Caltech.
+**
+** This program is free software; you can redistribute it and/or modify it
+** under the terms of the GNU General Public License as published by the
+** Free Software Foundation; either version 2, or (at your option) any
+** later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program; if not, write to the Free Software
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+**
+** $Id: Register.c $
+**
+**~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#include <mpi.h>
+#include <StGermain/StGermain.h>
+#include <StGermain/FD/FD.h>
+#include "Snac/Snac.h"
+#include "types.h"
+#include "Context.h"
+#include "Output.h"
+#include "DeleteExtensions.h"
+#include "Register.h"
+#include <stdio.h>
+
+/* Textual name of this class */
+const Type SnacXdmfOutput_Type = "SnacXdmfOutput";
+
+ExtensionInfo_Index SnacXdmfOutput_ContextHandle;
+
+
+Index _SnacXdmfOutput_Register( PluginsManager* pluginsMgr ) {
+	return PluginsManager_Submit( pluginsMgr, 
+				      SnacXdmfOutput_Type, 
+				      "0", 
+				      _SnacXdmfOutput_DefaultNew );
+}
+
+
+void* _SnacXdmfOutput_DefaultNew( Name name ) {
+	return _Codelet_New( sizeof(Codelet), 
+			     SnacXdmfOutput_Type, 
+			     _Codelet_Delete, 
+			     _Codelet_Print, 
+			     _Codelet_Copy, 
+			     _SnacXdmfOutput_DefaultNew, 
+			     _SnacXdmfOutput_Construct, 
+			     _Codelet_Build, 
+			     _Codelet_Initialise, 
+			     _Codelet_Execute, 
+			     _Codelet_Destroy, 
+			     name );
+}
+
+
+void _SnacXdmfOutput_Construct( void* component, Stg_ComponentFactory* cf, void* data ) {
+	Snac_Context*		context;
+	SnacXdmfOutput_Context*	contextExt;
+
+	/* Retrieve context. */
+	context = (Snac_Context*)Stg_ComponentFactory_ConstructByName( cf, "context", Snac_Context, True, data ); 
+
+	#ifdef DEBUG
+		printf( "In: %s()\n", __func__ );
+	#endif
+
+	/* Add extensions to the context */
+	SnacXdmfOutput_ContextHandle = ExtensionManager_Add( context->extensionMgr, SnacXdmfOutput_Type, sizeof(SnacXdmfOutput_Context) );
+
+	/* Add extensions to the entry points. Sync runs once the step's fields are final, as does the regular dump. */
+	EntryPoint_Append(
+		Context_GetEntryPoint( context, AbstractContext_EP_Sync ),
+		"SnacXdmfOutput_Write",
+		_SnacXdmfOutput_Write,
+		SnacXdmfOutput_Type );
+	EntryPoint_Append(
+		Context_GetEntryPoint( context, AbstractContext_EP_DestroyExtensions ),
+		SnacXdmfOutput_Type,
+		_SnacXdmfOutput_DeleteExtensions,
+		SnacXdmfOutput_Type );
+
+	/* Construct. */
+	contextExt = ExtensionManager_Get( context->extensionMgr, context, SnacXdmfOutput_ContextHandle );
+	contextExt->dumpCount = 0;
+	contextExt->dumpSize = 0;
+	contextExt->dumpTimeStep = NULL;
+}
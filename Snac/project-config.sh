@@ -52,6 +52,7 @@ setValue PROJECT 'Snac'
 . ./VMake/Config/math-config.sh
 . ./VMake/Config/mpi-config.sh
 . ./VMake/Config/xml-config.sh
+. ./VMake/Config/zlib-config.sh
 . ./VMake/Config/StGermain-config.sh
 ## . ./VMake/Config/gsl-config.sh
 ## . ./VMake/Config/python-config.sh --optional
@@ -35,6 +35,7 @@
 #include <assert.h>
 #include <vector>
 #include <algorithm>
+#include <limits>
 extern "C" {
 	#include <mpi.h>
 	#include <StGermain/StGermain.h>
@@ -175,6 +176,78 @@ const int nsub[] = {
 };
 
 
+namespace {
+
+	// Uniform grid over the points of a BoundedMesh, holding about one point per cell. The points of
+	// cell c are points_[start_[c]] .. points_[start_[c+1]-1], in increasing order.
+	class PointGrid {
+		double min_[Exchanger::DIM];
+		double scale_[Exchanger::DIM];
+		int n_[Exchanger::DIM];
+		std::vector<int> start_;
+		std::vector<int> points_;
+
+		int cell( int d, double x ) const {
+			int c = int( ( x - min_[d] ) * scale_[d] );
+			return std::max( 0, std::min( n_[d] - 1, c ) );
+		}
+
+	public:
+		PointGrid( const BoundedMesh& mesh ) {
+			const int npoints = mesh.size();
+			const int n = std::max( 1, int( ceil( pow( double( npoints ), 1.0 / 3.0 ) ) ) );
+
+			for( int d = 0; d < Exchanger::DIM; d++ ) {
+				double max = -std::numeric_limits<double>::max();
+
+				min_[d] = std::numeric_limits<double>::max();
+				for( int i = 0; i < npoints; i++ ) {
+					min_[d] = std::min( min_[d], mesh.X( d, i ) );
+					max = std::max( max, mesh.X( d, i ) );
+				}
+				n_[d] = ( max > min_[d] ) ? n : 1;
+				scale_[d] = ( max > min_[d] ) ? n_[d] / ( max - min_[d] ) : 0;
+			}
+
+			// counting sort of the points by cell; filling in point order keeps each cell sorted
+			std::vector<int> cells( npoints );
+			start_.assign( n_[0] * n_[1] * n_[2] + 1, 0 );
+			for( int i = 0; i < npoints; i++ ) {
+				cells[i] = ( cell( 2, mesh.X( 2, i ) ) * n_[1] + cell( 1, mesh.X( 1, i ) ) ) * n_[0] + cell( 0, mesh.X( 0, i ) );
+				start_[cells[i] + 1]++;
+			}
+			for( unsigned c = 1; c < start_.size(); c++ )
+				start_[c] += start_[c - 1];
+
+			std::vector<int> next( start_.begin(), start_.end() - 1 );
+			points_.resize( npoints );
+			for( int i = 0; i < npoints; i++ )
+				points_[next[cells[i]]++] = i;
+		}
+
+		// All points in the cells overlapping bbox, in increasing order.
+		void candidates( const BoundedBox& bbox, std::vector<int>& found ) const {
+			int lo[Exchanger::DIM], hi[Exchanger::DIM];
+
+			for( int d = 0; d < Exchanger::DIM; d++ ) {
+				lo[d] = cell( d, bbox[0][d] );
+				hi[d] = cell( d, bbox[1][d] );
+			}
+
+			found.clear();
+			for( int k = lo[2]; k <= hi[2]; k++ )
+				for( int j = lo[1]; j <= hi[1]; j++ )
+					for( int i = lo[0]; i <= hi[0]; i++ ) {
+						const int c = ( k * n_[1] + j ) * n_[0] + i;
+						found.insert( found.end(), points_.begin() + start_[c], points_.begin() + start_[c + 1] );
+					}
+			std::sort( found.begin(), found.end() );
+		}
+	};
+
+}
+
+
 void SnacInterpolator::findMaxGridSpacing( const void* _context ) {
 	Snac_Context* context = (Snac_Context*)_context;
 
@@ -221,6 +294,11 @@ void SnacInterpolator::init( const BoundedMesh& boundedMesh, const void* _contex
 
 	findMaxGridSpacing( context );
 
+	// Each element only tests the incoming points that share a grid cell with its bounding box. Candidates
+	// come back in point order, so points are still claimed by the first element containing them.
+	PointGrid grid( boundedMesh );
+	std::vector<int> candidates;
+
 	elem_.reserve( boundedMesh.size() );
 	tetra_.reserve( boundedMesh.size() );
 	shape_.reserve( boundedMesh.size() );
@@ -243,7 +321,7 @@ void SnacInterpolator::init( const BoundedMesh& boundedMesh, const void* _contex
 
 		for(int d=0; d<Exchanger::DIM; ++d) {
 			elembbox[0][d] = std::numeric_limits<double>::max();
-			elembbox[1][d] = std::numeric_limits<double>::min();
+			elembbox[1][d] = -std::numeric_limits<double>::max();
 		}
 
 		for(unsigned int n=0; n<elementNodeCount; ++n)
@@ -252,7 +330,10 @@ void SnacInterpolator::init( const BoundedMesh& boundedMesh, const void* _contex
 				elembbox[1][d] = std::max(elembbox[1][d], xc[n*Exchanger::DIM+d]);
 			}
 
-		for( int i = 0; i < boundedMesh.size(); i++ ) {
+		grid.candidates( elembbox, candidates );
+
+		for( unsigned c = 0; c < candidates.size(); c++ ) {
+			const int i = candidates[c];
 
 			if(ind[i]) continue;
 
@@ -33,11 +33,18 @@
 **
 **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
+#define _FILE_OFFSET_BITS 64
 #include <stdio.h>
 #include <stdlib.h>
 #include <math.h>
 #include <assert.h>
 #include <string.h>
+#include <stdint.h>
+#include <sys/types.h>
+#include <mpi.h>
+#ifdef HAVE_ZLIB
+	#include <zlib.h>
+#endif
 #ifndef PI
 	#ifndef M_PIl
 		#ifndef M_PI
@@ -67,13 +74,61 @@
 
 #define SWAP(a,b,t)     t=a;a=b;b=t; 
 
+/* Uncompressed bytes per zlib block, the same as vtkZLibDataCompressor's default. */
+#define VTK_ZLIB_BLOCK_SIZE 32768
+
 //#define DEBUG
 
 
+/*
+ * How the data arrays are laid out in the .vts files. Ascii is the historical (inline) output; raw and zlib write all
+ * arrays into an appended binary section, the latter compressed in independent blocks the way VTK itself does.
+ */
+typedef enum { OUTPUT_ASCII, OUTPUT_RAW, OUTPUT_ZLIB } OutputFormat;
+
+typedef enum { ARRAY_FLOAT32, ARRAY_FLOAT64, ARRAY_UINT32 } ArrayType;
+
+/* One data array of a piece: its description, its values and, for the appended formats, its encoded payload. */
+typedef struct {
+	char			name[64];
+	ArrayType		type;
+	unsigned int		componentCount;
+	unsigned int		tupleCount;
+	void*			data;
+	unsigned char*		encoded;
+	size_t			encodedSize;
+} VtkArray;
+
+#define MAX_VTK_ARRAYS 16
+
+/* The arrays of a piece, split up into the sections they belong to in the VTK file. */
+typedef struct {
+	VtkArray		pointData[MAX_VTK_ARRAYS];
+	unsigned int		pointDataCount;
+	VtkArray		cellData[MAX_VTK_ARRAYS];
+	unsigned int		cellDataCount;
+	VtkArray		points;
+} VtkPiece;
+
 
 void ConvertTimeStep( int rank, unsigned int dumpIteration, unsigned int simTimeStep, double time, int gnode[3], int rank_array[3], 
 		      const int rankI, const int rankJ, const int rankK );
 
+void OpenRankFiles( int rank );
+void CloseRankFiles( void );
+void ReadDumpArray( FILE* in, const char* fieldName, int rank, unsigned int dumpIteration, size_t itemSize, size_t itemCount, 
+		    void* buffer );
+VtkArray* AddArray( VtkArray* arrays, unsigned int* arrayCount, const char* name, ArrayType type, unsigned int componentCount, 
+		    unsigned int tupleCount );
+void FreePiece( VtkPiece* piece );
+void EncodeArray( VtkArray* array );
+void WriteDataArray( FILE* vtkOut, VtkArray* array, size_t* offset );
+void WriteAppendedData( FILE* vtkOut, VtkPiece* piece );
+void WriteParallelFile( VtkPiece* piece, unsigned int simTimeStep, int gnode[3], int rank_array[3] );
+const char* ArrayTypeName( ArrayType type );
+size_t ArrayTypeSize( ArrayType type );
+const char* ByteOrderName( void );
+
 int DerivePrincipalStresses(double stressTensor[3][3],double sp[3],double cn[3][3]);
 
 double** dmatrix(long nrl, long nrh, long ncl, long nch);
@@ -99,7 +154,7 @@ struct stressMeasures {
     double	slopeNormalStress;
 
 };
-void DeriveStressMeasures(FILE *stressTensorIn, 
+void DeriveStressMeasures(const float *stressTensorArray, 
 			  double elementStressTensor[3][3], 
 			  struct stressMeasures *elementStressMeasures);
 
@@ -107,9 +162,7 @@ void DeriveStressMeasures(FILE *stressTensorIn,
 
 char		path[PATH_MAX];
 FILE*		strainRateIn;
-FILE*		stressIn;
 FILE*		stressTensorIn;
-FILE*		hydroPressureIn;
 FILE*		coordIn;
 FILE*		velIn;
 FILE*		forceIn;
@@ -122,9 +175,13 @@ unsigned int	elementLocalSize[3];
 int 			doTemp = 1;
 int 			doForce = 1;
 int 			doAps = 1;
-int 			doHPr = 1;
 int 			doVisc = 1;
 double			failureAngle = 30.0;
+#ifdef HAVE_ZLIB
+OutputFormat		outputFormat = OUTPUT_ZLIB;
+#else
+OutputFormat		outputFormat = OUTPUT_RAW;
+#endif
 const unsigned	numStressVectorComponent = 6; /* 6 components in stress vector */
 const unsigned	numStressComponentsPerElement = 6; /* 6 averaged components per element */
 
@@ -136,6 +193,10 @@ int main( int argc, char* argv[])
     unsigned int	rank;
     unsigned int	simTimeStep;
     unsigned int	dumpIteration;
+    unsigned int	dumpCount;
+    unsigned int	dumpSize;
+    unsigned int*	dumpTimeStep;
+    double*		dumpTime;
     double		time;
     double		dt;
     int		gelem[3];
@@ -143,14 +204,22 @@ int main( int argc, char* argv[])
     int		rank_array[3];
     unsigned int	rankI,rankJ,rankK;
     unsigned int	stepMin=-1,stepMax=0;
+    int		procRank;
+    int		procCount;
+    unsigned int	workI;
 	
-    if( argc<2 || argc>5 ) {
-		fprintf(stderr,"snac2vtk path-to-output-directory [start-step[max-step]] [end-step[max-step]] [failure-angle[30 (degrees)]]\n");
+    MPI_Init( &argc, &argv );
+    MPI_Comm_rank( MPI_COMM_WORLD, &procRank );
+    MPI_Comm_size( MPI_COMM_WORLD, &procCount );
+
+    if( argc<2 || argc>6 ) {
+		fprintf(stderr,"snac2vtk path-to-output-directory [start-step[max-step]] [end-step[max-step]] [failure-angle[30 (degrees)]] [format[ascii|raw|zlib]]\n");
 		exit(1);
     }
 
     /*
-     * Set the default input/output path and range of time steps to process.
+     * Set the default input/output path and range of time steps to process. The dump times are kept so that the 
+     * time step file is read only once, however many ranks there are to convert.
      */
     strcpy( path, argv[1] );
 	sprintf( tmpBuf, "%s/timeStep.0", path );
@@ -158,8 +227,19 @@ int main( int argc, char* argv[])
 		fprintf(stderr, "\"%s\" not found\n", tmpBuf );
 		exit(1);
 	}
-	while( !feof( timeStepIn ) ) {
-		fscanf( timeStepIn, "%16u %16lg %16lg\n", &simTimeStep, &time, &dt );
+	dumpCount = 0;
+	dumpSize = 64;
+	dumpTimeStep = (unsigned int*)malloc( dumpSize * sizeof(unsigned int) );
+	dumpTime = (double*)malloc( dumpSize * sizeof(double) );
+	while( fscanf( timeStepIn, "%16u %16lg %16lg\n", &simTimeStep, &time, &dt ) == 3 ) {
+		if( dumpCount == dumpSize ) {
+			dumpSize *= 2;
+			dumpTimeStep = (unsigned int*)realloc( dumpTimeStep, dumpSize * sizeof(unsigned int) );
+			dumpTime = (double*)realloc( dumpTime, dumpSize * sizeof(double) );
+		}
+		dumpTimeStep[dumpCount] = simTimeStep;
+		dumpTime[dumpCount] = time;
+		dumpCount++;
 		if(stepMin==-1) stepMin=simTimeStep;
 		if(stepMax<simTimeStep) stepMax=simTimeStep;
 	}
@@ -187,14 +267,38 @@ int main( int argc, char* argv[])
 		fprintf(stderr, "Error in time step range (start/stop reversed):  %u <-> %u\n", stepMin, stepMax );
 		exit(1);
 	}
-	fprintf(stderr, "Time step range:  %u <-> %u\n", stepMin, stepMax );
+	if( procRank == 0 )
+		fprintf(stderr, "Time step range:  %u <-> %u\n", stepMin, stepMax );
 
 	/*
 	 *  Parse angle used to compute failure potential - using global variable (ick)
 	 */
 	if(argc>=5) {
 		failureAngle=atof(argv[4]);
-		fprintf(stderr, "Failure angle = %g\n", failureAngle );
+		if( procRank == 0 )
+			fprintf(stderr, "Failure angle = %g\n", failureAngle );
+	}
+
+	/*
+	 *  Parse the output format.
+	 */
+	if(argc>=6) {
+		if( !strcmp( argv[5], "ascii" ) )
+			outputFormat = OUTPUT_ASCII;
+		else if( !strcmp( argv[5], "raw" ) )
+			outputFormat = OUTPUT_RAW;
+		else if( !strcmp( argv[5], "zlib" ) ) {
+#ifdef HAVE_ZLIB
+			outputFormat = OUTPUT_ZLIB;
+#else
+			fprintf(stderr, "snac2vtk was built without zlib; use the \"raw\" or \"ascii\" format instead\n" );
+			exit(1);
+#endif
+		}
+		else {
+			fprintf(stderr, "Unknown output format \"%s\" (expected ascii, raw or zlib)\n", argv[5] );
+			exit(1);
+		}
 	}
 		
     /*
@@ -214,123 +318,146 @@ int main( int argc, char* argv[])
 	gnode[1] = gelem[1]+1;
 	gnode[2] = gelem[2]+1;
 
-	/* Start processing for each rank */
+	/*
+	 * Start processing for each rank. Every (rank, dump) pair is an independent piece of work, dealt out round-robin to 
+	 * the processes this converter runs on. A rank's files are only opened if at least one of its dumps is ours.
+	 */
+	workI = 0;
     for( rankK=0; rankK < rank_array[2]; rankK++ )
 	for( rankJ=0; rankJ < rank_array[1]; rankJ++ )
 	    for( rankI=0; rankI < rank_array[0]; rankI++ ) {
+			int filesOpen = 0;
+
 			rank = rankI + rankJ*rank_array[0] + rankK*rank_array[0]*rank_array[1]; 
 			
-			sprintf( tmpBuf, "%s/timeStep.0", path );
-			if( (timeStepIn = fopen( tmpBuf, "r" )) == NULL ) {
-				fprintf(stderr, "\"%s\" not found\n", tmpBuf );
-				exit(1);
-			}
-			sprintf( tmpBuf, "%s/strainRate.%u", path, rank );
-			if( (strainRateIn = fopen( tmpBuf, "r" )) == NULL ) {
-				fprintf(stderr, "\"%s\" not found\n", tmpBuf );
-				exit(1);
-			}
-			sprintf( tmpBuf, "%s/hydroPressure.%u", path, rank );
-			if( ( hydroPressureIn = fopen( tmpBuf, "r" )) == NULL ) {
-				fprintf(stderr, "\"%s\" not found\n", tmpBuf );
-				doHPr = 0;
-			}
-			sprintf( tmpBuf, "%s/stress.%u", path, rank );
-			if( (stressIn = fopen( tmpBuf, "r" )) == NULL ) {
-				fprintf(stderr, "\"%s\" not found\n", tmpBuf );
-				exit(1);
-			}
-			sprintf( tmpBuf, "%s/stressTensor.%u", path, rank );
-			if( (stressTensorIn = fopen( tmpBuf, "r" )) == NULL ) {
-				fprintf(stderr, "\"%s\" not found\n", tmpBuf );
-				exit(1);
-			}
-			sprintf( tmpBuf, "%s/coord.%u", path, rank );
-			if( (coordIn = fopen( tmpBuf, "r" )) == NULL ) {
-				fprintf(stderr, "\"%s\" not found\n", tmpBuf );
-				exit(1);
-			}
-			sprintf( tmpBuf, "%s/vel.%u", path, rank );
-			if( (velIn = fopen( tmpBuf, "r" )) == NULL ) {
-				fprintf(stderr, "\"%s\" not found\n", tmpBuf );
-				exit(1);
-			}
-			sprintf( tmpBuf, "%s/force.%u", path, rank );
-			if( (forceIn = fopen( tmpBuf, "r" )) == NULL ) {
-				fprintf(stderr, "\"%s\" not found\n", tmpBuf );
-				doForce = 0;
-			}
-			sprintf( tmpBuf, "%s/phaseIndex.%u", path, rank );
-			if( (phaseIn = fopen( tmpBuf, "r" )) == NULL ) {
-				fprintf(stderr, "\"%s\" not found\n", tmpBuf );
-				exit(1);
-			}
-			sprintf( tmpBuf, "%s/temperature.%u", path, rank );
-			if( (tempIn = fopen( tmpBuf, "r" )) == NULL ) {
-				fprintf(stderr, "\"%s\" not found... assuming temperature plugin not used\n", tmpBuf );
-				doTemp = 0;
-			}
-			sprintf( tmpBuf, "%s/plStrain.%u", path, rank );
-			if( (apsIn = fopen( tmpBuf, "r" )) == NULL ) {
-				fprintf(stderr, "\"%s\" not found... assuming plastic plugin not used\n", tmpBuf );
-				doAps = 0;
-			}
-			sprintf( tmpBuf, "%s/viscosity.%u", path, rank );
-			if( (viscIn = fopen( tmpBuf, "r" )) == NULL ) {
-				fprintf(stderr, "\"%s\" not found... assuming Maxwell plugin not used.\n", tmpBuf );
-				doVisc = 0;
-			}
-			
 			/*
-			 * Read in loop information and write VTK files for wanted time steps.
+			 * Write VTK files for wanted time steps.
 			 */
-			dumpIteration = 0;
-			while( !feof( timeStepIn ) ) {
-				fscanf( timeStepIn, "%16u %16lg %16lg\n", &simTimeStep, &time, &dt );
-				if( simTimeStep <stepMin || simTimeStep > stepMax ) {
-					dumpIteration++;
+			for( dumpIteration = 0; dumpIteration < dumpCount; dumpIteration++ ) {
+				if( dumpTimeStep[dumpIteration] < stepMin || dumpTimeStep[dumpIteration] > stepMax )
+					continue;
+				if( (workI++ % procCount) != procRank )
 					continue;
+				if( !filesOpen ) {
+					OpenRankFiles( rank );
+					filesOpen = 1;
 				}
-				ConvertTimeStep( rank, dumpIteration, simTimeStep, time, gnode, rank_array, rankI, rankJ, rankK );
-				dumpIteration++;
-			}
-			
-			/*
-			 * Close the input files 
-			 */
-			if( apsIn ) {
-				fclose( apsIn );
-			}
-			if( viscIn ) {
-				fclose( viscIn );
+				ConvertTimeStep( rank, dumpIteration, dumpTimeStep[dumpIteration], dumpTime[dumpIteration], gnode, rank_array, 
+						 rankI, rankJ, rankK );
 			}
-			if( tempIn ) {
-				fclose( tempIn );
-			}
-			if( forceIn ) {
-				fclose( forceIn );
-			}
-			if( hydroPressureIn ) {
-				fclose( hydroPressureIn );
-			}
-			fclose( timeStepIn );
-			fclose( phaseIn );
-			fclose( velIn );
-			fclose( coordIn );
-			fclose( stressIn );
-			fclose( stressTensorIn );
-			fclose( strainRateIn );
 			
-			/*
-			 * Do next rank 
-			 */
-			rank++;
+			if( filesOpen )
+				CloseRankFiles();
 	    } /* End processing for each rank */
+
+    free( dumpTimeStep );
+    free( dumpTime );
+    MPI_Finalize();
 	
     return 0;
 }
 
 
+/*
+ * Open the dump files of one rank. Fields written by optional plugins may be missing, in which case they are skipped.
+ */
+void OpenRankFiles( int rank ) {
+	char		tmpBuf[PATH_MAX];
+
+	sprintf( tmpBuf, "%s/strainRate.%u", path, rank );
+	if( (strainRateIn = fopen( tmpBuf, "r" )) == NULL ) {
+		fprintf(stderr, "\"%s\" not found\n", tmpBuf );
+		exit(1);
+	}
+	sprintf( tmpBuf, "%s/stressTensor.%u", path, rank );
+	if( (stressTensorIn = fopen( tmpBuf, "r" )) == NULL ) {
+		fprintf(stderr, "\"%s\" not found\n", tmpBuf );
+		exit(1);
+	}
+	sprintf( tmpBuf, "%s/coord.%u", path, rank );
+	if( (coordIn = fopen( tmpBuf, "r" )) == NULL ) {
+		fprintf(stderr, "\"%s\" not found\n", tmpBuf );
+		exit(1);
+	}
+	sprintf( tmpBuf, "%s/vel.%u", path, rank );
+	if( (velIn = fopen( tmpBuf, "r" )) == NULL ) {
+		fprintf(stderr, "\"%s\" not found\n", tmpBuf );
+		exit(1);
+	}
+	sprintf( tmpBuf, "%s/force.%u", path, rank );
+	if( (forceIn = fopen( tmpBuf, "r" )) == NULL ) {
+		fprintf(stderr, "\"%s\" not found\n", tmpBuf );
+	}
+	doForce = (forceIn != NULL);
+	sprintf( tmpBuf, "%s/phaseIndex.%u", path, rank );
+	if( (phaseIn = fopen( tmpBuf, "r" )) == NULL ) {
+		fprintf(stderr, "\"%s\" not found\n", tmpBuf );
+		exit(1);
+	}
+	sprintf( tmpBuf, "%s/temperature.%u", path, rank );
+	if( (tempIn = fopen( tmpBuf, "r" )) == NULL ) {
+		fprintf(stderr, "\"%s\" not found... assuming temperature plugin not used\n", tmpBuf );
+	}
+	doTemp = (tempIn != NULL);
+	sprintf( tmpBuf, "%s/plStrain.%u", path, rank );
+	if( (apsIn = fopen( tmpBuf, "r" )) == NULL ) {
+		fprintf(stderr, "\"%s\" not found... assuming plastic plugin not used\n", tmpBuf );
+	}
+	doAps = (apsIn != NULL);
+	sprintf( tmpBuf, "%s/viscosity.%u", path, rank );
+	if( (viscIn = fopen( tmpBuf, "r" )) == NULL ) {
+		fprintf(stderr, "\"%s\" not found... assuming Maxwell plugin not used.\n", tmpBuf );
+	}
+	doVisc = (viscIn != NULL);
+}
+
+
+void CloseRankFiles( void ) {
+	if( apsIn ) {
+		fclose( apsIn );
+	}
+	if( viscIn ) {
+		fclose( viscIn );
+	}
+	if( tempIn ) {
+		fclose( tempIn );
+	}
+	if( forceIn ) {
+		fclose( forceIn );
+	}
+	fclose( phaseIn );
+	fclose( velIn );
+	fclose( coordIn );
+	fclose( stressTensorIn );
+	fclose( strainRateIn );
+}
+
+
+/*
+ * Read the whole of one field for one dump with a single seek and read. Each dump of a field is stored contiguously,
+ * dumpIteration dumps into the file.
+ */
+void ReadDumpArray( FILE* in, const char* fieldName, int rank, unsigned int dumpIteration, size_t itemSize, size_t itemCount, 
+		    void* buffer ) 
+{
+	if( fseeko( in, (off_t)dumpIteration * itemCount * itemSize, SEEK_SET ) != 0 ) {
+		fprintf(stderr, "Cannot find read required portion of Snac %s output file:  rank=%d,  dump iteration=%u, count=%lu\n", 
+			fieldName, rank, dumpIteration, (unsigned long)itemCount );
+		exit(1);
+	}
+	if( fread( buffer, itemSize, itemCount, in ) != itemCount ) {
+		if( feof( in ) ) {
+			fprintf(stderr, "Error (reached EOF prematurely) while reading Snac %s output file:  rank=%d,  dump iteration=%u, count=%lu\n", 
+				fieldName, rank, dumpIteration, (unsigned long)itemCount );
+		} else {
+			fprintf(stderr, "Error while reading Snac %s output file:  rank=%d,  dump iteration=%u, count=%lu\n", 
+				fieldName, rank, dumpIteration, (unsigned long)itemCount );
+		}
+		exit(1);
+	}
+}
+
+
 void ConvertTimeStep( 
 		     int rank, 
 		     unsigned int dumpIteration, 
@@ -343,743 +470,406 @@ void ConvertTimeStep(
 		     const int rankK 
 		     ) 
 {
-    char		tmpBuf[PATH_MAX], tmpBuf1[PATH_MAX];
+    char		tmpBuf[PATH_MAX];
     FILE*		vtkOut;
-    FILE*		vtkOut1;
     unsigned int	elementLocalCount = elementLocalSize[0] * elementLocalSize[1] * elementLocalSize[2];
     unsigned int	nodeLocalSize[3] = { elementLocalSize[0] + 1, elementLocalSize[1] + 1, elementLocalSize[2] + 1 };
     unsigned int	nodeLocalCount = nodeLocalSize[0] * nodeLocalSize[1] * nodeLocalSize[2];
-    unsigned int	node_gI;
     unsigned int	element_gI;
+    unsigned int	array_I;
+    size_t		offset;
+    VtkPiece		piece;
+    VtkArray*		array;
+    VtkArray*		stressArray[6];
+    VtkArray*		pressureArray;
+    float*		stressTensorArray;
+    const char*		stressComponentName[6] = { "Sxx", "Syy", "Szz", "Sxy", "Sxz", "Syz" };
 	
-    /*
-     * Open the output file 
-     */
-    sprintf( tmpBuf, "%s/snac.%i.%06u.vts", path, rank, simTimeStep );
-    if( (vtkOut = fopen( tmpBuf, "w+" )) == NULL ) {
-	fprintf(stderr, "Cannot open \"%s\" for writing\n", tmpBuf );
-	exit(1);
-    }
-	
-    /*
-     * Write out simulation information 
-     */
-    fprintf( vtkOut, "<?xml version=\"1.0\"?>\n" );
-    fprintf( vtkOut, "<VTKFile type=\"StructuredGrid\"  version=\"0.1\" byte_order=\"LittleEndian\" compressor=\"vtkZLibDataCompressor\">\n");
-    fprintf( vtkOut, "  <StructuredGrid WholeExtent=\"%d %d %d %d %d %d\">\n",
-	     rankI*elementLocalSize[0],(rankI+1)*elementLocalSize[0],
-	     rankJ*elementLocalSize[1],(rankJ+1)*elementLocalSize[1],
-	     rankK*elementLocalSize[2],(rankK+1)*elementLocalSize[2]);
-    fprintf( vtkOut, "    <Piece Extent=\"%d %d %d %d %d %d\">\n",
-	     rankI*elementLocalSize[0],(rankI+1)*elementLocalSize[0],
-	     rankJ*elementLocalSize[1],(rankJ+1)*elementLocalSize[1],
-	     rankK*elementLocalSize[2],(rankK+1)*elementLocalSize[2]);
-	
+    memset( &piece, 0, sizeof(VtkPiece) );
+
     /* 
      *
-     *  			Start the ---node--- section 
+     *  			Read the ---node--- fields 
      *
      */
-    fprintf( vtkOut, "      <PointData Vectors=\"velocity\">\n");
-	
-    /*
-     * Write out the velocity information 
-     */
-    fprintf( vtkOut, "        <DataArray type=\"Float64\" Name=\"velocity\" NumberOfComponents=\"3\" format=\"ascii\">\n");
-    if (fseek( velIn, dumpIteration * nodeLocalCount * sizeof(float) * 3, SEEK_SET )!=0) {
-	fprintf(stderr, "Cannot find read required portion of Snac velocity output file:  rank=%d: %d, %d, %d,  dump iteration=%d, node count=%d\n", 
-		rank, rankI, rankJ, rankK,
-		dumpIteration, nodeLocalCount );
-	exit(1);
-    }
-    for( node_gI = 0; node_gI < nodeLocalCount; node_gI++ ) {
-	float		vel[3];
-	if (fread( &vel, sizeof(float), 3, velIn )==0) {
-	    if (feof(velIn)) {
-		fprintf(stderr, "Error (reached EOF prematurely) while reading Snac velocity output file:  rank=%d: %d, %d, %d,  dump iteration=%d, node=%d/%d\n", 
-			rank, rankI, rankJ, rankK,
-			dumpIteration, node_gI, nodeLocalCount );
-		exit(1);
-	    } else {
-		fprintf(stderr, "Error while reading Snac velocity output file:  rank=%d: %d, %d, %d,  dump iteration=%d, node=%d/%d\n", 
-			rank, rankI, rankJ, rankK,
-			dumpIteration, node_gI, nodeLocalCount );
-		exit(1);
-	    }
-	}	 
-
-
-
-	/* 		fprintf(stderr, "Error (reached EOF prematurely) while reading Snac force stress tensor output file: tetrahedral element #%d\n" , tetra_I); */
-   
-	fprintf( vtkOut, "%g %g %g\n", vel[0], vel[1], vel[2] );
-    }
-    fprintf( vtkOut, "        </DataArray>\n");
-	
-    /*
-     * Write out the force information 
-     */
+    array = AddArray( piece.pointData, &piece.pointDataCount, "velocity", ARRAY_FLOAT32, 3, nodeLocalCount );
+    ReadDumpArray( velIn, "velocity", rank, dumpIteration, sizeof(float) * 3, nodeLocalCount, array->data );
     if( doForce ) {
-	fprintf( vtkOut, "        <DataArray type=\"Float64\" Name=\"force\" NumberOfComponents=\"3\" format=\"ascii\">\n");
-	if (fseek( forceIn, dumpIteration * nodeLocalCount * sizeof(float) * 3, SEEK_SET )!=0) {
-	    fprintf(stderr, "Cannot find read required portion of Snac force output file:  rank=%d: %d, %d, %d,  dump iteration=%d, node count=%d\n", 
-		    rank, rankI, rankJ, rankK,
-		    dumpIteration, nodeLocalCount );
-	    exit(1);
-	}
-	for( node_gI = 0; node_gI < nodeLocalCount; node_gI++ ) {
-	    float		force[3];
-	    if (fread( &force, sizeof(float), 3, forceIn )==0)  {
-		if (feof(forceIn)) {
-		    fprintf(stderr, "Error (reached EOF prematurely) while reading Snac force output file:  rank=%d: %d, %d, %d,  dump iteration=%d, node=%d/%d\n", 
-			    rank, rankI, rankJ, rankK,
-			    dumpIteration, node_gI, nodeLocalCount );
-		    exit(1);
-		} else {
-		    fprintf(stderr, "Error while reading Snac force output file:  rank=%d: %d, %d, %d,  dump iteration=%d, node=%d/%d\n", 
-			    rank, rankI, rankJ, rankK,
-			    dumpIteration, node_gI, nodeLocalCount );
-		    exit(1);
-		}
-	    }
-	    fprintf( vtkOut, "%g %g %g\n", force[0], force[1], force[2] );
-	}
-	fprintf( vtkOut, "        </DataArray>\n");
+	array = AddArray( piece.pointData, &piece.pointDataCount, "force", ARRAY_FLOAT32, 3, nodeLocalCount );
+	ReadDumpArray( forceIn, "force", rank, dumpIteration, sizeof(float) * 3, nodeLocalCount, array->data );
     }
-	
-    /*
-     * Write out the temperature information 
-     */
     if( doTemp ) {
-	fprintf( vtkOut, "        <DataArray type=\"Float64\" Name=\"temperature\" format=\"ascii\">\n");
-	if (fseek( tempIn, dumpIteration * nodeLocalCount * sizeof(float), SEEK_SET )!=0) {
-	    fprintf(stderr, "Cannot find read required portion of Snac temperature output file:  rank=%d: %d, %d, %d,  dump iteration=%d, node count=%d\n", 
-		    rank, rankI, rankJ, rankK,
-		    dumpIteration, nodeLocalCount );
-	    exit(1);
-	}
-	for( node_gI = 0; node_gI < nodeLocalCount; node_gI++ ) {
-	    float		temperature;
-	    if (fread( &temperature, sizeof(float), 1, tempIn )==0)  {
-		if (feof(tempIn)) {
-		    fprintf(stderr, "Error (reached EOF prematurely) while reading Snac temperature output file:  rank=%d: %d, %d, %d,  dump iteration=%d, node=%d/%d\n", 
-			    rank, rankI, rankJ, rankK,
-			    dumpIteration, node_gI, nodeLocalCount );
-		    exit(1);
-		} else {
-		    fprintf(stderr, "Error while reading Snac temperature output file:  rank=%d: %d, %d, %d,  dump iteration=%d, node=%d/%d\n", 
-			    rank, rankI, rankJ, rankK,
-			    dumpIteration, node_gI, nodeLocalCount );
-		    exit(1);
-		}
-	    }
-	    fprintf( vtkOut, "%g ", temperature );
-	}
-	fprintf( vtkOut, "        </DataArray>\n");
+	array = AddArray( piece.pointData, &piece.pointDataCount, "temperature", ARRAY_FLOAT32, 1, nodeLocalCount );
+	ReadDumpArray( tempIn, "temperature", rank, dumpIteration, sizeof(float), nodeLocalCount, array->data );
     }
-    fprintf( vtkOut, "      </PointData>\n");
-
 
     /* 
      *
-     *  			Start the ---element--- section 
+     *  			Read the ---element--- fields 
      *
      */
-    fprintf( vtkOut, "      <CellData Scalars=\"Plastic strain\">\n");
-
-
-    /*
-     * Write out the plastic strain information 
-     */
     if( doAps ) {
-	fprintf( vtkOut, "        <DataArray type=\"Float64\" Name=\"Plastic strain\" format=\"ascii\">\n");
-	if (fseek( apsIn, dumpIteration * elementLocalCount * sizeof(float), SEEK_SET )!=0) {
-	    fprintf(stderr, "Cannot find read required portion of Snac plastic strain output file:  rank=%d: %d, %d, %d,  dump iteration=%d, node count=%d\n", 
-		    rank, rankI, rankJ, rankK,
-		    dumpIteration, nodeLocalCount );
-	    exit(1);
-	}
-	for( element_gI = 0; element_gI < elementLocalCount; element_gI++ ) {
-	    float		plStrain;
-	    if (fread( &plStrain, sizeof(float), 1, apsIn )==0)  {
-		if (feof(apsIn)) {
-		    fprintf(stderr, "Error (reached EOF prematurely) while reading Snac plastic strain output file:  rank=%d: %d, %d, %d,  dump iteration=%d, node=%d/%d\n", 
-			    rank, rankI, rankJ, rankK,
-			    dumpIteration, node_gI, nodeLocalCount );
-		    exit(1);
-		} else {
-		    fprintf(stderr, "Error while reading Snac plastic strain output file:  rank=%d: %d, %d, %d,  dump iteration=%d, node=%d/%d\n", 
-			    rank, rankI, rankJ, rankK,
-			    dumpIteration, node_gI, nodeLocalCount );
-		    exit(1);
-		}
-	    }
-	    fprintf( vtkOut, "%g ", plStrain );
-	}
-	fprintf( vtkOut, "        </DataArray>\n");
-    }
-	
-    /*
-     * Write out the strain rate information 
-     */
-    fprintf( vtkOut, "        <DataArray type=\"Float64\" Name=\"Strain rate\" format=\"ascii\">\n");
-    if (fseek( strainRateIn, dumpIteration * elementLocalCount * sizeof(float), SEEK_SET )!=0) {
-	fprintf(stderr, "Cannot find read required portion of Snac strain rate output file:  rank=%d: %d, %d, %d,  dump iteration=%d, node count=%d\n", 
-		rank, rankI, rankJ, rankK,
-		dumpIteration, nodeLocalCount );
-	exit(1);
-    }
-    for( element_gI = 0; element_gI < elementLocalCount; element_gI++ ) {
-	float		strainRate;
-	if (fread( &strainRate, sizeof(float), 1, strainRateIn )==0)  {
-	    if (feof(strainRateIn)) {
-		fprintf(stderr, "Error (reached EOF prematurely) while reading Snac strain rate output file:  rank=%d: %d, %d, %d,  dump iteration=%d, node=%d/%d\n", 
-			rank, rankI, rankJ, rankK,
-			dumpIteration, node_gI, nodeLocalCount );
-		exit(1);
-	    } else {
-		fprintf(stderr, "Error while reading Snac strain rate output file:  rank=%d: %d, %d, %d,  dump iteration=%d, node=%d/%d\n", 
-			rank, rankI, rankJ, rankK,
-			dumpIteration, node_gI, nodeLocalCount );
-		exit(1);
-	    }
-	}
-	fprintf( vtkOut, "%g ", strainRate );
-    }
-    fprintf( vtkOut, "        </DataArray>\n");
-	
-    /*
-     * Write out the stress tensor 
-     */
-    fprintf( vtkOut, "        <DataArray type=\"Float64\" Name=\"Sxx\" format=\"ascii\">\n");
-    if (fseek( stressTensorIn, dumpIteration * elementLocalCount * sizeof(float) * numStressComponentsPerElement, SEEK_SET )!=0) {
-		fprintf(stderr, "Cannot find read required portion of Snac stress tensor output file:  rank=%d: %d, %d, %d,  dump iteration=%d, node count=%d\n", 
-				rank, rankI, rankJ, rankK,
-				dumpIteration, nodeLocalCount );
-		exit(1);
-    }
-	for( element_gI = 0; element_gI < elementLocalCount; element_gI++ ) {
-		double	        	elementStressTensor[3][3]={{0,0,0},{0,0,0},{0,0,0}};
-		struct stressMeasures	elementStressMeasures;
-		/*
-		 *  Build average stress tensor for element and derive useful stress measures
-		 */
-		DeriveStressMeasures(stressTensorIn, elementStressTensor, &elementStressMeasures);
-		/*
-		 *  Write the chosen derived stress value to Paraview file
-		 */
-		fprintf( vtkOut, "%g ", elementStressMeasures.stressComponents[0] );
-    }
-    fprintf( vtkOut, "        </DataArray>\n");
-    fprintf( vtkOut, "        <DataArray type=\"Float64\" Name=\"Syy\" format=\"ascii\">\n");
-    if (fseek( stressTensorIn, dumpIteration * elementLocalCount * sizeof(float) * numStressComponentsPerElement, SEEK_SET )!=0) {
-		fprintf(stderr, "Cannot find read required portion of Snac stress tensor output file:  rank=%d: %d, %d, %d,  dump iteration=%d, node count=%d\n", 
-				rank, rankI, rankJ, rankK,
-				dumpIteration, nodeLocalCount );
-		exit(1);
-    }
-	for( element_gI = 0; element_gI < elementLocalCount; element_gI++ ) {
-		double	        	elementStressTensor[3][3]={{0,0,0},{0,0,0},{0,0,0}};
-		struct stressMeasures	elementStressMeasures;
-		/*
-		 *  Build average stress tensor for element and derive useful stress measures
-		 */
-		DeriveStressMeasures(stressTensorIn, elementStressTensor, &elementStressMeasures);
-		/*
-		 *  Write the chosen derived stress value to Paraview file
-		 */
-		fprintf( vtkOut, "%g ", elementStressMeasures.stressComponents[1] );
-    }
-    fprintf( vtkOut, "        </DataArray>\n");
-    fprintf( vtkOut, "        <DataArray type=\"Float64\" Name=\"Szz\" format=\"ascii\">\n");
-    if (fseek( stressTensorIn, dumpIteration * elementLocalCount * sizeof(float) * numStressComponentsPerElement, SEEK_SET )!=0) {
-		fprintf(stderr, "Cannot find read required portion of Snac stress tensor output file:  rank=%d: %d, %d, %d,  dump iteration=%d, node count=%d\n", 
-				rank, rankI, rankJ, rankK,
-				dumpIteration, nodeLocalCount );
-		exit(1);
-    }
-	for( element_gI = 0; element_gI < elementLocalCount; element_gI++ ) {
-		double	        	elementStressTensor[3][3]={{0,0,0},{0,0,0},{0,0,0}};
-		struct stressMeasures	elementStressMeasures;
-		/*
-		 *  Build average stress tensor for element and derive useful stress measures
-		 */
-		DeriveStressMeasures(stressTensorIn, elementStressTensor, &elementStressMeasures);
-		/*
-		 *  Write the chosen derived stress value to Paraview file
-		 */
-		fprintf( vtkOut, "%g ", elementStressMeasures.stressComponents[2] );
-    }
-    fprintf( vtkOut, "        </DataArray>\n");
-    fprintf( vtkOut, "        <DataArray type=\"Float64\" Name=\"Sxy\" format=\"ascii\">\n");
-    if (fseek( stressTensorIn, dumpIteration * elementLocalCount * sizeof(float) * numStressComponentsPerElement, SEEK_SET )!=0) {
-		fprintf(stderr, "Cannot find read required portion of Snac stress tensor output file:  rank=%d: %d, %d, %d,  dump iteration=%d, node count=%d\n", 
-				rank, rankI, rankJ, rankK,
-				dumpIteration, nodeLocalCount );
-		exit(1);
-    }
-	for( element_gI = 0; element_gI < elementLocalCount; element_gI++ ) {
-		double	        	elementStressTensor[3][3]={{0,0,0},{0,0,0},{0,0,0}};
-		struct stressMeasures	elementStressMeasures;
-		/*
-		 *  Build average stress tensor for element and derive useful stress measures
-		 */
-		DeriveStressMeasures(stressTensorIn, elementStressTensor, &elementStressMeasures);
-		/*
-		 *  Write the chosen derived stress value to Paraview file
-		 */
-		fprintf( vtkOut, "%g ", elementStressMeasures.stressComponents[3] );
-    }
-    fprintf( vtkOut, "        </DataArray>\n");
-    fprintf( vtkOut, "        <DataArray type=\"Float64\" Name=\"Sxz\" format=\"ascii\">\n");
-    if (fseek( stressTensorIn, dumpIteration * elementLocalCount * sizeof(float) * numStressComponentsPerElement, SEEK_SET )!=0) {
-		fprintf(stderr, "Cannot find read required portion of Snac stress tensor output file:  rank=%d: %d, %d, %d,  dump iteration=%d, node count=%d\n", 
-				rank, rankI, rankJ, rankK,
-				dumpIteration, nodeLocalCount );
-		exit(1);
+	array = AddArray( piece.cellData, &piece.cellDataCount, "Plastic strain", ARRAY_FLOAT32, 1, elementLocalCount );
+	ReadDumpArray( apsIn, "plastic strain", rank, dumpIteration, sizeof(float), elementLocalCount, array->data );
     }
-	for( element_gI = 0; element_gI < elementLocalCount; element_gI++ ) {
-		double	        	elementStressTensor[3][3]={{0,0,0},{0,0,0},{0,0,0}};
-		struct stressMeasures	elementStressMeasures;
-		/*
-		 *  Build average stress tensor for element and derive useful stress measures
-		 */
-		DeriveStressMeasures(stressTensorIn, elementStressTensor, &elementStressMeasures);
-		/*
-		 *  Write the chosen derived stress value to Paraview file
-		 */
-		fprintf( vtkOut, "%g ", elementStressMeasures.stressComponents[4] );
-    }
-    fprintf( vtkOut, "        </DataArray>\n");
-    fprintf( vtkOut, "        <DataArray type=\"Float64\" Name=\"Syz\" format=\"ascii\">\n");
-    if (fseek( stressTensorIn, dumpIteration * elementLocalCount * sizeof(float) * numStressComponentsPerElement, SEEK_SET )!=0) {
-		fprintf(stderr, "Cannot find read required portion of Snac stress tensor output file:  rank=%d: %d, %d, %d,  dump iteration=%d, node count=%d\n", 
-				rank, rankI, rankJ, rankK,
-				dumpIteration, nodeLocalCount );
-		exit(1);
-    }
-	for( element_gI = 0; element_gI < elementLocalCount; element_gI++ ) {
-		double	        	elementStressTensor[3][3]={{0,0,0},{0,0,0},{0,0,0}};
-		struct stressMeasures	elementStressMeasures;
-		/*
-		 *  Build average stress tensor for element and derive useful stress measures
-		 */
-		DeriveStressMeasures(stressTensorIn, elementStressTensor, &elementStressMeasures);
-		/*
-		 *  Write the chosen derived stress value to Paraview file
-		 */
-		fprintf( vtkOut, "%g ", elementStressMeasures.stressComponents[5] );
-    }
-    fprintf( vtkOut, "        </DataArray>\n");
+    array = AddArray( piece.cellData, &piece.cellDataCount, "Strain rate", ARRAY_FLOAT32, 1, elementLocalCount );
+    ReadDumpArray( strainRateIn, "strain rate", rank, dumpIteration, sizeof(float), elementLocalCount, array->data );
 
     /*
-     * Write out the pressure information 
+     * The stress tensor is read once and every derived measure is computed in the same pass over the elements.
      */
-    fprintf( vtkOut, "        <DataArray type=\"Float64\" Name=\"Pressure\" format=\"ascii\">\n");
-    if (fseek( stressTensorIn, dumpIteration * elementLocalCount * sizeof(float) * numStressComponentsPerElement, SEEK_SET )!=0) {
-		fprintf(stderr, "Cannot find read required portion of Snac stress tensor output file:  rank=%d: %d, %d, %d,  dump iteration=%d, node count=%d\n", 
-				rank, rankI, rankJ, rankK,
-				dumpIteration, nodeLocalCount );
-		exit(1);
-    }
+    for( array_I = 0; array_I < 6; array_I++ )
+	stressArray[array_I] = AddArray( piece.cellData, &piece.cellDataCount, stressComponentName[array_I], ARRAY_FLOAT32, 1, 
+					 elementLocalCount );
+    pressureArray = AddArray( piece.cellData, &piece.cellDataCount, "Pressure", ARRAY_FLOAT64, 1, elementLocalCount );
+    stressTensorArray = (float*)malloc( elementLocalCount * numStressComponentsPerElement * sizeof(float) );
+    ReadDumpArray( stressTensorIn, "stress tensor", rank, dumpIteration, sizeof(float) * numStressComponentsPerElement, 
+		   elementLocalCount, stressTensorArray );
     for( element_gI = 0; element_gI < elementLocalCount; element_gI++ ) {
 		double	        	elementStressTensor[3][3]={{0,0,0},{0,0,0},{0,0,0}};
 		struct stressMeasures	elementStressMeasures;
 		/*
 		 *  Build average stress tensor for element and derive useful stress measures
 		 */
-		DeriveStressMeasures(stressTensorIn, elementStressTensor, &elementStressMeasures);
-		/*
-		 *  Write the chosen derived stress value to Paraview file
-		 */
-		fprintf( vtkOut, "%g ", -elementStressMeasures.pressure );
+		elementStressMeasures.failureAngle=(failureAngle<0.0 ? 0.0 : failureAngle);
+		DeriveStressMeasures( &stressTensorArray[element_gI * numStressComponentsPerElement], elementStressTensor, 
+				      &elementStressMeasures );
+		for( array_I = 0; array_I < 6; array_I++ )
+			((float*)stressArray[array_I]->data)[element_gI] = (float)elementStressMeasures.stressComponents[array_I];
+		((double*)pressureArray->data)[element_gI] = -elementStressMeasures.pressure;
 #ifdef DEBUG
 		if (element_gI<10) fprintf( stderr, "Element pressure %d: %g  at angle %g\n", element_gI, elementStressMeasures.pressure, elementStressMeasures.failureAngle); 
 #endif	
     }
-    fprintf( vtkOut, "        </DataArray>\n");
+    free( stressTensorArray );
 
-#if 0
-    /*
-     * Write out the pressure information 
-     */
-    if( doHPr ) {
-	fprintf( vtkOut, "        <DataArray type=\"Float64\" Name=\"Hydrostatic pressure\" format=\"ascii\">\n");
-	if (fseek( hydroPressureIn, dumpIteration * elementLocalCount * sizeof(float), SEEK_SET )!=0) {
-	    fprintf(stderr, "Cannot find read required portion of Snac pressure output file:  rank=%d: %d, %d, %d,  dump iteration=%d, node count=%d\n", 
-		    rank, rankI, rankJ, rankK,
-		    dumpIteration, nodeLocalCount );
-	    exit(1);
-	}
-	for( element_gI = 0; element_gI < elementLocalCount; element_gI++ ) {
-	    float		hydroPressure;
-	    if (fread( &hydroPressure, sizeof(float), 1, hydroPressureIn )==0)  {
-		if (feof(hydroPressureIn)) {
-		    fprintf(stderr, "Error (reached EOF prematurely) while reading Snac pressure output file:  rank=%d: %d, %d, %d,  dump iteration=%d, node=%d/%d\n", 
-			    rank, rankI, rankJ, rankK,
-			    dumpIteration, node_gI, nodeLocalCount );
-		    exit(1);
-		} else {
-		    fprintf(stderr, "Error while reading Snac pressure output file:  rank=%d: %d, %d, %d,  dump iteration=%d, node=%d/%d\n", 
-			    rank, rankI, rankJ, rankK,
-			    dumpIteration, node_gI, nodeLocalCount );
-		    exit(1);
-		}
-	    }
-	    fprintf( vtkOut, "%g ", hydroPressure );
-	}
-	fprintf( vtkOut, "        </DataArray>\n");
+    array = AddArray( piece.cellData, &piece.cellDataCount, "Phase", ARRAY_UINT32, 1, elementLocalCount );
+    ReadDumpArray( phaseIn, "phase index", rank, dumpIteration, sizeof(unsigned int), elementLocalCount, array->data );
+    if( doVisc ) {
+	array = AddArray( piece.cellData, &piece.cellDataCount, "Viscosity", ARRAY_FLOAT32, 1, elementLocalCount );
+	ReadDumpArray( viscIn, "viscosity", rank, dumpIteration, sizeof(float), elementLocalCount, array->data );
     }
 
-    /*
-     * Write out the stress information 
+    /* 
+     *
+     *  			Read the coordinates
+     *
      */
-    fprintf( vtkOut, "        <DataArray type=\"Float64\" Name=\"Tetra shear stress\" format=\"ascii\">\n");
-    if (fseek( stressIn, dumpIteration * elementLocalCount * sizeof(float), SEEK_SET )!=0) {
-	fprintf(stderr, "Cannot find read required portion of Snac shear stress output file:  rank=%d: %d, %d, %d,  dump iteration=%d, node count=%d\n", 
-		rank, rankI, rankJ, rankK,
-		dumpIteration, nodeLocalCount );
-	exit(1);
-    }
-    for( element_gI = 0; element_gI < elementLocalCount; element_gI++ ) {
-	float		stress;
-	if (fread( &stress, sizeof(float), 1, stressIn )==0)  {
-	    if (feof(stressIn)) {
-		fprintf(stderr, "Error (reached EOF prematurely) while reading Snac shear stress output file:  rank=%d: %d, %d, %d,  dump iteration=%d, node=%d/%d\n", 
-			rank, rankI, rankJ, rankK,
-			dumpIteration, node_gI, nodeLocalCount );
- 			exit(1); 
-	    } else {
-		fprintf(stderr, "Error while reading Snac shear stress output file:  rank=%d: %d, %d, %d,  dump iteration=%d, node=%d/%d\n", 
-			rank, rankI, rankJ, rankK,
-			dumpIteration, node_gI, nodeLocalCount );
-		exit(1);
-	    }
-	}
-	fprintf( vtkOut, "%g ", stress );
-    }
-    fprintf( vtkOut, "        </DataArray>\n");
-
+    strcpy( piece.points.name, "coordinates" );
+    piece.points.type = ARRAY_FLOAT32;
+    piece.points.componentCount = 3;
+    piece.points.tupleCount = nodeLocalCount;
+    piece.points.data = malloc( nodeLocalCount * 3 * sizeof(float) );
+    ReadDumpArray( coordIn, "coordinates", rank, dumpIteration, sizeof(float) * 3, nodeLocalCount, piece.points.data );
 
     /*
-     * Write out the maxShearStress information 
+     * Encode the appended payloads up front, as their sizes determine the offsets written into the headers.
      */
-    fprintf( vtkOut, "        <DataArray type=\"Float64\" Name=\"Max. shear stress\" format=\"ascii\">\n");
-    if (fseek( stressTensorIn, dumpIteration * elementLocalCount * sizeof(float)*numStressComponentsPerElement, SEEK_SET )!=0) {
-	fprintf(stderr, "Cannot find read required portion of Snac stress tensor output file:  rank=%d: %d, %d, %d,  dump iteration=%d, node count=%d\n", 
-		rank, rankI, rankJ, rankK,
-		dumpIteration, nodeLocalCount );
-	exit(1);
-    }
-    for( element_gI = 0; element_gI < elementLocalCount; element_gI++ ) {
-		double	        	elementStressTensor[3][3]={{0,0,0},{0,0,0},{0,0,0}};
-	struct stressMeasures	elementStressMeasures;
-	/*
-	 *  Build average stress tensor for element and derive useful stress measures
-	 */
-	DeriveStressMeasures(stressTensorIn, 
-			     elementStressTensor,  &elementStressMeasures);
-	/*
-	 *  Write the chosen derived stress value to Paraview file
-	 */
-	fprintf( vtkOut, "%g ", elementStressMeasures.maxShearStress ); 
-#ifdef DEBUG
-	if (element_gI<10) fprintf( stderr, "Element max shear stress %d: %g\n", element_gI, elementStressMeasures.maxShearStress ); 
-#endif	
+    if( outputFormat != OUTPUT_ASCII ) {
+	for( array_I = 0; array_I < piece.pointDataCount; array_I++ )
+	    EncodeArray( &piece.pointData[array_I] );
+	for( array_I = 0; array_I < piece.cellDataCount; array_I++ )
+	    EncodeArray( &piece.cellData[array_I] );
+	EncodeArray( &piece.points );
     }
-    fprintf( vtkOut, "        </DataArray>\n");
 
     /*
-     * Write out the vonMisesStress information 
+     * Open the output file 
      */
-    fprintf( vtkOut, "        <DataArray type=\"Float64\" Name=\"Von Mises stress\" format=\"ascii\">\n");
-    if (fseek( stressTensorIn, dumpIteration * elementLocalCount * sizeof(float)*numStressComponentsPerElement, SEEK_SET )!=0) {
-	fprintf(stderr, "Cannot find read required portion of Snac stress tensor output file:  rank=%d: %d, %d, %d,  dump iteration=%d, node count=%d\n", 
-		rank, rankI, rankJ, rankK,
-		dumpIteration, nodeLocalCount );
+    sprintf( tmpBuf, "%s/snac.%i.%06u.vts", path, rank, simTimeStep );
+    if( (vtkOut = fopen( tmpBuf, "w+" )) == NULL ) {
+	fprintf(stderr, "Cannot open \"%s\" for writing\n", tmpBuf );
 	exit(1);
     }
-    for( element_gI = 0; element_gI < elementLocalCount; element_gI++ ) {
-		double	        	elementStressTensor[3][3]={{0,0,0},{0,0,0},{0,0,0}};
-	struct stressMeasures	elementStressMeasures;
-	/*
-	 *  Build average stress tensor for element and derive useful stress measures
-	 */
-	DeriveStressMeasures(stressTensorIn, elementStressTensor, &elementStressMeasures);
-	/*
-	 *  Write the chosen derived stress value to Paraview file
-	 */
-	fprintf( vtkOut, "%g ", elementStressMeasures.vonMisesStress ); 
-#ifdef DEBUG
-	if (element_gI<10) fprintf( stderr, "Element von Mises stress %d: %g\n", element_gI, elementStressMeasures.vonMisesStress ); 
-#endif	
-    }
-    fprintf( vtkOut, "        </DataArray>\n");
-
+	
     /*
-     * Write out the slopeShearStress information 
+     * Write out simulation information 
      */
-    fprintf( vtkOut, "        <DataArray type=\"Float64\" Name=\"Shear stress @%gd\" format=\"ascii\">\n",failureAngle);
-    if (fseek( stressTensorIn, dumpIteration * elementLocalCount * sizeof(float)*numStressComponentsPerElement, SEEK_SET )!=0) {
-	fprintf(stderr, "Cannot find read required portion of Snac stress tensor output file:  rank=%d: %d, %d, %d,  dump iteration=%d, node count=%d\n", 
-		rank, rankI, rankJ, rankK,
-		dumpIteration, nodeLocalCount );
-	exit(1);
-    }
-    for( element_gI = 0; element_gI < elementLocalCount; element_gI++ ) {
-		double	        	elementStressTensor[3][3]={{0,0,0},{0,0,0},{0,0,0}};
-	struct stressMeasures	elementStressMeasures;
-	/*
-	 *  Build average stress tensor for element and derive useful stress measures
-	 */
-	elementStressMeasures.failureAngle=(failureAngle<0.0 ? 0.0 : failureAngle);
-	DeriveStressMeasures(stressTensorIn, elementStressTensor, &elementStressMeasures);
-	/*
-	 *  Write the chosen derived stress value to Paraview file
-	 */
-	fprintf( vtkOut, "%g ", elementStressMeasures.slopeShearStress );
-#ifdef DEBUG
-	if (element_gI<10) fprintf( stderr, "Element slope shear stress %d: %g  at angle %g\n", element_gI, elementStressMeasures.slopeShearStress, elementStressMeasures.failureAngle); 
-#endif	
-    }
-    fprintf( vtkOut, "        </DataArray>\n");
+    fprintf( vtkOut, "<?xml version=\"1.0\"?>\n" );
+    if( outputFormat == OUTPUT_ASCII )
+	fprintf( vtkOut, "<VTKFile type=\"StructuredGrid\"  version=\"0.1\" byte_order=\"%s\" compressor=\"vtkZLibDataCompressor\">\n", 
+		 ByteOrderName() );
+    else if( outputFormat == OUTPUT_RAW )
+	fprintf( vtkOut, "<VTKFile type=\"StructuredGrid\"  version=\"1.0\" byte_order=\"%s\" header_type=\"UInt64\">\n", 
+		 ByteOrderName() );
+    else
+	fprintf( vtkOut, "<VTKFile type=\"StructuredGrid\"  version=\"1.0\" byte_order=\"%s\" header_type=\"UInt64\" compressor=\"vtkZLibDataCompressor\">\n", 
+		 ByteOrderName() );
+    fprintf( vtkOut, "  <StructuredGrid WholeExtent=\"%d %d %d %d %d %d\">\n",
+	     rankI*elementLocalSize[0],(rankI+1)*elementLocalSize[0],
+	     rankJ*elementLocalSize[1],(rankJ+1)*elementLocalSize[1],
+	     rankK*elementLocalSize[2],(rankK+1)*elementLocalSize[2]);
+    fprintf( vtkOut, "    <Piece Extent=\"%d %d %d %d %d %d\">\n",
+	     rankI*elementLocalSize[0],(rankI+1)*elementLocalSize[0],
+	     rankJ*elementLocalSize[1],(rankJ+1)*elementLocalSize[1],
+	     rankK*elementLocalSize[2],(rankK+1)*elementLocalSize[2]);
+	
+    offset = 0;
+    fprintf( vtkOut, "      <PointData Vectors=\"velocity\">\n");
+    for( array_I = 0; array_I < piece.pointDataCount; array_I++ )
+	WriteDataArray( vtkOut, &piece.pointData[array_I], &offset );
+    fprintf( vtkOut, "      </PointData>\n");
+
+    fprintf( vtkOut, "      <CellData Scalars=\"Plastic strain\">\n");
+    for( array_I = 0; array_I < piece.cellDataCount; array_I++ )
+	WriteDataArray( vtkOut, &piece.cellData[array_I], &offset );
+    fprintf( vtkOut, "      </CellData>\n");
+
+    fprintf( vtkOut, "      <Points>\n");
+    WriteDataArray( vtkOut, &piece.points, &offset );
+    fprintf( vtkOut, "      </Points>\n");
+    fprintf( vtkOut, "    </Piece>\n");
+    fprintf( vtkOut, "  </StructuredGrid>\n");
+    if( outputFormat != OUTPUT_ASCII )
+	WriteAppendedData( vtkOut, &piece );
+    fprintf( vtkOut, "</VTKFile>\n");
 
     /*
-     * Write out the slopeNormalStress information 
+     * Close the vtk output file 
      */
-    fprintf( vtkOut, "        <DataArray type=\"Float64\" Name=\"Normal stress @%gd\" format=\"ascii\">\n", failureAngle);
-    if (fseek( stressTensorIn, dumpIteration * elementLocalCount * sizeof(float)*numStressComponentsPerElement, SEEK_SET )!=0) {
-	fprintf(stderr, "Cannot find read required portion of Snac stress tensor output file:  rank=%d: %d, %d, %d,  dump iteration=%d, node count=%d\n", 
-		rank, rankI, rankJ, rankK,
-		dumpIteration, nodeLocalCount );
-	exit(1);
-    }
-    for( element_gI = 0; element_gI < elementLocalCount; element_gI++ ) {
-		double	        	elementStressTensor[3][3]={{0,0,0},{0,0,0},{0,0,0}};
-	struct stressMeasures	elementStressMeasures;
-	/*
-	 *  Build average stress tensor for element and derive useful stress measures
-	 */
-	elementStressMeasures.failureAngle=(failureAngle<0.0 ? 0.0 : failureAngle);
-	DeriveStressMeasures(stressTensorIn, elementStressTensor, &elementStressMeasures);
-	/*
-	 *  Write the chosen derived stress value to Paraview file
-	 */
-	fprintf( vtkOut, "%g ", elementStressMeasures.slopeNormalStress );
-#ifdef DEBUG
-	if (element_gI<10) fprintf( stderr, "Element slope normal stress %d: %g  at angle %g\n", element_gI, elementStressMeasures.slopeNormalStress, elementStressMeasures.failureAngle); 
-#endif	
-    }
-    fprintf( vtkOut, "        </DataArray>\n");
-
-    /* Write out the failurePotential information */
-    fprintf( vtkOut, "        <DataArray type=\"Float64\" Name=\"Failure potential\" format=\"ascii\">\n");
-    if (fseek( stressTensorIn, dumpIteration * elementLocalCount * sizeof(float)*numStressComponentsPerElement, SEEK_SET )!=0) {
-	fprintf(stderr, "Cannot find read required portion of Snac stress tensor output file:  rank=%d: %d, %d, %d,  dump iteration=%d, node count=%d\n", 
-		rank, rankI, rankJ, rankK,
-		dumpIteration, nodeLocalCount );
-	exit(1);
-    }
-    for( element_gI = 0; element_gI < elementLocalCount; element_gI++ ) {
-		double	        	elementStressTensor[3][3]={{0,0,0},{0,0,0},{0,0,0}};
-	struct stressMeasures	elementStressMeasures;
-	/*
-	 *  Build average stress tensor for element and derive useful stress measures
-	 */
-	elementStressMeasures.failureAngle=(failureAngle<0.0 ? 0.0 : failureAngle);
-	DeriveStressMeasures(stressTensorIn, elementStressTensor, &elementStressMeasures);
-	/*
-	 *  Write the chosen derived stress value to Paraview file
-	 */
-	fprintf( vtkOut, "%g ", elementStressMeasures.failurePotential );
-#ifdef DEBUG
-	if (element_gI<10) fprintf( stderr, "Element failure potential %d: %g  at angle %g\n", element_gI, elementStressMeasures.failurePotential, elementStressMeasures.failureAngle); 
-#endif	
-    }
-    fprintf( vtkOut, "        </DataArray>\n");
-#endif
+    fclose( vtkOut );
 
+    /*
+     * Write out Parallel VTS file. Only once when rank == 0. 
+     */
+    if( rank == 0 )
+	WriteParallelFile( &piece, simTimeStep, gnode, rank_array );
 
+    FreePiece( &piece );
+}
 
 
-    /*
-     * Write out the phase information 
-     */
-    fprintf( vtkOut, "        <DataArray type=\"Float64\" Name=\"Phase\" format=\"ascii\">\n");
-    if (fseek( phaseIn, dumpIteration * elementLocalCount * sizeof(unsigned int), SEEK_SET )!=0) {
-	fprintf(stderr, "Cannot find read required portion of Snac phase index output file:  rank=%d: %d, %d, %d,  dump iteration=%d, node count=%d\n", 
-		rank, rankI, rankJ, rankK,
-		dumpIteration, nodeLocalCount );
-	exit(1);
-    }
-    for( element_gI = 0; element_gI < elementLocalCount; element_gI++ ) {
-	unsigned int		phaseIndex;
-	if (fread( &phaseIndex, sizeof(unsigned int), 1, phaseIn )==0)  {
-	    if (feof(phaseIn)) {
-		fprintf(stderr, "Error (reached EOF prematurely) while reading Snac phase index output file:  rank=%d: %d, %d, %d,  dump iteration=%d, node=%d/%d\n", 
-			rank, rankI, rankJ, rankK,
-			dumpIteration, node_gI, nodeLocalCount );
-		exit(1);
-	    } else {
-		fprintf(stderr, "Error while reading Snac phase index output file:  rank=%d: %d, %d, %d,  dump iteration=%d, node=%d/%d\n", 
-			rank, rankI, rankJ, rankK,
-			dumpIteration, node_gI, nodeLocalCount );
+VtkArray* AddArray( VtkArray* arrays, unsigned int* arrayCount, const char* name, ArrayType type, unsigned int componentCount, 
+		    unsigned int tupleCount ) 
+{
+	VtkArray*	array;
+
+	assert( *arrayCount < MAX_VTK_ARRAYS );
+	array = &arrays[(*arrayCount)++];
+	strncpy( array->name, name, sizeof(array->name) - 1 );
+	array->type = type;
+	array->componentCount = componentCount;
+	array->tupleCount = tupleCount;
+	array->data = malloc( (size_t)componentCount * tupleCount * ArrayTypeSize( type ) );
+	array->encoded = NULL;
+	array->encodedSize = 0;
+	if( !array->data ) {
+		fprintf(stderr, "Cannot allocate memory for the \"%s\" array\n", name );
 		exit(1);
-	    }
 	}
-	fprintf( vtkOut, "%u ", phaseIndex );
-    }
-    fprintf( vtkOut, "        </DataArray>\n");
+	return array;
+}
 
 
-    /*
-     * Write out the viscosity information 
-     */
-    if( doVisc ) {
-	fprintf( vtkOut, "        <DataArray type=\"Float64\" Name=\"Viscosity\" format=\"ascii\">\n");
-	if (fseek( viscIn, dumpIteration * elementLocalCount * sizeof(float), SEEK_SET )!=0) {
-	    fprintf(stderr, "Cannot find read required portion of Snac viscosity output file:  rank=%d: %d, %d, %d,  dump iteration=%d, node count=%d\n", 
-		    rank, rankI, rankJ, rankK,
-		    dumpIteration, nodeLocalCount );
-	    exit(1);
+void FreePiece( VtkPiece* piece ) {
+	unsigned int	array_I;
+
+	for( array_I = 0; array_I < piece->pointDataCount; array_I++ ) {
+		free( piece->pointData[array_I].data );
+		free( piece->pointData[array_I].encoded );
 	}
-	for( element_gI = 0; element_gI < elementLocalCount; element_gI++ ) {
-	    float		viscosity;
-	    if (fread( &viscosity, sizeof(float), 1, viscIn )==0)  {
-		if (feof(viscIn)) {
-		    fprintf(stderr, "Error (reached EOF prematurely) while reading Snac viscosity output file:  rank=%d: %d, %d, %d,  dump iteration=%d, node=%d/%d\n", 
-			    rank, rankI, rankJ, rankK,
-			    dumpIteration, node_gI, nodeLocalCount );
-		    exit(1);
-		} else {
-		    fprintf(stderr, "Error while reading Snac viscosity output file:  rank=%d: %d, %d, %d,  dump iteration=%d, node=%d/%d\n", 
-			    rank, rankI, rankJ, rankK,
-			    dumpIteration, node_gI, nodeLocalCount );
-		    exit(1);
-		}
-	    }
-	    fprintf( vtkOut, "%g ", viscosity );
+	for( array_I = 0; array_I < piece->cellDataCount; array_I++ ) {
+		free( piece->cellData[array_I].data );
+		free( piece->cellData[array_I].encoded );
 	}
-	fprintf( vtkOut, "        </DataArray>\n");
-    }
-    fprintf( vtkOut, "      </CellData>\n");
-	
+	free( piece->points.data );
+	free( piece->points.encoded );
+}
 
 
+const char* ArrayTypeName( ArrayType type ) {
+	switch( type ) {
+		case ARRAY_FLOAT32:
+			return "Float32";
+		case ARRAY_FLOAT64:
+			return "Float64";
+		default:
+			return "UInt32";
+	}
+}
 
-    /* 
-     *
-     *  			Write out coordinates
-     *
-     */
-    fprintf( vtkOut, "      <Points>\n");
-    fprintf( vtkOut, "        <DataArray type=\"Float64\" NumberOfComponents=\"3\" format=\"ascii\">\n");
-    if (fseek( coordIn, dumpIteration * nodeLocalCount * sizeof(float) * 3, SEEK_SET )!=0) {
-	fprintf(stderr, "Cannot find read required portion of Snac coordinates output file:  rank=%d: %d, %d, %d,  dump iteration=%d, node count=%d\n", 
-		rank, rankI, rankJ, rankK,
-		dumpIteration, nodeLocalCount );
-	exit(1);
-    }
-    for( node_gI = 0; node_gI < nodeLocalCount; node_gI++ ) {
-	float		coord[3];
-	if (fread( &coord, sizeof(float), 3, coordIn )==0)  {
-	    if (feof(coordIn)) {
-		fprintf(stderr, "Error (reached EOF prematurely) while reading Snac coordinates output file:  rank=%d: %d, %d, %d,  dump iteration=%d, node=%d/%d\n", 
-			rank, rankI, rankJ, rankK,
-			dumpIteration, node_gI, nodeLocalCount );
-		exit(1);
-	    } else {
-		fprintf(stderr, "Error while reading Snac coordinates output file:  rank=%d: %d, %d, %d,  dump iteration=%d, node=%d/%d\n", 
-			rank, rankI, rankJ, rankK,
-			dumpIteration, node_gI, nodeLocalCount );
-		exit(1);
-	    }
-	}	 
-	fprintf( vtkOut, "%g %g %g\n", coord[0], coord[1], coord[2] );
-    }
-    fprintf( vtkOut, "        </DataArray>\n");
-    fprintf( vtkOut, "      </Points>\n");
-    fprintf( vtkOut, "    </Piece>\n");
-    fprintf( vtkOut, "  </StructuredGrid>\n");
-    fprintf( vtkOut, "</VTKFile>\n");
 
+size_t ArrayTypeSize( ArrayType type ) {
+	return type == ARRAY_FLOAT64 ? sizeof(double) : 4;
+}
 
 
-    /*
-     * Close the vtk output file 
-     */
-    fclose( vtkOut );
+/* The dumps are read and the binary payloads written in the native byte order, so label the files with it. */
+const char* ByteOrderName( void ) {
+	const uint16_t	probe = 1;
 
+	return *(const unsigned char*)&probe ? "LittleEndian" : "BigEndian";
+}
 
 
+/*
+ * Build the appended payload of an array. For raw data this is a UInt64 byte count followed by the values. For zlib it
+ * is the vtkZLibDataCompressor layout: a UInt64 header of block count, block size, last block size and the compressed size
+ * of every block, followed by the independently compressed blocks.
+ */
+void EncodeArray( VtkArray* array ) {
+	const size_t	byteCount = (size_t)array->componentCount * array->tupleCount * ArrayTypeSize( array->type );
 
+	if( outputFormat == OUTPUT_RAW ) {
+		uint64_t	header = byteCount;
 
+		array->encodedSize = sizeof(uint64_t) + byteCount;
+		array->encoded = (unsigned char*)malloc( array->encodedSize );
+		memcpy( array->encoded, &header, sizeof(uint64_t) );
+		memcpy( array->encoded + sizeof(uint64_t), array->data, byteCount );
+	}
+#ifdef HAVE_ZLIB
+	else {
+		const size_t	blockCount = (byteCount + VTK_ZLIB_BLOCK_SIZE - 1) / VTK_ZLIB_BLOCK_SIZE;
+		const size_t	headerSize = (3 + blockCount) * sizeof(uint64_t);
+		uint64_t*	header;
+		unsigned char*	compressed;
+		size_t		block_I;
+
+		array->encoded = (unsigned char*)malloc( headerSize + blockCount * compressBound( VTK_ZLIB_BLOCK_SIZE ) );
+		header = (uint64_t*)malloc( headerSize );
+		header[0] = blockCount;
+		header[1] = VTK_ZLIB_BLOCK_SIZE;
+		header[2] = byteCount % VTK_ZLIB_BLOCK_SIZE;
+		compressed = array->encoded + headerSize;
+		for( block_I = 0; block_I < blockCount; block_I++ ) {
+			const size_t	blockSize = ( block_I == blockCount - 1 && header[2] ) ? header[2] : VTK_ZLIB_BLOCK_SIZE;
+			uLongf		compressedSize = compressBound( blockSize );
+
+			if( compress2( compressed, &compressedSize, (const Bytef*)array->data + block_I * VTK_ZLIB_BLOCK_SIZE, blockSize, 
+				       Z_DEFAULT_COMPRESSION ) != Z_OK ) 
+			{
+				fprintf(stderr, "zlib failed to compress the \"%s\" array\n", array->name );
+				exit(1);
+			}
+			header[3 + block_I] = compressedSize;
+			compressed += compressedSize;
+		}
+		memcpy( array->encoded, header, headerSize );
+		array->encodedSize = compressed - array->encoded;
+		free( header );
+	}
+#endif
+}
 
 
+/*
+ * Write the DataArray element of an array. Ascii arrays are written inline, exactly as older versions of snac2vtk did; 
+ * appended arrays only record where their payload starts in the appended section.
+ */
+void WriteDataArray( FILE* vtkOut, VtkArray* array, size_t* offset ) {
+	char		nameAttribute[80] = "";
+	unsigned int	value_I;
+	unsigned int	valueCount = array->componentCount * array->tupleCount;
+
+	if( strcmp( array->name, "coordinates" ) )
+		sprintf( nameAttribute, " Name=\"%s\"", array->name );
+
+	if( outputFormat != OUTPUT_ASCII ) {
+		if( array->componentCount > 1 )
+			fprintf( vtkOut, "        <DataArray type=\"%s\"%s NumberOfComponents=\"%u\" format=\"appended\" offset=\"%lu\"/>\n", 
+				 ArrayTypeName( array->type ), nameAttribute, array->componentCount, (unsigned long)*offset );
+		else
+			fprintf( vtkOut, "        <DataArray type=\"%s\"%s format=\"appended\" offset=\"%lu\"/>\n", 
+				 ArrayTypeName( array->type ), nameAttribute, (unsigned long)*offset );
+		*offset += array->encodedSize;
+		return;
+	}
 
-    /*
-     * Write out Parallel VTS file. Only once when rank == 0. 
-     */
-    if( rank == 0 ) {
-	int rankII, rankJJ, rankKK, rank2;
+	if( array->componentCount > 1 ) {
+		fprintf( vtkOut, "        <DataArray type=\"Float64\"%s NumberOfComponents=\"%u\" format=\"ascii\">\n", 
+			 nameAttribute, array->componentCount );
+		for( value_I = 0; value_I < valueCount; value_I += 3 ) {
+			const float*	tuple = &((const float*)array->data)[value_I];
+			fprintf( vtkOut, "%g %g %g\n", tuple[0], tuple[1], tuple[2] );
+		}
+	}
+	else {
+		fprintf( vtkOut, "        <DataArray type=\"Float64\"%s format=\"ascii\">\n", nameAttribute );
+		for( value_I = 0; value_I < valueCount; value_I++ ) {
+			switch( array->type ) {
+				case ARRAY_FLOAT32:
+					fprintf( vtkOut, "%g ", ((const float*)array->data)[value_I] );
+					break;
+				case ARRAY_FLOAT64:
+					fprintf( vtkOut, "%g ", ((const double*)array->data)[value_I] );
+					break;
+				default:
+					fprintf( vtkOut, "%u ", ((const unsigned int*)array->data)[value_I] );
+					break;
+			}
+		}
+	}
+    fprintf( vtkOut, "        </DataArray>\n");
+}
+
+
+void WriteAppendedData( FILE* vtkOut, VtkPiece* piece ) {
+	unsigned int	array_I;
+
+	fprintf( vtkOut, "  <AppendedData encoding=\"raw\">\n   _" );
+	for( array_I = 0; array_I < piece->pointDataCount; array_I++ )
+		fwrite( piece->pointData[array_I].encoded, 1, piece->pointData[array_I].encodedSize, vtkOut );
+	for( array_I = 0; array_I < piece->cellDataCount; array_I++ )
+		fwrite( piece->cellData[array_I].encoded, 1, piece->cellData[array_I].encodedSize, vtkOut );
+	fwrite( piece->points.encoded, 1, piece->points.encodedSize, vtkOut );
+	fprintf( vtkOut, "\n  </AppendedData>\n" );
+}
+
+
+/*
+ * Write the .pvts index of a time step. The array list is taken from rank 0's piece so that it always matches the pieces.
+ */
+void WriteParallelFile( VtkPiece* piece, unsigned int simTimeStep, int gnode[3], int rank_array[3] ) {
+	char		tmpBuf1[PATH_MAX];
+	FILE*		vtkOut1;
+	int		rankII, rankJJ, rankKK, rank2;
+	unsigned int	array_I;
 
 	sprintf( tmpBuf1, "%s/snac.%06u.pvts", path, simTimeStep );
 	if( (vtkOut1 = fopen( tmpBuf1, "w" )) == NULL ) {
-	    fprintf(stderr, "Cannot open \"%s\" for writing\n", tmpBuf );
+	    fprintf(stderr, "Cannot open \"%s\" for writing\n", tmpBuf1 );
 	    exit(1);
 	}
 	fprintf(stderr,"Writing file %s...\n",tmpBuf1);
 
 	fprintf( vtkOut1, "<?xml version=\"1.0\"?>\n" );
-	fprintf( vtkOut1, "<VTKFile type= \"PStructuredGrid\"  version= \"0.1\" byte_order=\"LittleEndian\" compressor=\"vtkZLibDataCompressor\">\n");
+	fprintf( vtkOut1, "<VTKFile type= \"PStructuredGrid\"  version= \"0.1\" byte_order=\"%s\" compressor=\"vtkZLibDataCompressor\">\n",
+		 ByteOrderName() );
 	fprintf( vtkOut1, "  <PStructuredGrid WholeExtent=\"0 %d 0 %d 0 %d\" GhostLevel=\"0\">\n",gnode[0]-1,gnode[1]-1,gnode[2]-1);
 
 	/*
 	 * Start the node section 
 	 */
 	fprintf( vtkOut1, "    <PPointData>\n");
-	fprintf( vtkOut1, "        <PDataArray type=\"Float64\" Name=\"Velocity\" NumberOfComponents=\"3\"/>\n");
-	if( doForce )
-	    fprintf( vtkOut1, "        <PDataArray type=\"Float64\" Name=\"Force\" NumberOfComponents=\"3\"/>\n");
-	if( doTemp )
-	    fprintf( vtkOut1, "        <PDataArray type=\"Float64\" Name=\"Temperature\"/>\n");
+	for( array_I = 0; array_I < piece->pointDataCount; array_I++ ) {
+		VtkArray*	array = &piece->pointData[array_I];
+		if( array->componentCount > 1 )
+			fprintf( vtkOut1, "        <PDataArray type=\"%s\" Name=\"%s\" NumberOfComponents=\"%u\"/>\n", 
+				 outputFormat == OUTPUT_ASCII ? "Float64" : ArrayTypeName( array->type ), array->name, array->componentCount );
+		else
+			fprintf( vtkOut1, "        <PDataArray type=\"%s\" Name=\"%s\"/>\n", 
+				 outputFormat == OUTPUT_ASCII ? "Float64" : ArrayTypeName( array->type ), array->name );
+	}
 	fprintf( vtkOut1, "    </PPointData>\n");
 
 	/*
 	 * Start the element section 
 	 */
 	fprintf( vtkOut1, "    <PCellData>\n");
-	if( doAps )
-	    fprintf( vtkOut1, "        <PDataArray type=\"Float64\" Name=\"Plastic strain\"/>\n");
-	fprintf( vtkOut1, "        <PDataArray type=\"Float64\" Name=\"Strain rate\"/>\n");
-	fprintf( vtkOut1, "        <PDataArray type=\"Float64\" Name=\"Sxx\"/>\n");
-	fprintf( vtkOut1, "        <PDataArray type=\"Float64\" Name=\"Syy\"/>\n");
-	fprintf( vtkOut1, "        <PDataArray type=\"Float64\" Name=\"Szz\"/>\n");
-	fprintf( vtkOut1, "        <PDataArray type=\"Float64\" Name=\"Sxy\"/>\n");
-	fprintf( vtkOut1, "        <PDataArray type=\"Float64\" Name=\"Sxz\"/>\n");
-	fprintf( vtkOut1, "        <PDataArray type=\"Float64\" Name=\"Syz\"/>\n");
-	fprintf( vtkOut1, "        <PDataArray type=\"Float64\" Name=\"Pressure\"/>\n");
-#if 0
-	if( doHPr )
-	    fprintf( vtkOut1, "        <PDataArray type=\"Float64\" Name=\"Hydrostatic pressure\"/>\n");
-	fprintf( vtkOut1, "        <PDataArray type=\"Float64\" Name=\"Tetra shear stress\"/>\n");
-	fprintf( vtkOut1, "        <PDataArray type=\"Float64\" Name=\"Max. shear stress\"/>\n");
-	fprintf( vtkOut1, "        <PDataArray type=\"Float64\" Name=\"Von Mises stress\"/>\n");
-	fprintf( vtkOut1, "        <PDataArray type=\"Float64\" Name=\"Shear stress @%gd\"/>\n",failureAngle);
-	fprintf( vtkOut1, "        <PDataArray type=\"Float64\" Name=\"Normal stress @%gd\"/>\n",failureAngle);
-	fprintf( vtkOut1, "        <PDataArray type=\"Float64\" Name=\"Failure potential @%gd\"/>\n",failureAngle);
-#endif
-	fprintf( vtkOut1, "        <PDataArray type=\"Float64\" Name=\"Phase\"/>\n");
-
-	if( doVisc )
-	    fprintf( vtkOut1, "        <PDataArray type=\"Float64\" Name=\"Viscosity\"/>\n");
+	for( array_I = 0; array_I < piece->cellDataCount; array_I++ ) {
+		VtkArray*	array = &piece->cellData[array_I];
+		fprintf( vtkOut1, "        <PDataArray type=\"%s\" Name=\"%s\"/>\n", 
+			 outputFormat == OUTPUT_ASCII ? "Float64" : ArrayTypeName( array->type ), array->name );
+	}
 	fprintf( vtkOut1, "    </PCellData>\n");
 	
 	/*
 	 * Write out coordinates. 
 	 */
 	fprintf( vtkOut1, "    <PPoints>\n");
-	fprintf( vtkOut1, "        <PDataArray type=\"Float64\" NumberOfComponents=\"3\"/>\n");
+	fprintf( vtkOut1, "        <PDataArray type=\"%s\" NumberOfComponents=\"3\"/>\n", 
+		 outputFormat == OUTPUT_ASCII ? "Float64" : ArrayTypeName( piece->points.type ) );
 	fprintf( vtkOut1, "    </PPoints>\n");
 
 	/*
@@ -1103,7 +893,6 @@ void ConvertTimeStep(
 	 * Close the output file. 
 	 */
 	fclose( vtkOut1 );
-    }
 }
 
 
@@ -1350,7 +1139,7 @@ void free_ivector(int *v, long nl, long nh)
  *
  * DeriveStressMeasures --
  *
- *      Process tetrahedral stress tensors into element stress measures
+ *      Process an element's averaged stress tensor (6 components, as dumped) into element stress measures
  *
  * Returns:
  *      Void
@@ -1361,25 +1150,12 @@ void free_ivector(int *v, long nl, long nh)
  *----------------------------------------------------------------------
  */
 void 
-DeriveStressMeasures(FILE *stressTensorIn, double elementStressTensor[3][3], struct stressMeasures *elementStressMeasures)
+DeriveStressMeasures(const float *stressTensorArray, double elementStressTensor[3][3], struct stressMeasures *elementStressMeasures)
 {
     double		failureAngleRadians=elementStressMeasures->failureAngle*M_PI/180.0;
     double		normalVector[3],slopeParallelVector[3],tractionVector[3];
     double		tmp;
-	float	stressTensorArray[numStressVectorComponent];
 
-	/*
-	 *  Read all tetrahedral stress tensors for this element gI
-	 */
-	if ( fread( stressTensorArray, sizeof(float), numStressVectorComponent, stressTensorIn )==0 )  {
-		if (feof(stressTensorIn)) {
-			fprintf(stderr, "Error (reached EOF prematurely) while reading Snac stress tensor output file.\n");
-			exit(1);
-		} else {
-			fprintf(stderr, "Error while reading Snac stress tensor output file.\n");
-			exit(1);
-		}
-	}
 	/*
 	 *  Report error and bail if we pick up NaNs in any of the stress components.
 	 */
@@ -104,7 +104,7 @@ int main( int argc, char* argv[] ) {
 	Dictionary_Add( dictionary, "rank", Dictionary_Entry_Value_FromUnsignedInt( rank ) );
 	Dictionary_Add( dictionary, "numProcessors", Dictionary_Entry_Value_FromUnsignedInt( numProcessors ) );
 	
-	/* Read input */
+	/* Read input: rank 0 parses the XML and broadcasts the resulting dictionary */
 	ioHandler = XML_IO_Handler_New();
 	if( argc >= 2 ) {
 		filename = strdup( argv[1] );
@@ -112,11 +112,13 @@ int main( int argc, char* argv[] ) {
 	else {
 		filename = strdup( "input.xml" );
 	}
-	if ( False == IO_Handler_ReadAllFromFile( ioHandler, filename, dictionary ) )
+	if ( False == IO_Handler_ReadAllFromFileBroadcast( ioHandler, filename, dictionary, CommWorld ) )
 	{
 		fprintf( stderr, "Error: Snac couldn't find specified input file %s. Exiting.\n", filename );
 		exit( EXIT_FAILURE );
 	}
+	/* Parameters given as "--param=value" on the command line override those of the input file */
+	Dictionary_ReadAllParamFromCommandLine( dictionary, argc, argv );
 	Journal_ReadFromDictionary( dictionary );
 
 	snacContext = Snac_Context_New( 0.0f, 0.0f, sizeof(Snac_Node), sizeof(Snac_Element), CommWorld, dictionary );
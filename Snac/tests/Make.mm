@@ -56,6 +56,10 @@ all:
 
 check:: test
 
+.PHONY: benchmark
+benchmark:
+	cd benchmark && ${SH} ./benchmark.sh
+
 test:
 	@if test ! -f ${PASSTOTALFILE}; then \
 		echo "0" | cat > ${PASSTOTALFILE}; \
@@ -0,0 +1,165 @@
+#!/bin/sh
+##~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+##
+## Copyright (C), 2003,
+##	Steve Quenette, 110 Victoria Street, Melbourne, Victoria, 3053, Australia.
+##	Californian Institute of Technology, 1200 East California Boulevard, Pasadena, California, 91125, USA.
+##	University of Texas, 1 University Station, Austin, Texas, 78712, USA.
+##
+## Role:
+##	Runs the Cookbook models over a matrix of rheologies, remeshing, mesh sizes and processor counts with the
+##	SnacBenchmark plugin, gathers the per-phase timings and memory high-water marks into one CSV and compares
+##	each run against its stored baseline.
+##
+## Assumptions:
+##	MPI_RUN environment variable is set, else defaults to "mpirun"
+##	MPI_NPROC environment variable is set, else defaults to "-np"
+##	BENCH_CASES, BENCH_SIZES (nodes, IxJxK), BENCH_RANKS and BENCH_STEPS narrow or widen the matrix.
+##	BENCH_TIME_TOLERANCE and BENCH_MEMORY_TOLERANCE are the relative slow-downs allowed (default 0.15 and 0.10);
+##	phases whose baseline takes less than BENCH_TIME_FLOOR seconds (default 0.01) are too noisy to compare.
+##	UPDATE_MODE=on records the runs as the new baselines, as for the regression tests.
+##
+## Comments:
+##	Baselines belong to the machine they were recorded on, so none are kept in the repository; record them
+##	from the release being compared against, then run again with the new one.
+##
+## $Id: benchmark.sh $
+##
+##~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+# name, input, and the extra parameters of each case
+cases() {
+	cat <<CASES
+elastic			elastic.xml
+elastic-remesh		elastic.xml		--extensions[]=SnacRemesher --remeshCondition=onTimeStep
+plastic			plastic.xml
+plastic-remesh		plastic.xml		--extensions[]=SnacRemesher --remeshCondition=onTimeStep
+viscoplastic		viscoplastic.xml
+viscoplastic-remesh	viscoplastic.xml	--remeshCondition=onTimeStep
+dike			viscoplastic.xml	--extensions[]=SnacDikeInjection --startX=20000 --endX=20000 --startZ=0 --endZ=80000 --dikeWidth=3000 --dikeDepth=-6000 --injectionRate=1.5e-10
+dike-remesh		viscoplastic.xml	--extensions[]=SnacDikeInjection --startX=20000 --endX=20000 --startZ=0 --endZ=80000 --dikeWidth=3000 --dikeDepth=-6000 --injectionRate=1.5e-10 --remeshCondition=onTimeStep
+CASES
+}
+
+if test "x${BENCH_CASES}" = "x"; then
+	BENCH_CASES=`cases | cut -f 1`
+fi
+if test "x${BENCH_SIZES}" = "x"; then
+	BENCH_SIZES="17x5x17 33x5x33"
+fi
+if test "x${BENCH_RANKS}" = "x"; then
+	BENCH_RANKS="1 2 4"
+fi
+if test "x${BENCH_STEPS}" = "x"; then
+	BENCH_STEPS=20
+fi
+if test "x${BENCH_TIME_TOLERANCE}" = "x"; then
+	BENCH_TIME_TOLERANCE=0.15
+fi
+if test "x${BENCH_MEMORY_TOLERANCE}" = "x"; then
+	BENCH_MEMORY_TOLERANCE=0.10
+fi
+if test "x${BENCH_TIME_FLOOR}" = "x"; then
+	BENCH_TIME_FLOOR=0.01
+fi
+if test "x${BENCH_OUTPUT}" = "x"; then
+	BENCH_OUTPUT=./output
+fi
+if test "x${BENCH_BASELINES}" = "x"; then
+	BENCH_BASELINES=./baselines
+fi
+if test "x${MPI_RUN}" = "x"; then
+	MPI_RUN="mpirun"
+fi
+if test "x${MPI_NPROC}" = "x"; then
+	MPI_NPROC="-np"
+fi
+
+if ! which Snac 1> /dev/null 2>&1; then
+	export PATH="$PATH:../../../build/bin"
+	if ! which Snac 1> /dev/null 2>&1; then
+		echo "Snac could not be found"
+		exit 1;
+	fi
+	LD_LIBRARY_PATH="../../../build/lib:${LD_LIBRARY_PATH}"
+	export LD_LIBRARY_PATH
+fi
+progname=`which Snac`
+
+# Print the metrics of "current" that run slower, or use more memory, than in "baseline"
+compareToBaseline() {
+	awk -F, -v timeTol=${BENCH_TIME_TOLERANCE} -v memTol=${BENCH_MEMORY_TOLERANCE} -v floor=${BENCH_TIME_FLOOR} '
+		/^#/ || $1 == "metric" { next }
+		FNR == NR { base[$1] = $6; next }
+		!($1 in base) { next }
+		$2 == "s" && base[$1] >= floor && $6 > base[$1] * (1.0 + timeTol) {
+			printf( "  %s: %.4g s, baseline %.4g s (+%.0f%%)\n", $1, $6, base[$1], 100.0 * ($6 / base[$1] - 1.0) )
+		}
+		$2 == "kB" && $6 > base[$1] * (1.0 + memTol) {
+			printf( "  %s: %d kB, baseline %d kB (+%.0f%%)\n", $1, $6, base[$1], 100.0 * ($6 / base[$1] - 1.0) )
+		}' $1 $2
+}
+
+mkdir -p ${BENCH_OUTPUT} ${BENCH_BASELINES}
+results=${BENCH_OUTPUT}/results.csv
+echo "case,size,ranks,metric,unit,calls,min,mean,max" > ${results}
+failed=0
+
+for case in ${BENCH_CASES}; do
+	line=`cases | tr -s '\t' | grep "^${case}	"`
+	if test "x${line}" = "x"; then
+		echo "Unknown case ${case}"
+		exit 1
+	fi
+	input=`echo "${line}" | cut -f 2`
+	params=`echo "${line}" | cut -f 3`
+
+	for size in ${BENCH_SIZES}; do
+		sizeI=`echo ${size} | cut -d x -f 1`
+		sizeJ=`echo ${size} | cut -d x -f 2`
+		sizeK=`echo ${size} | cut -d x -f 3`
+
+		for nproc in ${BENCH_RANKS}; do
+			run=${case}.${size}.${nproc}
+			outdir=${BENCH_OUTPUT}/${run}
+			rm -rf ${outdir}
+			mkdir -p ${outdir}
+			printf "${run}: "
+
+			if ! ${MPI_RUN} ${MPI_MACHINES} ${MPI_NPROC} ${nproc} ${progname} ${input} \
+				--outputPath=${outdir} --maxTimeSteps=${BENCH_STEPS} \
+				--remeshTimeStepCriterion=`expr ${BENCH_STEPS} / 2` \
+				--mesh.meshSizeI=${sizeI} --mesh.meshSizeJ=${sizeJ} --mesh.meshSizeK=${sizeK} \
+				'--extensions[]=SnacBenchmark' ${params} > ${outdir}/stdout 2> ${outdir}/stderr \
+				|| test ! -r ${outdir}/benchmark.csv
+			then
+				echo "*Failed to run*"
+				echo "  Output stored in ${outdir}"
+				failed=1
+				continue
+			fi
+			grep -v "^#" ${outdir}/benchmark.csv | grep -v "^metric" | \
+				sed "s/^/${case},${size},${nproc},/" >> ${results}
+
+			baseline=${BENCH_BASELINES}/${run}.csv
+			if test "${UPDATE_MODE}x" = "onx"; then
+				cp ${outdir}/benchmark.csv ${baseline}
+				echo "Recorded baseline ${baseline}"
+			elif test ! -r ${baseline}; then
+				echo "No baseline"
+			else
+				slower=`compareToBaseline ${baseline} ${outdir}/benchmark.csv`
+				if test "x${slower}" = "x"; then
+					echo "Passed"
+				else
+					echo "*Slower*"
+					echo "${slower}"
+					failed=1
+				fi
+			fi
+		done
+	done
+done
+
+echo "Results stored in ${results}"
+exit ${failed}
@@ -313,7 +313,7 @@ void Stg_CallGraph_Push( void* callGraph, void* functionPtr, Type name ) {
 
 			
 			newSize = self->_tableSize + _Stg_CallGraph_Table_Delta;
-			newTable = Memory_Alloc_Array( _Stg_CallGraph_Entry, newSize, _Stg_CallGrap_Entry_Type );
+			newTable = Memory_Alloc_Array( _Stg_CallGraph_Entry, newSize, _Stg_CallGraph_Entry_Type );
 			/* safe to do, we want to copy ptr values */
 			memcpy( newTable, self->table, self->_tableSize * sizeof(_Stg_CallGraph_Entry) ); 
 			Memory_Free( self->table );
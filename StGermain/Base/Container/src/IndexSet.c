@@ -48,7 +48,45 @@ const Type IndexSet_Type = "IndexSet";
 
 /** Macro to calculate container membership */
 #define IS_MEMBER( indexSet, index ) \
-	((indexSet)->_container[(index) / (sizeof(char) * 8 )] & (1 << ((index) % (sizeof(char) * 8))))
+	((indexSet)->_words[(index) / IndexSet_WordBits] & ((IndexSet_Word)1 << ((index) % IndexSet_WordBits)))
+
+/* Word-level bit counting. The portable versions are the usual SWAR popcount and its use for the trailing zero
+   count of a non-zero word. */
+#ifdef __GNUC__
+	#define IndexSet_PopCount( word ) \
+		((Index)__builtin_popcountll( word ))
+	#define IndexSet_CountTrailingZeros( word ) \
+		((Index)__builtin_ctzll( word ))
+#else
+	static Index IndexSet_PopCount( IndexSet_Word word ) {
+		word = word - ((word >> 1) & 0x5555555555555555ULL);
+		word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+		word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+		return (Index)((word * 0x0101010101010101ULL) >> 56);
+	}
+	
+	static Index IndexSet_CountTrailingZeros( IndexSet_Word word ) {
+		return IndexSet_PopCount( (word & (~word + 1)) - 1 );
+	}
+#endif
+
+/** Mask of the bits in a word below the given bit count (all bits for a count of IndexSet_WordBits) */
+static IndexSet_Word _IndexSet_LowMask( Index bitCount ) {
+	return bitCount < IndexSet_WordBits ? ((IndexSet_Word)1 << bitCount) - 1 : ~(IndexSet_Word)0;
+}
+
+/** Mask of the bits of the last word that are inside the set */
+static IndexSet_Word _IndexSet_LastWordMask( IndexSet* self ) {
+	return _IndexSet_LowMask( self->size - (self->_wordCount - 1) * IndexSet_WordBits );
+}
+
+/** Splits the range common to two sets into whole words and a mask for the trailing partial word */
+static void _IndexSet_MergeRange( IndexSet* self, IndexSet* secondSet, Index* wordCount, IndexSet_Word* lastMask ) {
+	IndexSet_Index	size = self->size <= secondSet->size ? self->size : secondSet->size;
+	
+	*wordCount = size / IndexSet_WordBits;
+	*lastMask = _IndexSet_LowMask( size % IndexSet_WordBits );
+}
 
 IndexSet* IndexSet_New( IndexSet_Index size ) {
 	return _IndexSet_New( sizeof(IndexSet), IndexSet_Type, _IndexSet_Delete, _IndexSet_Print, _IndexSet_Copy, _IndexSet_Duplicate, size );
@@ -105,8 +143,9 @@ void _IndexSet_Init( IndexSet* self, IndexSet_Index size ) {
 	/* IndexSet info */
 	self->size = size;
 	self->_containerSize = self->size / (sizeof(char) * 8) + (self->size % (sizeof(char) * 8) ? 1 : 0);
-	self->_container = Memory_Alloc_Array( BitField, self->_containerSize, "IndexSet->_container");
-	memset( self->_container, 0, sizeof(char) * self->_containerSize );
+	self->_wordCount = self->size / IndexSet_WordBits + (self->size % IndexSet_WordBits ? 1 : 0);
+	self->_words = Memory_Alloc_Array( IndexSet_Word, self->_wordCount, "IndexSet->_words");
+	memset( self->_words, 0, sizeof(IndexSet_Word) * self->_wordCount );
 	self->membersCount = 0;
 	self->error = Journal_Register( ErrorStream_Type, self->type );
 }
@@ -115,8 +154,8 @@ void _IndexSet_Init( IndexSet* self, IndexSet_Index size ) {
 void _IndexSet_Delete( void* indexSet ) {
 	IndexSet* self = (IndexSet*)indexSet;
 	
-	if( self->_container ) {
-		Memory_Free( self->_container );
+	if( self->_words ) {
+		Memory_Free( self->_words );
 	}
 	
 	/* Stg_Class_Delete parent class */
@@ -138,19 +177,13 @@ void _IndexSet_Print( void* indexSet, Stream* stream ) {
 	/* IndexSet */
 	Journal_Printf( indexSetStream, "\tsize: %u\n", self->size );
 	Journal_Printf( indexSetStream, "\t_containerSize: %lu\n", self->_containerSize );
-	Journal_Printf( indexSetStream, "\t_container: %p\n", self->_container );
+	Journal_Printf( indexSetStream, "\t_words: %p\n", self->_words );
 
-	if( self->_container ) {
+	if( self->_words ) {
 		IndexSet_Index		index_I;
 		
 		for( index_I = 0; index_I < self->size; index_I++ ) {
-			Index			containerIndex;
-			char			indexMask;
-			
-			containerIndex = index_I / (sizeof(char) * 8);
-			indexMask = 1 << (index_I % (sizeof(char) * 8));
-			
-			if( self->_container[containerIndex] & indexMask ) {
+			if( IS_MEMBER( self, index_I ) ) {
 				Journal_Printf( indexSetStream, "\t\tindex %u: In set.\n", index_I );
 			}
 			else {
@@ -175,8 +208,9 @@ void* _IndexSet_Copy( void* indexSet, void* dest, Bool deep, Name nameExt, PtrMa
 	
 	newIndexSet->size = self->size;
 	newIndexSet->_containerSize = self->_containerSize;
-	newIndexSet->_container = Memory_Alloc_Array( char, newIndexSet->_containerSize, "IndexSet->_container" );
-	memcpy( newIndexSet->_container, self->_container, sizeof(char) * newIndexSet->_containerSize );
+	newIndexSet->_wordCount = self->_wordCount;
+	newIndexSet->_words = Memory_Alloc_Array( IndexSet_Word, newIndexSet->_wordCount, "IndexSet->_words" );
+	memcpy( newIndexSet->_words, self->_words, sizeof(IndexSet_Word) * newIndexSet->_wordCount );
 	newIndexSet->membersCount = self->membersCount;
 	newIndexSet->error = self->error;
 	
@@ -192,7 +226,7 @@ void IndexSet_Add( void* indexSet, Index index ) {
 			__func__, index, self->size);
 	#endif
 	
-	self->_container[index / (sizeof(char) * 8)] |= (1 << (index % (sizeof(char) * 8)));
+	self->_words[index / IndexSet_WordBits] |= ((IndexSet_Word)1 << (index % IndexSet_WordBits));
 	self->membersCount = (unsigned)-1;
 }
 
@@ -205,7 +239,7 @@ void IndexSet_Remove( void* indexSet, Index index ) {
 			__func__, index, self->size);
 	#endif
 	
-	self->_container[index / (sizeof(char) * 8)] &= ~(1 << (index % (sizeof(char) * 8)));
+	self->_words[index / IndexSet_WordBits] &= ~((IndexSet_Word)1 << (index % IndexSet_WordBits));
 	self->membersCount = (unsigned)-1;
 }
 
@@ -217,22 +251,27 @@ Bool IndexSet_IsMember( void* indexSet, Index index ) {
 			__func__, index, self->size);
 	#endif
 	
-	return IS_MEMBER( self, index );
+	return IS_MEMBER( self, index ) ? True : False;
 }
 
 
 IndexSet_Index IndexSet_GetIndexOfNthMember( void* indexSet, const Index nthMember ) {
 	IndexSet*		self = (IndexSet*)indexSet;
-	int		membersSoFar = -1;
-	IndexSet_Index	index_I;
-	
-	for( index_I = 0; index_I < self->size; index_I++ ) {
-		if( IS_MEMBER( self, index_I ) ) {
-			membersSoFar++;
-			if ( nthMember == membersSoFar ) {
-				return index_I;
+	Index			membersLeft = nthMember;
+	Index			word_I;
+	
+	/* Skip whole words by their member count, then drop the lower members of the word holding the Nth */
+	for( word_I = 0; word_I < self->_wordCount; word_I++ ) {
+		IndexSet_Word	word = self->_words[word_I];
+		Index		wordCount = IndexSet_PopCount( word );
+		
+		if( membersLeft < wordCount ) {
+			for( ; membersLeft > 0; membersLeft-- ) {
+				word &= word - 1;
 			}
+			return word_I * IndexSet_WordBits + IndexSet_CountTrailingZeros( word );
 		}
+		membersLeft -= wordCount;
 	}
 
 	return IndexSet_Invalid( self );
@@ -241,14 +280,12 @@ IndexSet_Index IndexSet_GetIndexOfNthMember( void* indexSet, const Index nthMemb
 
 IndexSet_Index IndexSet_UpdateMembersCount( void* indexSet ) {
 	IndexSet*		self = (IndexSet*)indexSet;
-	IndexSet_Index		index_I;
+	Index			word_I;
 
 	if (self->membersCount == (unsigned)-1 ) {
 		self->membersCount = 0;
-		for( index_I = 0; index_I < self->size; index_I++ ) {
-			if( IS_MEMBER( self, index_I ) ) {
-				self->membersCount++;
-			}
+		for( word_I = 0; word_I < self->_wordCount; word_I++ ) {
+			self->membersCount += IndexSet_PopCount( self->_words[word_I] );
 		}
 	}
 
@@ -256,6 +293,26 @@ IndexSet_Index IndexSet_UpdateMembersCount( void* indexSet ) {
 }
 
 
+IndexSet_Index IndexSet_CountMembersBefore( void* indexSet, Index index ) {
+	IndexSet*		self = (IndexSet*)indexSet;
+	IndexSet_Index		count = 0;
+	Index			word_I;
+	Index			lastWord_I;
+
+	if( index >= self->size ) {
+		return IndexSet_UpdateMembersCount( self );
+	}
+	
+	lastWord_I = index / IndexSet_WordBits;
+	for( word_I = 0; word_I < lastWord_I; word_I++ ) {
+		count += IndexSet_PopCount( self->_words[word_I] );
+	}
+	count += IndexSet_PopCount( self->_words[lastWord_I] & _IndexSet_LowMask( index % IndexSet_WordBits ) );
+	
+	return count;
+}
+
+
 void IndexSet_GetMembers( void* indexSet, IndexSet_Index* countPtr, Index** arrayPtr ) {
 	IndexSet*		self = (IndexSet*)indexSet;
 	
@@ -272,12 +329,14 @@ void IndexSet_GetMembers( void* indexSet, IndexSet_Index* countPtr, Index** arra
 
 void IndexSet_GetMembers2( void* indexSet, Index* const array ) {
 	IndexSet*		self = (IndexSet*)indexSet;
-	IndexSet_Index		index_I;
+	Index			word_I;
 	unsigned int		array_I;
 
-	for( array_I = 0, index_I = 0; index_I < self->size; index_I++ ) {
-		if( IS_MEMBER( self, index_I ) ) {
-			array[array_I] = index_I;
+	for( array_I = 0, word_I = 0; word_I < self->_wordCount; word_I++ ) {
+		IndexSet_Word	word = self->_words[word_I];
+		
+		for( ; word; word &= word - 1 ) {
+			array[array_I] = word_I * IndexSet_WordBits + IndexSet_CountTrailingZeros( word );
 			array_I++;
 		}
 	}
@@ -286,16 +345,21 @@ void IndexSet_GetMembers2( void* indexSet, Index* const array ) {
 
 void IndexSet_GetVacancies( void* indexSet, IndexSet_Index* countPtr, Index** arrayPtr ) {
 	IndexSet*		self = (IndexSet*)indexSet;
-	IndexSet_Index		index_I;
+	Index			word_I;
 	unsigned int		array_I;
 
 	IndexSet_UpdateMembersCount( self );
 	*countPtr = self->size - self->membersCount;
 	
 	*arrayPtr = Memory_Alloc_Array( Index, (*countPtr), "IndexSet vacancies" );
-	for( array_I = 0, index_I = 0; index_I < self->size; index_I++ ) {
-		if( !IS_MEMBER( self, index_I) ) {
-			(*arrayPtr)[array_I] = index_I;
+	for( array_I = 0, word_I = 0; word_I < self->_wordCount; word_I++ ) {
+		IndexSet_Word	word = ~self->_words[word_I];
+		
+		if( word_I == self->_wordCount - 1 ) {
+			word &= _IndexSet_LastWordMask( self );
+		}
+		for( ; word; word &= word - 1 ) {
+			(*arrayPtr)[array_I] = word_I * IndexSet_WordBits + IndexSet_CountTrailingZeros( word );
 			array_I++;
 		}
 	}
@@ -307,12 +371,15 @@ void IndexSet_Merge_OR(void* indexSet, void* indexSetTwo )
 	IndexSet*	self = (IndexSet*)indexSet;
 	IndexSet*	secondSet = (IndexSet*)indexSetTwo;
 	Index		size;
+	IndexSet_Word	lastMask;
 	Index		i;
 	
-	size = self->size <= secondSet->size ? self->_containerSize : secondSet->_containerSize;
+	_IndexSet_MergeRange( self, secondSet, &size, &lastMask );
 	
 	for (i = 0; i < size; i++)
-		self->_container[i] |= secondSet->_container[i];
+		self->_words[i] |= secondSet->_words[i];
+	if( lastMask )
+		self->_words[size] |= secondSet->_words[size] & lastMask;
 	
 	self->membersCount = (unsigned int)-1;
 }
@@ -323,12 +390,34 @@ void IndexSet_Merge_AND(void* indexSet, void* indexSetTwo )
 	IndexSet*	self = (IndexSet*)indexSet;
 	IndexSet*	secondSet = (IndexSet*)indexSetTwo;
 	Index		size;
+	IndexSet_Word	lastMask;
 	Index		i;
 	
-	size = self->size <= secondSet->size ? self->_containerSize : secondSet->_containerSize;
+	_IndexSet_MergeRange( self, secondSet, &size, &lastMask );
 	
 	for (i = 0; i < size; i++)
-		self->_container[i] &= secondSet->_container[i];
+		self->_words[i] &= secondSet->_words[i];
+	if( lastMask )
+		self->_words[size] &= secondSet->_words[size] | ~lastMask;
+	
+	self->membersCount = (unsigned int)-1;
+}
+
+
+void IndexSet_Merge_ANDNOT(void* indexSet, void* indexSetTwo )
+{
+	IndexSet*	self = (IndexSet*)indexSet;
+	IndexSet*	secondSet = (IndexSet*)indexSetTwo;
+	Index		size;
+	IndexSet_Word	lastMask;
+	Index		i;
+	
+	_IndexSet_MergeRange( self, secondSet, &size, &lastMask );
+	
+	for (i = 0; i < size; i++)
+		self->_words[i] &= ~secondSet->_words[i];
+	if( lastMask )
+		self->_words[size] &= ~(secondSet->_words[size] & lastMask);
 	
 	self->membersCount = (unsigned int)-1;
 }
@@ -339,8 +428,10 @@ void IndexSet_AddAll( void* indexSet )
 	IndexSet*	self = (IndexSet*)indexSet;
 	Index		i;
 	
-	for( i = 0; i < self->_containerSize; i++)
-		self->_container[i] |= 0xFF;
+	for( i = 0; i < self->_wordCount; i++)
+		self->_words[i] = ~(IndexSet_Word)0;
+	if( self->_wordCount )
+		self->_words[self->_wordCount - 1] = _IndexSet_LastWordMask( self );
 
 	self->membersCount = self->size;
 }
@@ -349,10 +440,8 @@ void IndexSet_AddAll( void* indexSet )
 void IndexSet_RemoveAll( void* indexSet )
 {
 	IndexSet*	self = (IndexSet*)indexSet;
-	Index		i;
 	
-	for( i = 0; i < self->_containerSize; i++)
-		self->_container[i] &= 0x00;
+	memset( self->_words, 0, sizeof(IndexSet_Word) * self->_wordCount );
 
 	self->membersCount = 0;
 }
@@ -371,9 +460,42 @@ IndexSet* IndexSet_Duplicate( void* indexSet ) {
 
 
 void _IndexSet_Duplicate( void* indexSet, void* newIndexSet ){
-	/* self->containerSize and self->container are set by _IndexSet_Init */
+	/* self->_wordCount and self->_words are set by _IndexSet_Init */
 	IndexSet*	self = (IndexSet*)indexSet;
 	IndexSet*	newSet = (IndexSet*)newIndexSet;
-	memcpy( ((IndexSet*)newIndexSet)->_container, ((IndexSet*)indexSet)->_container, sizeof(char)*((IndexSet*)indexSet)->_containerSize );
+	memcpy( newSet->_words, self->_words, sizeof(IndexSet_Word) * self->_wordCount );
 	newSet->membersCount = self->membersCount;
 }
+
+
+IndexSet_Index IndexSet_Iterator_First( IndexSet_Iterator* iterator, void* indexSet ) {
+	IndexSet*	self = (IndexSet*)indexSet;
+	
+	iterator->set = self;
+	iterator->word_I = 0;
+	if( self->_wordCount == 0 ) {
+		return IndexSet_Invalid( self );
+	}
+	iterator->remaining = self->_words[0];
+	
+	return IndexSet_Iterator_Next( iterator );
+}
+
+
+IndexSet_Index IndexSet_Iterator_Next( IndexSet_Iterator* iterator ) {
+	IndexSet*	self = iterator->set;
+	Index		bit;
+	
+	while( !iterator->remaining ) {
+		if( iterator->word_I + 1 >= self->_wordCount ) {
+			return IndexSet_Invalid( self );
+		}
+		iterator->word_I++;
+		iterator->remaining = self->_words[iterator->word_I];
+	}
+	
+	bit = IndexSet_CountTrailingZeros( iterator->remaining );
+	iterator->remaining &= iterator->remaining - 1;
+	
+	return iterator->word_I * IndexSet_WordBits + bit;
+}
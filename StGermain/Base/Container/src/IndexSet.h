@@ -33,12 +33,14 @@
 ** Assumptions:
 **
 ** Comments:
-**	The Boolean values are stored using single bits in a bit field.
+**	The Boolean values are stored using single bits in an array of 64-bit
+**	words, index i being bit (i % 64) of word (i / 64). Bits beyond the set's
+**	size in the last word are kept False, so counting, merging and
+**	enumerating work a whole word at a time.
 **	The total count of values in the set is currently fixed.
-**	IndexSet_GetMembers() and IndexSet_GetVacancies() is potentially a CPU-hog
-**	if called very frequently on a large set. If this becomes a problem, the
-**	client code's algorithm may need to be improved with a lookup or hash
-**	table: see MeshDecomp .
+**	IndexSet_GetMembers() and IndexSet_GetVacancies() still allocate and
+**	fill an array the size of the result; use an IndexSet_Iterator to walk
+**	the members without allocating.
 **
 **
 ** $Id: IndexSet.h 3462 2006-02-19 06:53:24Z WalterLandry $
@@ -69,10 +71,12 @@
 		Stream*				error; \
 		/** Number of items in the set. Currently fixed. */ \
 		IndexSet_Index			size; \
-		/** Total size of the container in bytes */ \
+		/** Total size of the container in bytes (see IndexSet_Byte) */ \
 		SizeT				_containerSize; \
-		/** The set of boolean-repesenting bytes */ \
-		char*				_container; \
+		/** Number of words in the container */ \
+		Index				_wordCount; \
+		/** The set of boolean-repesenting words */ \
+		IndexSet_Word*			_words; \
 		/** Counter of 'Trues' in set, is reset to unsigned -1 when Add or Remove is called. */ \
 		IndexSet_Index			membersCount;					
 
@@ -84,6 +88,25 @@
 	#define IndexSet_Invalid( self ) \
 		(self)->size
 	
+	/** Number of indices held by each container word */
+	#define IndexSet_WordBits \
+		( sizeof(IndexSet_Word) * 8 )
+	
+	/** Byte byte_I of the container: the values of indices 8 * byte_I to 8 * byte_I + 7, lowest index in the lowest 
+	bit, whatever the host's byte order. */
+	#define IndexSet_Byte( self, byte_I ) \
+		( (unsigned char)( (self)->_words[(byte_I) / sizeof(IndexSet_Word)] >> ( (byte_I) % sizeof(IndexSet_Word) * 8 ) ) )
+	
+	/** Walks the members of an IndexSet:: in increasing order without allocating. Lives on the caller's stack:
+	**	for( index = IndexSet_Iterator_First( &iterator, set ); index < set->size; index = IndexSet_Iterator_Next( &iterator ) )
+	** The set must not be modified during the walk. */
+	struct IndexSet_Iterator {
+		IndexSet*			set;
+		Index				word_I;
+		/** Members of the current word not yet returned */
+		IndexSet_Word			remaining;
+	};
+	
 	/** Create a IndexSet:: of the given size. All values are
 	initially False.*/
 	IndexSet* IndexSet_New( IndexSet_Index size );
@@ -144,6 +167,10 @@
 	tracing is important. */
 	void IndexSet_GetMembers2( void* indexSet, Index* const array );
 
+	/** Returns the number of members with an index less than the given index, i.e. the position the index has (or
+	would have) in the array returned by IndexSet_GetMembers(). */
+	IndexSet_Index IndexSet_CountMembersBefore( void* indexSet, Index index );
+
 	/** Return a dynamically allocated array of all indices in the set that
 	are currently True. Note that the time is proportional to the number
 	of elements in the set, so use with some caution for large sets. */
@@ -170,6 +197,12 @@
 	*/
 	void IndexSet_Merge_AND( void* indexSet, void* merger );
 	
+	/** Remove from the first set every member of the second set (a binary AND with the complement of the second
+	set), saving the result to the first set. As for IndexSet_Merge_AND(), the operation is only applied up to the
+	shorter of the 2 lengths.
+	*/
+	void IndexSet_Merge_ANDNOT( void* indexSet, void* merger );
+	
 	/** Sets every index in the set as True. */
 	void IndexSet_AddAll( void* indexSet );
 	
@@ -182,6 +215,13 @@
 	/** IndexSet_Duplicate() implementation. */
 	void _IndexSet_Duplicate( void* indexSet, void* newIndexSet );
 	
+	/** Starts a walk over the members of the set, returning the first member's index, or IndexSet_Invalid if the
+	set is empty. */
+	IndexSet_Index IndexSet_Iterator_First( IndexSet_Iterator* iterator, void* indexSet );
+	
+	/** Returns the index of the next member in the walk, or IndexSet_Invalid once all members have been visited. */
+	IndexSet_Index IndexSet_Iterator_Next( IndexSet_Iterator* iterator );
+	
 	/** Prints message and exits properly when bad access/write detected. */
 	void _IndexSet_Abort( IndexSet* indexSet, const char* const funcName, IndexSet_Index index );
 
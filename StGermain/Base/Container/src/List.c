@@ -136,7 +136,7 @@ void _List_Init(
 	self->elementSize = elementSize;
 	self->delta = delta;
 	self->maxElements = self->delta;
-	self->elements = Memory_Alloc_Bytes_Unnamed( self->elementSize * self->maxElements, char);
+	self->elements = Memory_Alloc_Bytes_Unnamed( self->elementSize * self->maxElements, "char" );
 	assert( self->elements ); 
 	self->elementCnt = 0;
 }
@@ -215,7 +215,7 @@ void List_Resize( void* list, unsigned size ) {
 		factor = ceil( (float)(size - self->maxElements) / (float)self->delta );
 		self->maxElements += factor * self->delta;
 		
-		newElements = Memory_Alloc_Bytes_Unnamed( self->elementSize * self->maxElements, char );
+		newElements = Memory_Alloc_Bytes_Unnamed( self->elementSize * self->maxElements, "char" );
 		assert( newElements ); 
 		if( self->elements ) {
 			memcpy( newElements, self->elements, self->elementSize * self->elementCnt );
@@ -97,10 +97,10 @@ void _MemoryPool_Init( MemoryPool* self ){
 	assert( self );
 	_Stg_Class_Init ((Stg_Class*) self);
 	
-	self->elements = Memory_Alloc_Bytes_Unnamed( self->elementSize * self->numElements, char );
+	self->elements = Memory_Alloc_Bytes_Unnamed( self->elementSize * self->numElements, "char" );
 	memset( self->elements, 0, self->elementSize * self->numElements );
 
-	self->pool = Memory_Alloc_Bytes_Unnamed( sizeof( char* ) * self->numElements, char* );
+	self->pool = Memory_Alloc_Bytes_Unnamed( sizeof( char* ) * self->numElements, "char*" );
 	memset( self->pool, 0, sizeof(char*) * self->numElements );
 	
 	for( i=0; i<self->numElements; i++ ){
@@ -68,6 +68,8 @@
 	typedef struct RangeSet			RangeSet;
 	typedef unsigned char		Stg_Byte;
 	typedef char					BitField;
+	typedef unsigned long long		IndexSet_Word;
+	typedef struct IndexSet_Iterator		IndexSet_Iterator;
 	
 	typedef struct BTreeNode			BTreeNode;
 	typedef struct BTree				BTree;
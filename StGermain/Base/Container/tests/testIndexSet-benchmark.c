@@ -0,0 +1,172 @@
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+**
+** Copyright (C), 2003, Victorian Partnership for Advanced Computing (VPAC) Ltd, 110 Victoria Street, Melbourne, 3053, Australia.
+**
+** Authors:
+**	Stevan M. Quenette, Senior Software Engineer, VPAC. (steve@vpac.org)
+**	Patrick D. Sunter, Software Engineer, VPAC. (pds@vpac.org)
+**	Luke J. Hodkinson, Computational Engineer, VPAC. (lhodkins@vpac.org)
+**	Siew-Ching Tan, Software Engineer, VPAC. (siew@vpac.org)
+**	Alan H. Lo, Computational Engineer, VPAC. (alan@vpac.org)
+**	Raquibul Hassan, Computational Engineer, VPAC. (raq@vpac.org)
+**
+**  This library is free software; you can redistribute it and/or
+**  modify it under the terms of the GNU Lesser General Public
+**  License as published by the Free Software Foundation; either
+**  version 2.1 of the License, or (at your option) any later version.
+**
+**  This library is distributed in the hope that it will be useful,
+**  but WITHOUT ANY WARRANTY; without even the implied warranty of
+**  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+**  Lesser General Public License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License along with this library; if not, write to the Free Software
+**  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+**
+** $Id: testIndexSet-benchmark.c 3462 2006-02-19 06:53:24Z WalterLandry $
+**
+**~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#include <mpi.h>
+#include "Base/Foundation/Foundation.h"
+#include "Base/IO/IO.h"
+#include "Base/Container/Container.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Times the IndexSet queries used by the mesh decomposition against the equivalent per-index IndexSet_IsMember()
+   loops. Not a check, as the output is machine dependent:
+	testIndexSet-benchmark [size] [repeats] */
+
+int main( int argc, char* argv[] ) {
+	IndexSet_Index		size = 1000000;
+	unsigned int		repeats = 20;
+	IndexSet*		is;
+	IndexSet*		is2;
+	IndexSet_Iterator	iterator;
+	Index*			array;
+	IndexSet_Index		index;
+	IndexSet_Index		i;
+	unsigned int		repeat_I;
+	unsigned long		sum;
+	unsigned long		checkSum;
+	double			start;
+	double			perBit;
+	double			perWord;
+	
+	MPI_Init( &argc, &argv );
+	BaseFoundation_Init( &argc, &argv );
+	BaseIO_Init( &argc, &argv );
+	BaseContainer_Init( &argc, &argv );
+	
+	if( argc >= 2 ) {
+		size = atoi( argv[1] );
+	}
+	if( argc >= 3 ) {
+		repeats = atoi( argv[2] );
+	}
+	
+	is = IndexSet_New( size );
+	is2 = IndexSet_New( size );
+	array = Memory_Alloc_Array( Index, size, "members" );
+	srand( 1 );
+	for( i = 0; i < size; i++ ) {
+		if( rand() % 2 ) IndexSet_Add( is, i );
+		if( rand() % 3 ) IndexSet_Add( is2, i );
+	}
+	printf( "size %u, repeats %u, members %u\n", size, repeats, IndexSet_UpdateMembersCount( is ) );
+	printf( "%-24s %12s %12s %8s\n", "operation", "per-index(s)", "word(s)", "speedup" );
+	
+	/* Members count */
+	start = MPI_Wtime();
+	for( sum = 0, repeat_I = 0; repeat_I < repeats; repeat_I++ ) {
+		for( i = 0; i < size; i++ ) {
+			if( IndexSet_IsMember( is, i ) ) sum++;
+		}
+	}
+	perBit = MPI_Wtime() - start;
+	checkSum = sum;
+	start = MPI_Wtime();
+	for( sum = 0, repeat_I = 0; repeat_I < repeats; repeat_I++ ) {
+		is->membersCount = (unsigned)-1;
+		sum += IndexSet_UpdateMembersCount( is );
+	}
+	perWord = MPI_Wtime() - start;
+	printf( "%-24s %12.6f %12.6f %7.1fx%s\n", "UpdateMembersCount", perBit, perWord, perBit / perWord, 
+		sum == checkSum ? "" : " MISMATCH" );
+	
+	/* Member enumeration */
+	start = MPI_Wtime();
+	for( sum = 0, repeat_I = 0; repeat_I < repeats; repeat_I++ ) {
+		for( i = 0; i < size; i++ ) {
+			if( IndexSet_IsMember( is, i ) ) sum += i;
+		}
+	}
+	perBit = MPI_Wtime() - start;
+	checkSum = sum;
+	start = MPI_Wtime();
+	for( sum = 0, repeat_I = 0; repeat_I < repeats; repeat_I++ ) {
+		IndexSet_Index	count = IndexSet_UpdateMembersCount( is );
+		
+		IndexSet_GetMembers2( is, array );
+		for( i = 0; i < count; i++ ) sum += array[i];
+	}
+	perWord = MPI_Wtime() - start;
+	printf( "%-24s %12.6f %12.6f %7.1fx%s\n", "GetMembers2", perBit, perWord, perBit / perWord, 
+		sum == checkSum ? "" : " MISMATCH" );
+	start = MPI_Wtime();
+	for( sum = 0, repeat_I = 0; repeat_I < repeats; repeat_I++ ) {
+		for( index = IndexSet_Iterator_First( &iterator, is ); index < size; index = IndexSet_Iterator_Next( &iterator ) ) {
+			sum += index;
+		}
+	}
+	perWord = MPI_Wtime() - start;
+	printf( "%-24s %12.6f %12.6f %7.1fx%s\n", "Iterator", perBit, perWord, perBit / perWord, 
+		sum == checkSum ? "" : " MISMATCH" );
+	
+	/* Set algebra */
+	start = MPI_Wtime();
+	for( repeat_I = 0; repeat_I < repeats; repeat_I++ ) {
+		for( i = 0; i < size; i++ ) {
+			if( IndexSet_IsMember( is2, i ) ) IndexSet_Add( is, i );
+		}
+	}
+	perBit = MPI_Wtime() - start;
+	start = MPI_Wtime();
+	for( repeat_I = 0; repeat_I < repeats; repeat_I++ ) {
+		IndexSet_Merge_OR( is, is2 );
+	}
+	perWord = MPI_Wtime() - start;
+	printf( "%-24s %12.6f %12.6f %7.1fx\n", "Merge_OR", perBit, perWord, perBit / perWord );
+	
+	/* Global to local index: the MeshDecomp 1D maps, for a sample of indices */
+	start = MPI_Wtime();
+	for( sum = 0, index = 0; index < size; index += size / repeats + 1 ) {
+		for( i = 0; i < index; i++ ) {
+			if( IndexSet_IsMember( is2, i ) ) sum++;
+		}
+	}
+	perBit = MPI_Wtime() - start;
+	checkSum = sum;
+	start = MPI_Wtime();
+	for( sum = 0, index = 0; index < size; index += size / repeats + 1 ) {
+		sum += IndexSet_CountMembersBefore( is2, index );
+	}
+	perWord = MPI_Wtime() - start;
+	printf( "%-24s %12.6f %12.6f %7.1fx%s\n", "CountMembersBefore", perBit, perWord, perBit / perWord, 
+		sum == checkSum ? "" : " MISMATCH" );
+	
+	Memory_Free( array );
+	Stg_Class_Delete( is2 );
+	Stg_Class_Delete( is );
+	
+	BaseContainer_Finalise();
+	BaseIO_Finalise();
+	BaseFoundation_Finalise();
+	MPI_Finalize();
+	
+	return 0;
+}
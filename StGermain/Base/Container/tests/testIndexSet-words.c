@@ -0,0 +1,210 @@
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+**
+** Copyright (C), 2003, Victorian Partnership for Advanced Computing (VPAC) Ltd, 110 Victoria Street, Melbourne, 3053, Australia.
+**
+** Authors:
+**	Stevan M. Quenette, Senior Software Engineer, VPAC. (steve@vpac.org)
+**	Patrick D. Sunter, Software Engineer, VPAC. (pds@vpac.org)
+**	Luke J. Hodkinson, Computational Engineer, VPAC. (lhodkins@vpac.org)
+**	Siew-Ching Tan, Software Engineer, VPAC. (siew@vpac.org)
+**	Alan H. Lo, Computational Engineer, VPAC. (alan@vpac.org)
+**	Raquibul Hassan, Computational Engineer, VPAC. (raq@vpac.org)
+**
+**  This library is free software; you can redistribute it and/or
+**  modify it under the terms of the GNU Lesser General Public
+**  License as published by the Free Software Foundation; either
+**  version 2.1 of the License, or (at your option) any later version.
+**
+**  This library is distributed in the hope that it will be useful,
+**  but WITHOUT ANY WARRANTY; without even the implied warranty of
+**  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+**  Lesser General Public License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License along with this library; if not, write to the Free Software
+**  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+**
+** $Id: testIndexSet-words.c 3462 2006-02-19 06:53:24Z WalterLandry $
+**
+**~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#include <mpi.h>
+#include "Base/Foundation/Foundation.h"
+#include "Base/IO/IO.h"
+#include "Base/Container/Container.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Checks the word-at-a-time IndexSet operations against a plain Bool array, for sizes either side of the word
+   boundaries. */
+
+#define SIZE_COUNT 7
+static const IndexSet_Index sizes[SIZE_COUNT] = { 1, 7, 63, 64, 65, 127, 200 };
+
+
+/* Fills the set and the reference with a pattern that depends on the seed */
+void Fill( IndexSet* is, Bool* ref, unsigned int seed ) {
+	IndexSet_Index i;
+	
+	IndexSet_RemoveAll( is );
+	for( i = 0; i < is->size; i++ ) {
+		ref[i] = ( (i * 37 + seed * 11) % 7 < 3 || i == is->size - 1 ) ? True : False;
+		if( ref[i] ) {
+			IndexSet_Add( is, i );
+		}
+	}
+}
+
+
+/* Returns the number of differences between the set's queries and the reference */
+unsigned int Compare( IndexSet* is, Bool* ref ) {
+	IndexSet_Iterator	iterator;
+	IndexSet_Index		count = 0;
+	IndexSet_Index		index;
+	IndexSet_Index		setCount;
+	Index*			array;
+	unsigned int		errors = 0;
+	IndexSet_Index		i;
+	
+	for( i = 0; i < is->size; i++ ) {
+		if( IndexSet_IsMember( is, i ) != ref[i] ) errors++;
+		if( IndexSet_CountMembersBefore( is, i ) != count ) errors++;
+		if( ref[i] ) {
+			if( IndexSet_GetIndexOfNthMember( is, count ) != i ) errors++;
+			count++;
+		}
+	}
+	is->membersCount = (unsigned)-1;
+	if( IndexSet_UpdateMembersCount( is ) != count ) errors++;
+	if( IndexSet_CountMembersBefore( is, is->size ) != count ) errors++;
+	if( IndexSet_GetIndexOfNthMember( is, count ) != IndexSet_Invalid( is ) ) errors++;
+	
+	IndexSet_GetMembers( is, &setCount, &array );
+	if( setCount != count ) errors++;
+	for( i = 0; i < setCount; i++ ) {
+		if( !ref[array[i]] || (i > 0 && array[i] <= array[i - 1]) ) errors++;
+	}
+	if( array ) Memory_Free( array );
+	
+	IndexSet_GetVacancies( is, &setCount, &array );
+	if( setCount != is->size - count ) errors++;
+	for( i = 0; i < setCount; i++ ) {
+		if( array[i] >= is->size || ref[array[i]] || (i > 0 && array[i] <= array[i - 1]) ) errors++;
+	}
+	if( array ) Memory_Free( array );
+	
+	setCount = 0;
+	for( index = IndexSet_Iterator_First( &iterator, is ); index < is->size; index = IndexSet_Iterator_Next( &iterator ) ) {
+		if( !ref[index] ) errors++;
+		setCount++;
+	}
+	if( setCount != count || index != IndexSet_Invalid( is ) ) errors++;
+	
+	return errors;
+}
+
+
+int main( int argc, char* argv[] ) {
+	MPI_Comm			CommWorld;
+	int				rank;
+	int				numProcessors;
+	int				procToWatch;
+	
+	/* Initialise MPI, get world info */
+	MPI_Init( &argc, &argv );
+	MPI_Comm_dup( MPI_COMM_WORLD, &CommWorld );
+	MPI_Comm_size( CommWorld, &numProcessors );
+	MPI_Comm_rank( CommWorld, &rank );
+
+	BaseFoundation_Init( &argc, &argv );
+	BaseIO_Init( &argc, &argv );
+	BaseContainer_Init( &argc, &argv );
+
+	if( argc >= 2 ) {
+		procToWatch = atoi( argv[1] );
+	}
+	else {
+		procToWatch = 0;
+	}
+	if( rank == procToWatch ) {
+		unsigned int			size_I;
+		
+		printf( "Watching rank: %i\n", rank );
+		
+		for( size_I = 0; size_I < SIZE_COUNT; size_I++ ) {
+			IndexSet_Index		size = sizes[size_I];
+			/* Second sets shorter, equal and longer than the first */
+			IndexSet_Index		mergeSizes[3] = { size / 2 + 1, size, size + 70 };
+			IndexSet*		is = IndexSet_New( size );
+			Bool*			ref = Memory_Alloc_Array( Bool, size, "ref" );
+			Bool*			ref2 = Memory_Alloc_Array( Bool, size + 70, "ref2" );
+			unsigned int		merge_I;
+			IndexSet_Index		i;
+			
+			printf( "* Size %u *\n", size );
+			
+			Fill( is, ref, 1 );
+			printf( "Members: %u, errors: %u\n", IndexSet_UpdateMembersCount( is ), Compare( is, ref ) );
+			
+			IndexSet_AddAll( is );
+			for( i = 0; i < size; i++ ) ref[i] = True;
+			printf( "AddAll members: %u, errors: %u\n", IndexSet_UpdateMembersCount( is ), Compare( is, ref ) );
+			
+			IndexSet_RemoveAll( is );
+			for( i = 0; i < size; i++ ) ref[i] = False;
+			printf( "RemoveAll members: %u, errors: %u\n", IndexSet_UpdateMembersCount( is ), Compare( is, ref ) );
+			
+			for( merge_I = 0; merge_I < 3; merge_I++ ) {
+				IndexSet_Index	mergeSize = mergeSizes[merge_I];
+				IndexSet_Index	common = mergeSize < size ? mergeSize : size;
+				IndexSet*	is2 = IndexSet_New( mergeSize );
+				IndexSet*	copy;
+				
+				/* The second set is full past the first's size, which must not leak into the first */
+				Fill( is2, ref2, 2 );
+				for( i = size; i < mergeSize; i++ ) {
+					IndexSet_Add( is2, i );
+				}
+				
+				Fill( is, ref, 1 );
+				IndexSet_Merge_OR( is, is2 );
+				for( i = 0; i < common; i++ ) ref[i] = ref[i] || ref2[i];
+				printf( "Merge_OR with size %u: members %u, errors: %u\n", mergeSize, 
+					IndexSet_UpdateMembersCount( is ), Compare( is, ref ) );
+				
+				Fill( is, ref, 1 );
+				IndexSet_Merge_AND( is, is2 );
+				for( i = 0; i < common; i++ ) ref[i] = ref[i] && ref2[i];
+				printf( "Merge_AND with size %u: members %u, errors: %u\n", mergeSize, 
+					IndexSet_UpdateMembersCount( is ), Compare( is, ref ) );
+				
+				Fill( is, ref, 1 );
+				IndexSet_Merge_ANDNOT( is, is2 );
+				for( i = 0; i < common; i++ ) ref[i] = ref[i] && !ref2[i];
+				printf( "Merge_ANDNOT with size %u: members %u, errors: %u\n", mergeSize, 
+					IndexSet_UpdateMembersCount( is ), Compare( is, ref ) );
+				
+				copy = IndexSet_Duplicate( is );
+				printf( "Duplicate errors: %u\n", Compare( copy, ref ) );
+				
+				Stg_Class_Delete( copy );
+				Stg_Class_Delete( is2 );
+			}
+			
+			Memory_Free( ref2 );
+			Memory_Free( ref );
+			Stg_Class_Delete( is );
+		}
+	}
+	
+	BaseContainer_Finalise();
+	BaseIO_Finalise();
+	BaseFoundation_Finalise();
+	
+	/* Close off MPI */
+	MPI_Finalize();
+	
+	return 0; /* success */
+}
@@ -42,7 +42,9 @@ void Print_Container( IndexSet* is ) {
 
 	printf( "is->_container[0-%lu]: ", is->_containerSize );
 	for( i = 0; i < is->_containerSize; i++ ) {
-		printf( "%u%u%u%u%u%u%u%u, ", is->_container[i] & 0x01 ? 1 : 0, is->_container[i] & 0x02 ? 1 : 0, is->_container[i] & 0x04 ? 1 : 0, is->_container[i] & 0x08 ? 1 : 0, is->_container[i] & 0x10 ? 1 : 0, is->_container[i] & 0x20 ? 1 : 0, is->_container[i] & 0x40 ? 1 : 0, is->_container[i] & 0x80 ? 1 : 0 );
+		unsigned char byte = IndexSet_Byte( is, i );
+
+		printf( "%u%u%u%u%u%u%u%u, ", byte & 0x01 ? 1 : 0, byte & 0x02 ? 1 : 0, byte & 0x04 ? 1 : 0, byte & 0x08 ? 1 : 0, byte & 0x10 ? 1 : 0, byte & 0x20 ? 1 : 0, byte & 0x40 ? 1 : 0, byte & 0x80 ? 1 : 0 );
 	}
 	printf( "\n" );
 }	
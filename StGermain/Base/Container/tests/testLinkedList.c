@@ -75,7 +75,7 @@ void dataPrintFunction( void *nodeData, void *args )
 
 void dataCopyFunction( void **nodeData, void *newData, SizeT dataSize)
 {
-	*nodeData = Memory_Alloc_Bytes_Unnamed(dataSize, char);
+	*nodeData = Memory_Alloc_Bytes_Unnamed(dataSize, "char" );
 	memset(*nodeData, 0, dataSize);
 
 	memcpy(*nodeData, newData, dataSize);
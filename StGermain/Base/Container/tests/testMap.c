@@ -45,11 +45,11 @@ int mapCompareFunc( void* left, void* right ) {
 
 
 void mapCopyFunc( void** newData, void* data, SizeT size ) {
-	*newData = Memory_Alloc_Bytes_Unnamed( size , char);
+	*newData = Memory_Alloc_Bytes_Unnamed( size , "char" );
 	/* TODO: convert to journal */
 	assert( *newData );
 
-	(*(MapTuple**)newData)->keyData = Memory_Alloc_Bytes_Unnamed( strlen( ((MapTuple*)data)->keyData ) + 1 , char);
+	(*(MapTuple**)newData)->keyData = Memory_Alloc_Bytes_Unnamed( strlen( ((MapTuple*)data)->keyData ) + 1 , "char" );
 	strcpy( (*(MapTuple**)newData)->keyData, ((MapTuple*)data)->keyData );
 
 	(*(MapTuple**)newData)->valueData = Memory_Alloc( int, "MapTuple_newData->valueData" );
@@ -53,7 +53,7 @@ int compareFunc( void* left, void* right ) {
 
 
 void copyFunc( void** newData, void* data, SizeT size ) {
-	*newData = Memory_Alloc_Bytes_Unnamed( size, char );
+	*newData = Memory_Alloc_Bytes_Unnamed( size, "char" );
 	/* TODO: convert to journal */
 	assert( *newData );
 
@@ -728,6 +728,30 @@ void* ExtensionManager_GetFunc( void* extension, void* ptr, ExtensionInfo_Index
 	return ExtensionManager_GetMacro( self, ptr, handle );
 }
 
+ExtensionView ExtensionManager_GetView( void* extension, void* array, ExtensionInfo_Index handle ) {
+	ExtensionManager*			self = (ExtensionManager*)extension;
+	ExtensionView				view;
+	
+	view.base = ExtensionManager_Get( self, array, handle );
+	if( ExtensionManager_OfExisting( self ) ) {
+		view.stride = 0;
+	}
+	else if( !ExtensionManager_OfArray( self ) ) {
+		view.stride = ExtensionManager_GetFinalSize( self );
+	}
+	else if( !ExtensionManager_OfExtendedArray( self ) ) {
+		view.stride = ExtensionInfo_At( self->extInfos, handle )->size;
+	}
+	else if( handle < self->em->extInfos->count ) {
+		view.stride = ExtensionManager_GetFinalSize( self->em );
+	}
+	else {
+		view.stride = ExtensionInfo_At( self->extInfos, handle - self->em->extInfos->count )->size;
+	}
+	
+	return view;
+}
+
 void* ExtensionManager_HashGet( void* extension, void* ptr, Name key ) {
 	/*
 	ExtensionManager*			self = (ExtensionManager*)extension;
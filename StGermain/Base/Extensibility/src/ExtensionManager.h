@@ -350,6 +350,24 @@
 	void* ExtensionManager_HashGet( void* extension, void* ptr, Name key );
 	
 
+	/** A view of one extension over a whole array of extended items: the extension of item "index" is at
+	 *  base + index * stride. Resolve it once (e.g. before a loop over the items) instead of calling
+	 *  ExtensionManager_Get per item. The stride is that of the extended struct, or that of the extension's own array
+	 *  for extensions stored out-of-line (OfArray / OfExtendedArray). It is 0 for extensions to an existing object.
+	 *  Like ExtensionManager_Get, a view is invalidated by ExtensionManager_Add or re-allocating the items. */
+	struct ExtensionView {
+		void*			base;
+		SizeT			stride;
+	};
+
+	/** Get the view of the handle specified extension over the array of items starting at "array". */
+	ExtensionView ExtensionManager_GetView( void* extension, void* array, ExtensionInfo_Index handle );
+
+	/** Get the pointer to the extension of item "index" from a view. */
+	#define ExtensionView_At( view, index ) \
+		( (void*)( (ArithPointer)(view).base + (ArithPointer)(index) * (ArithPointer)(view).stride ) )
+	
+
 	/** Calculate the word-aligned version of provided data size. */
 	#define ExtensionManager_AlignMacro( size ) \
 		( (size) % sizeof(Stg_Word) ? ( (size)/sizeof(Stg_Word) + 1 ) * sizeof(Stg_Word) : (size) )
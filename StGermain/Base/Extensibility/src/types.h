@@ -51,6 +51,7 @@
 	typedef struct SimpleExtensionInfo		SimpleExtensionInfo;
 	typedef struct ClassPtrExtensionInfo		ClassPtrExtensionInfo;
 	typedef struct ExtensionManager			ExtensionManager;
+	typedef struct ExtensionView			ExtensionView;
 	typedef struct ExtensionManager_Register	ExtensionManager_Register;
 	typedef struct EntryPoint_Register		EntryPoint_Register;
 	typedef struct Codelet				Codelet;
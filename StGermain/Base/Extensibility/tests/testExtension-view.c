@@ -0,0 +1,172 @@
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+**
+** Copyright (C), 2003, Victorian Partnership for Advanced Computing (VPAC) Ltd, 110 Victoria Street, Melbourne, 3053, Australia.
+**
+** Authors:
+**	Stevan M. Quenette, Senior Software Engineer, VPAC. (steve@vpac.org)
+**	Patrick D. Sunter, Software Engineer, VPAC. (pds@vpac.org)
+**	Luke J. Hodkinson, Computational Engineer, VPAC. (lhodkins@vpac.org)
+**	Siew-Ching Tan, Software Engineer, VPAC. (siew@vpac.org)
+**	Alan H. Lo, Computational Engineer, VPAC. (alan@vpac.org)
+**	Raquibul Hassan, Computational Engineer, VPAC. (raq@vpac.org)
+**
+**  This library is free software; you can redistribute it and/or
+**  modify it under the terms of the GNU Lesser General Public
+**  License as published by the Free Software Foundation; either
+**  version 2.1 of the License, or (at your option) any later version.
+**
+**  This library is distributed in the hope that it will be useful,
+**  but WITHOUT ANY WARRANTY; without even the implied warranty of
+**  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+**  Lesser General Public License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License along with this library; if not, write to the Free Software
+**  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+**
+** $Id: testExtension-view.c $
+**
+**~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#include "Base/Foundation/Foundation.h"
+#include "Base/IO/IO.h"
+#include "Base/Container/Container.h"
+#include "Base/Automation/Automation.h"
+#include "Base/Extensibility/Extensibility.h"
+
+#include "stdio.h"
+#include "stdlib.h"
+#include "mpi.h"
+
+typedef struct {
+	double x;
+	double y;
+	char dim;
+} BaseClass;
+
+typedef struct {
+	char type;
+} ExtensionStruct0;
+const Type Type0 = "Type0";
+
+typedef struct {
+	double temp;
+	int flag;
+} ExtensionStruct1;
+const Type Temp0 = "Temp0";
+
+#define ArraySize 100
+
+int main( int argc, char* argv[] ) {
+	MPI_Comm CommWorld;
+	int rank;
+	int numProcessors;
+	int procToWatch;
+	Stream* stream;
+
+	/* Initialise MPI, get world info */
+	MPI_Init( &argc, &argv );
+	MPI_Comm_dup( MPI_COMM_WORLD, &CommWorld );
+	MPI_Comm_size( CommWorld, &numProcessors );
+	MPI_Comm_rank( CommWorld, &rank );
+	
+	BaseFoundation_Init( &argc, &argv );
+	BaseIO_Init( &argc, &argv );
+	BaseContainer_Init( &argc, &argv );
+	BaseAutomation_Init( &argc, &argv );
+	BaseExtensibility_Init( &argc, &argv );
+	
+	/* creating a stream */
+	stream =  Journal_Register( InfoStream_Type, "myStream" );
+
+	if( argc >= 2 ) {
+		procToWatch = atoi( argv[1] );
+	}
+	else {
+		procToWatch = 0;
+	}
+	if( rank == procToWatch ) {
+		ExtensionManager*	extensionMgr;
+		BaseClass*		nArray;
+		BaseClass		aArray[ArraySize];
+		BaseClass*		n;
+		ExtensionView		view0;
+		ExtensionView		view1;
+		Index			i;
+		Bool			match;
+
+		Journal_Printf( (void*) stream, "Watching rank: %i\n", rank );
+		
+		/* Extensions stored in the extended struct */
+		extensionMgr = ExtensionManager_New_OfStruct( "Node", sizeof(BaseClass) );
+		ExtensionManager_Add( extensionMgr, Type0, sizeof(ExtensionStruct0) );
+		ExtensionManager_Add( extensionMgr, Temp0, sizeof(ExtensionStruct1) );
+		nArray = (BaseClass*)ExtensionManager_Malloc( extensionMgr, ArraySize );
+
+		view0 = ExtensionManager_GetView( extensionMgr, nArray, 0 );
+		view1 = ExtensionManager_GetView( extensionMgr, nArray, 1 );
+		Journal_Printf( stream, "OfStruct: stride equals finalSize: %s\n",
+			view1.stride == ExtensionManager_GetFinalSize( extensionMgr ) ? "True" : "False" );
+		match = True;
+		for( i = 0; i < ArraySize; i++ ) {
+			n = (BaseClass*)ExtensionManager_At( extensionMgr, nArray, i );
+			((ExtensionStruct1*)ExtensionView_At( view1, i ))->temp = (double)i;
+			if( ExtensionView_At( view0, i ) != ExtensionManager_Get( extensionMgr, n, 0 ) ||
+			    ExtensionView_At( view1, i ) != ExtensionManager_Get( extensionMgr, n, 1 ) ||
+			    ((ExtensionStruct1*)ExtensionManager_Get( extensionMgr, n, 1 ))->temp != (double)i )
+			{
+				match = False;
+			}
+		}
+		Journal_Printf( stream, "OfStruct: view matches ExtensionManager_Get for all items: %s\n", match ? "True" : "False" );
+
+		ExtensionManager_Free( extensionMgr, nArray );
+		Stg_Class_Delete( extensionMgr );
+
+		/* Extensions stored out-of-line, in an array of their own */
+		extensionMgr = ExtensionManager_New_OfArray( "NodeArray", aArray, sizeof(BaseClass), ArraySize );
+		ExtensionManager_Add( extensionMgr, Type0, sizeof(ExtensionStruct0) );
+		ExtensionManager_Add( extensionMgr, Temp0, sizeof(ExtensionStruct1) );
+
+		view0 = ExtensionManager_GetView( extensionMgr, aArray, 0 );
+		view1 = ExtensionManager_GetView( extensionMgr, aArray, 1 );
+		Journal_Printf( stream, "OfArray: stride equals the extension size: %s\n",
+			view1.stride == ExtensionInfo_At( extensionMgr->extInfos, 1 )->size ? "True" : "False" );
+		match = True;
+		for( i = 0; i < ArraySize; i++ ) {
+			if( ExtensionView_At( view0, i ) != ExtensionManager_Get( extensionMgr, &aArray[i], 0 ) ||
+			    ExtensionView_At( view1, i ) != ExtensionManager_Get( extensionMgr, &aArray[i], 1 ) )
+			{
+				match = False;
+			}
+		}
+		Journal_Printf( stream, "OfArray: view matches ExtensionManager_Get for all items: %s\n", match ? "True" : "False" );
+
+		Stg_Class_Delete( extensionMgr );
+
+		/* Extensions to an existing object */
+		n = Memory_Alloc_Unnamed( BaseClass );
+		extensionMgr = ExtensionManager_New_OfExistingObject( "Object", n );
+		ExtensionManager_Add( extensionMgr, Type0, sizeof(ExtensionStruct0) );
+		ExtensionManager_Add( extensionMgr, Temp0, sizeof(ExtensionStruct1) );
+
+		view1 = ExtensionManager_GetView( extensionMgr, n, 1 );
+		Journal_Printf( stream, "OfExistingObject: view matches ExtensionManager_Get: %s\n",
+			( view1.stride == 0 && ExtensionView_At( view1, 0 ) == ExtensionManager_Get( extensionMgr, n, 1 ) ) ?
+				"True" : "False" );
+
+		Stg_Class_Delete( extensionMgr );
+		Memory_Free( n );
+	}
+
+	BaseExtensibility_Finalise();
+	BaseAutomation_Finalise();
+	BaseContainer_Finalise();
+	BaseIO_Finalise();
+	BaseFoundation_Finalise();
+	
+	/* Close off MPI */
+	MPI_Finalize();
+
+	return 0; /* success */
+}
@@ -47,6 +47,7 @@
 	#include "MemoryTag.h"
 	#include "MemoryPointer.h"
 	#include "MemoryField.h"
+	#include "MemoryCounter.h"
 	#include "MemoryReport.h"
 	#include "Memory.h"
 	#include "Class.h"
@@ -34,6 +34,7 @@
 
 #include "MemoryTag.h"
 #include "MemoryField.h"
+#include "MemoryCounter.h"
 #include "MemoryPointer.h"
 #include "Memory.h"
 
@@ -63,6 +64,12 @@ void Memory_Free_Pointer( MemoryPointer* memoryPointer );
 /** Attempts to find the pointer in database. */
 MemoryPointer* Memory_Find_Pointer( Pointer ptr );
 
+/** Attempts to find a live allocation in database, skipping the search if the allocation was not sampled. */
+MemoryPointer* Memory_Find_Tracked_Pointer( Pointer ptr );
+
+/** Charges a new allocation to its type/name counter and decides whether it is sampled into a MemoryPointer. */
+Bool Memory_Track_Pointer( Pointer ptr, SizeT size, Type type, Name name );
+
 /** Setups the pointer locations in a 2D array. */
 void Memory_SetupPointer_2DArray(
 	void* ptr,
@@ -190,6 +197,22 @@ Memory* Memory_Init()
 	result->stgCurrentMemory = 0;
 	result->stgPeakMemory = 0;
 	
+	result->sampleInterval = 1;
+	result->sampleThreshold = 0;
+	result->sampleCount = 0;
+	result->counters = NULL;
+	#ifdef MEMORY_STATS
+		result->counters = MemoryCounter_NewTable();
+	#endif
+	
+	/* The Dictionary does not exist yet, so sampling of a run is chosen through the environment */
+	if ( getenv( "STG_MEMORY_SAMPLE_INTERVAL" ) ) {
+		result->sampleInterval = strtoul( getenv( "STG_MEMORY_SAMPLE_INTERVAL" ), NULL, 0 );
+	}
+	if ( getenv( "STG_MEMORY_SAMPLE_THRESHOLD" ) ) {
+		result->sampleThreshold = strtoul( getenv( "STG_MEMORY_SAMPLE_THRESHOLD" ), NULL, 0 );
+	}
+	
 	return result;
 }
 
@@ -210,6 +233,22 @@ void Memory_Delete()
 	if( stgMemory->pointers != NULL){
 		BTree_Delete( stgMemory->pointers );
 	}
+	
+	/* Allocations freed from here on are no longer charged to a counter */
+	MemoryCounter_DeleteTable( stgMemory->counters );
+	stgMemory->counters = NULL;
+}
+
+void Memory_SetEnable( Bool enable )
+{
+	stgMemory->enable = enable;
+}
+
+void Memory_SetSampling( Index interval, SizeT threshold )
+{
+	stgMemory->sampleInterval = interval;
+	stgMemory->sampleThreshold = threshold;
+	stgMemory->sampleCount = 0;
 }
 
 
@@ -227,7 +266,7 @@ void* _Memory_Alloc_Func(
 	
 	result = _Memory_InternalMalloc( size );
 	
-	if ( stgMemory->enable ) {
+	if ( Memory_Track_Pointer( result, size, type, name ) ) {
 		memoryPointer = MemoryPointer_New( result, stgMemory->stamp++, type, name, fileName, funcName, lineNumber, MEMORY_OBJECT, size, size );
 		memoryPointer->length.oneD = 1;
 		
@@ -253,7 +292,7 @@ void* _Memory_Alloc_Array_Func(
 	size = Memory_Length_1DArray( itemSize, arrayLength );
 	result = _Memory_InternalMalloc( size );
 	
-	if ( stgMemory->enable ) {
+	if ( Memory_Track_Pointer( result, size, type, name ) ) {
 		memoryPointer = MemoryPointer_New( result, stgMemory->stamp++, type, name, fileName, funcName, lineNumber, MEMORY_1DARRAY, itemSize, size );
 		memoryPointer->length.oneD = arrayLength;
 		
@@ -287,7 +326,7 @@ void* _Memory_Alloc_2DArray_Func(
 	Memory_SetupPointer_2DArray( result, itemSize, xLength, yLength );
 	
 	#ifdef MEMORY_STATS
-		if ( stgMemory->enable ) {
+		if ( Memory_Track_Pointer( result, size, type, name ) ) {
 			memoryPointer = MemoryPointer_New( result, stgMemory->stamp++, type, name, fileName, funcName, lineNumber, MEMORY_2DARRAY, itemSize, size );
 			memoryPointer->length.twoD[0] = xLength;
 			memoryPointer->length.twoD[1] = yLength;
@@ -323,7 +362,7 @@ void* _Memory_Alloc_3DArray_Func(
 	Memory_SetupPointer_3DArray( result, itemSize, xLength, yLength, zLength );
 	
 	#ifdef MEMORY_STATS
-		if ( stgMemory->enable ) {
+		if ( Memory_Track_Pointer( result, size, type, name ) ) {
 			memoryPointer = MemoryPointer_New( result, stgMemory->stamp++, type, name, fileName, funcName, lineNumber, MEMORY_3DARRAY, itemSize, size );
 			memoryPointer->length.threeD[0] = xLength;
 			memoryPointer->length.threeD[1] = yLength;
@@ -409,7 +448,7 @@ void* _Memory_Alloc_4DArray_Func(
 	}
 	
 	#ifdef MEMORY_STATS
-		if ( stgMemory->enable ) {
+		if ( Memory_Track_Pointer( result, size, type, name ) ) {
 			memoryPointer = MemoryPointer_New( result, stgMemory->stamp++, type, name, fileName, funcName, lineNumber, MEMORY_3DARRAY, itemSize, size );
 			memoryPointer->length.fourD[0] = xLength;
 			memoryPointer->length.fourD[1] = yLength;
@@ -442,7 +481,7 @@ void* _Memory_Alloc_2DArrayAs1D_Func(
 	size = Memory_Length_2DAs1D( itemSize, xLength, yLength );
 	result = _Memory_InternalMalloc( size );
 	
-	if ( stgMemory->enable ) {
+	if ( Memory_Track_Pointer( result, size, type, name ) ) {
 		memoryPointer = MemoryPointer_New( result, stgMemory->stamp++, type, name, fileName, funcName, lineNumber, MEMORY_2DAS1D, itemSize, size );
 		memoryPointer->length.twoD[0] = xLength;
 		memoryPointer->length.twoD[1] = yLength;
@@ -471,7 +510,7 @@ void* _Memory_Alloc_3DArrayAs1D_Func(
 	size = Memory_Length_3DAs1D( itemSize, xLength, yLength, zLength );
 	result = _Memory_InternalMalloc( size );
 	
-	if ( stgMemory->enable ) {
+	if ( Memory_Track_Pointer( result, size, type, name ) ) {
 		memoryPointer = MemoryPointer_New( result, stgMemory->stamp++, type, name, fileName, funcName, lineNumber, MEMORY_3DAS1D, itemSize, size );
 		memoryPointer->length.threeD[0] = xLength;
 		memoryPointer->length.threeD[1] = yLength;
@@ -504,7 +543,7 @@ void* _Memory_Alloc_4DArrayAs1D_Func(
 	result = _Memory_InternalMalloc( size );
 	
 	
-	if ( stgMemory->enable ) {
+	if ( Memory_Track_Pointer( result, size, type, name ) ) {
 		memoryPointer = MemoryPointer_New( result, stgMemory->stamp++, type, name, fileName, funcName, lineNumber, MEMORY_4DAS1D, itemSize, size );
 		memoryPointer->length.fourD[0] = xLength;
 		memoryPointer->length.fourD[1] = yLength;
@@ -567,12 +606,12 @@ void* _Memory_Alloc_2DComplex_Func(
 	}
 	
 	#ifdef MEMORY_STATS
-	if ( stgMemory->enable ) {
+	if ( Memory_Track_Pointer( result, size, type, name ) ) {
 		memoryPointer = MemoryPointer_New( result, stgMemory->stamp++, type, name, fileName, funcName, lineNumber, MEMORY_2DCOMPLEX, itemSize, size );
 		memoryPointer->length.xyz.x = xLength;
 		memoryPointer->length.xyz.y = (Index*) malloc( sizeof(Index) * xLength );
 		if ( memoryPointer->length.xyz.y == NULL ) {
-			Memory_OutOfMemoryError( sizeof(Index) * length );
+			Memory_OutOfMemoryError( sizeof(Index) * xLength );
 		}
 		
 		for ( i = 0; i < xLength; ++i )
@@ -604,7 +643,7 @@ Index** _Memory_Alloc_3DSetup_Func(
 		"Index", "MEMORY_SETUP", fileName, funcName, lineNumber );
 	
 	#ifdef MEMORY_STATS
-	if ( stgMemory->enable ) {
+	if ( stgMemory->enable && result && Memory_TrackedGet( result ) ) {
 		memPtr = Memory_Find_Pointer ( result );
 		assert( memPtr );
 		memPtr->allocType = MEMORY_3DSETUP;
@@ -669,7 +708,7 @@ void* _Memory_Alloc_3DComplex_Func(
 	
 	
 	#ifdef MEMORY_STATS
-	if ( stgMemory->enable ) {
+	if ( Memory_Track_Pointer( result, size, type, name ) ) {
 		memoryPointer = MemoryPointer_New( result, stgMemory->stamp++, type, name, fileName, funcName, lineNumber, MEMORY_3DCOMPLEX, itemSize, size );
 		memoryPointer->length.xyz.x = xLength;
 		memoryPointer->length.xyz.y = (Index*) malloc( sizeof(Index) * xLength );
@@ -731,7 +770,7 @@ void* _Memory_Realloc_Func(
 	
 	Pointer result = NULL;
 	
-	memoryPointer = Memory_Find_Pointer( ptr );
+	memoryPointer = Memory_Find_Tracked_Pointer( ptr );
 	result = _Memory_InternalRealloc( ptr, newSize );
 	
 	if ( stgMemory->enable ) {
@@ -773,7 +812,7 @@ void* _Memory_Realloc_Func(
 			}
 			/* Any other pointer type is invalid use of function */
 		}
-		else
+		else if ( Memory_Track_Pointer( result, newSize, type, Name_Invalid ) )
 		{
 			memoryPointer = MemoryPointer_New( result, stgMemory->stamp++, type, Name_Invalid,
 				fileName, funcName, lineNumber, MEMORY_OBJECT, newSize, newSize );
@@ -802,7 +841,7 @@ void* _Memory_Realloc_Array_Func(
 	
 	Pointer result = NULL;
 	
-	memoryPointer = Memory_Find_Pointer( ptr );
+	memoryPointer = Memory_Find_Tracked_Pointer( ptr );
 	
 	newSize = itemSize * newLength;
 	result = _Memory_InternalRealloc( ptr, newSize );
@@ -858,7 +897,7 @@ void* _Memory_Realloc_Array_Func(
 			}
 			/* Any other pointer type is invalid use of function */
 		}
-		else
+		else if ( Memory_Track_Pointer( result, newSize, type, Name_Invalid ) )
 		{
 			memoryPointer = MemoryPointer_New( result, stgMemory->stamp++, type, Name_Invalid,
 				fileName, funcName, lineNumber, MEMORY_1DARRAY, itemSize, newSize );
@@ -945,7 +984,7 @@ void* _Memory_Realloc_2DArray_Func(
 			}
 			/* Any other pointer type is invalid use of function */
 		}
-		else
+		else if ( Memory_Track_Pointer( result, newSize, type, Name_Invalid ) )
 		{
 			memoryPointer = MemoryPointer_New( result, stgMemory->stamp++, type, Name_Invalid,
 				fileName, funcName, lineNumber, MEMORY_2DARRAY, itemSize, newSize );
@@ -1041,7 +1080,7 @@ void* _Memory_Realloc_3DArray_Func(
 			}
 			/* Any other pointer type is invalid use of function */
 		}
-		else
+		else if ( Memory_Track_Pointer( result, newSize, type, Name_Invalid ) )
 		{
 			memoryPointer = MemoryPointer_New( result, stgMemory->stamp++, type, Name_Invalid,
 				fileName, funcName, lineNumber, MEMORY_3DARRAY, itemSize, newSize );
@@ -1119,7 +1158,7 @@ void* _Memory_Realloc_2DArrayAs1D_Func(
 			}
 			/* Any other pointer type is invalid use of function */
 		}
-		else
+		else if ( Memory_Track_Pointer( result, newSize, type, Name_Invalid ) )
 		{
 			memoryPointer = MemoryPointer_New( result, stgMemory->stamp++, type, Name_Invalid,
 				fileName, funcName, lineNumber, MEMORY_2DAS1D, itemSize, newSize );
@@ -1199,7 +1238,7 @@ void* _Memory_Realloc_3DArrayAs1D_Func(
 			}
 			/* Any other pointer type is invalid use of function */
 		}
-		else
+		else if ( Memory_Track_Pointer( result, newSize, type, Name_Invalid ) )
 		{
 			memoryPointer = MemoryPointer_New( result, stgMemory->stamp++, type, Name_Invalid,
 				fileName, funcName, lineNumber, MEMORY_3DAS1D, itemSize, newSize );
@@ -1220,7 +1259,7 @@ void _Memory_Free_Func( void* ptr )
 {
 	MemoryPointer* memoryPointer = NULL;
 	
-	memoryPointer = Memory_Find_Pointer( ptr );
+	memoryPointer = Memory_Find_Tracked_Pointer( ptr );
 	
 	if ( memoryPointer )
 	{
@@ -1321,6 +1360,19 @@ void Memory_Print_Summary()
 	Stream_UnIndent( stgMemory->infoStream );
 }
 
+void Memory_PrintHighWater()
+{
+	#ifdef MEMORY_STATS
+		Journal_Printf( stgMemory->infoStream, "Memory high-water marks (sample interval %u, sample threshold %lu bytes):\n",
+			stgMemory->sampleInterval, stgMemory->sampleThreshold );
+		Stream_Indent( stgMemory->infoStream );
+		MemoryCounter_PrintTable( stgMemory->counters );
+		Stream_UnIndent( stgMemory->infoStream );
+	#else
+		Journal_Printf( stgMemory->infoStream, "Memory high-water marks need the Memory module compiled with MEMORY_STATS\n" );
+	#endif
+}
+
 void Memory_Print()
 {
 	Memory_Print_Summary();
@@ -1540,7 +1592,8 @@ Bool Memory_IsAllocated( void* ptr ) {
 
 	#ifdef MEMORY_STATS
 		if ( stgMemory->enable ) {
-			return Memory_Find_Pointer( ptr ) != NULL;
+			/* Allocations left out by sampling cannot be told apart from freed ones */
+			return Memory_Find_Pointer( ptr ) != NULL || stgMemory->sampleInterval != 1;
 		}
 		else {
 			#ifdef DEBUG
@@ -1594,6 +1647,47 @@ void Memory_Free_Pointer( MemoryPointer* memoryPointer )
 	MemoryField_Update( memoryPointer->func, -(memoryPointer->totalSize) );
 }
 
+MemoryPointer* Memory_Find_Tracked_Pointer( Pointer ptr )
+{
+	#ifdef MEMORY_STATS
+		if ( ptr == NULL || !Memory_TrackedGet( ptr ) ) {
+			return NULL;
+		}
+	#endif
+	
+	return Memory_Find_Pointer( ptr );
+}
+
+Bool Memory_Track_Pointer( Pointer ptr, SizeT size, Type type, Name name )
+{
+	Bool tracked;
+	
+	if ( !stgMemory->enable || ptr == NULL ) {
+		return False;
+	}
+	
+	if ( stgMemory->sampleInterval == 1 || ( stgMemory->sampleThreshold && size >= stgMemory->sampleThreshold ) ) {
+		tracked = True;
+	}
+	else if ( stgMemory->sampleInterval == 0 ) {
+		tracked = False;
+	}
+	else {
+		tracked = ( ++stgMemory->sampleCount % stgMemory->sampleInterval ) == 0;
+	}
+	
+	#ifdef MEMORY_STATS
+		/* A reallocation keeps the counter it was first charged to; _Memory_InternalRealloc() moves the bytes */
+		if ( stgMemory->counters && Memory_CounterGet( ptr ) == NULL ) {
+			Memory_CounterGet( ptr ) = MemoryCounter_Register( stgMemory->counters, type, name );
+			MemoryCounter_Alloc( Memory_CounterGet( ptr ), size );
+		}
+		Memory_TrackedGet( ptr ) = tracked;
+	#endif
+	
+	return tracked;
+}
+
 MemoryPointer* Memory_Find_Pointer( Pointer ptr )
 {
 	BTreeNode *node = NULL;
@@ -1769,6 +1863,10 @@ void* _Memory_InternalMalloc( SizeT size ) {
 	
 	Memory_CountGet( data ) = 0;
 	Memory_SizeGet( data ) = size;
+	#ifdef MEMORY_STATS
+		Memory_CounterGet( data ) = NULL;
+		Memory_TrackedGet( data ) = False;
+	#endif
 
 	return data;
 #endif
@@ -1803,6 +1901,11 @@ void* _Memory_InternalRealloc( void* ptr, SizeT size ) {
 	}
 	data = (void*)((ArithPointer)result + sizeof( MemoryTag ));
 
+	#ifdef MEMORY_STATS
+		if ( stgMemory->counters && Memory_CounterGet( data ) ) {
+			MemoryCounter_Update( Memory_CounterGet( data ), (long)size - (long)Memory_SizeGet( data ) );
+		}
+	#endif
 	Memory_CountGet( data ) = count;
 	Memory_SizeGet( data )  = size;
 	stgMemory->stgCurrentMemory += size;
@@ -1818,6 +1921,11 @@ void _Memory_InternalFree( void* ptr ) {
 	free( ptr );
 #else
 	stgMemory->stgCurrentMemory -= Memory_SizeGet( ptr );
+	#ifdef MEMORY_STATS
+		if ( stgMemory->counters && Memory_CounterGet( ptr ) ) {
+			MemoryCounter_Update( Memory_CounterGet( ptr ), -(long)Memory_SizeGet( ptr ) );
+		}
+	#endif
 	free( (void*)((ArithPointer)ptr - sizeof( MemoryTag)) );
 #endif
 }
@@ -93,7 +93,11 @@
 		void*			errorStream;	/**< A Stream object where errors from by the Memory module is sent. */ \
 		void*			debugStream;	/**< A Stream object where debuging info from the Memory module is send.*/ \
 		unsigned long stgPeakMemory; \
-		unsigned long stgCurrentMemory;
+		unsigned long stgCurrentMemory; \
+		Index			sampleInterval;	/**< Every sampleInterval'th allocation gets a MemoryPointer (1: all, 0: none). */ \
+		SizeT			sampleThreshold;/**< Allocations of this many bytes or more always get a MemoryPointer (0: off). */ \
+		MemoryOpStamp		sampleCount;	/**< Allocations considered for sampling so far. */ \
+		MemoryCounter*		counters;	/**< Byte counters per type and type/name, of every allocation. */
 	struct Memory { __Memory };
 
 
@@ -105,6 +109,11 @@
 
 	/** Enables/Disables Memory module for statistics recording. */
 	void Memory_SetEnable( Bool enable );
+	
+	/** Records a MemoryPointer for only every interval'th allocation (1 records all, 0 none) and for every allocation
+	 ** of threshold bytes or more (0 for no threshold). The per type/name byte counters still see every allocation.
+	 ** The environment variables STG_MEMORY_SAMPLE_INTERVAL and STG_MEMORY_SAMPLE_THRESHOLD set the initial values. */
+	void Memory_SetSampling( Index interval, SizeT threshold );
 
 	/* See implementations for _Memory_InternalMalloc and _Memory_InternalFree at the bottom of Memory.c */
 	/* Replacement for malloc(), to insert MemoryTag in front of every alloc */
@@ -443,6 +452,10 @@
 	/** Prints a summary by types and names in the system. */
 	void Memory_Print();
 	
+	/** Prints the peak and current bytes of every type and, beneath it, of each of its names. Unlike Memory_Print_Summary(),
+	 ** this covers the allocations left out by sampling (see Memory_SetSampling()). Needs MEMORY_STATS. */
+	void Memory_PrintHighWater();
+	
 	/** Displays allocations which are currently still allocated. */
 	void Memory_Print_Leak();
 	
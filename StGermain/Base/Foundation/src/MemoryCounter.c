@@ -0,0 +1,264 @@
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+**
+** Copyright (C), 2003, Victorian Partnership for Advanced Computing (VPAC) Ltd, 110 Victoria Street, Melbourne, 3053, Australia.
+**
+** Authors:
+**	Stevan M. Quenette, Senior Software Engineer, VPAC. (steve@vpac.org)
+**	Patrick D. Sunter, Software Engineer, VPAC. (pds@vpac.org)
+**	Luke J. Hodkinson, Computational Engineer, VPAC. (lhodkins@vpac.org)
+**	Siew-Ching Tan, Software Engineer, VPAC. (siew@vpac.org)
+**	Alan H. Lo, Computational Engineer, VPAC. (alan@vpac.org)
+**	Raquibul Hassan, Computational Engineer, VPAC. (raq@vpac.org)
+**
+**  This library is free software; you can redistribute it and/or
+**  modify it under the terms of the GNU Lesser General Public
+**  License as published by the Free Software Foundation; either
+**  version 2.1 of the License, or (at your option) any later version.
+**
+**  This library is distributed in the hope that it will be useful,
+**  but WITHOUT ANY WARRANTY; without even the implied warranty of
+**  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+**  Lesser General Public License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License along with this library; if not, write to the Free Software
+**  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+**
+** $Id: MemoryCounter.c 3803 2006-09-27 03:17:12Z LukeHodkinson $
+**
+**~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#include "types.h"
+#include "forwardDecl.h"
+
+#include "MemoryCounter.h"
+#include "Memory.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#ifdef __GNUC__
+	#define MemoryCounter_AtomicAdd( var, value ) \
+		__sync_add_and_fetch( &(var), (value) )
+	#define MemoryCounter_AtomicCAS( var, oldValue, newValue ) \
+		__sync_bool_compare_and_swap( &(var), (oldValue), (newValue) )
+	#define MemoryCounter_Barrier() \
+		__sync_synchronize()
+#else
+	/* No atomic operations available: correct for a single thread only, like the rest of the Memory module. */
+	#define MemoryCounter_AtomicAdd( var, value ) \
+		( (var) += (value) )
+	#define MemoryCounter_AtomicCAS( var, oldValue, newValue ) \
+		( (var) == (oldValue) ? ( (var) = (newValue), True ) : False )
+	#define MemoryCounter_Barrier()
+#endif
+
+char MemoryCounter_TypeTotal[] = "(all)";
+
+static char* _MemoryCounter_CopyString( const char* value ) {
+	char* result;
+	
+	if ( value == NULL || value == MemoryCounter_TypeTotal ) {
+		return (char*)value;
+	}
+	result = (char*) malloc( strlen( value ) + 1 );
+	assert( result );
+	strcpy( result, value );
+	return result;
+}
+
+static Bool _MemoryCounter_Equal( const char* a, const char* b ) {
+	if ( a == b ) {
+		return True;
+	}
+	if ( a == NULL || b == NULL || a == MemoryCounter_TypeTotal || b == MemoryCounter_TypeTotal ) {
+		return False;
+	}
+	return strcmp( a, b ) == 0;
+}
+
+static unsigned long _MemoryCounter_Hash( const char* type, const char* name ) {
+	unsigned long hash = 5381;
+	const char* c;
+	
+	for ( c = type; c && *c; c++ ) {
+		hash = hash * 33 + (unsigned char)*c;
+	}
+	hash = hash * 33 + '/';
+	if ( name == MemoryCounter_TypeTotal ) {
+		hash = hash * 33 + 1;
+	}
+	else {
+		for ( c = name; c && *c; c++ ) {
+			hash = hash * 33 + (unsigned char)*c;
+		}
+	}
+	return hash;
+}
+
+static void _MemoryCounter_RaisePeak( MemoryCounter* counter, long current ) {
+	long peak;
+	
+	while ( current > ( peak = counter->peakAllocation ) ) {
+		if ( MemoryCounter_AtomicCAS( counter->peakAllocation, peak, current ) ) {
+			break;
+		}
+	}
+}
+
+MemoryCounter* MemoryCounter_NewTable() {
+	/* One extra slot at the end is the overflow counter */
+	MemoryCounter* table = (MemoryCounter*) calloc( MEMORYCOUNTER_TABLE_SIZE + 1, sizeof(MemoryCounter) );
+	
+	assert( table );
+	table[MEMORYCOUNTER_TABLE_SIZE].type = "(overflow)";
+	table[MEMORYCOUNTER_TABLE_SIZE].name = MemoryCounter_TypeTotal;
+	table[MEMORYCOUNTER_TABLE_SIZE].ready = True;
+	
+	return table;
+}
+
+void MemoryCounter_DeleteTable( MemoryCounter* table ) {
+	Index i;
+	
+	if ( table == NULL ) {
+		return;
+	}
+	for ( i = 0; i < MEMORYCOUNTER_TABLE_SIZE; i++ ) {
+		if ( table[i].type ) {
+			free( table[i].type );
+			if ( table[i].name != MemoryCounter_TypeTotal ) {
+				free( table[i].name );
+			}
+		}
+	}
+	free( table );
+}
+
+MemoryCounter* MemoryCounter_Register( MemoryCounter* table, const char* type, const char* name ) {
+	unsigned long	hash = _MemoryCounter_Hash( type, name );
+	Index		probe;
+	char*		typeCopy = NULL;
+	
+	for ( probe = 0; probe < MEMORYCOUNTER_TABLE_SIZE; probe++ ) {
+		MemoryCounter* counter = &table[( hash + probe ) & ( MEMORYCOUNTER_TABLE_SIZE - 1 )];
+		
+		if ( counter->type == NULL ) {
+			if ( typeCopy == NULL ) {
+				typeCopy = _MemoryCounter_CopyString( type ? type : "(null)" );
+			}
+			if ( MemoryCounter_AtomicCAS( counter->type, NULL, typeCopy ) ) {
+				counter->name = _MemoryCounter_CopyString( name );
+				counter->parent = ( name == MemoryCounter_TypeTotal ) ? 
+					NULL : MemoryCounter_Register( table, type, MemoryCounter_TypeTotal );
+				MemoryCounter_Barrier();
+				counter->ready = True;
+				return counter;
+			}
+		}
+		
+		/* Another thread may still be filling in a slot it has just claimed */
+		while ( !counter->ready ) {
+			MemoryCounter_Barrier();
+		}
+		if ( _MemoryCounter_Equal( counter->name, name ) && _MemoryCounter_Equal( counter->type, type ? type : "(null)" ) ) {
+			if ( typeCopy ) {
+				free( typeCopy );
+			}
+			return counter;
+		}
+	}
+	
+	if ( typeCopy ) {
+		free( typeCopy );
+	}
+	return &table[MEMORYCOUNTER_TABLE_SIZE];
+}
+
+void MemoryCounter_Update( MemoryCounter* counter, long bytes ) {
+	for ( ; counter; counter = counter->parent ) {
+		long current = MemoryCounter_AtomicAdd( counter->currentAllocation, bytes );
+		
+		if ( bytes > 0 ) {
+			_MemoryCounter_RaisePeak( counter, current );
+		}
+	}
+}
+
+void MemoryCounter_Alloc( MemoryCounter* counter, SizeT bytes ) {
+	MemoryCounter* c;
+	
+	for ( c = counter; c; c = c->parent ) {
+		MemoryCounter_AtomicAdd( c->allocCount, 1 );
+	}
+	MemoryCounter_Update( counter, (long)bytes );
+}
+
+static int _MemoryCounter_ComparePeak( const void* a, const void* b ) {
+	long peakA = (*(MemoryCounter**)a)->peakAllocation;
+	long peakB = (*(MemoryCounter**)b)->peakAllocation;
+	
+	if ( peakA != peakB ) {
+		return peakA < peakB ? 1 : -1;
+	}
+	return strcmp( (*(MemoryCounter**)a)->type, (*(MemoryCounter**)b)->type );
+}
+
+static int _MemoryCounter_ComparePeakThenName( const void* a, const void* b ) {
+	const char* nameA = (*(MemoryCounter**)a)->name;
+	const char* nameB = (*(MemoryCounter**)b)->name;
+	long peakA = (*(MemoryCounter**)a)->peakAllocation;
+	long peakB = (*(MemoryCounter**)b)->peakAllocation;
+	
+	if ( peakA != peakB ) {
+		return peakA < peakB ? 1 : -1;
+	}
+	return strcmp( nameA ? nameA : "", nameB ? nameB : "" );
+}
+
+static void _MemoryCounter_PrintRow( MemoryCounter* counter, const char* label, const char* value ) {
+	Journal_Printf( stgMemory->infoStream, "%s: %-40s peak %12ld bytes, current %12ld bytes, %10lu allocations\n",
+		label, value, counter->peakAllocation, counter->currentAllocation, counter->allocCount );
+}
+
+void MemoryCounter_PrintTable( MemoryCounter* table ) {
+	MemoryCounter**	types;
+	MemoryCounter**	names;
+	Index		typeCount = 0;
+	Index		nameCount;
+	Index		i, j;
+	
+	types = (MemoryCounter**) malloc( sizeof(MemoryCounter*) * ( MEMORYCOUNTER_TABLE_SIZE + 1 ) );
+	names = (MemoryCounter**) malloc( sizeof(MemoryCounter*) * MEMORYCOUNTER_TABLE_SIZE );
+	assert( types && names );
+	
+	for ( i = 0; i <= MEMORYCOUNTER_TABLE_SIZE; i++ ) {
+		if ( table[i].ready && table[i].parent == NULL && table[i].allocCount ) {
+			types[typeCount++] = &table[i];
+		}
+	}
+	qsort( types, typeCount, sizeof(MemoryCounter*), _MemoryCounter_ComparePeak );
+	
+	for ( i = 0; i < typeCount; i++ ) {
+		_MemoryCounter_PrintRow( types[i], "Type", types[i]->type );
+		
+		nameCount = 0;
+		for ( j = 0; j < MEMORYCOUNTER_TABLE_SIZE; j++ ) {
+			if ( table[j].ready && table[j].parent == types[i] ) {
+				names[nameCount++] = &table[j];
+			}
+		}
+		qsort( names, nameCount, sizeof(MemoryCounter*), _MemoryCounter_ComparePeakThenName );
+		
+		Stream_Indent( stgMemory->infoStream );
+		for ( j = 0; j < nameCount; j++ ) {
+			_MemoryCounter_PrintRow( names[j], "Name", names[j]->name ? names[j]->name : "(unnamed)" );
+		}
+		Stream_UnIndent( stgMemory->infoStream );
+	}
+	
+	free( names );
+	free( types );
+}
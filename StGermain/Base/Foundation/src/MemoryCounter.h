@@ -0,0 +1,86 @@
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+**
+** Copyright (C), 2003, Victorian Partnership for Advanced Computing (VPAC) Ltd, 110 Victoria Street, Melbourne, 3053 Australia.
+**
+** Authors:
+**	Stevan M. Quenette, Senior Software Engineer, VPAC. (steve@vpac.org)
+**	Patrick D. Sunter, Software Engineer, VPAC. (pds@vpac.org)
+**	Luke J. Hodkinson, Computational Engineer, VPAC. (lhodkins@vpac.org)
+**	Siew-Ching Tan, Software Engineer, VPAC. (siew@vpac.org)
+**	Alan H. Lo, Computational Engineer, VPAC. (alan@vpac.org)
+**	Raquibul Hassan, Computational Engineer, VPAC. (raq@vpac.org)
+**
+**  This library is free software; you can redistribute it and/or
+**  modify it under the terms of the GNU Lesser General Public
+**  License as published by the Free Software Foundation; either
+**  version 2.1 of the License, or (at your option) any later version.
+**
+**  This library is distributed in the hope that it will be useful,
+**  but WITHOUT ANY WARRANTY; without even the implied warranty of
+**  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+**  Lesser General Public License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License along with this library; if not, write to the Free Software
+**  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+**~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+/** \file
+** <b>Role:</b>
+**	Running byte counters of the allocations made under each type and type/name pair, kept for every allocation
+**	whether or not the Memory module samples it into a MemoryPointer.
+**
+** <b>Assumptions</b>
+**	Memory Module is enabled and compiled with MEMORY_STATS.
+**
+** <b>Comments</b>
+**	The counters live in a fixed size open-addressed table, so registering and updating a counter never allocates
+**	table space or takes a lock: slots are claimed with a compare-and-swap and the byte counts are updated with
+**	atomic adds. When the table is full, further type/name pairs are charged to a single overflow counter.
+**
+** <b>Description</b>
+**	Each type/name counter has a parent counter that accumulates the whole type, so the peak of a type is the true
+**	peak of its sum rather than the sum of the peaks of its names.
+**
+** $Id: MemoryCounter.h 3462 2006-02-19 06:53:24Z WalterLandry $
+**
+**/
+
+#ifndef __Base_Foundation_MemoryCounter_h__
+#define __Base_Foundation_MemoryCounter_h__
+
+	/** Number of counters in a table. Must be a power of two. */
+	#define MEMORYCOUNTER_TABLE_SIZE	4096
+
+	/** \def __MemoryCounter See MemoryCounter. */
+	#define __MemoryCounter \
+		char* volatile			type;		/**< The type counted, NULL if the slot is free. */ \
+		char*				name;		/**< The name counted, MemoryCounter_TypeTotal for type counters. */ \
+		MemoryCounter*			parent;		/**< The counter of the whole type, NULL for type counters. */ \
+		volatile long			currentAllocation; \
+		volatile long			peakAllocation; \
+		volatile unsigned long		allocCount; \
+		volatile Bool			ready;		/**< Set once type, name and parent are filled in. */
+	struct MemoryCounter { __MemoryCounter };
+
+	/** Special name of the counter which accumulates a whole type. */
+	extern char MemoryCounter_TypeTotal[];
+
+	/** Creates an empty table of counters. */
+	MemoryCounter* MemoryCounter_NewTable();
+
+	/** Deallocates a table of counters. */
+	void MemoryCounter_DeleteTable( MemoryCounter* table );
+
+	/** Returns the counter of the given type and name, registering it on first use. */
+	MemoryCounter* MemoryCounter_Register( MemoryCounter* table, const char* type, const char* name );
+
+	/** Adds bytes (which may be negative) to a counter and to its type, raising their peaks as needed. */
+	void MemoryCounter_Update( MemoryCounter* counter, long bytes );
+
+	/** Records a new allocation of the given size against a counter and its type. */
+	void MemoryCounter_Alloc( MemoryCounter* counter, SizeT bytes );
+
+	/** Displays the peak, current and allocation count of every type and, beneath each, of its names, largest peak first. */
+	void MemoryCounter_PrintTable( MemoryCounter* table );
+
+#endif /* __Base_Foundation_MemoryCounter_h__ */
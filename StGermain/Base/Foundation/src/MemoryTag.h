@@ -46,9 +46,17 @@
 	 * NOTE: Keep this guy aligned to 8-byte words to avoid misalign problems
 	 *       (not doing as a macro because it may not resolve optimally and slow things down)
 	 */
-	#define __MemoryTag\
-		unsigned long	instCount;		/**< Instance counter. */  \
-		unsigned long   size;
+	#ifdef MEMORY_STATS
+		#define __MemoryTag\
+			unsigned long	instCount;		/**< Instance counter. */  \
+			unsigned long   size; \
+			struct MemoryCounter*	counter;	/**< The type/name counter charged with this allocation, if any. */ \
+			unsigned long	tracked;		/**< Whether the allocation was sampled into a MemoryPointer. */
+	#else
+		#define __MemoryTag\
+			unsigned long	instCount;		/**< Instance counter. */  \
+			unsigned long   size;
+	#endif
 
 	struct MemoryTag { __MemoryTag };
 
@@ -61,5 +69,11 @@
 
 	#define Memory_SizeGet( ptr ) ((MemoryTag*)( (ArithPointer)(ptr) - sizeof(MemoryTag) ))->size
 
+	#ifdef MEMORY_STATS
+		#define Memory_CounterGet( ptr ) ((MemoryTag*)( (ArithPointer)(ptr) - sizeof(MemoryTag) ))->counter
+
+		#define Memory_TrackedGet( ptr ) ((MemoryTag*)( (ArithPointer)(ptr) - sizeof(MemoryTag) ))->tracked
+	#endif
+
 
 #endif
@@ -66,6 +66,7 @@
 	/* Memory module classes */
 	typedef struct MemoryTag		MemoryTag;
 	typedef struct MemoryField		MemoryField;
+	typedef struct MemoryCounter		MemoryCounter;
 	typedef struct MemoryPointer		MemoryPointer;
 	typedef struct MemoryReport		MemoryReport;
 	typedef struct Memory			Memory;
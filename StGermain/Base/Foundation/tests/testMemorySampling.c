@@ -0,0 +1,157 @@
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+**
+** Copyright (C), 2003, Victorian Partnership for Advanced Computing (VPAC) Ltd, 110 Victoria Street, Melbourne, 3053, Australia.
+**
+** Authors:
+**	Stevan M. Quenette, Senior Software Engineer, VPAC. (steve@vpac.org)
+**	Patrick D. Sunter, Software Engineer, VPAC. (pds@vpac.org)
+**	Luke J. Hodkinson, Computational Engineer, VPAC. (lhodkins@vpac.org)
+**	Siew-Ching Tan, Software Engineer, VPAC. (siew@vpac.org)
+**	Alan H. Lo, Computational Engineer, VPAC. (alan@vpac.org)
+**	Raquibul Hassan, Computational Engineer, VPAC. (raq@vpac.org)
+**
+**  This library is free software; you can redistribute it and/or
+**  modify it under the terms of the GNU Lesser General Public
+**  License as published by the Free Software Foundation; either
+**  version 2.1 of the License, or (at your option) any later version.
+**
+**  This library is distributed in the hope that it will be useful,
+**  but WITHOUT ANY WARRANTY; without even the implied warranty of
+**  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+**  Lesser General Public License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License along with this library; if not, write to the Free Software
+**  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+**
+** Role:
+**	Tests accuracy of memory statistics generation.
+**
+**
+**~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#include "Base/Foundation/Foundation.h"
+#include "JournalWrappers.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <mpi.h>
+
+struct StructA
+{
+	int x;
+	float y;
+	char z;
+};
+typedef struct StructA StructA;
+
+struct StructB
+{
+	double x;
+};
+typedef struct StructB StructB;
+
+#define OBJECT_COUNT 20
+
+void PrintCounter( Stream* stream, const char* type, const char* name ) {
+	MemoryCounter* counter = MemoryCounter_Register( stgMemory->counters, type, name );
+
+	Journal_Printf( stream, "%s/%s: current %ld, peak %ld, allocations %lu\n", type, 
+		name == MemoryCounter_TypeTotal ? "(all)" : name,
+		counter->currentAllocation, counter->peakAllocation, counter->allocCount );
+}
+
+int main( int argc, char* argv[] )
+{	
+	MPI_Comm CommWorld;
+	int rank;
+	int numProcessors;
+	int procToWatch;
+	
+	Stream* stream;
+
+	StructA*	objects[OBJECT_COUNT];
+	StructB*	bigArray;
+	StructB*	array;
+	Index		tracked;
+	Index		i;
+	
+	/* Initialise MPI, get world info */
+	MPI_Init( &argc, &argv );
+	MPI_Comm_dup( MPI_COMM_WORLD, &CommWorld );
+	MPI_Comm_size( CommWorld, &numProcessors );
+	MPI_Comm_rank( CommWorld, &rank );
+	
+	BaseFoundation_Init( &argc, &argv );
+	
+	if( argc >= 2 ) {
+		procToWatch = atoi( argv[1] );
+	}
+	else {
+		procToWatch = 0;
+	}
+	
+	stream = Journal_Register( "info", "myStream" );
+
+	if( rank == procToWatch ) {
+		/* Full tracking: every allocation gets a MemoryPointer */
+		tracked = 0;
+		for ( i = 0; i < OBJECT_COUNT; i++ ) {
+			objects[i] = Memory_Alloc( StructA, "Full" );
+			tracked += Memory_TrackedGet( objects[i] ) ? 1 : 0;
+		}
+		Journal_Printf( stream, "Full: %u of %u allocations tracked\n", tracked, OBJECT_COUNT );
+		for ( i = 0; i < OBJECT_COUNT; i++ ) {
+			Memory_Free( objects[i] );
+		}
+		PrintCounter( stream, "StructA", "Full" );
+
+		/* Sampling: only every 4th allocation, plus those of 1000 bytes or more */
+		Memory_SetSampling( 4, 1000 );
+		tracked = 0;
+		for ( i = 0; i < OBJECT_COUNT; i++ ) {
+			objects[i] = Memory_Alloc( StructA, "Sampled" );
+			tracked += Memory_TrackedGet( objects[i] ) ? 1 : 0;
+		}
+		Journal_Printf( stream, "Sampled: %u of %u allocations tracked\n", tracked, OBJECT_COUNT );
+		bigArray = Memory_Alloc_Array( StructB, 200, "Big" );
+		Journal_Printf( stream, "Allocation above the threshold tracked: %s\n", Memory_TrackedGet( bigArray ) ? "True" : "False" );
+		
+		/* The counters see every allocation, sampled or not */
+		PrintCounter( stream, "StructA", "Sampled" );
+		for ( i = 0; i < OBJECT_COUNT / 2; i++ ) {
+			Memory_Free( objects[i] );
+		}
+		PrintCounter( stream, "StructA", "Sampled" );
+		PrintCounter( stream, "StructA", MemoryCounter_TypeTotal );
+
+		/* Reallocations move their bytes within the counter they were first charged to */
+		array = Memory_Alloc_Array( StructB, 10, "Grown" );
+		array = Memory_Realloc_Array( array, StructB, 100 );
+		PrintCounter( stream, "StructB", "Grown" );
+		array = Memory_Realloc_Array( array, StructB, 5 );
+		PrintCounter( stream, "StructB", "Grown" );
+		Memory_Free( array );
+		Memory_Free( bigArray );
+		PrintCounter( stream, "StructB", MemoryCounter_TypeTotal );
+
+		/* Nothing sampled: the counters still work */
+		Memory_SetSampling( 0, 0 );
+		for ( i = OBJECT_COUNT / 2; i < OBJECT_COUNT; i++ ) {
+			Memory_Free( objects[i] );
+		}
+		objects[0] = Memory_Alloc( StructA, "Sampled" );
+		Journal_Printf( stream, "Unsampled allocation tracked: %s\n", Memory_TrackedGet( objects[0] ) ? "True" : "False" );
+		Memory_Free( objects[0] );
+		PrintCounter( stream, "StructA", "Sampled" );
+		
+		Memory_SetSampling( 1, 0 );
+		Memory_PrintHighWater();
+	}
+	
+	BaseFoundation_Finalise();
+	
+	MPI_Finalize();
+	
+	return 0;
+}
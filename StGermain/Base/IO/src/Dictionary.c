@@ -53,6 +53,14 @@ static const int DEFAULT_DELTA = 5;
 static const int STRUCT_INIT_SIZE = 2;
 static const int STRUCT_DELTA = 2;
 
+/* Key lookups scan the entries until a dictionary holds this many, and use the hash index after; most struct
+   dictionaries stay below it and never allocate an index. */
+static const Dictionary_Index HASH_MIN_COUNT = 8;
+static const Dictionary_Index HASH_INIT_SIZE = 16;
+
+static void _Dictionary_HashSync( Dictionary* self );
+static Dictionary_Index _Dictionary_FindIndex( Dictionary* self, Dictionary_Entry_Key key );
+
 Dictionary* Dictionary_New( void ) {
 	return _Dictionary_New( sizeof(Dictionary), Dictionary_Type, _Dictionary_Delete, _Dictionary_Print, NULL, 
 		_Dictionary_Add, _Dictionary_AddWithSource, _Dictionary_Set, _Dictionary_SetWithSource, _Dictionary_Get, _Dictionary_GetSource );
@@ -120,6 +128,9 @@ void _Dictionary_Init( Dictionary* self ) {
 	self->delta = DEFAULT_DELTA;
 	self->count = 0;
 	self->entryPtr = Memory_Alloc_Array( Dictionary_Entry*, self->size, "Dictionary->entryPtr" );
+	self->hashSize = 0;
+	self->hashCount = 0;
+	self->hashTable = NULL;
 
 	self->debugStream = Journal_Register( Debug_Type, "DictionaryWarning" );
 }
@@ -133,6 +144,9 @@ void _Dictionary_Delete( void* dictionary ) {
 		Dictionary_Entry_Delete( self->entryPtr[index] );
 	}
 	Memory_Free( self->entryPtr );
+	if( self->hashTable ) {
+		Memory_Free( self->hashTable );
+	}
 	
 	/* Stg_Class_Delete parent */
 	_Stg_Class_Delete( self );
@@ -212,12 +226,10 @@ Dictionary_Entry_Value* Dictionary_GetByIndex( void* dictionary, Dictionary_Inde
 
 Dictionary_Entry* Dictionary_GetEntry( void* dictionary, Dictionary_Entry_Key key ) {
 	Dictionary* self = dictionary;
-	Dictionary_Index index;
+	Dictionary_Index index = _Dictionary_FindIndex( self, key );
 	
-	for( index = 0; index < self->count; index++ ) {
-		if( Dictionary_Entry_Compare( self->entryPtr[index], key ) != 0 ) {
-			return self->entryPtr[index];
-		}
+	if( index < self->count ) {
+		return self->entryPtr[index];
 	}
 	return 0;
 }
@@ -244,6 +256,10 @@ void _Dictionary_Add( void* dictionary, Dictionary_Entry_Key key, Dictionary_Ent
 	
 	self->entryPtr[self->count] = Dictionary_Entry_New( key, value );
 	self->count++;
+	
+	if( self->count >= HASH_MIN_COUNT ) {
+		_Dictionary_HashSync( self );
+	}
 }
 
 void _Dictionary_AddWithSource( void* dictionary, Dictionary_Entry_Key key, Dictionary_Entry_Value* value, 
@@ -258,6 +274,10 @@ void _Dictionary_AddWithSource( void* dictionary, Dictionary_Entry_Key key, Dict
 	
 	self->entryPtr[self->count] = Dictionary_Entry_NewWithSource( key, value, source );
 	self->count++;
+	
+	if( self->count >= HASH_MIN_COUNT ) {
+		_Dictionary_HashSync( self );
+	}
 }
 
 Dictionary_Entry_Value* Dictionary_AddMerge( 
@@ -463,13 +483,11 @@ Dictionary_Entry_Value* Dictionary_AddMergeWithSource(
 
 Bool _Dictionary_Set( void* dictionary, Dictionary_Entry_Key key, Dictionary_Entry_Value* value ) {
 	Dictionary* self = (Dictionary*) dictionary;
-	Dictionary_Index index;
+	Dictionary_Index index = _Dictionary_FindIndex( self, key );
 	
-	for( index = 0; index < self->count; index++ ) {
-		if( Dictionary_Entry_Compare( self->entryPtr[index], key ) != 0 ) {
-			Dictionary_Entry_Set( self->entryPtr[index], value );
-			return True;
-		}
+	if( index < self->count ) {
+		Dictionary_Entry_Set( self->entryPtr[index], value );
+		return True;
 	}
 
 	/* If we reach here and haven't found it, add new entry */
@@ -499,26 +517,22 @@ Bool _Dictionary_SetWithSource( void* dictionary, Dictionary_Entry_Key key, Dict
 
 Dictionary_Entry_Value* _Dictionary_Get( void* dictionary, Dictionary_Entry_Key key ) {
 	Dictionary* self = (Dictionary*) dictionary;
-	Dictionary_Index index;
+	Dictionary_Index index = _Dictionary_FindIndex( self, key );
 	
-	for( index = 0; index < self->count; index++ ) {
-		if( Dictionary_Entry_Compare( self->entryPtr[index], key ) != 0 ) {
-			return Dictionary_Entry_Get( self->entryPtr[index] );
-		}
+	if( index < self->count ) {
+		return Dictionary_Entry_Get( self->entryPtr[index] );
 	}
 	return 0;
 }
 
 Dictionary_Entry_Source _Dictionary_GetSource( void* dictionary, Dictionary_Entry_Key key) {
 	Dictionary* self = (Dictionary*) dictionary;
-	Dictionary_Index index;
+	Dictionary_Index index = _Dictionary_FindIndex( self, key );
 
-	for( index = 0; index < self->count; index++ ) {
-                if( Dictionary_Entry_Compare( self->entryPtr[index], key ) != 0 ) {
-                        return Dictionary_Entry_GetSource( self->entryPtr[index] );
-                }
-        }
-        return 0;
+	if( index < self->count ) {
+		return Dictionary_Entry_GetSource( self->entryPtr[index] );
+	}
+	return 0;
 }
 
 
@@ -529,14 +543,12 @@ Dictionary_Entry_Value* _Dictionary_GetByIndex( void* dictionary, Dictionary_Ind
 
 Dictionary_Entry_Value* Dictionary_GetDefault( void* dictionary, Dictionary_Entry_Key key, Dictionary_Entry_Value* value ) {
 	Dictionary* self = (Dictionary*) dictionary;
-	Dictionary_Index index;
+	Dictionary_Index index = _Dictionary_FindIndex( self, key );
 	
-	for( index = 0; index < self->count; index++ ) {
-		if( Dictionary_Entry_Compare( self->entryPtr[index], key ) != 0 ) {
-			/* key found, so delete the default value */
-			Dictionary_Entry_Value_Delete( value );
-			return Dictionary_Entry_Get( self->entryPtr[index] );
-		}
+	if( index < self->count ) {
+		/* key found, so delete the default value */
+		Dictionary_Entry_Value_Delete( value );
+		return Dictionary_Entry_Get( self->entryPtr[index] );
 	}
 	
 	Journal_Printf( self->debugStream, "Warning - value %s not found in dictionary, using default value of ", key );
@@ -547,6 +559,87 @@ Dictionary_Entry_Value* Dictionary_GetDefault( void* dictionary, Dictionary_Entr
 	return value;
 }
 
+/* 32 bit FNV-1a */
+static unsigned int _Dictionary_HashKey( const char* key ) {
+	unsigned int hash = 2166136261u;
+
+	for( ; *key; key++ ) {
+		hash ^= (unsigned char)*key;
+		hash *= 16777619u;
+	}
+	return hash;
+}
+
+/* Indexes one entry, unless an earlier entry with the same key is already indexed: lookups return the first match. */
+static void _Dictionary_HashInsert( Dictionary* self, Dictionary_Index index ) {
+	Dictionary_Index mask = self->hashSize - 1;
+	Dictionary_Index slot = _Dictionary_HashKey( self->entryPtr[index]->key ) & mask;
+
+	while( self->hashTable[slot] ) {
+		if( Dictionary_Entry_Compare( self->entryPtr[self->hashTable[slot] - 1], self->entryPtr[index]->key ) ) {
+			return;
+		}
+		slot = ( slot + 1 ) & mask;
+	}
+	self->hashTable[slot] = index + 1;
+}
+
+/* Brings the index up to date with entryPtr. Entries are only ever appended by the Dictionary itself, so normally
+   this indexes the new ones; the table is rebuilt, doubled to stay at most half full, when it fills up or if
+   entries were taken away behind the Dictionary's back. */
+static void _Dictionary_HashSync( Dictionary* self ) {
+	if( self->hashCount == self->count ) {
+		return;
+	}
+
+	if( self->count < self->hashCount || self->count * 2 > self->hashSize ) {
+		Dictionary_Index newSize = self->hashSize ? self->hashSize : HASH_INIT_SIZE;
+
+		while( self->count * 2 > newSize ) {
+			newSize *= 2;
+		}
+		if( newSize != self->hashSize ) {
+			if( self->hashTable ) {
+				Memory_Free( self->hashTable );
+			}
+			self->hashTable = Memory_Alloc_Array( Dictionary_Index, newSize, "Dictionary->hashTable" );
+			self->hashSize = newSize;
+		}
+		memset( self->hashTable, 0, sizeof(Dictionary_Index) * self->hashSize );
+		self->hashCount = 0;
+	}
+
+	for( ; self->hashCount < self->count; self->hashCount++ ) {
+		_Dictionary_HashInsert( self, self->hashCount );
+	}
+}
+
+/* Index of the first entry with the given key, or self->count if there is none. */
+static Dictionary_Index _Dictionary_FindIndex( Dictionary* self, Dictionary_Entry_Key key ) {
+	Dictionary_Index index;
+	Dictionary_Index mask;
+	Dictionary_Index slot;
+
+	if( self->count < HASH_MIN_COUNT ) {
+		for( index = 0; index < self->count; index++ ) {
+			if( Dictionary_Entry_Compare( self->entryPtr[index], key ) != 0 ) {
+				return index;
+			}
+		}
+		return self->count;
+	}
+
+	_Dictionary_HashSync( self );
+	mask = self->hashSize - 1;
+	for( slot = _Dictionary_HashKey( key ) & mask; self->hashTable[slot]; slot = ( slot + 1 ) & mask ) {
+		index = self->hashTable[slot] - 1;
+		if( Dictionary_Entry_Compare( self->entryPtr[index], key ) != 0 ) {
+			return index;
+		}
+	}
+	return self->count;
+}
+
 Index Dictionary_GetCount( void* dictionary ) {
 	Dictionary* self = (Dictionary*) dictionary;
 	return self->count;
@@ -789,3 +882,310 @@ void Dictionary_ReadAllParamFromCommandLine( void* dictionary, int argc, char* a
 		Memory_Free( paramString );
 	}
 }
+
+
+Bool Dictionary_Compare( void* dictionary, void* other ) {
+	Dictionary*      self = (Dictionary*)dictionary;
+	Dictionary*      otherDict = (Dictionary*)other;
+	Dictionary_Index index;
+
+	if( self->count != otherDict->count ) {
+		return False;
+	}
+
+	for( index = 0; index < self->count; index++ ) {
+		Dictionary_Entry* entry = self->entryPtr[index];
+		Dictionary_Entry* otherEntry = otherDict->entryPtr[index];
+
+		if( strcmp( entry->key, otherEntry->key ) != 0 ) {
+			return False;
+		}
+		if( ( entry->source == NULL || otherEntry->source == NULL ) ?
+			entry->source != otherEntry->source : strcmp( entry->source, otherEntry->source ) != 0 )
+		{
+			return False;
+		}
+		if( !Dictionary_Entry_Value_Compare( entry->value, otherEntry->value ) ) {
+			return False;
+		}
+	}
+	return True;
+}
+
+
+/* Binary layout: a header (magic, version) then the top level dictionary. A dictionary is its entry count followed
+ * by key, source and value per entry. A value is its type followed by its contents; lists store their encoding and
+ * element count before the elements, structs store a nested dictionary. Strings are stored with a length that
+ * includes the terminating null, or DICTIONARY_BINARY_NULL_STRING for a NULL source. */
+static const unsigned int DICTIONARY_BINARY_MAGIC = 0x44477453; /* "StGD" */
+static const unsigned int DICTIONARY_BINARY_VERSION = 1;
+static const unsigned int DICTIONARY_BINARY_NULL_STRING = (unsigned int)-1;
+static const SizeT        DICTIONARY_BINARY_INIT_SIZE = 4096;
+
+typedef struct {
+	char*       data;
+	SizeT       size;
+	SizeT       capacity;
+} Dictionary_BinaryWriter;
+
+typedef struct {
+	const char* data;
+	SizeT       size;
+	SizeT       offset;
+} Dictionary_BinaryReader;
+
+static void _Dictionary_BinaryPut( Dictionary_BinaryWriter* writer, const void* bytes, SizeT length ) {
+	if( writer->size + length > writer->capacity ) {
+		while( writer->size + length > writer->capacity ) {
+			writer->capacity *= 2;
+		}
+		writer->data = Memory_Realloc_Array( writer->data, char, writer->capacity );
+	}
+	memcpy( writer->data + writer->size, bytes, length );
+	writer->size += length;
+}
+
+static void _Dictionary_BinaryPutUnsignedInt( Dictionary_BinaryWriter* writer, unsigned int value ) {
+	_Dictionary_BinaryPut( writer, &value, sizeof(unsigned int) );
+}
+
+static void _Dictionary_BinaryPutString( Dictionary_BinaryWriter* writer, const char* string ) {
+	unsigned int length;
+
+	if( string == NULL ) {
+		_Dictionary_BinaryPutUnsignedInt( writer, DICTIONARY_BINARY_NULL_STRING );
+		return;
+	}
+	length = strlen( string ) + 1;
+	_Dictionary_BinaryPutUnsignedInt( writer, length );
+	_Dictionary_BinaryPut( writer, string, length );
+}
+
+static void _Dictionary_BinaryPutDictionary( Dictionary_BinaryWriter* writer, Dictionary* dictionary );
+
+static void _Dictionary_BinaryPutValue( Dictionary_BinaryWriter* writer, Dictionary_Entry_Value* value ) {
+	Dictionary_Entry_Value* cur;
+	unsigned int            boolValue;
+
+	_Dictionary_BinaryPutUnsignedInt( writer, value->type );
+	switch( value->type ) {
+		case Dictionary_Entry_Value_Type_String:
+			_Dictionary_BinaryPutString( writer, value->as.typeString );
+			break;
+		case Dictionary_Entry_Value_Type_Double:
+			_Dictionary_BinaryPut( writer, &value->as.typeDouble, sizeof(double) );
+			break;
+		case Dictionary_Entry_Value_Type_UnsignedInt:
+			_Dictionary_BinaryPut( writer, &value->as.typeUnsignedInt, sizeof(unsigned int) );
+			break;
+		case Dictionary_Entry_Value_Type_Int:
+			_Dictionary_BinaryPut( writer, &value->as.typeInt, sizeof(int) );
+			break;
+		case Dictionary_Entry_Value_Type_UnsignedLong:
+			_Dictionary_BinaryPut( writer, &value->as.typeUnsignedLong, sizeof(unsigned long) );
+			break;
+		case Dictionary_Entry_Value_Type_Bool:
+			boolValue = value->as.typeBool ? 1 : 0;
+			_Dictionary_BinaryPutUnsignedInt( writer, boolValue );
+			break;
+		case Dictionary_Entry_Value_Type_List:
+			_Dictionary_BinaryPutUnsignedInt( writer, value->as.typeList->encoding );
+			_Dictionary_BinaryPutUnsignedInt( writer, value->as.typeList->count );
+			for( cur = value->as.typeList->first; cur; cur = cur->next ) {
+				_Dictionary_BinaryPutValue( writer, cur );
+			}
+			break;
+		case Dictionary_Entry_Value_Type_Struct:
+			_Dictionary_BinaryPutDictionary( writer, value->as.typeStruct );
+			break;
+		default:
+			Journal_Firewall( False, Journal_Register( Error_Type, Dictionary_Type ),
+				"Error in func %s: value type '%u' cannot be written as binary.\n", __func__, value->type );
+	}
+}
+
+static void _Dictionary_BinaryPutDictionary( Dictionary_BinaryWriter* writer, Dictionary* dictionary ) {
+	Dictionary_Index index;
+
+	_Dictionary_BinaryPutUnsignedInt( writer, dictionary->count );
+	for( index = 0; index < dictionary->count; index++ ) {
+		_Dictionary_BinaryPutString( writer, dictionary->entryPtr[index]->key );
+		_Dictionary_BinaryPutString( writer, dictionary->entryPtr[index]->source );
+		_Dictionary_BinaryPutValue( writer, dictionary->entryPtr[index]->value );
+	}
+}
+
+void* Dictionary_WriteBinary( void* dictionary, SizeT* sizePtr ) {
+	Dictionary*             self = (Dictionary*)dictionary;
+	Dictionary_BinaryWriter writer;
+
+	writer.capacity = DICTIONARY_BINARY_INIT_SIZE;
+	writer.size = 0;
+	writer.data = Memory_Alloc_Array( char, writer.capacity, "Dictionary binary" );
+
+	_Dictionary_BinaryPutUnsignedInt( &writer, DICTIONARY_BINARY_MAGIC );
+	_Dictionary_BinaryPutUnsignedInt( &writer, DICTIONARY_BINARY_VERSION );
+	_Dictionary_BinaryPutDictionary( &writer, self );
+
+	*sizePtr = writer.size;
+	return writer.data;
+}
+
+
+static Bool _Dictionary_BinaryGet( Dictionary_BinaryReader* reader, void* bytes, SizeT length ) {
+	if( length > reader->size - reader->offset ) {
+		return False;
+	}
+	memcpy( bytes, reader->data + reader->offset, length );
+	reader->offset += length;
+	return True;
+}
+
+static Bool _Dictionary_BinaryGetUnsignedInt( Dictionary_BinaryReader* reader, unsigned int* value ) {
+	return _Dictionary_BinaryGet( reader, value, sizeof(unsigned int) );
+}
+
+/* Strings are not copied: the returned pointer refers into the blob, as the Dictionary copies what it keeps. */
+static Bool _Dictionary_BinaryGetString( Dictionary_BinaryReader* reader, const char** string ) {
+	unsigned int length;
+
+	if( !_Dictionary_BinaryGetUnsignedInt( reader, &length ) ) {
+		return False;
+	}
+	if( length == DICTIONARY_BINARY_NULL_STRING ) {
+		*string = NULL;
+		return True;
+	}
+	if( length == 0 || length > reader->size - reader->offset || reader->data[reader->offset + length - 1] != '\0' ) {
+		return False;
+	}
+	*string = reader->data + reader->offset;
+	reader->offset += length;
+	return True;
+}
+
+static Bool _Dictionary_BinaryGetDictionary( Dictionary_BinaryReader* reader, Dictionary* dictionary );
+
+static Dictionary_Entry_Value* _Dictionary_BinaryGetValue( Dictionary_BinaryReader* reader ) {
+	Dictionary_Entry_Value* value = NULL;
+	Dictionary_Entry_Value* element;
+	unsigned int            type;
+	const char*             string;
+	double                  doubleValue;
+	unsigned int            uintValue;
+	int                     intValue;
+	unsigned long           ulongValue;
+	unsigned int            encoding;
+	unsigned int            count;
+	unsigned int            element_I;
+
+	if( !_Dictionary_BinaryGetUnsignedInt( reader, &type ) ) {
+		return NULL;
+	}
+
+	switch( type ) {
+		case Dictionary_Entry_Value_Type_String:
+			if( _Dictionary_BinaryGetString( reader, &string ) && string ) {
+				value = Dictionary_Entry_Value_FromString( string );
+			}
+			break;
+		case Dictionary_Entry_Value_Type_Double:
+			if( _Dictionary_BinaryGet( reader, &doubleValue, sizeof(double) ) ) {
+				value = Dictionary_Entry_Value_FromDouble( doubleValue );
+			}
+			break;
+		case Dictionary_Entry_Value_Type_UnsignedInt:
+			if( _Dictionary_BinaryGetUnsignedInt( reader, &uintValue ) ) {
+				value = Dictionary_Entry_Value_FromUnsignedInt( uintValue );
+			}
+			break;
+		case Dictionary_Entry_Value_Type_Int:
+			if( _Dictionary_BinaryGet( reader, &intValue, sizeof(int) ) ) {
+				value = Dictionary_Entry_Value_FromInt( intValue );
+			}
+			break;
+		case Dictionary_Entry_Value_Type_UnsignedLong:
+			if( _Dictionary_BinaryGet( reader, &ulongValue, sizeof(unsigned long) ) ) {
+				value = Dictionary_Entry_Value_FromUnsignedLong( ulongValue );
+			}
+			break;
+		case Dictionary_Entry_Value_Type_Bool:
+			if( _Dictionary_BinaryGetUnsignedInt( reader, &uintValue ) ) {
+				value = Dictionary_Entry_Value_FromBool( uintValue ? True : False );
+			}
+			break;
+		case Dictionary_Entry_Value_Type_List:
+			if( !_Dictionary_BinaryGetUnsignedInt( reader, &encoding ) || 
+				!_Dictionary_BinaryGetUnsignedInt( reader, &count ) ) 
+			{
+				break;
+			}
+			value = Dictionary_Entry_Value_NewList();
+			Dictionary_Entry_Value_SetEncoding( value, (Encoding)encoding );
+			for( element_I = 0; element_I < count; element_I++ ) {
+				if( !(element = _Dictionary_BinaryGetValue( reader )) ) {
+					Dictionary_Entry_Value_Delete( value );
+					return NULL;
+				}
+				Dictionary_Entry_Value_AddElement( value, element );
+			}
+			break;
+		case Dictionary_Entry_Value_Type_Struct:
+			value = Dictionary_Entry_Value_NewStruct();
+			if( !_Dictionary_BinaryGetDictionary( reader, value->as.typeStruct ) ) {
+				Dictionary_Entry_Value_Delete( value );
+				return NULL;
+			}
+			break;
+		default:
+			break;
+	}
+	return value;
+}
+
+static Bool _Dictionary_BinaryGetDictionary( Dictionary_BinaryReader* reader, Dictionary* dictionary ) {
+	unsigned int            count;
+	unsigned int            entry_I;
+	const char*             key;
+	const char*             source;
+	Dictionary_Entry_Value* value;
+
+	if( !_Dictionary_BinaryGetUnsignedInt( reader, &count ) ) {
+		return False;
+	}
+	for( entry_I = 0; entry_I < count; entry_I++ ) {
+		if( !_Dictionary_BinaryGetString( reader, &key ) || key == NULL ||
+			!_Dictionary_BinaryGetString( reader, &source ) ||
+			!(value = _Dictionary_BinaryGetValue( reader )) )
+		{
+			return False;
+		}
+		Dictionary_AddWithSource( dictionary, (Dictionary_Entry_Key)key, value, (Dictionary_Entry_Source)source );
+	}
+	return True;
+}
+
+Bool Dictionary_ReadBinary( void* dictionary, const void* buffer, SizeT size ) {
+	Dictionary*             self = (Dictionary*)dictionary;
+	Dictionary_BinaryReader reader;
+	unsigned int            magic;
+	unsigned int            version;
+
+	reader.data = (const char*)buffer;
+	reader.size = size;
+	reader.offset = 0;
+
+	if( !_Dictionary_BinaryGetUnsignedInt( &reader, &magic ) || magic != DICTIONARY_BINARY_MAGIC ||
+		!_Dictionary_BinaryGetUnsignedInt( &reader, &version ) || version != DICTIONARY_BINARY_VERSION )
+	{
+		Journal_Printf( self->debugStream, "Warning - in func %s: buffer is not a version %u dictionary blob.\n",
+			__func__, DICTIONARY_BINARY_VERSION );
+		return False;
+	}
+	if( !_Dictionary_BinaryGetDictionary( &reader, self ) || reader.offset != reader.size ) {
+		Journal_Printf( self->debugStream, "Warning - in func %s: dictionary blob is truncated or corrupt.\n",
+			__func__ );
+		return False;
+	}
+	return True;
+}
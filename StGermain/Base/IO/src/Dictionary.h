@@ -94,6 +94,12 @@
 		Dictionary_Index		count; \
 		Dictionary_Entry**		entryPtr; \
 		\
+		/* Key index: open addressing table of (entry index + 1) of the first entry with each key, 0 if \
+		   empty. Built once the dictionary is big enough that a scan is slower; hashCount entries are indexed. */ \
+		Dictionary_Index		hashSize; \
+		Dictionary_Index		hashCount; \
+		Dictionary_Index*		hashTable; \
+		\
 		Stream*				debugStream;
 	struct _Dictionary { __Dictionary };
 	
@@ -209,4 +215,17 @@
 	/** Loops over command line arguments and reads in values with format "--param=value" */
 	void Dictionary_ReadAllParamFromCommandLine( void* dictionary, int argc, char* argv[] ) ;
 
+	/** Compares two dictionaries: same keys, sources and values (see Dictionary_Entry_Value_Compare), in the same order */
+	Bool Dictionary_Compare( void* dictionary, void* other );
+
+	/** Flattens the dictionary, including nested lists and structs, into a single binary blob that can be sent
+	 * with one MPI message or written to disk. The blob is in native byte order and is allocated with Memory_Alloc;
+	 * the caller owns it. Its length in bytes is returned in sizePtr. */
+	void* Dictionary_WriteBinary( void* dictionary, SizeT* sizePtr );
+
+	/** Appends the entries held in a blob made by Dictionary_WriteBinary to the dictionary, in their original
+	 * order. Returns False if the blob is truncated or not a dictionary blob, in which case the entries decoded
+	 * before the error are left in the dictionary. */
+	Bool Dictionary_ReadBinary( void* dictionary, const void* buffer, SizeT size );
+
 #endif /* __Base_IO_Dictionary_h__ */
@@ -143,6 +143,8 @@ void Dictionary_Entry_SetWithSource( Dictionary_Entry* self, Dictionary_Entry_Va
 		Memory_Free( self->source );
 	if( source != NULL )
 		self->source = StG_Strdup( source );
+	else
+		self->source = NULL;
 }
 
 Dictionary_Entry_Value* Dictionary_Entry_Get( Dictionary_Entry* self )
@@ -490,6 +490,55 @@ void Dictionary_Entry_Value_Print( Dictionary_Entry_Value* self, Stream* stream
 }
 
 
+Bool Dictionary_Entry_Value_Compare( Dictionary_Entry_Value* self, Dictionary_Entry_Value* other ) {
+	Dictionary_Entry_Value* cur;
+	Dictionary_Entry_Value* otherCur;
+
+	if( !self || !other ) {
+		return self == other;
+	}
+	if( self->type != other->type ) {
+		return False;
+	}
+
+	switch( self->type ) {
+		case Dictionary_Entry_Value_Type_String:
+			return 0 == strcmp( self->as.typeString, other->as.typeString );
+		case Dictionary_Entry_Value_Type_Double:
+			return self->as.typeDouble == other->as.typeDouble;
+		case Dictionary_Entry_Value_Type_UnsignedInt:
+			return self->as.typeUnsignedInt == other->as.typeUnsignedInt;
+		case Dictionary_Entry_Value_Type_Int:
+			return self->as.typeInt == other->as.typeInt;
+		case Dictionary_Entry_Value_Type_UnsignedLong:
+			return self->as.typeUnsignedLong == other->as.typeUnsignedLong;
+		case Dictionary_Entry_Value_Type_Bool:
+			return ( self->as.typeBool ? True : False ) == ( other->as.typeBool ? True : False );
+		case Dictionary_Entry_Value_Type_List:
+			if( self->as.typeList->count != other->as.typeList->count ||
+				self->as.typeList->encoding != other->as.typeList->encoding )
+			{
+				return False;
+			}
+			for( cur = self->as.typeList->first, otherCur = other->as.typeList->first; cur && otherCur;
+				cur = cur->next, otherCur = otherCur->next )
+			{
+				if( !Dictionary_Entry_Value_Compare( cur, otherCur ) ) {
+					return False;
+				}
+			}
+			return cur == otherCur;
+		case Dictionary_Entry_Value_Type_Struct:
+			return Dictionary_Compare( self->as.typeStruct, other->as.typeStruct );
+		default: {
+			Stream* errorStream = Journal_Register( Error_Type, "Dictionary_Entry_Value" );
+			Journal_Firewall( False, errorStream, "In func %s: self->type '%d' is invalid.\n", __func__, self->type );
+		}
+	}
+	return False;
+}
+
+
 void Dictionary_Entry_Value_SetFrom( Dictionary_Entry_Value* self, void* value, const char type) {
 	Dictionary_Entry_Value_DeleteContents( self );
 	
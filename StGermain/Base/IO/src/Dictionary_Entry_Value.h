@@ -157,6 +157,9 @@
 	
 	/** Printing the semantic value of element in its current state */
 	void Dictionary_Entry_Value_Print( Dictionary_Entry_Value* self, Stream* stream );
+
+	/** Compares two values: same type and contents, and for lists and structs the same members in the same order */
+	Bool Dictionary_Entry_Value_Compare( Dictionary_Entry_Value* self, Dictionary_Entry_Value* other );
 	
 	
 	/** Set a dictionary entry value to the given type and value */
@@ -39,10 +39,12 @@
 
 #include "Journal.h"
 
+#include <mpi.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
 #include <assert.h>
+#include <unistd.h>
 
 /** Textual name of this class */
 const Type IO_Handler_Type = Type_Invalid;
@@ -89,15 +91,22 @@ void _IO_Handler_Init( IO_Handler* self ) {
 	self->currDictionary = NULL;
 	self->resource = NULL;
 	self->currPath = NULL;
+	self->filesReadCount = 0;
+	self->filesRead = NULL;
 }
 
 
 /** delete the object's memory at this level */
 void _IO_Handler_Delete( void* io_handler ) {
 	IO_Handler* self = (IO_Handler*)io_handler;
+	Index       file_I;
 	
 	if( self->currPath ) Memory_Free( self->currPath );
 	if( self->resource ) Memory_Free( self->resource );
+	for( file_I = 0; file_I < self->filesReadCount; file_I++ ) {
+		Memory_Free( self->filesRead[file_I] );
+	}
+	if( self->filesRead ) Memory_Free( self->filesRead );
 	
 	/* Stg_Class_Delete parent class */
 	_Stg_Class_Delete( self );
@@ -441,3 +450,320 @@ Index IO_Handler_ReadAllFromCommandLineForceSource( void* ioHandler, int argc, c
 
 	return filesRead;
 }
+
+
+void IO_Handler_AddFileRead( void* ioHandler, const char* filename ) {
+	IO_Handler* self = (IO_Handler*) ioHandler;
+	Index       file_I;
+
+	for( file_I = 0; file_I < self->filesReadCount; file_I++ ) {
+		if( strcmp( self->filesRead[file_I], filename ) == 0 ) {
+			return;
+		}
+	}
+
+	if( self->filesReadCount == 0 ) {
+		self->filesRead = Memory_Alloc_Array( char*, 1, "IO_Handler->filesRead" );
+	}
+	else {
+		self->filesRead = Memory_Realloc_Array( self->filesRead, char*, self->filesReadCount + 1 );
+	}
+	self->filesRead[self->filesReadCount] = StG_Strdup( filename );
+	self->filesReadCount++;
+}
+
+
+/* Input cache file: a header (magic, version, file count), then the path and content hash of every file parsed to
+ * make the blob, then the blob length and the Dictionary_WriteBinary blob itself. Native byte order. */
+static const unsigned int IO_HANDLER_CACHE_MAGIC = 0x43477453; /* "StGC" */
+static const unsigned int IO_HANDLER_CACHE_VERSION = 1;
+
+/* 64 bit FNV-1a */
+typedef unsigned long long IO_Handler_Hash;
+static const IO_Handler_Hash IO_HANDLER_HASH_INIT = 14695981039346656037ULL;
+static const IO_Handler_Hash IO_HANDLER_HASH_PRIME = 1099511628211ULL;
+
+static IO_Handler_Hash _IO_Handler_HashBytes( IO_Handler_Hash hash, const void* bytes, SizeT length ) {
+	const unsigned char* byte = (const unsigned char*)bytes;
+	SizeT                byte_I;
+
+	for( byte_I = 0; byte_I < length; byte_I++ ) {
+		hash ^= byte[byte_I];
+		hash *= IO_HANDLER_HASH_PRIME;
+	}
+	return hash;
+}
+
+static Bool _IO_Handler_HashFile( const char* filename, IO_Handler_Hash* hash ) {
+	FILE*  file = fopen( filename, "rb" );
+	char   buffer[8192];
+	SizeT  length;
+
+	if( !file ) {
+		return False;
+	}
+	*hash = IO_HANDLER_HASH_INIT;
+	while( (length = fread( buffer, 1, sizeof(buffer), file )) > 0 ) {
+		*hash = _IO_Handler_HashBytes( *hash, buffer, length );
+	}
+	fclose( file );
+	return True;
+}
+
+/* The cache key covers the names and contents of the top level files, and the module path that includes are
+ * searched on. Included files are checked against the hashes stored in the cache file itself. */
+static Bool _IO_Handler_InputCacheFilename( char** filenames, Index count, const char* cacheDir, char** cacheFilename ) {
+	IO_Handler_Hash key = IO_HANDLER_HASH_INIT;
+	IO_Handler_Hash fileHash;
+	char*           modulePath = getenv( "STG_MODULE_PATH" );
+	Index           file_I;
+
+	for( file_I = 0; file_I < count; file_I++ ) {
+		if( !_IO_Handler_HashFile( filenames[file_I], &fileHash ) ) {
+			return False;
+		}
+		key = _IO_Handler_HashBytes( key, filenames[file_I], strlen( filenames[file_I] ) + 1 );
+		key = _IO_Handler_HashBytes( key, &fileHash, sizeof(IO_Handler_Hash) );
+	}
+	if( modulePath ) {
+		key = _IO_Handler_HashBytes( key, modulePath, strlen( modulePath ) + 1 );
+	}
+
+	Stg_asprintf( cacheFilename, "%s/input-%016llx.stgdict", cacheDir, key );
+	return True;
+}
+
+/* Returns the cached blob if every file it was made from is unchanged, NULL otherwise. */
+static void* _IO_Handler_ReadInputCache( const char* cacheFilename, SizeT* sizePtr ) {
+	FILE*           file = fopen( cacheFilename, "rb" );
+	unsigned int    header[3];
+	unsigned int    length;
+	char            filename[1024];
+	IO_Handler_Hash storedHash;
+	IO_Handler_Hash fileHash;
+	unsigned long   blobSize = 0;
+	char*           blob = NULL;
+	long            blobStart;
+	long            fileEnd;
+	Index           file_I;
+
+	if( !file ) {
+		return NULL;
+	}
+	if( fread( header, sizeof(unsigned int), 3, file ) != 3 || 
+		header[0] != IO_HANDLER_CACHE_MAGIC || header[1] != IO_HANDLER_CACHE_VERSION ) 
+	{
+		fclose( file );
+		return NULL;
+	}
+	for( file_I = 0; file_I < header[2]; file_I++ ) {
+		if( fread( &length, sizeof(unsigned int), 1, file ) != 1 || length == 0 || length > sizeof(filename) ||
+			fread( filename, 1, length, file ) != length || filename[length - 1] != '\0' ||
+			fread( &storedHash, sizeof(IO_Handler_Hash), 1, file ) != 1 ||
+			!_IO_Handler_HashFile( filename, &fileHash ) || fileHash != storedHash )
+		{
+			fclose( file );
+			return NULL;
+		}
+	}
+	if( fread( &blobSize, sizeof(unsigned long), 1, file ) == 1 ) {
+		/* The blob runs to the end of the file; a size that doesn't fit is corrupt, so don't try to allocate it. */
+		blobStart = ftell( file );
+		if( blobStart >= 0 && fseek( file, 0, SEEK_END ) == 0 && (fileEnd = ftell( file )) >= blobStart &&
+			blobSize > 0 && blobSize <= (unsigned long)(fileEnd - blobStart) && 
+			fseek( file, blobStart, SEEK_SET ) == 0 )
+		{
+			blob = Memory_Alloc_Array( char, blobSize, "IO_Handler input cache" );
+			if( fread( blob, 1, blobSize, file ) != blobSize ) {
+				Memory_Free( blob );
+				blob = NULL;
+			}
+		}
+	}
+	fclose( file );
+
+	*sizePtr = blob ? blobSize : 0;
+	return blob;
+}
+
+/* Written under a temporary name then renamed, so a concurrent reader never sees a partial file. */
+static void _IO_Handler_WriteInputCache( IO_Handler* self, const char* cacheFilename, void* blob, SizeT size ) {
+	FILE*           file;
+	char*           tmpFilename;
+	unsigned int    header[3];
+	unsigned int    length;
+	IO_Handler_Hash fileHash;
+	unsigned long   blobSize = size;
+	Index           file_I;
+	Bool            result;
+
+	Stg_asprintf( &tmpFilename, "%s.%d.tmp", cacheFilename, (int)getpid() );
+	if( !(file = fopen( tmpFilename, "wb" )) ) {
+		Memory_Free( tmpFilename );
+		return;
+	}
+
+	header[0] = IO_HANDLER_CACHE_MAGIC;
+	header[1] = IO_HANDLER_CACHE_VERSION;
+	header[2] = self->filesReadCount;
+	result = fwrite( header, sizeof(unsigned int), 3, file ) == 3;
+	for( file_I = 0; result && file_I < self->filesReadCount; file_I++ ) {
+		length = strlen( self->filesRead[file_I] ) + 1;
+		result = _IO_Handler_HashFile( self->filesRead[file_I], &fileHash ) &&
+			fwrite( &length, sizeof(unsigned int), 1, file ) == 1 &&
+			fwrite( self->filesRead[file_I], 1, length, file ) == length &&
+			fwrite( &fileHash, sizeof(IO_Handler_Hash), 1, file ) == 1;
+	}
+	result = result && fwrite( &blobSize, sizeof(unsigned long), 1, file ) == 1 && 
+		fwrite( blob, 1, size, file ) == size;
+	result = ( fclose( file ) == 0 ) && result;
+
+	if( !result || rename( tmpFilename, cacheFilename ) != 0 ) {
+		remove( tmpFilename );
+	}
+	Memory_Free( tmpFilename );
+}
+
+/* Moves the entries of source onto the end of dictionary, leaving source empty. Keys dictionary already had are
+ * replaced, as the XML handler does by default; the rest are appended so duplicate keys in the input survive. */
+static void _IO_Handler_MoveEntries( Dictionary* dictionary, Dictionary* source ) {
+	Dictionary_Entry** existing = Memory_Alloc_Array( Dictionary_Entry*, source->count + 1, "IO_Handler existing entries" );
+	Dictionary_Index   entry_I;
+	Dictionary_Entry*  entry;
+
+	/* Look every key up before appending any, so only the keys dictionary already had can match. */
+	for( entry_I = 0; entry_I < source->count; entry_I++ ) {
+		existing[entry_I] = Dictionary_GetEntry( dictionary, source->entryPtr[entry_I]->key );
+	}
+
+	for( entry_I = 0; entry_I < source->count; entry_I++ ) {
+		entry = source->entryPtr[entry_I];
+		if( existing[entry_I] ) {
+			Dictionary_Entry_SetWithSource( existing[entry_I], entry->value, entry->source );
+		}
+		else {
+			Dictionary_AddWithSource( dictionary, entry->key, entry->value, entry->source );
+		}
+
+		Memory_Free( entry->key );
+		if( entry->source ) {
+			Memory_Free( entry->source );
+		}
+		Memory_Free( entry );
+	}
+	source->count = 0;
+	Memory_Free( existing );
+}
+
+static Bool _IO_Handler_ReadAllFilesBroadcast( IO_Handler* self, char** filenames, Index count, Dictionary* dictionary,
+		MPI_Comm comm )
+{
+	Stream*       errorStream = Journal_Register( Error_Type, CURR_MODULE_NAME );
+	Stream*       debugStream = Journal_Register( Debug_Type, CURR_MODULE_NAME );
+	Dictionary*   received = Dictionary_New();
+	char*         cacheDir;
+	char*         cacheFilename = NULL;
+	void*         blob = NULL;
+	SizeT         blobSize = 0;
+	unsigned long header[2] = { True, 0 };
+	int           rank;
+	Index         file_I;
+
+	MPI_Comm_rank( comm, &rank );
+
+	if( rank == 0 ) {
+		cacheDir = getenv( "STG_INPUT_CACHE" );
+		if( cacheDir && _IO_Handler_InputCacheFilename( filenames, count, cacheDir, &cacheFilename ) ) {
+			if( (blob = _IO_Handler_ReadInputCache( cacheFilename, &blobSize )) ) {
+				if( Dictionary_ReadBinary( received, blob, blobSize ) ) {
+					Journal_DPrintf( debugStream, "Read input from cache file %s.\n", cacheFilename );
+				}
+				else {
+					Memory_Free( blob );
+					blob = NULL;
+					Stg_Class_Delete( received );
+					received = Dictionary_New();
+				}
+			}
+		}
+
+		if( !blob ) {
+			for( file_I = 0; file_I < count && header[0]; file_I++ ) {
+				header[0] = IO_Handler_ReadAllFromFile( self, filenames[file_I], received );
+			}
+			if( header[0] ) {
+				blob = Dictionary_WriteBinary( received, &blobSize );
+				if( cacheFilename ) {
+					Journal_DPrintf( debugStream, "Writing input cache file %s.\n", cacheFilename );
+					_IO_Handler_WriteInputCache( self, cacheFilename, blob, blobSize );
+				}
+			}
+		}
+		header[1] = blobSize;
+	}
+
+	MPI_Bcast( header, 2, MPI_UNSIGNED_LONG, 0, comm );
+
+	if( header[0] ) {
+		if( rank != 0 ) {
+			blobSize = header[1];
+			blob = Memory_Alloc_Array( char, blobSize, "IO_Handler broadcast input" );
+		}
+		MPI_Bcast( blob, (int)blobSize, MPI_BYTE, 0, comm );
+		if( rank != 0 ) {
+			Journal_Firewall( Dictionary_ReadBinary( received, blob, blobSize ), errorStream,
+				"Error: the input dictionary received from rank 0 is corrupt.\n" );
+		}
+		_IO_Handler_MoveEntries( dictionary, received );
+	}
+
+	if( blob ) {
+		Memory_Free( blob );
+	}
+	if( cacheFilename ) {
+		Memory_Free( cacheFilename );
+	}
+	Stg_Class_Delete( received );
+
+	return header[0] ? True : False;
+}
+
+
+Bool IO_Handler_ReadAllFromFileBroadcast( void* ioHandler, const char* filename, Dictionary* dictionary, MPI_Comm comm ) {
+	IO_Handler* self = (IO_Handler*) ioHandler;
+	char*       filenames[1];
+
+	filenames[0] = (char*)filename;
+	return _IO_Handler_ReadAllFilesBroadcast( self, filenames, 1, dictionary, comm );
+}
+
+
+Index IO_Handler_ReadAllFromCommandLineBroadcast( void* ioHandler, int argc, char* argv[], Dictionary* dictionary,
+		MPI_Comm comm )
+{
+	IO_Handler* self          = (IO_Handler*) ioHandler;
+	Stream*     errorStream   = Journal_Register( Error_Type, CURR_MODULE_NAME );
+	char**      filenames     = Memory_Alloc_Array( char*, argc, "IO_Handler broadcast filenames" );
+	Index       arg_I;
+	char*       extension;
+	Bool        result;
+	Index       filesRead = 0;
+
+	/* Same selection as IO_Handler_ReadAllFilesFromCommandLine: every argument with a ".xml" extension */
+	for ( arg_I = 1 ; arg_I < argc ; arg_I++ ) {
+		extension = strrchr( argv[ arg_I ], '.' );
+		if ( extension != NULL && strcasecmp( extension, ".xml" ) == 0 )
+			filenames[ filesRead++ ] = argv[ arg_I ];
+	}
+
+	if ( filesRead > 0 ) {
+		result = _IO_Handler_ReadAllFilesBroadcast( self, filenames, filesRead, dictionary, comm );
+		Journal_Firewall( result, errorStream, 
+				"Error: %s could not read its input files. Exiting.\n", argv[0] );
+	}
+	Memory_Free( filenames );
+
+	Dictionary_ReadAllParamFromCommandLine( dictionary, argc, argv );
+
+	return filesRead;
+}
@@ -40,6 +40,8 @@
 
 #ifndef __Base_IO_IO_Handler_h__
 #define __Base_IO_IO_Handler_h__
+
+#include <mpi.h>
 	
 	/* Function pointer interface for inherited classes to use */
 	typedef void (IO_Handler_DeleteFunction) (void* io_handler);
@@ -69,7 +71,9 @@
 		/* IO_Handler info */ \
 		Dictionary*				currDictionary; \
 		char*					resource; \
-		char*					currPath;
+		char*					currPath; \
+		Index					filesReadCount; \
+		char**					filesRead;	/**< Every file parsed, including includes. */
 	struct _IO_Handler { __IO_Handler };
 	
 	/* No "IO_Handler_New" and "IO_Handler_Init" as this is an abstract class */
@@ -142,5 +146,21 @@
 	/** Runs IO_Handler_ReadAllFilesFromCommandLineForceSource and Dictionary_ReadAllParamFromCommandLine.
 	Returns the number of files successfully read. */
 	Index IO_Handler_ReadAllFromCommandLineForceSource( void* ioHandler, int argc, char* argv[], Dictionary* dictionary ) ;
+
+	/** Records that a file has been parsed (used to validate the input cache). Duplicates are ignored. */
+	void IO_Handler_AddFileRead( void* ioHandler, const char* filename );
+
+	/** As IO_Handler_ReadAllFromFile, but only rank 0 of comm parses the file; the resulting entries are sent to
+	every rank as a single Dictionary_WriteBinary blob. If the environment variable STG_INPUT_CACHE names a
+	directory, rank 0 also keeps the blob there, keyed by a hash of the input files, and reuses it while the
+	files parsed to make it are unchanged. Entries whose keys are already in the dictionary are replaced.
+	Must be called by every rank of comm. */
+	Bool IO_Handler_ReadAllFromFileBroadcast( void* ioHandler, const char* filename, Dictionary* dictionary, 
+		MPI_Comm comm ) ;
+
+	/** As IO_Handler_ReadAllFromCommandLine, but the ".xml" files are parsed by rank 0 of comm only and broadcast
+	(see IO_Handler_ReadAllFromFileBroadcast). Returns the number of files read. */
+	Index IO_Handler_ReadAllFromCommandLineBroadcast( void* ioHandler, int argc, char* argv[], Dictionary* dictionary,
+		MPI_Comm comm ) ;
 	
 #endif /* __Base_IO_IO_Handler_h__ */
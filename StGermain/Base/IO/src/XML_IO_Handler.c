@@ -623,6 +623,9 @@ static void _XML_IO_Handler_OpenFile( XML_IO_Handler* self, const char* filename
 	if ( self->currDoc == NULL ) {
 		xmlCleanupParser();
 	}
+	else {
+		IO_Handler_AddFileRead( self, filename );
+	}
 	if ( self->resource ) {
 		Memory_Free( self->resource );
 	}
@@ -880,6 +883,9 @@ static void _XML_IO_Handler_ParseNodes( XML_IO_Handler* self, xmlNodePtr cur, Di
 							spaceStrippedFileName );
 					}
 					
+					for ( i = 0; i < newHandler->filesReadCount; i++ ) {
+						IO_Handler_AddFileRead( self, newHandler->filesRead[i] );
+					}
 					Stg_Class_Delete( newHandler );
 				}
 				xmlFree( filename );
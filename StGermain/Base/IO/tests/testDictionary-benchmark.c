@@ -0,0 +1,124 @@
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+**
+** Copyright (C), 2003, Victorian Partnership for Advanced Computing (VPAC) Ltd, 110 Victoria Street, Melbourne, 3053, Australia.
+**
+** Authors:
+**	Stevan M. Quenette, Senior Software Engineer, VPAC. (steve@vpac.org)
+**	Patrick D. Sunter, Software Engineer, VPAC. (pds@vpac.org)
+**	Luke J. Hodkinson, Computational Engineer, VPAC. (lhodkins@vpac.org)
+**	Siew-Ching Tan, Software Engineer, VPAC. (siew@vpac.org)
+**	Alan H. Lo, Computational Engineer, VPAC. (alan@vpac.org)
+**	Raquibul Hassan, Computational Engineer, VPAC. (raq@vpac.org)
+**
+**  This library is free software; you can redistribute it and/or
+**  modify it under the terms of the GNU Lesser General Public
+**  License as published by the Free Software Foundation; either
+**  version 2.1 of the License, or (at your option) any later version.
+**
+**  This library is distributed in the hope that it will be useful,
+**  but WITHOUT ANY WARRANTY; without even the implied warranty of
+**  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+**  Lesser General Public License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License along with this library; if not, write to the Free Software
+**  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+**
+** $Id: testDictionary-benchmark.c 3743 2006-08-03 03:14:38Z KentHumphries $
+**
+**~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#include <mpi.h>
+#include "Base/Foundation/Foundation.h"
+#include "Base/IO/IO.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Times Dictionary_Get through the hash index against the linear strcmp scan it replaced, for dictionaries of
+   increasing size. Not a check, as the output is machine dependent:
+	testDictionary-benchmark [maxKeys] [lookups] */
+
+static Dictionary_Entry_Value* ScanGet( Dictionary* dictionary, Dictionary_Entry_Key key ) {
+	Dictionary_Index index;
+
+	for( index = 0; index < dictionary->count; index++ ) {
+		if( Dictionary_Entry_Compare( dictionary->entryPtr[index], key ) ) {
+			return dictionary->entryPtr[index]->value;
+		}
+	}
+	return NULL;
+}
+
+int main( int argc, char* argv[] ) {
+	Index         maxKeys = 10000;
+	Index         lookups = 1000000;
+	Index         keyCount;
+	Index         i;
+	Dictionary*   dictionary;
+	char**        keys;
+	unsigned long sum;
+	unsigned long checkSum;
+	double        start;
+	double        build;
+	double        scan;
+	double        hashed;
+	
+	MPI_Init( &argc, &argv );
+	BaseFoundation_Init( &argc, &argv );
+	BaseIO_Init( &argc, &argv );
+	
+	if( argc >= 2 ) {
+		maxKeys = atoi( argv[1] );
+	}
+	if( argc >= 3 ) {
+		lookups = atoi( argv[2] );
+	}
+	
+	keys = Memory_Alloc_Array( char*, maxKeys, "keys" );
+	for( i = 0; i < maxKeys; i++ ) {
+		keys[i] = Memory_Alloc_Array( char, 32, "key" );
+		sprintf( keys[i], "plugin%u.parameter", i );
+	}
+	
+	printf( "lookups %u\n", lookups );
+	printf( "%8s %10s %12s %12s %8s\n", "keys", "build(s)", "scan(s)", "hashed(s)", "speedup" );
+	for( keyCount = 4; keyCount <= maxKeys; keyCount *= 5 ) {
+		dictionary = Dictionary_New();
+		start = MPI_Wtime();
+		for( i = 0; i < keyCount; i++ ) {
+			Dictionary_Add( dictionary, keys[i], Dictionary_Entry_Value_FromUnsignedInt( i ) );
+		}
+		build = MPI_Wtime() - start;
+		
+		/* Same pseudo random sequence of keys for both */
+		start = MPI_Wtime();
+		for( sum = 0, i = 0; i < lookups; i++ ) {
+			sum += ScanGet( dictionary, keys[( i * 7919 ) % keyCount] )->as.typeUnsignedInt;
+		}
+		scan = MPI_Wtime() - start;
+		checkSum = sum;
+		
+		start = MPI_Wtime();
+		for( sum = 0, i = 0; i < lookups; i++ ) {
+			sum += Dictionary_Get( dictionary, keys[( i * 7919 ) % keyCount] )->as.typeUnsignedInt;
+		}
+		hashed = MPI_Wtime() - start;
+		
+		printf( "%8u %10.6f %12.6f %12.6f %7.1fx%s\n", keyCount, build, scan, hashed, scan / hashed, 
+			sum == checkSum ? "" : " MISMATCH" );
+		Stg_Class_Delete( dictionary );
+	}
+	
+	for( i = 0; i < maxKeys; i++ ) {
+		Memory_Free( keys[i] );
+	}
+	Memory_Free( keys );
+	
+	BaseIO_Finalise();
+	BaseFoundation_Finalise();
+	MPI_Finalize();
+	
+	return 0;
+}
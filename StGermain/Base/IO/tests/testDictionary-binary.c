@@ -0,0 +1,235 @@
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+**
+** Copyright (C), 2003, Victorian Partnership for Advanced Computing (VPAC) Ltd, 110 Victoria Street, Melbourne, 3053, Australia.
+**
+** Authors:
+**	Stevan M. Quenette, Senior Software Engineer, VPAC. (steve@vpac.org)
+**	Patrick D. Sunter, Software Engineer, VPAC. (pds@vpac.org)
+**	Luke J. Hodkinson, Computational Engineer, VPAC. (lhodkins@vpac.org)
+**	Siew-Ching Tan, Software Engineer, VPAC. (siew@vpac.org)
+**	Alan H. Lo, Computational Engineer, VPAC. (alan@vpac.org)
+**	Raquibul Hassan, Computational Engineer, VPAC. (raq@vpac.org)
+**
+**  This library is free software; you can redistribute it and/or
+**  modify it under the terms of the GNU Lesser General Public
+**  License as published by the Free Software Foundation; either
+**  version 2.1 of the License, or (at your option) any later version.
+**
+**  This library is distributed in the hope that it will be useful,
+**  but WITHOUT ANY WARRANTY; without even the implied warranty of
+**  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+**  Lesser General Public License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License along with this library; if not, write to the Free Software
+**  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+**
+** Role:
+**	Tests the flattened binary dictionary, and reading input on one rank and broadcasting it
+**
+** $Id: testDictionary-binary.c 3743 2006-08-03 03:14:38Z KentHumphries $
+**
+**~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#include "Base/Foundation/Foundation.h"
+#include "Base/IO/IO.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <mpi.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+static const char* CACHE_DIR = "./testDictionary-binary-cache";
+
+static void WriteInput( const char* filename, const char* contents ) {
+	FILE* file = fopen( filename, "w" );
+
+	fprintf( file, "<?xml version=\"1.0\"?>\n"
+		"<StGermainData xmlns=\"http://www.vpac.org/StGermain/XML_IO_Handler/Jun2003\">\n"
+		"%s\n"
+		"</StGermainData>\n", contents );
+	fclose( file );
+}
+
+static void RemoveCacheDir( void ) {
+	DIR*           dir = opendir( CACHE_DIR );
+	struct dirent* entry;
+	char           path[1024];
+
+	if( !dir ) {
+		return;
+	}
+	while( (entry = readdir( dir )) ) {
+		if( strcmp( entry->d_name, "." ) != 0 && strcmp( entry->d_name, ".." ) != 0 ) {
+			sprintf( path, "%s/%s", CACHE_DIR, entry->d_name );
+			remove( path );
+		}
+	}
+	closedir( dir );
+	rmdir( CACHE_DIR );
+}
+
+/* True only if the condition holds on every rank */
+static Bool AllRanks( Bool condition, MPI_Comm comm ) {
+	int local = condition ? 1 : 0;
+	int global;
+
+	MPI_Allreduce( &local, &global, 1, MPI_INT, MPI_LAND, comm );
+	return global ? True : False;
+}
+
+/* Reads the cache test input through a fresh handler, returning how many files rank 0 had to parse */
+static Index ReadCacheInput( const char* filename, Dictionary* dictionary, MPI_Comm comm ) {
+	XML_IO_Handler* io_handler = XML_IO_Handler_New();
+	Index           filesParsed;
+
+	IO_Handler_ReadAllFromFileBroadcast( io_handler, filename, dictionary, comm );
+	filesParsed = io_handler->filesReadCount;
+	Stg_Class_Delete( io_handler );
+	return filesParsed;
+}
+
+int main( int argc, char* argv[] ) {
+	MPI_Comm CommWorld;
+	int rank;
+	int numProcessors;
+	int procToWatch;
+	
+	/* Initialise MPI, get world info */
+	MPI_Init( &argc, &argv );
+	MPI_Comm_dup( MPI_COMM_WORLD, &CommWorld );
+	MPI_Comm_size( CommWorld, &numProcessors );
+	MPI_Comm_rank( CommWorld, &rank );
+	
+	BaseFoundation_Init( &argc, &argv );
+	BaseIO_Init( &argc, &argv );
+	
+	if( argc >= 2 ) {
+		procToWatch = atoi( argv[1] );
+	}
+	else {
+		procToWatch = 0;
+	}
+
+	{
+		XML_IO_Handler*		io_handler = XML_IO_Handler_New();
+		Dictionary*		xmlDictionary = Dictionary_New();
+		Dictionary*		binaryDictionary = Dictionary_New();
+		Dictionary*		corruptDictionary = Dictionary_New();
+		Dictionary*		expectedDictionary = Dictionary_New();
+		Dictionary*		broadcastDictionary = Dictionary_New();
+		Dictionary_Entry_Value*	conditions;
+		void*			blob;
+		SizeT			blobSize;
+		Bool			result;
+		
+		IO_Handler_ReadAllFromFile( io_handler, "data/binary.xml", xmlDictionary );
+
+		/* Round trip through the binary form */
+		blob = Dictionary_WriteBinary( xmlDictionary, &blobSize );
+		result = Dictionary_ReadBinary( binaryDictionary, blob, blobSize );
+		if( rank == procToWatch ) {
+			printf( "XML dictionary has %u entries, binary dictionary has %u entries\n", 
+				xmlDictionary->count, binaryDictionary->count );
+			printf( "Binary read succeeded: %s\n", result ? "True" : "False" );
+			printf( "XML and binary dictionaries equal: %s\n", 
+				Dictionary_Compare( xmlDictionary, binaryDictionary ) ? "True" : "False" );
+			printf( "Binary dictionary:\n" );
+			Dictionary_PrintConcise( binaryDictionary, Journal_Register( Info_Type, "myStream" ) );
+		}
+
+		/* A change deep inside a list of structs must be seen by the comparison */
+		conditions = Dictionary_Entry_Value_GetMember(
+			Dictionary_Entry_Value_GetElement( Dictionary_Get( binaryDictionary, "plugins" ), 1 ), "conditions" );
+		Dictionary_Entry_Value_SetFromDouble( 
+			Dictionary_Entry_Value_GetMember( Dictionary_Entry_Value_GetFirstElement( conditions ), "limit" ), 0.5 );
+		if( rank == procToWatch ) {
+			printf( "Equal after changing a nested value: %s\n", 
+				Dictionary_Compare( xmlDictionary, binaryDictionary ) ? "True" : "False" );
+		}
+
+		/* Truncated and foreign blobs are rejected */
+		result = Dictionary_ReadBinary( corruptDictionary, blob, blobSize - 1 );
+		if( rank == procToWatch ) {
+			printf( "Truncated blob read succeeded: %s\n", result ? "True" : "False" );
+		}
+		result = Dictionary_ReadBinary( corruptDictionary, "<?xml", 6 );
+		if( rank == procToWatch ) {
+			printf( "XML text read as a blob succeeded: %s\n", result ? "True" : "False" );
+		}
+		Memory_Free( blob );
+
+		/* Broadcast from rank 0 into a dictionary that already has a per rank entry: the same as every rank
+		 * parsing the file itself */
+		Dictionary_Add( expectedDictionary, "rank", Dictionary_Entry_Value_FromUnsignedInt( rank ) );
+		IO_Handler_ReadAllFromFile( io_handler, "data/binary.xml", expectedDictionary );
+		Dictionary_Add( broadcastDictionary, "rank", Dictionary_Entry_Value_FromUnsignedInt( rank ) );
+		result = IO_Handler_ReadAllFromFileBroadcast( io_handler, "data/binary.xml", broadcastDictionary, CommWorld );
+		result = AllRanks( result && Dictionary_Compare( expectedDictionary, broadcastDictionary ), CommWorld );
+		if( rank == procToWatch ) {
+			printf( "Broadcast dictionary equal to parsed dictionary on all ranks: %s\n", result ? "True" : "False" );
+		}
+
+		Stg_Class_Delete( io_handler );
+		Stg_Class_Delete( xmlDictionary );
+		Stg_Class_Delete( binaryDictionary );
+		Stg_Class_Delete( corruptDictionary );
+		Stg_Class_Delete( expectedDictionary );
+		Stg_Class_Delete( broadcastDictionary );
+	}
+
+	/* The input cache: reused while unchanged, rebuilt when an included file changes */
+	{
+		char            topFilename[1024];
+		char            includedFilename[1024];
+		Dictionary*     dictionary;
+		Index           filesParsed;
+		Index           pass;
+		unsigned int    expected[] = { 1, 1, 2 };
+		Bool            result;
+
+		sprintf( topFilename, "%s/top.xml", CACHE_DIR );
+		sprintf( includedFilename, "%s/included.xml", CACHE_DIR );
+		if( rank == 0 ) {
+			RemoveCacheDir();
+			mkdir( CACHE_DIR, 0755 );
+			WriteInput( topFilename, "<param name=\"top\">1</param>\n<include>included.xml</include>" );
+			WriteInput( includedFilename, "<param name=\"x\" type=\"uint\">1</param>" );
+		}
+		setenv( "STG_INPUT_CACHE", CACHE_DIR, 1 );
+
+		for( pass = 0; pass < 3; pass++ ) {
+			if( rank == 0 && pass == 2 ) {
+				WriteInput( includedFilename, "<param name=\"x\" type=\"uint\">2</param>" );
+			}
+			dictionary = Dictionary_New();
+			filesParsed = ReadCacheInput( topFilename, dictionary, CommWorld );
+			result = AllRanks( Dictionary_GetCount( dictionary ) == 2 && 
+				Dictionary_Entry_Value_AsUnsignedInt( Dictionary_Get( dictionary, "x" ) ) == expected[pass], 
+				CommWorld );
+			if( rank == procToWatch ) {
+				printf( "Cache pass %u: rank 0 parsed %u files, x = %u on all ranks: %s\n", pass, 
+					rank == 0 ? filesParsed : 0, expected[pass], result ? "True" : "False" );
+			}
+			Stg_Class_Delete( dictionary );
+		}
+
+		unsetenv( "STG_INPUT_CACHE" );
+		MPI_Barrier( CommWorld );
+		if( rank == 0 ) {
+			RemoveCacheDir();
+		}
+	}
+	
+	BaseIO_Finalise();
+	BaseFoundation_Finalise();
+
+	/* Close off MPI */
+	MPI_Finalize();
+	
+	return EXIT_SUCCESS;
+}
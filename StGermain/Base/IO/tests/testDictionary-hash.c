@@ -0,0 +1,142 @@
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+**
+** Copyright (C), 2003, Victorian Partnership for Advanced Computing (VPAC) Ltd, 110 Victoria Street, Melbourne, 3053, Australia.
+**
+** Authors:
+**	Stevan M. Quenette, Senior Software Engineer, VPAC. (steve@vpac.org)
+**	Patrick D. Sunter, Software Engineer, VPAC. (pds@vpac.org)
+**	Luke J. Hodkinson, Computational Engineer, VPAC. (lhodkins@vpac.org)
+**	Siew-Ching Tan, Software Engineer, VPAC. (siew@vpac.org)
+**	Alan H. Lo, Computational Engineer, VPAC. (alan@vpac.org)
+**	Raquibul Hassan, Computational Engineer, VPAC. (raq@vpac.org)
+**
+**  This library is free software; you can redistribute it and/or
+**  modify it under the terms of the GNU Lesser General Public
+**  License as published by the Free Software Foundation; either
+**  version 2.1 of the License, or (at your option) any later version.
+**
+**  This library is distributed in the hope that it will be useful,
+**  but WITHOUT ANY WARRANTY; without even the implied warranty of
+**  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+**  Lesser General Public License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License along with this library; if not, write to the Free Software
+**  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+**
+** Role:
+**	Tests that keyed lookups through the Dictionary's hash index keep first-match-wins semantics and insertion order
+**
+** $Id: testDictionary-hash.c 3743 2006-08-03 03:14:38Z KentHumphries $
+**
+**~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#include <mpi.h>
+#include "Base/Foundation/Foundation.h"
+#include "Base/IO/IO.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Fills a dictionary with count keys "key<i>", each given value i, then appends a second, later entry for every
+   seventh key, with value count + i. */
+static void FillDictionary( Dictionary* dictionary, Index count ) {
+	char  key[32];
+	Index i;
+
+	for( i = 0; i < count; i++ ) {
+		sprintf( key, "key%u", i );
+		Dictionary_AddWithSource( dictionary, key, Dictionary_Entry_Value_FromUnsignedInt( i ), "first" );
+	}
+	for( i = 0; i < count; i += 7 ) {
+		sprintf( key, "key%u", i );
+		Dictionary_AddMergeWithSource( dictionary, key, Dictionary_Entry_Value_FromUnsignedInt( count + i ), 
+			Dictionary_MergeType_Append, "duplicate" );
+	}
+}
+
+/* Checks every key finds its first entry, and that the entries are still in insertion order. */
+static Bool CheckFirstMatch( Dictionary* dictionary, Index count ) {
+	char              key[32];
+	Index             i;
+	Dictionary_Entry* entry;
+
+	for( i = 0; i < count; i++ ) {
+		sprintf( key, "key%u", i );
+		if( Dictionary_Entry_Value_AsUnsignedInt( Dictionary_Get( dictionary, key ) ) != i ||
+			strcmp( Dictionary_GetSource( dictionary, key ), "first" ) != 0 ||
+			( entry = Dictionary_GetEntry( dictionary, key ) ) != Dictionary_GetEntryByIndex( dictionary, i ) ) 
+		{
+			printf( "\tkey %s: wrong entry found\n", key );
+			return False;
+		}
+		if( strcmp( entry->key, key ) != 0 ) {
+			printf( "\tentry %u out of order\n", i );
+			return False;
+		}
+	}
+	for( i = 0; i < ( count + 6 ) / 7; i++ ) {
+		if( Dictionary_Entry_Value_AsUnsignedInt( Dictionary_GetByIndex( dictionary, count + i ) ) != count + i * 7 ) {
+			printf( "\tduplicate %u out of order\n", i );
+			return False;
+		}
+	}
+	return True;
+}
+
+int main( int argc, char* argv[] ) {
+	Index                   sizes[] = { 5, 8, 100, 5000 };
+	Index                   size_I;
+	Index                   count;
+	Dictionary*             dictionary;
+	Dictionary_Entry_Value* structValue;
+	Dictionary_Entry_Value* defaultValue;
+	char                    key[32];
+	Bool                    result;
+	
+	MPI_Init( &argc, &argv );
+	BaseFoundation_Init( &argc, &argv );
+	BaseIO_Init( &argc, &argv );
+
+	/* Sizes either side of where the index is built, and big enough to grow it several times */
+	for( size_I = 0; size_I < sizeof(sizes) / sizeof(sizes[0]); size_I++ ) {
+		count = sizes[size_I];
+		dictionary = Dictionary_New();
+		FillDictionary( dictionary, count );
+		printf( "%u keys, %u entries:\n", count, Dictionary_GetCount( dictionary ) );
+		printf( "\tfirst match found for every key, in insertion order: %s\n", 
+			CheckFirstMatch( dictionary, count ) ? "True" : "False" );
+
+		/* Set and GetDefault act on the first entry, and missing keys are not found */
+		sprintf( key, "key%u", count - 1 - ( count - 1 ) % 7 );
+		Dictionary_Set( dictionary, key, Dictionary_Entry_Value_FromUnsignedInt( 12345 ) );
+		result = Dictionary_Entry_Value_AsUnsignedInt( Dictionary_Get( dictionary, key ) ) == 12345 &&
+			Dictionary_Entry_Value_AsUnsignedInt( 
+				Dictionary_GetByIndex( dictionary, Dictionary_GetCount( dictionary ) - 1 ) ) ==
+				count + count - 1 - ( count - 1 ) % 7;
+		printf( "\tSet replaced the first entry only: %s\n", result ? "True" : "False" );
+		defaultValue = Dictionary_GetDefault( dictionary, "key0", Dictionary_Entry_Value_FromUnsignedInt( 999 ) );
+		printf( "\tGetDefault of an existing key: %u\n", Dictionary_Entry_Value_AsUnsignedInt( defaultValue ) );
+		printf( "\tmissing key found: %s\n", Dictionary_Get( dictionary, "key" ) ? "True" : "False" );
+		defaultValue = Dictionary_GetDefault( dictionary, "missing", Dictionary_Entry_Value_FromUnsignedInt( 999 ) );
+		printf( "\tGetDefault of a missing key: %u, now found: %s\n", Dictionary_Entry_Value_AsUnsignedInt( defaultValue ),
+			Dictionary_Get( dictionary, "missing" ) == defaultValue ? "True" : "False" );
+
+		Stg_Class_Delete( dictionary );
+	}
+
+	/* Struct members are looked up the same way */
+	structValue = Dictionary_Entry_Value_NewStruct();
+	FillDictionary( structValue->as.typeStruct, 100 );
+	Dictionary_Entry_Value_AddMember( structValue, "key14", Dictionary_Entry_Value_FromUnsignedInt( 999 ) );
+	printf( "Struct member key14: %u\n", 
+		Dictionary_Entry_Value_AsUnsignedInt( Dictionary_Entry_Value_GetMember( structValue, "key14" ) ) );
+	Dictionary_Entry_Value_Delete( structValue );
+
+	BaseIO_Finalise();
+	BaseFoundation_Finalise();
+	MPI_Finalize();
+
+	return EXIT_SUCCESS;
+}
@@ -43,6 +43,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <assert.h>
+#include <math.h>
 #include "MeshDecomp.h"
 #include "Decomp.h"
 #include "Decomp_Sync.h"
@@ -284,6 +285,7 @@ void _HexaEL_Init( HexaEL* self, Dimension_Index dim, IJK pointSize, IJK element
 	}
 	self->elementCount = self->elementSize[0] * self->elementSize[1] * self->elementSize[2];
 	assert( self->elementCount );
+	self->walkStart = self->elementCount;
 	
 	self->cornerCount = self->geometry->pointCount;
 	if( dim == 1 ) {
@@ -357,6 +359,7 @@ void* _HexaEL_Copy( void* hexaEL, void* dest, Bool deep, Name nameExt, PtrMap* p
 	newHexaEL->elementSize[0] = self->elementSize[0];
 	newHexaEL->elementSize[1] = self->elementSize[1];
 	newHexaEL->elementSize[2] = self->elementSize[2];
+	newHexaEL->walkStart = self->walkStart;
 	
 	return (void*)newHexaEL;
 }
@@ -452,6 +455,9 @@ void _HexaEL_Destroy( void* hexaEL, void* data )
 #define HEL_E_1DTo2D( self, index, ij )				\
 	HEL_E_1DTo2D_2( self, index, &(ij)[0], &(ij)[1] )
 
+/* Barycentric coordinate below which a walk's point may also lie in a neighbouring element. */
+#define HEL_WALK_FACE_TOLERANCE	1e-10
+
 
 void _HexaEL_BuildCornerIndices( void* hexaEL, Element_GlobalIndex globalIndex, Index* points ) {
 	HexaEL*		self = (HexaEL*)hexaEL;
@@ -1382,20 +1388,166 @@ Element_DomainIndex _HexaEL_ElementWithPoint1D( void* hexaEL, void* _decomp, Coo
 	abort();
 }
 
+/* Gathers the corners of a 2D or 3D element, ordered by IJK offset with I varying fastest. */
+static void _HexaEL_ElementCoords( HexaEL* self, IJK ijk, Coord* crds ) {
+	Geometry*	geometry = self->geometry;
+	unsigned	nCrds = (self->dim == 2) ? 4 : 8;
+	unsigned	c_i;
+
+	for( c_i = 0; c_i < nCrds; c_i++ ) {
+		geometry->pointAt( geometry, 
+				   HEL_P_3DTo1D_3( self, ijk[0] + (c_i & 1), ijk[1] + ((c_i >> 1) & 1), ijk[2] + ((c_i >> 2) & 1) ), 
+				   crds[c_i] );
+	}
+}
+
+
+/* Guesses the element containing a point from the extent of the first and last grid points. */
+static Element_GlobalIndex _HexaEL_CoarseElement( HexaEL* self, Coord point ) {
+	Geometry*	geometry = self->geometry;
+	Coord		lo, hi;
+	IJK		ijk = { 0, 0, 0 };
+	unsigned	d_i;
+
+	geometry->pointAt( geometry, 0, lo );
+	geometry->pointAt( geometry, geometry->pointCount - 1, hi );
+	for( d_i = 0; d_i < self->dim; d_i++ ) {
+		double	extent = hi[d_i] - lo[d_i];
+		double	guess;
+
+		if( extent == 0.0 )
+			continue;
+		guess = (point[d_i] - lo[d_i]) / extent * (double)self->elementSize[d_i];
+		if( guess >= (double)self->elementSize[d_i] )
+			ijk[d_i] = self->elementSize[d_i] - 1;
+		else if( guess > 0.0 )
+			ijk[d_i] = (unsigned)guess;
+	}
+
+	return HEL_E_3DTo1D_3( self, ijk[0], ijk[1], ijk[2] );
+}
+
+
+/* Approximates the point's position relative to an element as an affine map about its centroid, in units of 
+   element width; components lie within [-0.5, 0.5] when the point is inside. Returns False if the element is 
+   degenerate. */
+static Bool _HexaEL_LocalCoords( HexaEL* self, const Coord* crds, Coord point, double* xi ) {
+	unsigned	nCrds = (self->dim == 2) ? 4 : 8;
+	Coord		axes[3];
+	Coord		dist;
+	unsigned	c_i, d_i;
+
+	memset( axes, 0, sizeof(axes) );
+	memset( dist, 0, sizeof(Coord) );
+	for( c_i = 0; c_i < nCrds; c_i++ ) {
+		for( d_i = 0; d_i < 3; d_i++ ) {
+			unsigned	a_i;
+
+			dist[d_i] -= crds[c_i][d_i] / (double)nCrds;
+			for( a_i = 0; a_i < self->dim; a_i++ )
+				axes[a_i][d_i] += ((c_i >> a_i) & 1 ? 2.0 : -2.0) * crds[c_i][d_i] / (double)nCrds;
+		}
+	}
+	for( d_i = 0; d_i < 3; d_i++ )
+		dist[d_i] += point[d_i];
+
+	if( self->dim == 2 ) {
+		double	det = axes[0][0] * axes[1][1] - axes[0][1] * axes[1][0];
+
+		if( det == 0.0 )
+			return False;
+		xi[0] = (dist[0] * axes[1][1] - dist[1] * axes[1][0]) / det;
+		xi[1] = (axes[0][0] * dist[1] - axes[0][1] * dist[0]) / det;
+	}
+	else {
+		Coord	cross;
+		double	det;
+
+		Vector_Cross( cross, axes[1], axes[2] );
+		det = Vector_Dot( axes[0], cross );
+		if( det == 0.0 )
+			return False;
+		xi[0] = Vector_Dot( dist, cross ) / det;
+		Vector_Cross( cross, dist, axes[2] );
+		xi[1] = Vector_Dot( axes[0], cross ) / det;
+		Vector_Cross( cross, axes[1], dist );
+		xi[2] = Vector_Dot( axes[0], cross ) / det;
+	}
+
+	return True;
+}
+
+
+/* Returns the lowest domain index, among the found element and its neighbours, of an element containing the point, so a 
+   point on a shared face, edge or corner resolves as the scan over every element would. Only called when the point 
+   lies within rounding of one of the found element's faces; no other neighbour can contain it. */
+static Element_DomainIndex _HexaEL_LowestElementWithPoint( HexaEL* self, HexaMD* decomp, Coord point, 
+							   PartitionBoundaryStatus boundaryStatus, IJK ijk, 
+							   Element_DomainIndex elInd )
+{
+	int		lo[3], hi[3];
+	int		nbr[3];
+	unsigned	d_i;
+
+	for( d_i = 0; d_i < 3; d_i++ ) {
+		lo[d_i] = (d_i < self->dim && ijk[d_i] > 0) ? (int)ijk[d_i] - 1 : (int)ijk[d_i];
+		hi[d_i] = (d_i < self->dim && ijk[d_i] + 1 < self->elementSize[d_i]) ? (int)ijk[d_i] + 1 : (int)ijk[d_i];
+	}
+
+	for( nbr[2] = lo[2]; nbr[2] <= hi[2]; nbr[2]++ ) {
+		for( nbr[1] = lo[1]; nbr[1] <= hi[1]; nbr[1]++ ) {
+			for( nbr[0] = lo[0]; nbr[0] <= hi[0]; nbr[0]++ ) {
+				Element_GlobalIndex	gNbr = HEL_E_3DTo1D_3( self, nbr[0], nbr[1], nbr[2] );
+				Element_DomainIndex	dNbr = decomp->elementMapGlobalToDomain( decomp, gNbr );
+				IJK			nbrIJK;
+				Coord			crds[8];
+				unsigned		inds[4];
+				double			bc[4];
+
+				/* Anything at or above the current best, including elements outside the domain, can't win. */
+				if( dNbr >= elInd )
+					continue;
+
+				nbrIJK[0] = nbr[0]; nbrIJK[1] = nbr[1]; nbrIJK[2] = nbr[2];
+				_HexaEL_ElementCoords( self, nbrIJK, crds );
+				if( self->dim == 2 ? 
+				    _HexaEL_FindTriBarycenter( (const Coord*)crds, point, bc, inds, boundaryStatus, self->topo, gNbr ) : 
+				    _HexaEL_FindTetBarycenter( (const Coord*)crds, point, bc, inds, boundaryStatus, self->topo, gNbr ) )
+				{
+					elInd = dNbr;
+				}
+			}
+		}
+	}
+
+	return elInd;
+}
+
 Element_DomainIndex _HexaEL_ElementWithPoint2D( void* hexaEL, void* _decomp, Coord point, void* _mesh, 
 						PartitionBoundaryStatus boundaryStatus, unsigned nHints, unsigned* hints )
 {
 	HexaEL*		self = (HexaEL*)hexaEL;
 	HexaMD*		decomp = (HexaMD*)_decomp;
-	Geometry*       geometry = self->geometry;
 	Mesh*		mesh = (Mesh*)_mesh;
-	IJK		ij;
+	IJK		ijk;
 	Coord		crds[4];
 	unsigned	inds[3];
 	Coord		bc;
 	unsigned	nEls = nHints ? nHints : decomp->elementDomainCount;
 	unsigned	e_i;
 
+	/* Without hints, walk to the point before resorting to testing every element. */
+	if( nHints ) {
+		if( hints[0] < decomp->elementDomainCount )
+			self->walkStart = decomp->elementMapDomainToGlobal( decomp, hints[0] );
+	}
+	else {
+		Element_DomainIndex	elInd = _HexaEL_WalkToPoint( self, decomp, point, boundaryStatus );
+
+		if( elInd < decomp->elementDomainCount )
+			return elInd;
+	}
+
 	for( e_i = 0; e_i < nEls; e_i++ ) {
 		unsigned	elInd = nHints ? hints[e_i] : e_i;
 
@@ -1408,24 +1560,15 @@ Element_DomainIndex _HexaEL_ElementWithPoint2D( void* hexaEL, void* _decomp, Coo
 			elInd = Mesh_ElementMapDomainToGlobal( mesh, elInd );
 		else
 			elInd = decomp->elementMapDomainToGlobal( decomp, elInd );
-		HEL_E_1DTo2D( self, elInd, ij );
+		HEL_E_1DTo2D( self, elInd, ijk );
+		ijk[2] = 0;
 
 		/* Collect points. */
-		geometry->pointAt( geometry, 
-				   HEL_P_2DTo1D_2( self, ij[0], ij[1] ), 
-				   crds[0] );
-		geometry->pointAt( geometry, 
-				   HEL_P_2DTo1D_2( self, ij[0] + 1, ij[1] ), 
-				   crds[1] );
-		geometry->pointAt( geometry, 
-				   HEL_P_2DTo1D_2( self, ij[0], ij[1] + 1 ), 
-				   crds[2] );
-		geometry->pointAt( geometry, 
-				   HEL_P_2DTo1D_2( self, ij[0] + 1, ij[1] + 1 ), 
-				   crds[3] );
+		_HexaEL_ElementCoords( self, ijk, crds );
 		if( _HexaEL_FindTriBarycenter( (const Coord*)crds, point, bc, inds, 
 					       boundaryStatus, self->topo, elInd ) )
 		{
+			self->walkStart = elInd;
 			return decomp->elementMapGlobalToDomain( decomp, elInd );
 		}
 	}
@@ -1439,7 +1582,6 @@ Element_DomainIndex _HexaEL_ElementWithPoint3D( void* hexaEL, void* _decomp, Coo
 {
 	HexaEL*		self = (HexaEL*)hexaEL;
 	HexaMD*		decomp = (HexaMD*)_decomp;
-	Geometry*       geometry = self->geometry;
 	Mesh*		mesh = (Mesh*)_mesh;
 	IJK		ijk;
 	Coord		crds[8];
@@ -1448,6 +1590,18 @@ Element_DomainIndex _HexaEL_ElementWithPoint3D( void* hexaEL, void* _decomp, Coo
 	unsigned	nEls = nHints ? nHints : decomp->elementDomainCount;
 	unsigned	e_i;
 
+	/* Without hints, walk to the point before resorting to testing every element. */
+	if( nHints ) {
+		if( hints[0] < decomp->elementDomainCount )
+			self->walkStart = decomp->elementMapDomainToGlobal( decomp, hints[0] );
+	}
+	else {
+		Element_DomainIndex	elInd = _HexaEL_WalkToPoint( self, decomp, point, boundaryStatus );
+
+		if( elInd < decomp->elementDomainCount )
+			return elInd;
+	}
+
 	for( e_i = 0; e_i < nEls; e_i++ ) {
 		unsigned	elInd = nHints ? hints[e_i] : e_i;
 
@@ -1463,35 +1617,13 @@ Element_DomainIndex _HexaEL_ElementWithPoint3D( void* hexaEL, void* _decomp, Coo
 		HEL_E_1DTo3D( self, elInd, ijk );
 
 		/* Collect the coordinates. */
-		geometry->pointAt( geometry, 
-				   HEL_P_3DTo1D_3( self, ijk[0], ijk[1], ijk[2] ), 
-				   crds[0] );
-		geometry->pointAt( geometry, 
-				   HEL_P_3DTo1D_3( self, ijk[0] + 1, ijk[1], ijk[2] ), 
-				   crds[1] );
-		geometry->pointAt( geometry, 
-				   HEL_P_3DTo1D_3( self, ijk[0], ijk[1] + 1, ijk[2] ), 
-				   crds[2] );
-		geometry->pointAt( geometry, 
-				   HEL_P_3DTo1D_3( self, ijk[0] + 1, ijk[1] + 1, ijk[2] ), 
-				   crds[3] );
-		geometry->pointAt( geometry, 
-				   HEL_P_3DTo1D_3( self, ijk[0], ijk[1], ijk[2] + 1 ), 
-				   crds[4] );
-		geometry->pointAt( geometry, 
-				   HEL_P_3DTo1D_3( self, ijk[0] + 1, ijk[1], ijk[2] + 1 ), 
-				   crds[5] );
-		geometry->pointAt( geometry, 
-				   HEL_P_3DTo1D_3( self, ijk[0], ijk[1] + 1, ijk[2] + 1 ), 
-				   crds[6] );
-		geometry->pointAt( geometry, 
-				   HEL_P_3DTo1D_3( self, ijk[0] + 1, ijk[1] + 1, ijk[2] + 1 ), 
-				   crds[7] );
+		_HexaEL_ElementCoords( self, ijk, crds );
 
 		/* Find the barycenter. */
 		if( _HexaEL_FindTetBarycenter( (const Coord*)crds, point, bc, inds, 
 					       boundaryStatus, self->topo, elInd ) )
 		{
+			self->walkStart = elInd;
 			return decomp->elementMapGlobalToDomain( decomp, elInd );
 		}
 	}
@@ -1499,6 +1631,93 @@ Element_DomainIndex _HexaEL_ElementWithPoint3D( void* hexaEL, void* _decomp, Coo
 	return decomp->elementDomainCount;
 }
 
+
+Element_DomainIndex _HexaEL_WalkToPoint( void* hexaEL, void* _decomp, Coord point, 
+					 PartitionBoundaryStatus boundaryStatus )
+{
+	HexaEL*			self = (HexaEL*)hexaEL;
+	HexaMD*			decomp = (HexaMD*)_decomp;
+	unsigned		maxSteps = self->elementSize[0] + self->elementSize[1] + self->elementSize[2] + 4;
+	Element_GlobalIndex	elInd = self->walkStart;
+	unsigned		step_i;
+
+	if( !decomp->elementDomainCount )
+		return decomp->elementDomainCount;
+
+	/* Start from the last element found, or else from a coarse IJK guess. */
+	if( elInd >= self->elementCount || 
+	    decomp->elementMapGlobalToDomain( decomp, elInd ) >= decomp->elementDomainCount )
+	{
+		elInd = _HexaEL_CoarseElement( self, point );
+		if( decomp->elementMapGlobalToDomain( decomp, elInd ) >= decomp->elementDomainCount )
+			elInd = decomp->elementMapDomainToGlobal( decomp, 0 );
+	}
+
+	for( step_i = 0; step_i < maxSteps; step_i++ ) {
+		Coord		crds[8];
+		unsigned	inds[4];
+		double		bc[4];
+		double		xi[3];
+		int		step[3];
+		IJK		ijk;
+		unsigned	largest = 0;
+		Bool		moved = False;
+		unsigned	d_i;
+
+		HEL_E_1DTo3D( self, elInd, ijk );
+		_HexaEL_ElementCoords( self, ijk, crds );
+		if( self->dim == 2 ? 
+		    _HexaEL_FindTriBarycenter( (const Coord*)crds, point, bc, inds, boundaryStatus, self->topo, elInd ) : 
+		    _HexaEL_FindTetBarycenter( (const Coord*)crds, point, bc, inds, boundaryStatus, self->topo, elInd ) )
+		{
+			Element_DomainIndex	dElInd = decomp->elementMapGlobalToDomain( decomp, elInd );
+			unsigned		nBcs = (self->dim == 2) ? 3 : 4;
+			unsigned		bc_i;
+
+			/* On (or within rounding of) a face, a neighbour with a lower index may hold the point too. */
+			for( bc_i = 0; bc_i < nBcs; bc_i++ ) {
+				if( bc[bc_i] < HEL_WALK_FACE_TOLERANCE )
+					break;
+			}
+			if( bc_i < nBcs ) {
+				dElInd = _HexaEL_LowestElementWithPoint( self, decomp, point, boundaryStatus, ijk, dElInd );
+				elInd = decomp->elementMapDomainToGlobal( decomp, dElInd );
+			}
+
+			self->walkStart = elInd;
+			return dElInd;
+		}
+
+		/* Step towards the point by its local coordinates, at least one element along the dominant axis. */
+		if( !_HexaEL_LocalCoords( self, (const Coord*)crds, point, xi ) )
+			break;
+		for( d_i = 0; d_i < self->dim; d_i++ ) {
+			step[d_i] = (int)floor( xi[d_i] + 0.5 );
+			if( fabs( xi[d_i] ) > fabs( xi[largest] ) )
+				largest = d_i;
+		}
+		if( !step[0] && !step[1] && (self->dim == 2 || !step[2]) )
+			step[largest] = xi[largest] > 0.0 ? 1 : -1;
+
+		for( d_i = 0; d_i < self->dim; d_i++ ) {
+			int	next = (int)ijk[d_i] + step[d_i];
+
+			if( next < 0 ) next = 0;
+			if( next > (int)self->elementSize[d_i] - 1 ) next = self->elementSize[d_i] - 1;
+			if( next != (int)ijk[d_i] ) moved = True;
+			ijk[d_i] = next;
+		}
+		if( !moved )
+			break;
+
+		elInd = HEL_E_3DTo1D_3( self, ijk[0], ijk[1], ijk[2] );
+		if( decomp->elementMapGlobalToDomain( decomp, elInd ) >= decomp->elementDomainCount )
+			break;
+	}
+
+	return decomp->elementDomainCount;
+}
+
 #if 0
 Element_DomainIndex _HexaEL_ElementWithPoint3D( void* hexaEL, void* decomp, Coord point,
 						PartitionBoundaryStatus boundaryStatus, unsigned nHints, unsigned* hints )
@@ -55,7 +55,9 @@
 		Dimension_Index dim;       \
 		IJK				pointSize; \
 		IJK				elementSize; \
-		Bool                            topologyWasCreatedInternally;
+		Bool                            topologyWasCreatedInternally; \
+		/* Global element that a point-location walk starts from: the last element found, or the first hint tried */ \
+		Element_GlobalIndex		walkStart;
 		
 	struct _HexaEL { __HexaEL };
 	
@@ -184,6 +186,12 @@
 	Element_DomainIndex _HexaEL_ElementWithPoint3D( void* hexaEL, void* decomp, Coord point, void* mesh, 
 							PartitionBoundaryStatus boundaryStatus, unsigned nHints, unsigned* hints );
 	
+	/* Locate a point by walking the structured element grid from self->walkStart, stepping by the point's
+	   approximate local coordinates within each element visited. Returns elementDomainCount if the walk leaves
+	   the domain or does not settle, in which case the caller falls back to testing every element. */
+	Element_DomainIndex _HexaEL_WalkToPoint( void* hexaEL, void* decomp, Coord point, 
+						 PartitionBoundaryStatus boundaryStatus );
+	
 	
 	/*--------------------------------------------------------------------------------------------------------------------------
 	** Public member functions
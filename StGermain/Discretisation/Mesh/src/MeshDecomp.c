@@ -639,21 +639,9 @@ Node_LocalIndex _MeshDecomp_Node_GlobalToLocal1D( void* meshDecomp, Node_GlobalI
 		return MD_N_Invalid( self );
 	}
 	else {
-		int		lNode_I = 0;
-		IndexSet_Index	index;
-		
 		/* since we now know this global index corresponds to a local node, just 
-		find out how many other local nodes there are before it.
-		
-		THIS IS THE SLOWEST FUNCTION IN THE WORLD YET DISCOVERED 
-		 */
-		for( index = 0; index < globalIndex; index++ ) {
-			if( IndexSet_IsMember( self->localNodeSets[self->rank], index ) ) {
-				lNode_I++;
-			}
-		}	
-		
-		return lNode_I;
+		find out how many other local nodes there are before it. */
+		return IndexSet_CountMembersBefore( self->localNodeSets[self->rank], globalIndex );
 	}
 }
 
@@ -666,18 +654,9 @@ Node_ShadowIndex _MeshDecomp_Node_GlobalToShadow1D( void* meshDecomp, Node_Globa
 		return MD_N_Invalid( self );
 	}	
 	else {
-		IndexSet_Index	index;
-		Node_ShadowIndex	sNode_I = 0;
-		
 		/* since we now know this global index corresponds to a shadow node, just 
 		find out how many other shadow nodes there are before it. */
-		for( index = 0; index < globalIndex; index++ ) {
-			if( IndexSet_IsMember( self->shadowNodeSets[self->rank], index ) ) {
-				sNode_I++;
-			}
-		}	
-		
-		return sNode_I;
+		return IndexSet_CountMembersBefore( self->shadowNodeSets[self->rank], globalIndex );
 	}
 	
 	return MD_N_Invalid( self );
@@ -734,18 +713,9 @@ Element_LocalIndex _MeshDecomp_Element_GlobalToLocal1D( void* meshDecomp, Elemen
 		return MD_E_Invalid( self );
 	}
 	else {
-		int		lElement_I = 0;
-		IndexSet_Index	index;
-		
 		/* since we now know this global index corresponds to a local element, just 
 		find out how many other local elements there are before it. */
-		for( index = 0; index < globalIndex; index++ ) {
-			if( IndexSet_IsMember( self->localElementSets[self->rank], index ) ) {
-				lElement_I++;
-			}
-		}	
-		
-		return lElement_I;
+		return IndexSet_CountMembersBefore( self->localElementSets[self->rank], globalIndex );
 	}
 }
 
@@ -758,18 +728,9 @@ Element_ShadowIndex _MeshDecomp_Element_GlobalToShadow1D( void* meshDecomp, Elem
 		return MD_E_Invalid( self );
 	}	
 	else {
-		IndexSet_Index	index;
-		Element_ShadowIndex	sElement_I = 0;
-		
 		/* since we now know this global index corresponds to a shadow element, just 
 		find out how many other shadow elements there are before it. */
-		for( index = 0; index < globalIndex; index++ ) {
-			if( IndexSet_IsMember( self->shadowElementSets[self->rank], index ) ) {
-				sElement_I++;
-			}
-		}	
-		
-		return sElement_I;
+		return IndexSet_CountMembersBefore( self->shadowElementSets[self->rank], globalIndex );
 	}
 	
 	return MD_E_Invalid( self );
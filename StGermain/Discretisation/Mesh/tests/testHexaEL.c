@@ -50,6 +50,8 @@ int main( int argc, char* argv[] ) {
 	NodeLayout*		nLayout;
 	HexaMD*			meshDecomp;
 	Element_GlobalIndex	e_I;
+	unsigned*		allElements;
+	Element_DomainIndex*	walked;
 	Index			i;
 	
 	/* Initialise MPI, get world info */
@@ -119,6 +121,31 @@ int main( int argc, char* argv[] ) {
 	}
 	printf( "\n" );
 	
+	/* Grid points lie on the faces, edges and corners shared between elements: the walk must pick the same 
+	   element as testing every one in turn. Walking them backwards starts each walk in a higher element. */
+	printf( "Element with grid point:\n" );
+	allElements = Memory_Alloc_Array( unsigned, meshDecomp->elementDomainCount, "allElements" );
+	walked = Memory_Alloc_Array( Element_DomainIndex, geometry->pointCount, "walked" );
+	for( e_I = 0; e_I < meshDecomp->elementDomainCount; e_I++ )
+		allElements[e_I] = e_I;
+	for( i = geometry->pointCount; i > 0; i-- ) {
+		Coord point;
+		
+		geometry->pointAt( geometry, i - 1, point );
+		walked[i - 1] = eLayout->elementWithPoint( eLayout, meshDecomp, point, NULL, INCLUSIVE_UPPER_BOUNDARY, 0, NULL );
+	}
+	for( i = 0; i < geometry->pointCount; i++ ) {
+		Coord point;
+		
+		geometry->pointAt( geometry, i, point );
+		printf( "\tPoint %u : %u (scan %u)\n", i, walked[i], 
+			eLayout->elementWithPoint( eLayout, meshDecomp, point, NULL, INCLUSIVE_UPPER_BOUNDARY, 
+						   meshDecomp->elementDomainCount, allElements ) );
+	}
+	printf( "\n" );
+	Memory_Free( walked );
+	Memory_Free( allElements );
+	
 	Stg_Class_Delete( dictionary );
 	Stg_Class_Delete( meshDecomp );
 	Stg_Class_Delete( nLayout );
@@ -56,29 +56,29 @@
 		/* General info */ \
 		Stream*				debug; \
 		Swarm*				swarm; \
-		Particle_Index* 		shadowParticlesLeavingMeIndices; \
+		/** procs exchanged with: the cell layout's nbr procs, or every other proc if it has no shadow cells */ \
+		Neighbour_Index			nbrCount; \
+		Processor_Index*		nbrTbl; \
 		Index				shadowParticlesLeavingMeTotalCount; \
-		Index				shadowParticlesLeavingMeUnfilledCount; \
-		Index				currShadowParticleLeavingMeIndex; \
 		Particle_Index* 		particlesOutsideDomainIndices; \
 		Index				particlesOutsideDomainTotalCount; \
-		Index				particlesOutsideDomainUnfilledCount; \
-		Index				currParticleLeavingMyDomainIndex; \
-		/** cnts of [nbr][st_cell] outgoing particles */ \
-		Particle_Index**		shadowParticlesLeavingMeCountsPerCell; \
-		/** cnts of [nbr] total outgoing particles via my shadow cells to nbr procs */ \
-		Particle_Index*			shadowParticlesLeavingMeTotalCounts; \
-		/** transfer array [nbr] of particles to send */ \
-		Particle**			shadowParticlesLeavingMe; \
-		MPI_Request**			shadowParticlesLeavingMeHandles; \
-		/** cnts of [nbr][st_cell] incoming particles */ \
-		Particle_Index**		particlesArrivingFromNbrShadowCellCounts; \
-		MPI_Request**			particlesArrivingFromNbrShadowCellCountsHandles; \
-		/** cnts of [nbr] total incoming particles via shadow cells of nbr procs */\
-		Particle_Index*			particlesArrivingFromNbrShadowCellsTotalCounts; \
-		/** transfer array [nbr] of particles to recv */ \
-		Particle**			particlesArrivingFromNbrShadowCells; \
-		MPI_Request**			particlesArrivingFromNbrShadowCellsHandles; \
+		Index				particlesArrivingMyDomainCount; \
+		/** cnts of [nbr][st_cell] outgoing particles, the last entry being those outside my domain */ \
+		Particle_Index**		particlesLeavingMeCounts; \
+		MPI_Request*			particlesLeavingMeCountsHandles; \
+		/** cnts of [nbr] total outgoing particles */ \
+		Particle_Index*			particlesLeavingMeTotalCounts; \
+		/** packed transfer array [nbr] of particles to send */ \
+		Particle**			particlesLeavingMe; \
+		MPI_Request*			particlesLeavingMeHandles; \
+		/** cnts of [nbr][st_cell] incoming particles, the last entry being those outside nbr's domain */ \
+		Particle_Index**		particlesArrivingCounts; \
+		MPI_Request*			particlesArrivingCountsHandles; \
+		/** cnts of [nbr] total incoming particles */ \
+		Particle_Index*			particlesArrivingTotalCounts; \
+		/** packed transfer array [nbr] of particles to recv */ \
+		Particle**			particlesArriving; \
+		MPI_Request*			particlesArrivingHandles; \
 		Bool				defensive;
 
 
@@ -147,32 +147,20 @@
 
 	/* --- private functions --- */
 
-	void _ParticleCommHandler_SendParticleTotalsInShadowCellsToNbrs( ParticleCommHandler* self );
-
-	void _ParticleCommHandler_NonBlockingSendParticlesInShadowCellsToNbrs( ParticleCommHandler* self );
-
-	void _ParticleCommHandler_ReceiveAndUpdateShadowParticlesEnteringMyDomain( ParticleCommHandler* self );
+	void _ParticleCommHandler_FindNbrs( ParticleCommHandler* self );
 
 	void _ParticleCommHandler_FindParticlesThatHaveMovedOutsideMyDomain( ParticleCommHandler* self );
 
-	void
-	_ParticleCommHandler_ShareAndUpdateParticlesThatHaveMovedOutsideDomains(
-		ParticleCommHandler* self,
-		Particle_Index*      globalParticlesArrivingMyDomainCountPtr,
-		Particle_Index*      globalParticlesOutsideDomainTotalPtr );
+	void _ParticleCommHandler_SendParticleTotalsToNbrs( ParticleCommHandler* self );
+
+	void _ParticleCommHandler_NonBlockingSendParticlesToNbrs( ParticleCommHandler* self );
 
-	void _ParticleCommHandler_GetCountOfParticlesOutsideDomainPerProcessor(
-		ParticleCommHandler*	self,
-		Particle_Index**	globalParticlesOutsideDomainCountsPtr,
-		Particle_Index*		maxGlobalParticlesOutsideDomainCountPtr,
-		Particle_Index*		globalParticlesOutsideDomainTotalPtr );
-		
-	Particle_Index _ParticleCommHandler_FindFreeSlotAndPrepareForInsertion( ParticleCommHandler* self );
+	void _ParticleCommHandler_NonBlockingRecvParticlesFromNbrs( ParticleCommHandler* self );
 
-	void _ParticleCommHandler_FillRemainingHolesInLocalParticlesArray( ParticleCommHandler*	self );
+	void _ParticleCommHandler_CompactLocalParticlesArray( ParticleCommHandler* self );
 
-	Particle_Index* _ParticleCommHandler_MergeListsOfUnfilledParticleSlots( ParticleCommHandler* self );
+	void _ParticleCommHandler_ReceiveAndUpdateParticlesEnteringMyDomain( ParticleCommHandler* self );
 
-	void _ParticleCommHandler_PrintParticleSlotsYetToFill( ParticleCommHandler* self );
+	void _ParticleCommHandler_CheckParticlesLeavingMyDomainWereFound( ParticleCommHandler* self );
 
 #endif
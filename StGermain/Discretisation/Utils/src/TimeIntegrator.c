@@ -43,6 +43,9 @@
 
 #include <assert.h>
 #include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
 
 /* Textual name of this class */
 const Type TimeIntegrator_Type = "TimeIntegrator";
@@ -130,9 +133,19 @@ void _TimeIntegrator_Init(
 	self->setupData = Stg_ObjectList_New();
 	self->finishData = Stg_ObjectList_New();
 
+	self->timings     = NULL;
+	self->timingCount = 0;
+	self->timingSize  = 0;
+
 	if ( context ) {
+		EntryPoint* destroyEP = Context_GetEntryPoint( context, AbstractContext_EP_Destroy );
+
 		EP_AppendClassHook( Context_GetEntryPoint( context, AbstractContext_EP_UpdateClass ), 
 				TimeIntegrator_UpdateClass, self );
+
+		/* One hook writes the tables of all the context's integrators */
+		if ( !Stg_ObjectList_Get( destroyEP->hooks, "_TimeIntegrator_WriteAllTimings" ) )
+			EP_Append( destroyEP, _TimeIntegrator_WriteAllTimings );
 	}
 }
 
@@ -145,6 +158,14 @@ void _TimeIntegrator_Delete( void* timeIntegrator ) {
 	
 	Stg_Class_Delete( self->setupData );
 	Stg_Class_Delete( self->finishData );
+
+	if ( self->timings ) {
+		Index timing_I;
+
+		for ( timing_I = 0 ; timing_I < self->timingCount ; timing_I++ )
+			Memory_Free( self->timings[timing_I].name );
+		Memory_Free( self->timings );
+	}
 	
 	/* Stg_Class_Delete parent*/
 	_Stg_Component_Delete( self );
@@ -305,7 +326,9 @@ void _TimeIntegrator_ExecuteEuler( void* timeIntegrator, void* data ) {
 	
 		wallTime = MPI_Wtime();
 		TimeIntegratee_FirstOrder( integratee, integratee->variable, dt );
-		Journal_Printf(self->info,"\t1st order: %35s - %9.4f (secs)\n", integratee->name, MPI_Wtime()-wallTime);
+		wallTime = MPI_Wtime() - wallTime;
+		TimeIntegrator_AddTiming( self, TimeIntegrator_Timing_Integratee, integratee->name, wallTime );
+		Journal_Printf(self->info,"\t1st order: %35s - %9.4f (secs)\n", integratee->name, wallTime);
 	}
 	TimeIntegrator_Finalise( self );
 }
@@ -332,7 +355,9 @@ void _TimeIntegrator_ExecuteRK2( void* timeIntegrator, void* data ) {
 		
 		wallTime = MPI_Wtime();
 		TimeIntegratee_SecondOrder( integratee, integratee->variable, dt );
-		Journal_Printf(self->info,"\t2nd order: %35s - %9.4f (secs)\n", integratee->name, MPI_Wtime()-wallTime);
+		wallTime = MPI_Wtime() - wallTime;
+		TimeIntegrator_AddTiming( self, TimeIntegrator_Timing_Integratee, integratee->name, wallTime );
+		Journal_Printf(self->info,"\t2nd order: %35s - %9.4f (secs)\n", integratee->name, wallTime);
 		
 	}
 	
@@ -359,7 +384,9 @@ void _TimeIntegrator_ExecuteRK4( void* timeIntegrator, void* data ) {
 		TimeIntegrator_SetTime( self, context->currentTime );
 		wallTime = MPI_Wtime();
 		TimeIntegratee_FourthOrder( integratee, integratee->variable, dt );
-		Journal_Printf(self->info,"\t4th order: %35s - %9.4f (secs)\n", integratee->name, MPI_Wtime()-wallTime);
+		wallTime = MPI_Wtime() - wallTime;
+		TimeIntegrator_AddTiming( self, TimeIntegrator_Timing_Integratee, integratee->name, wallTime );
+		Journal_Printf(self->info,"\t4th order: %35s - %9.4f (secs)\n", integratee->name, wallTime);
 	}
 	TimeIntegrator_Finalise( self );
 }
@@ -427,6 +454,7 @@ void _TimeIntegrator_ExecuteRK4Simultaneous( void* timeIntegrator, void* data )
 	TimeIntegratee*        integratee;
 	Variable**             originalVariableList;
 	Variable**             timeDerivVariableList;
+	double                 wallTime;
 
 	Journal_DPrintf( self->debug, "In %s for %s '%s'\n", __func__, self->type, self->name );
 
@@ -440,6 +468,7 @@ void _TimeIntegrator_ExecuteRK4Simultaneous( void* timeIntegrator, void* data )
 	TimeIntegrator_Setup( self );
 	for ( integratee_I = 0 ; integratee_I < integrateeCount ; integratee_I++ ) {
 		integratee = TimeIntegrator_GetByIndex( self, integratee_I );
+		wallTime = MPI_Wtime();
 		Journal_Printf(self->info,"\t2nd order (simultaneous): %s\n", integratee->name);
 
 		/* Store Original Position Variable */
@@ -451,6 +480,8 @@ void _TimeIntegrator_ExecuteRK4Simultaneous( void* timeIntegrator, void* data )
 
 		/* 1st Step */
 		TimeIntegratee_FirstOrder( integratee, integratee->variable, 0.5 * dt );
+
+		TimeIntegrator_AddTiming( self, TimeIntegrator_Timing_Integratee, integratee->name, MPI_Wtime() - wallTime );
 	}
 	TimeIntegrator_Finalise( self );
 	
@@ -461,23 +492,29 @@ void _TimeIntegrator_ExecuteRK4Simultaneous( void* timeIntegrator, void* data )
 	TimeIntegrator_Setup( self );
 	for ( integratee_I = 0 ; integratee_I < integrateeCount ; integratee_I++ ) {
 		integratee = TimeIntegrator_GetByIndex( self, integratee_I );
+		wallTime = MPI_Wtime();
 
 		/* Add k2 */
 		TimeIntegratee_Add2TimesTimeDeriv( integratee, timeDerivVariableList[ integratee_I ] );
 
 		TimeIntegratee_FirstOrder( integratee, originalVariableList[ integratee_I ], 0.5 * dt );
+
+		TimeIntegrator_AddTiming( self, TimeIntegrator_Timing_Integratee, integratee->name, MPI_Wtime() - wallTime );
 	}
 	TimeIntegrator_Finalise( self );
 
 	TimeIntegrator_Setup( self );
 	for ( integratee_I = 0 ; integratee_I < integrateeCount ; integratee_I++ ) {
 		integratee = TimeIntegrator_GetByIndex( self, integratee_I );
+		wallTime = MPI_Wtime();
 		
 		/* Add k3 */
 		TimeIntegratee_Add2TimesTimeDeriv( integratee, timeDerivVariableList[ integratee_I ] );
 
 		/* 3rd Step */
 		TimeIntegratee_FirstOrder( integratee, originalVariableList[ integratee_I ], dt );
+
+		TimeIntegrator_AddTiming( self, TimeIntegrator_Timing_Integratee, integratee->name, MPI_Wtime() - wallTime );
 	}
 	TimeIntegrator_Finalise( self );
 	
@@ -487,8 +524,10 @@ void _TimeIntegrator_ExecuteRK4Simultaneous( void* timeIntegrator, void* data )
 	TimeIntegrator_Setup( self );
 	for ( integratee_I = 0 ; integratee_I < integrateeCount ; integratee_I++ ) {
 		integratee = TimeIntegrator_GetByIndex( self, integratee_I );
+		wallTime = MPI_Wtime();
 
 		TimeIntegratee_FourthOrderFinalStep( integratee, originalVariableList[ integratee_I ], timeDerivVariableList[ integratee_I ], dt );
+		TimeIntegrator_AddTiming( self, TimeIntegrator_Timing_Integratee, integratee->name, MPI_Wtime() - wallTime );
 
 		/* Free Original */
 		Stg_Class_Delete( timeDerivVariableList[ integratee_I ] );
@@ -523,9 +562,11 @@ void TimeIntegrator_Setup( void* timeIntegrator ) {
 		
 		((EntryPoint_2VoidPtr_Cast*)((Hook*)entryPoint->hooks->data[hookIndex])->funcPtr)(
 			self, Stg_ObjectList_At( self->setupData, hookIndex ) );
+		wallTime = MPI_Wtime() - wallTime;
+		TimeIntegrator_AddTiming( self, TimeIntegrator_Timing_Setup, (entryPoint->hooks->data[hookIndex])->name, wallTime );
 			
 		Journal_Printf(self->info,"\t       EP: %35s - %9.4f (secs)\n",(entryPoint->hooks->data[hookIndex])->name,
-			MPI_Wtime()-wallTime);	
+			wallTime);	
 	}		
 }
 
@@ -555,9 +596,11 @@ void TimeIntegrator_Finalise( void* timeIntegrator ) {
 		
 		((EntryPoint_2VoidPtr_Cast*)((Hook*)entryPoint->hooks->data[hookIndex])->funcPtr)(
 			self, Stg_ObjectList_At( self->finishData, hookIndex ) );
+		wallTime = MPI_Wtime() - wallTime;
+		TimeIntegrator_AddTiming( self, TimeIntegrator_Timing_Finish, (entryPoint->hooks->data[hookIndex])->name, wallTime );
 		
 		Journal_Printf(self->info,"\t       EP: %35s - %9.4f (secs)\n",(entryPoint->hooks->data[hookIndex])->name,
-				MPI_Wtime()-wallTime);	
+				wallTime);	
 
 
 	}
@@ -633,6 +676,177 @@ double TimeIntegrator_GetTime( void* timeIntegrator ) {
 	return self->time;
 }
 
+/* +++ Timings +++ */
+
+static const char* TimeIntegrator_TimingKindNames[] = { "setup", "finish", "integratee" };
+
+/* A row of the reduced table: the slowest rank's total is kept in timing.total */
+typedef struct {
+	TimeIntegrator_Timing  timing;
+	double                 totalMean;
+} TimeIntegrator_TimingRow;
+
+static int _TimeIntegrator_CompareTimingNames( const void* a, const void* b ) {
+	const TimeIntegrator_Timing* timingA = (const TimeIntegrator_Timing*)a;
+	const TimeIntegrator_Timing* timingB = (const TimeIntegrator_Timing*)b;
+
+	if ( timingA->kind != timingB->kind )
+		return timingA->kind < timingB->kind ? -1 : 1;
+	return strcmp( timingA->name, timingB->name );
+}
+
+static int _TimeIntegrator_CompareTimingRows( const void* a, const void* b ) {
+	const TimeIntegrator_TimingRow* rowA = (const TimeIntegrator_TimingRow*)a;
+	const TimeIntegrator_TimingRow* rowB = (const TimeIntegrator_TimingRow*)b;
+
+	if ( rowA->timing.total != rowB->timing.total )
+		return rowA->timing.total > rowB->timing.total ? -1 : 1;
+	return _TimeIntegrator_CompareTimingNames( &rowA->timing, &rowB->timing );
+}
+
+TimeIntegrator_Timing* TimeIntegrator_GetTiming( void* timeIntegrator, TimeIntegrator_TimingKind kind, Name name ) {
+	TimeIntegrator*        self            = (TimeIntegrator*)timeIntegrator;
+	Index                  timing_I;
+
+	for ( timing_I = 0 ; timing_I < self->timingCount ; timing_I++ ) {
+		if ( self->timings[timing_I].kind == kind && strcmp( self->timings[timing_I].name, name ) == 0 )
+			return &self->timings[timing_I];
+	}
+	return NULL;
+}
+
+void TimeIntegrator_AddTiming( void* timeIntegrator, TimeIntegrator_TimingKind kind, Name name, double time ) {
+	TimeIntegrator*        self            = (TimeIntegrator*)timeIntegrator;
+	TimeIntegrator_Timing* timing;
+
+	timing = TimeIntegrator_GetTiming( self, kind, name );
+	if ( !timing ) {
+		if ( self->timingCount == self->timingSize ) {
+			self->timingSize = self->timingSize ? 2 * self->timingSize : 8;
+			self->timings = Memory_Realloc_Array( self->timings, TimeIntegrator_Timing, self->timingSize );
+		}
+		timing = &self->timings[self->timingCount++];
+		timing->kind  = kind;
+		timing->name  = StG_Strdup( name );
+		timing->count = 0;
+		timing->total = 0.0;
+		timing->min   = HUGE_VAL;
+		timing->max   = 0.0;
+	}
+
+	timing->count++;
+	timing->total += time;
+	if ( time < timing->min ) timing->min = time;
+	if ( time > timing->max ) timing->max = time;
+}
+
+void TimeIntegrator_WriteTimings( void* timeIntegrator, const char* filename, MPI_Comm comm ) {
+	TimeIntegrator*           self            = (TimeIntegrator*)timeIntegrator;
+	Stream*                   errorStream     = Journal_Register( Error_Type, self->type );
+	unsigned int              count           = self->timingCount;
+	unsigned int              minCount;
+	unsigned int              maxCount;
+	unsigned int*             localCounts;
+	unsigned int*             counts;
+	double*                   localValues;
+	double*                   totals;
+	double*                   totalMaxs;
+	double*                   mins;
+	double*                   maxs;
+	TimeIntegrator_TimingRow* rows;
+	FILE*                     file;
+	int                       rank;
+	int                       nProc;
+	Index                     timing_I;
+
+	MPI_Comm_rank( comm, &rank );
+	MPI_Comm_size( comm, &nProc );
+
+	MPI_Allreduce( &count, &minCount, 1, MPI_UNSIGNED, MPI_MIN, comm );
+	MPI_Allreduce( &count, &maxCount, 1, MPI_UNSIGNED, MPI_MAX, comm );
+	if ( maxCount == 0 ) return;
+	if ( minCount != maxCount ) {
+		if ( rank == 0 )
+			Journal_Printf( errorStream, "Warning- in %s(), %s '%s' timed %u to %u hooks and integratees on "
+				"different ranks; not writing \"%s\".\n", __func__, self->type, self->name, minCount, maxCount, filename );
+		return;
+	}
+
+	/* Same order on every rank for the reduction */
+	qsort( self->timings, count, sizeof(TimeIntegrator_Timing), _TimeIntegrator_CompareTimingNames );
+
+	localCounts = Memory_Alloc_Array( unsigned int, 2 * count, "TimeIntegrator timing counts" );
+	counts      = localCounts + count;
+	localValues = Memory_Alloc_Array( double, 7 * count, "TimeIntegrator timing values" );
+	totals      = localValues + 3 * count;
+	totalMaxs   = localValues + 4 * count;
+	mins        = localValues + 5 * count;
+	maxs        = localValues + 6 * count;
+	for ( timing_I = 0 ; timing_I < count ; timing_I++ ) {
+		localCounts[timing_I]             = self->timings[timing_I].count;
+		localValues[timing_I]             = self->timings[timing_I].total;
+		localValues[count + timing_I]     = self->timings[timing_I].min;
+		localValues[2 * count + timing_I] = self->timings[timing_I].max;
+	}
+	MPI_Reduce( localCounts, counts, count, MPI_UNSIGNED, MPI_MAX, 0, comm );
+	MPI_Reduce( localValues, totals, count, MPI_DOUBLE, MPI_SUM, 0, comm );
+	MPI_Reduce( localValues, totalMaxs, count, MPI_DOUBLE, MPI_MAX, 0, comm );
+	MPI_Reduce( localValues + count, mins, count, MPI_DOUBLE, MPI_MIN, 0, comm );
+	MPI_Reduce( localValues + 2 * count, maxs, count, MPI_DOUBLE, MPI_MAX, 0, comm );
+
+	if ( rank == 0 ) {
+		rows = Memory_Alloc_Array( TimeIntegrator_TimingRow, count, "TimeIntegrator timing rows" );
+		for ( timing_I = 0 ; timing_I < count ; timing_I++ ) {
+			rows[timing_I].timing       = self->timings[timing_I];
+			rows[timing_I].timing.count = counts[timing_I];
+			rows[timing_I].timing.total = totalMaxs[timing_I];
+			rows[timing_I].timing.min   = mins[timing_I];
+			rows[timing_I].timing.max   = maxs[timing_I];
+			rows[timing_I].totalMean    = totals[timing_I] / nProc;
+		}
+		qsort( rows, count, sizeof(TimeIntegrator_TimingRow), _TimeIntegrator_CompareTimingRows );
+
+		file = fopen( filename, "w" );
+		if ( !file ) {
+			Journal_Printf( errorStream, "Warning- in %s(), couldn't open \"%s\" for writing.\n", __func__, filename );
+		}
+		else {
+			fprintf( file, "kind,name,calls,total_mean,total_max,min,max\n" );
+			for ( timing_I = 0 ; timing_I < count ; timing_I++ ) {
+				TimeIntegrator_Timing* timing = &rows[timing_I].timing;
+
+				fprintf( file, "%s,%s,%u,%.6e,%.6e,%.6e,%.6e\n", TimeIntegrator_TimingKindNames[timing->kind],
+					timing->name, timing->count, rows[timing_I].totalMean, timing->total, timing->min, timing->max );
+			}
+			fclose( file );
+		}
+		Memory_Free( rows );
+	}
+
+	Memory_Free( localValues );
+	Memory_Free( localCounts );
+}
+
+void _TimeIntegrator_WriteAllTimings( void* context ) {
+	AbstractContext*       self            = (AbstractContext*)context;
+	LiveComponentRegister* lcRegister;
+	Stg_Component*         component;
+	char*                  filename;
+	Index                  component_I;
+
+	if ( !self->CF ) return;
+
+	lcRegister = self->CF->LCRegister;
+	for ( component_I = 0 ; component_I < LiveComponentRegister_GetCount( lcRegister ) ; component_I++ ) {
+		component = LiveComponentRegister_At( lcRegister, component_I );
+		if ( !Stg_Class_IsInstance( component, TimeIntegrator_Type ) ) continue;
+
+		Stg_asprintf( &filename, "%s/%s-timing.csv", self->outputPath, component->name );
+		TimeIntegrator_WriteTimings( component, filename, self->communicator );
+		Memory_Free( filename );
+	}
+}
+
 Variable* Variable_NewFromOld( Variable* oldVariable, Name name, Bool copyValues ) {
 	Variable*         self;
 	Index             array_I;
@@ -43,6 +43,23 @@
 	/* typedefs for virtual functions: */
 	extern const Type TimeIntegrator_Type;
 	
+	/** The work timed by a TimeIntegrator: its setup and finish EP hooks, and the update of each integratee */
+	typedef enum {
+		TimeIntegrator_Timing_Setup,
+		TimeIntegrator_Timing_Finish,
+		TimeIntegrator_Timing_Integratee
+	} TimeIntegrator_TimingKind;
+	
+	/** Wall time accumulated over all calls of one hook or integratee */
+	struct TimeIntegrator_Timing {
+		TimeIntegrator_TimingKind              kind;
+		Name                                   name;
+		unsigned int                           count;
+		double                                 total;
+		double                                 min;
+		double                                 max;
+	};
+	
 	/* TimeIntegrator information */
 	#define __TimeIntegrator  \
 		/* General info */ \
@@ -59,7 +76,11 @@
 		Stg_ObjectList*                        setupData;               \
 		EntryPoint*                            finishEP;                \
 		Stg_ObjectList*                        finishData;              \
-		double                                 time;
+		double                                 time;                    \
+		/* Per hook and per integratee wall times */ \
+		TimeIntegrator_Timing*                 timings;                 \
+		Index                                  timingCount;             \
+		Index                                  timingSize;
 		  
 	struct TimeIntegrator { __TimeIntegrator };
 	
@@ -154,4 +175,18 @@
 
 	Variable* Variable_NewFromOld( Variable* oldVariable, Name name, Bool copyValues ) ;
 
+	/** Adds one call's wall time to the timing of the given hook or integratee */
+	void TimeIntegrator_AddTiming( void* timeIntegrator, TimeIntegrator_TimingKind kind, Name name, double time ) ;
+
+	/** Returns the accumulated timing of the given hook or integratee, or NULL if it has not been called */
+	TimeIntegrator_Timing* TimeIntegrator_GetTiming( void* timeIntegrator, TimeIntegrator_TimingKind kind, Name name ) ;
+
+	/** Reduces the timings to the root of the communicator and writes them there as a CSV table, slowest first.
+	Collective: every rank must have timed the same hooks and integratees. The columns are the kind and name,
+	the call count, the mean over ranks and the maximum of the total time, and the fastest and slowest single call. */
+	void TimeIntegrator_WriteTimings( void* timeIntegrator, const char* filename, MPI_Comm comm ) ;
+
+	/** Context destroy hook: writes the timings of every live TimeIntegrator to <outputPath>/<name>-timing.csv */
+	void _TimeIntegrator_WriteAllTimings( void* context ) ;
+
 #endif 
@@ -64,6 +64,7 @@
 	typedef struct SobolGenerator            SobolGenerator;
 	typedef struct TimeIntegratee            TimeIntegratee;
 	typedef struct TimeIntegrator            TimeIntegrator;
+	typedef struct TimeIntegrator_Timing     TimeIntegrator_Timing;
 	typedef struct ShapeAdvector             ShapeAdvector;
 	typedef struct Remesher			Remesher;
 	typedef struct StripRemesher		StripRemesher;
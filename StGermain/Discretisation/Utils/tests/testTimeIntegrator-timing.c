@@ -0,0 +1,223 @@
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+**
+** Copyright (C), 2003, Victorian Partnership for Advanced Computing (VPAC) Ltd, 110 Victoria Street, Melbourne, 3053, Australia.
+**
+** Authors:
+**	Stevan M. Quenette, Senior Software Engineer, VPAC. (steve@vpac.org)
+**	Patrick D. Sunter, Software Engineer, VPAC. (pds@vpac.org)
+**	Luke J. Hodkinson, Computational Engineer, VPAC. (lhodkins@vpac.org)
+**	Siew-Ching Tan, Software Engineer, VPAC. (siew@vpac.org)
+**	Alan H. Lo, Computational Engineer, VPAC. (alan@vpac.org)
+**	Raquibul Hassan, Computational Engineer, VPAC. (raq@vpac.org)
+**
+**  This library is free software; you can redistribute it and/or
+**  modify it under the terms of the GNU Lesser General Public
+**  License as published by the Free Software Foundation; either
+**  version 2.1 of the License, or (at your option) any later version.
+**
+**  This library is distributed in the hope that it will be useful,
+**  but WITHOUT ANY WARRANTY; without even the implied warranty of
+**  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+**  Lesser General Public License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License along with this library; if not, write to the Free Software
+**  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+**
+** $Id: testTimeIntegrator-timing.c 3665 2006-07-04 04:56:29Z PatrickSunter $
+**
+**~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#include <mpi.h>
+#include "Base/Base.h"
+
+#include "Discretisation/Geometry/Geometry.h"
+#include "Discretisation/Shape/Shape.h"
+#include "Discretisation/Mesh/Mesh.h"
+#include "Discretisation/Utils/Utils.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+/* Runs a 2nd order TimeIntegrator with two dummy integratees, one setup and one finish hook, then checks the call
+   counts in the timing table written by TimeIntegrator_WriteTimings(). The times themselves vary from run to run, so
+   only their ordering is checked. */
+
+double GetDt( void* context ) {
+	return 0.1;
+}
+
+Bool DummyTimeDeriv( void* timeIntegratee, Index array_I, double* timeDeriv ) {
+	timeDeriv[0] = 1.0;
+	return True;
+}
+
+void DummySetup( void* timeIntegrator, void* data ) {
+}
+
+void DummyFinish( void* timeIntegrator, void* data ) {
+}
+
+int CompareRows( const void* a, const void* b ) {
+	return strcmp( (const char*)a, (const char*)b );
+}
+
+int main( int argc, char* argv[] ) {
+	MPI_Comm                   CommWorld;
+	int                        rank;
+	int                        numProcessors;
+	int                        procToWatch;
+	Dictionary*                dictionary;
+	DiscretisationContext*     context;
+	TimeIntegrator*            timeIntegrator;
+	TimeIntegratee*            timeIntegrateeList[2];
+	Variable*                  variableList[2];
+	double*                    array;
+	double*                    array2;
+	Index                      size0              = 11;
+	Index                      size1              = 7;
+	Index                      timestep;
+	Index                      maxTimesteps       = 5;
+	char*                      filename           = "./testTimeIntegrator-timing.csv";
+	char                       rows[16][320];
+	Index                      rowCount           = 0;
+	Index                      row_I;
+	
+	/* Initialise MPI, get world info */
+	MPI_Init( &argc, &argv );
+	MPI_Comm_dup( MPI_COMM_WORLD, &CommWorld );
+	MPI_Comm_size( CommWorld, &numProcessors );
+	MPI_Comm_rank( CommWorld, &rank );
+	
+	Base_Init( &argc, &argv );
+	
+	DiscretisationGeometry_Init( &argc, &argv );
+	DiscretisationShape_Init( &argc, &argv );
+	DiscretisationMesh_Init( &argc, &argv );
+	DiscretisationUtils_Init( &argc, &argv );
+	MPI_Barrier( CommWorld ); /* Ensures copyright info always come first in output */
+	
+	if( argc >= 2 ) {
+		procToWatch = atoi( argv[1] );
+	}
+	else {
+		procToWatch = 0;
+	}
+	if( rank == procToWatch ) printf( "Watching rank: %i\n", rank );
+	/* The per call times printed by the integrator are not reproducible */
+	Stream_Enable( Journal_Register( Info_Type, TimeIntegrator_Type ), False );
+
+	/* Create Context */
+	dictionary = Dictionary_New();
+	context = _DiscretisationContext_New( 
+			sizeof(DiscretisationContext), 
+			DiscretisationContext_Type, 
+			_DiscretisationContext_Delete, 
+			_DiscretisationContext_Print,
+			NULL,
+			NULL,
+			NULL,
+			NULL,
+			NULL,
+			NULL,
+			NULL,
+			"discretisationContext",
+			True,
+			NULL,
+			0,0,
+			CommWorld, dictionary );
+	ContextEP_Append( context, AbstractContext_EP_Dt, GetDt );
+
+	/* Create Stuff */
+	variableList[0] = Variable_NewScalar( "testVariable",  Variable_DataType_Double, &size0, (void**)&array, NULL );
+	variableList[1] = Variable_NewScalar( "testVariable2", Variable_DataType_Double, &size1, (void**)&array2, NULL );
+	timeIntegrator  = TimeIntegrator_New( "testTimeIntegrator", 2, False, NULL, NULL );
+	timeIntegrateeList[0] = TimeIntegratee_New( "testTimeIntegratee0", timeIntegrator, variableList[0],
+		0, NULL, True );
+	timeIntegrateeList[1] = TimeIntegratee_New( "testTimeIntegratee1", timeIntegrator, variableList[1],
+		0, NULL, True );
+	timeIntegrateeList[0]->_calculateTimeDeriv = DummyTimeDeriv;
+	timeIntegrateeList[1]->_calculateTimeDeriv = DummyTimeDeriv;
+
+	TimeIntegrator_AppendSetupEP( timeIntegrator, "dummySetup", DummySetup, CURR_MODULE_NAME, context );
+	TimeIntegrator_AppendFinishEP( timeIntegrator, "dummyFinish", DummyFinish, CURR_MODULE_NAME, context );
+
+	/* Build and initialise */
+	Stg_Component_Build( variableList[0], context, False );
+	Stg_Component_Build( variableList[1], context, False );
+	Stg_Component_Build( timeIntegrator, context, False );
+	Stg_Component_Build( timeIntegrateeList[0], context, False );
+	Stg_Component_Build( timeIntegrateeList[1], context, False );
+	array = Memory_Alloc_Array( double, size0, "array" );
+	array2 = Memory_Alloc_Array( double, size1, "array2" );
+	memset( array, 0, sizeof(double) * size0 );
+	memset( array2, 0, sizeof(double) * size1 );
+	Stg_Component_Initialise( timeIntegrator, context, False );
+	Stg_Component_Initialise( variableList[0], context, False );
+	Stg_Component_Initialise( variableList[1], context, False );
+	Stg_Component_Initialise( timeIntegrateeList[0], context, False );
+	Stg_Component_Initialise( timeIntegrateeList[1], context, False );
+
+	for ( timestep = 0 ; timestep < maxTimesteps ; timestep++ ) {
+		Stg_Component_Execute( timeIntegrator, context, True );
+		context->currentTime += AbstractContext_Dt( context );
+	}
+
+	TimeIntegrator_WriteTimings( timeIntegrator, filename, CommWorld );
+	MPI_Barrier( CommWorld );
+
+	if( rank == procToWatch ) {
+		FILE*          file = fopen( filename, "r" );
+		char           line[1024];
+		char           kind[64];
+		char           name[256];
+		unsigned int   calls;
+		double         totalMean, totalMax, min, max;
+		Bool           ordered = True;
+
+		assert( file );
+		fgets( line, sizeof(line), file );
+		printf( "Header: %s", line );
+		while ( fgets( line, sizeof(line), file ) ) {
+			/* Names have no commas, so split by hand rather than trusting %s */
+			char* field = strtok( line, "," );
+			strcpy( kind, field );
+			strcpy( name, strtok( NULL, "," ) );
+			sscanf( strtok( NULL, "\n" ), "%u,%lf,%lf,%lf,%lf", &calls, &totalMean, &totalMax, &min, &max );
+			if ( !( 0.0 <= min && min <= max && totalMean <= totalMax && max <= totalMax ) )
+				ordered = False;
+			/* The table is ordered by time, which varies, so sort by name before printing */
+			sprintf( rows[rowCount++], "%s %s: calls %u", kind, name, calls );
+		}
+		qsort( rows, rowCount, sizeof(rows[0]), CompareRows );
+		for ( row_I = 0 ; row_I < rowCount ; row_I++ )
+			printf( "%s\n", rows[row_I] );
+		printf( "Times ordered: %s\n", ordered ? "True" : "False" );
+		fclose( file );
+	}
+	MPI_Barrier( CommWorld );
+	if ( rank == 0 ) remove( filename );
+
+	/* Destroy stuff */
+	Memory_Free( array );
+	Memory_Free( array2 );
+	Stg_Class_Delete( variableList[0] );
+	Stg_Class_Delete( variableList[1] );
+	Stg_Class_Delete( timeIntegrator );
+	Stg_Class_Delete( timeIntegrateeList[0] );
+	Stg_Class_Delete( timeIntegrateeList[1] );
+	
+	DiscretisationUtils_Finalise();
+	DiscretisationMesh_Finalise();
+	DiscretisationShape_Finalise();
+	DiscretisationGeometry_Finalise();
+	
+	Base_Finalise();
+	
+	/* Close off MPI */
+	MPI_Finalize();
+	
+	return 0; /* success */
+}
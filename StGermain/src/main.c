@@ -85,9 +85,9 @@ int main( int argc, char* argv[] )
 	/* Create the application's dictionary */
 	dictionary = Dictionary_New();
 
-	/* Read input */
+	/* Read input: rank 0 parses the XML and broadcasts the resulting dictionary */
 	ioHandler = XML_IO_Handler_New();
-	IO_Handler_ReadAllFromCommandLine( ioHandler, argc, argv, dictionary );
+	IO_Handler_ReadAllFromCommandLineBroadcast( ioHandler, argc, argv, dictionary, CommWorld );
 
 	Journal_ReadFromDictionary( dictionary );
 	